@@ -182,6 +182,57 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
         dnnl_primitive_t *primitive, const_dnnl_primitive_desc_t primitive_desc,
         size_t size, const uint8_t *cache_blob);
 
+/// Starts creating a primitive on a library-owned background thread.
+///
+/// The creation goes through the primitive cache, so concurrent requests for
+/// an identical primitive share a single in-flight creation. The number of
+/// background threads can be controlled with the
+/// `ONEDNN_PRIMITIVE_CREATION_THREADS` environment variable.
+///
+/// @note
+///     The primitive descriptor must remain valid until the creation
+///     completes, i.e. until dnnl_primitive_future_get() returns or the
+///     future is destroyed.
+///
+/// @param future Output primitive future.
+/// @param primitive_desc Primitive descriptor used to create the primitive.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_async(
+        dnnl_primitive_future_t *future,
+        const_dnnl_primitive_desc_t primitive_desc);
+
+/// Checks whether the asynchronous creation of a primitive has completed.
+///
+/// @param future Primitive future.
+/// @param is_ready Output value: 1 if the creation has completed and
+///     dnnl_primitive_future_get() will not block, and 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_is_ready(
+        const_dnnl_primitive_future_t future, int *is_ready);
+
+/// Waits for the asynchronous creation of a primitive to complete and returns
+/// the primitive. The function can be called only once for a future.
+///
+/// @param primitive Output primitive. The caller owns the primitive and is
+///     responsible for destroying it.
+/// @param future Primitive future.
+/// @returns The status of the primitive creation: #dnnl_success on success
+///     and a status describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_get(
+        dnnl_primitive_t *primitive, dnnl_primitive_future_t future);
+
+/// Destroys a primitive future. Blocks until the creation completes if it is
+/// still in progress. A primitive that has not been obtained via
+/// dnnl_primitive_future_get() is destroyed as well.
+///
+/// @param future Primitive future to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_destroy(
+        dnnl_primitive_future_t future);
+
 /// Executes a primitive.
 ///
 /// @param primitive Primitive to execute.
@@ -314,6 +365,58 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the primitive attributes shared weights mode.
+///
+/// @param attr Primitive attributes.
+/// @param value Output shared weights mode: 1 if the mode is enabled and 0
+///     otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_shared_weights(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets primitive attributes shared weights mode.
+///
+/// When the mode is enabled, the user guarantees that the contents of a
+/// weights memory object do not change once it has been passed to a
+/// primitive created with the attribute. Implementations may then reorder
+/// the weights into an internal layout once per memory object and data
+/// handle and share the result between all the primitives that apply the
+/// same transformation to the same weights. The mode is a hint:
+/// implementations that do not support it ignore it.
+///
+/// @param attr Primitive attributes.
+/// @param value Shared weights mode: 0 (default) to disable the mode and 1
+///     to enable it.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_shared_weights(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the primitive attributes scheduling mode.
+///
+/// @param attr Primitive attributes.
+/// @param mode Output scheduling mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_scheduling(
+        const_dnnl_primitive_attr_t attr, dnnl_scheduling_t *mode);
+
+/// Sets primitive attributes scheduling mode.
+///
+/// The mode controls how CPU implementations distribute the iterations of
+/// their parallel loops between threads. It is a hint: implementations
+/// that do not support a mode use the default one.
+///
+/// @param attr Primitive attributes.
+/// @param mode Scheduling mode. The possible values are:
+///     #dnnl_scheduling_balanced (default) and
+///     #dnnl_scheduling_work_stealing.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_scheduling(
+        dnnl_primitive_attr_t attr, dnnl_scheduling_t mode);
+
 /// Sets primitive attributes scaling factors for primitive operations for a
 /// given memory argument. The scaling factors must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -354,6 +457,85 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales_mask(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_zero_points_mask(
         dnnl_primitive_attr_t attr, int arg, int mask);
 
+/// Sets primitive attributes scaling factors for primitive operations for a
+/// given memory argument with groups and a data type. The scaling factors
+/// must be passed at execution time as an argument with index
+/// #DNNL_ARG_ATTR_SCALES | arg.
+///
+/// @sa dnnl_primitive_attr_set_scales_mask
+///
+/// @param attr Primitive attributes.
+/// @param arg Parameter argument index as passed to the
+///     dnnl_primitive_execute() call.
+/// @param mask Scaling factors correspondence mask that defines the
+///     correspondence between the tensor dimensions and the scales array.
+/// @param ndims Number of group dimensions. Set to 0 to use a dedicated
+///     scaling factor for each index along the dimensions selected by
+///     @p mask.
+/// @param group_dims Scaling factors group dimensions. A single scaling
+///     factor is used for each group of @p group_dims elements of the last
+///     @p ndims dimensions of the tensor.
+/// @param data_type Scaling factors data type. Can be #dnnl_f32, #dnnl_bf16
+///     or #dnnl_f16.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales(
+        dnnl_primitive_attr_t attr, int arg, int mask, int ndims,
+        const dnnl_dims_t group_dims, dnnl_data_type_t data_type);
+
+/// Sets primitive attributes zero points for primitive operations for a given
+/// memory argument with groups and a data type. The zero points must be
+/// passed at execution time as an argument with index
+/// #DNNL_ARG_ATTR_ZERO_POINTS | arg.
+///
+/// @sa dnnl_primitive_attr_set_zero_points_mask
+///
+/// @param attr Primitive attributes.
+/// @param arg Parameter argument index as passed to the
+///     dnnl_primitive_execute() call.
+/// @param mask Zero point correspondence mask that defines the
+///     correspondence between the tensor dimensions and the zero points
+///     array.
+/// @param ndims Number of group dimensions. Set to 0 to use a dedicated zero
+///     point for each index along the dimensions selected by @p mask.
+/// @param group_dims Zero points group dimensions. Groups are supported for
+///     #DNNL_ARG_WEIGHTS only.
+/// @param data_type Zero points data type. Can be #dnnl_s32 for any argument
+///     and #dnnl_s8, #dnnl_u8, #dnnl_s4 or #dnnl_u4 for #DNNL_ARG_WEIGHTS.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_zero_points(
+        dnnl_primitive_attr_t attr, int arg, int mask, int ndims,
+        const dnnl_dims_t group_dims, dnnl_data_type_t data_type);
+
+/// Returns the primitive attributes source dynamic quantization data type.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type the source is quantized to, or
+///     #dnnl_data_type_undef if dynamic quantization is disabled.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets primitive attributes source dynamic quantization data type.
+///
+/// With dynamic quantization enabled, a primitive with floating-point source
+/// and integer weights quantizes each row of the source to @p data_type at
+/// execution time. A row scale is computed as the maximum absolute value of
+/// the row divided by the largest value of @p data_type. The primitive
+/// computes the product in integer arithmetic and multiplies the result by
+/// the row scale before it applies weights scales, bias and post-ops.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Data type to quantize the source to. Possible values are
+///     #dnnl_data_type_undef (default) to disable dynamic quantization and
+///     #dnnl_s8.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_dynamic_quantization(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
 /// Returns primitive attributes post-ops.
 ///
 /// @warning
@@ -715,6 +897,53 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_csr_encoding(
         dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
         dnnl_data_type_t data_type, dnnl_dim_t nnz, dnnl_data_type_t indices_dt,
         dnnl_data_type_t pointers_dt);
+
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The tensor is split into blocks of @p block_dims elements, and only the
+/// blocks that contain non-zero elements are stored. The values of a block
+/// are stored densely in the row-major order, the indices contain the column
+/// index of each stored block, and the pointers contain the position of the
+/// first stored block of each row of blocks.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Must be 2.
+/// @param dims Array of dimensions. Each dimension must be a multiple of the
+///     corresponding block dimension.
+/// @param data_type Elements data type.
+/// @param block_dims Array of @p ndims block dimensions.
+/// @param nnz Number of non-zero blocks.
+/// @param indices_dt Data type of indices.
+/// @param pointers_dt Data type of pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, const dnnl_dims_t block_dims,
+        dnnl_dim_t nnz, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
+/// Creates a memory descriptor for grouped encoding.
+///
+/// The values are stored as a dense row-major matrix whose rows are split
+/// into @p ngroups groups of consecutive rows. The offsets contain
+/// @p ngroups + 1 non-decreasing entries: the rows of group `g` are
+/// [offsets[g], offsets[g + 1]). The sizes of the groups are known at
+/// execution time only.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Must be 2.
+/// @param dims Array of dimensions. The first dimension is the total number
+///     of rows available for all groups.
+/// @param data_type Elements data type.
+/// @param ngroups Number of groups.
+/// @param offsets_dt Data type of offsets.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_grouped_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t ngroups,
+        dnnl_data_type_t offsets_dt);
 #endif
 
 /// Creates a memory descriptor for a region inside an area
@@ -2048,6 +2277,39 @@ dnnl_status_t DNNL_API dnnl_layer_normalization_backward_primitive_desc_create(
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// Creates a primitive descriptor for a group normalization forward
+///     propagation primitive.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src.
+///
+/// @param primitive_desc Output primitive_descriptor.
+/// @param engine Engine to use.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param groups Number of groups the channels are split into. Must divide
+///     the number of channels.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+///     Only #dnnl_use_global_stats, #dnnl_use_scale, and #dnnl_use_shift are
+///     supported.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_forward_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_prop_kind_t prop_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc, dnnl_dim_t groups, float epsilon,
+        unsigned flags, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product
 /// @{
 
@@ -3182,6 +3444,80 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+/// @{
+
+/// Creates a primitive descriptor for a scaled dot-product attention
+///     primitive.
+///
+/// The primitive computes `dst = softmax(scale * Q * K^T + mask) * V`
+/// without storing the intermediate scores in memory.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param query_desc Queries memory descriptor with dimensions
+///     `[batch..., S_q, D]`.
+/// @param key_desc Keys memory descriptor with dimensions
+///     `[batch..., S_kv, D]`.
+/// @param value_desc Values memory descriptor with dimensions
+///     `[batch..., S_kv, D_v]`.
+/// @param mask_desc Additive attention mask memory descriptor with dimensions
+///     broadcastable to `[batch..., S_q, S_kv]`. Passing NULL, a zero memory
+///     descriptor, or a memory descriptor with format_kind set to
+///     #dnnl_format_kind_undef disables the mask.
+/// @param dst_desc Destination memory descriptor with dimensions
+///     `[batch..., S_q, D_v]`.
+/// @param scale Scaling factor applied to the scores before the mask.
+/// @param flags Scaled dot-product attention flags
+///     (@ref dnnl_sdpa_flags_t).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_sdpa_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc, const_dnnl_memory_desc_t mask_desc,
+        const_dnnl_memory_desc_t dst_desc, float scale, unsigned flags,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_sdpa
+
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+/// @{
+
+/// Creates a primitive descriptor for an embedding bag primitive.
+///
+/// The primitive looks up the rows of an embedding table by indices and
+/// either copies them to the destination (#dnnl_embedding_bag_gather) or
+/// pools the rows of every bag of indices (#dnnl_embedding_bag_sum and
+/// #dnnl_embedding_bag_mean).
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Embedding bag algorithm kind: #dnnl_embedding_bag_gather,
+///     #dnnl_embedding_bag_sum, or #dnnl_embedding_bag_mean.
+/// @param src_desc Embedding table memory descriptor with dimensions
+///     `[rows, D]`.
+/// @param indices_desc Indices memory descriptor with dimensions
+///     `[n_indices]`.
+/// @param offsets_desc Bag offsets memory descriptor with dimensions
+///     `[n_bags]`. Must be NULL, a zero memory descriptor, or a memory
+///     descriptor with format_kind set to #dnnl_format_kind_undef for
+///     #dnnl_embedding_bag_gather and a valid memory descriptor otherwise.
+/// @param dst_desc Destination memory descriptor with dimensions
+///     `[n_bags, D]`, or `[n_indices, D]` for #dnnl_embedding_bag_gather.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
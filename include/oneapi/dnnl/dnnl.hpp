@@ -146,6 +146,12 @@ struct primitive : public handle<dnnl_primitive_t> {
         softmax = dnnl_softmax,
         /// A layer normalization primitive.
         layer_normalization = dnnl_layer_normalization,
+        /// A scaled dot-product attention primitive.
+        sdpa = dnnl_sdpa,
+        /// A group normalization primitive.
+        group_normalization = dnnl_group_normalization,
+        /// An embedding bag primitive.
+        embedding_bag = dnnl_embedding_bag,
     };
 
     using handle::handle;
@@ -298,6 +304,26 @@ inline dnnl_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
     return static_cast<dnnl_scratchpad_mode_t>(mode);
 }
 
+/// Scheduling mode for the parallel loops of a primitive
+enum class scheduling {
+    /// The iteration space is split into equal contiguous ranges, one per
+    /// thread, before the loop starts (default).
+    balanced = dnnl_scheduling_balanced,
+    /// The iteration space is split into several chunks per thread. Each
+    /// thread processes its own chunks first and then takes the remaining
+    /// chunks of other threads. This mode helps when the cost of iterations
+    /// is uneven or when threads are delayed by other work.
+    work_stealing = dnnl_scheduling_work_stealing,
+};
+
+/// Converts a scheduling mode enum value from C++ API to C API type.
+///
+/// @param mode C++ API scheduling mode enum value.
+/// @returns Corresponding C API scheduling mode enum value.
+inline dnnl_scheduling_t convert_to_c(scheduling mode) {
+    return static_cast<dnnl_scheduling_t>(mode);
+}
+
 /// Propagation kind.
 enum class prop_kind {
     /// Undefined propagation kind.
@@ -477,6 +503,12 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// Embedding lookup without pooling
+    embedding_bag_gather = dnnl_embedding_bag_gather,
+    /// Embedding bag with sum pooling
+    embedding_bag_sum = dnnl_embedding_bag_sum,
+    /// Embedding bag with mean pooling
+    embedding_bag_mean = dnnl_embedding_bag_mean,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -528,6 +560,12 @@ enum class normalization_flags : unsigned {
     /// On training, normalization will require the workspace to implement
     /// backward propagation. On inference, the workspace is not required.
     fuse_norm_add_relu = dnnl_fuse_norm_add_relu,
+
+    /// Use Root Mean Square (RMS) normalization. If specified, the mean is
+    /// assumed to be zero and is neither computed nor used, and the variance
+    /// is computed as the mean of squared source values. Supported by layer
+    /// normalization only.
+    rms_norm = dnnl_rms_norm,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -537,6 +575,24 @@ inline dnnl_normalization_flags_t convert_to_c(normalization_flags flags) {
     return static_cast<dnnl_normalization_flags_t>(flags);
 }
 
+/// Flags for scaled dot-product attention primitive.
+enum class sdpa_flags : unsigned {
+    /// Use no flags.
+    none = dnnl_sdpa_flags_none,
+
+    /// Apply causal masking. If specified, a query with index `i` does not
+    /// attend to the keys with indices greater than `i + (S_kv - S_q)`.
+    causal_mask = dnnl_sdpa_causal_mask,
+};
+
+/// Converts scaled dot-product attention flags enum value from C++ API to C
+/// API type.
+/// @param flags C++ API scaled dot-product attention flags enum value.
+/// @returns Corresponding C API scaled dot-product attention flags enum value.
+inline dnnl_sdpa_flags_t convert_to_c(sdpa_flags flags) {
+    return static_cast<dnnl_sdpa_flags_t>(flags);
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_rnn
@@ -548,6 +604,8 @@ enum class rnn_flags : unsigned {
     undef = dnnl_rnn_flags_undef,
     /// Do not add weights gradient to existing diff_weights memory
     diff_weights_overwrite = dnnl_rnn_flags_diff_weights_overwrite,
+    /// Use per-minibatch sequence lengths passed at execution time
+    variable_sequence_length = dnnl_rnn_flags_variable_sequence_length,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -559,6 +617,7 @@ inline dnnl_rnn_flags_t convert_to_c(rnn_flags flags) {
 
 DNNL_DEFINE_BITMASK_OPS(normalization_flags)
 DNNL_DEFINE_BITMASK_OPS(rnn_flags)
+DNNL_DEFINE_BITMASK_OPS(sdpa_flags)
 
 /// A direction of RNN primitive execution
 enum class rnn_direction {
@@ -675,6 +734,8 @@ enum class query {
     kernel = dnnl_query_kernel,
     /// Shuffle parameter group size
     group_size_s64 = dnnl_query_group_size_s64,
+    /// Concat parameter in-place offset of a source
+    inplace_offset_s64 = dnnl_query_inplace_offset_s64,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -848,6 +909,19 @@ struct memory : public handle<dnnl_memory_t> {
         s8 = dnnl_s8,
         /// 8-bit unsigned integer.
         u8 = dnnl_u8,
+        /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+        /// with a 5-bit exponent and a 2-bit mantissa.
+        f8_e5m2 = dnnl_f8_e5m2,
+        /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+        /// with a 4-bit exponent and a 3-bit mantissa.
+        f8_e4m3 = dnnl_f8_e4m3,
+        /// 4-bit signed integer. Two values are packed into a byte.
+        s4 = dnnl_s4,
+        /// 4-bit unsigned integer. Two values are packed into a byte.
+        u4 = dnnl_u4,
+        /// [4-bit NormalFloat](https://arxiv.org/abs/2305.14314). Two values
+        /// are packed into a byte.
+        nf4 = dnnl_nf4,
     };
 
     /// Returns size of data type in bytes.
@@ -881,6 +955,10 @@ struct memory : public handle<dnnl_memory_t> {
             undef = dnnl_sparse_encoding_undef,
             /// Compressed Sparse Row (CSR) encoding.
             csr = dnnl_csr,
+            /// Block Compressed Sparse Row (BSR) encoding.
+            bsr = dnnl_bsr,
+            /// Grouped encoding.
+            grouped = dnnl_grouped,
     };
 #endif
 
@@ -2638,6 +2716,76 @@ struct memory : public handle<dnnl_memory_t> {
                         "encoding");
             return desc {md};
         }
+
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 3 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values, stored as dense row-major blocks
+        ///  - 1: column indices of the blocks
+        ///  - 2: pointers to the first block of each row of blocks
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param block_dims Block dimensions.
+        /// @param nnz Number of non-zero blocks.
+        /// @param index_dt Data type of indices.
+        /// @param pointer_dt Data type of pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        static desc bsr(const dims &adims, data_type adata_type,
+                const dims &block_dims, dim nnz, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_dims(block_dims, (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), block_dims.data(), nnz,
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
+        /// Function for creating a memory descriptor for grouped sparse
+        /// encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 2 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values, stored as a dense row-major matrix
+        ///  - 1: offsets of the first row of each group, `ngroups + 1`
+        ///       entries
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param ngroups Number of groups.
+        /// @param offsets_dt Data type of offsets.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        static desc grouped(const dims &adims, data_type adata_type,
+                dim ngroups, data_type offsets_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_grouped_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type), ngroups,
+                            convert_to_c(offsets_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for grouped "
+                        "sparse encoding");
+            return desc {md};
+        }
 #endif
         /// Construct a memory descriptor from a C API ::dnnl_memory_desc_t
         /// handle. The resulting handle is not weak and the C handle will be
@@ -3707,6 +3855,45 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the shared weights mode.
+    bool get_shared_weights() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_shared_weights(get(), &result),
+                "could not get shared weights primitive attribute");
+        return result != 0;
+    }
+
+    /// Sets the shared weights mode.
+    ///
+    /// @sa dnnl_primitive_attr_set_shared_weights
+    ///
+    /// @param value Specified shared weights mode.
+    void set_shared_weights(bool value) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_shared_weights(get(), value ? 1 : 0),
+                "could not set shared weights primitive attribute");
+    }
+
+    /// Returns the scheduling mode.
+    scheduling get_scheduling() const {
+        dnnl_scheduling_t result;
+        error::wrap_c_api(dnnl_primitive_attr_get_scheduling(get(), &result),
+                "could not get scheduling primitive attribute");
+        return scheduling(result);
+    }
+
+    /// Sets the scheduling mode.
+    ///
+    /// @sa dnnl_primitive_attr_set_scheduling
+    ///
+    /// @param mode Specified scheduling mode.
+    void set_scheduling(scheduling mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_scheduling(
+                                  get(), dnnl::convert_to_c(mode)),
+                "could not set scheduling primitive attribute");
+    }
+
     /// Sets scaling factors for primitive operations for a given memory
     /// argument. The scaling factors must be passed at execution time
     /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -3744,6 +3931,84 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set zero points primitive attribute");
     }
 
+    /// Sets scaling factors for primitive operations for a given memory
+    /// argument with groups and a data type. The scaling factors must be
+    /// passed at execution time as an argument with index
+    /// #DNNL_ARG_ATTR_SCALES | arg.
+    ///
+    /// @sa dnnl_primitive_attr_set_scales
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Scaling factors correspondence mask that defines the
+    ///     correspondence between the tensor dimensions and the scales
+    ///     vector.
+    /// @param groups Scaling factors group dimensions. A single scaling
+    ///     factor is used for each group of elements of the last
+    ///     `groups.size()` dimensions of the tensor. Leave empty to use a
+    ///     dedicated scaling factor for each index.
+    /// @param data_type Scaling factors data type.
+    void set_scales(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::f32) {
+        error::wrap_c_api(dnnl_primitive_attr_set_scales(get(), arg, mask,
+                                  (int)groups.size(), groups.data(),
+                                  memory::convert_to_c(data_type)),
+                "could not set scales primitive attribute");
+    }
+
+    /// Sets zero points for primitive operations for a given memory argument
+    /// with groups and a data type. The zero points must be passed at
+    /// execution time as an argument with index
+    /// #DNNL_ARG_ATTR_ZERO_POINTS | arg.
+    ///
+    /// @sa dnnl_primitive_attr_set_zero_points
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Zero point correspondence mask that defines the
+    ///     correspondence between the tensor dimensions and the zero points
+    ///     vector.
+    /// @param groups Zero points group dimensions. Groups are supported for
+    ///     #DNNL_ARG_WEIGHTS only.
+    /// @param data_type Zero points data type.
+    void set_zero_points(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::s32) {
+        error::wrap_c_api(dnnl_primitive_attr_set_zero_points(get(), arg, mask,
+                                  (int)groups.size(), groups.data(),
+                                  memory::convert_to_c(data_type)),
+                "could not set zero points primitive attribute");
+    }
+
+    /// Returns the source dynamic quantization data type.
+    ///
+    /// @returns Data type the source is quantized to, or
+    ///     #dnnl::memory::data_type::undef if dynamic quantization is
+    ///     disabled.
+    memory::data_type get_src_dynamic_quantization() const {
+        dnnl_data_type_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_src_dynamic_quantization(
+                        get(), &result),
+                "could not get source dynamic quantization primitive "
+                "attribute");
+        return static_cast<memory::data_type>(result);
+    }
+
+    /// Sets the source dynamic quantization data type.
+    ///
+    /// @sa dnnl_primitive_attr_set_src_dynamic_quantization
+    ///
+    /// @param data_type Data type to quantize the source to. Possible values
+    ///     are #dnnl::memory::data_type::undef (default) to disable dynamic
+    ///     quantization and #dnnl::memory::data_type::s8.
+    void set_src_dynamic_quantization(memory::data_type data_type) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_src_dynamic_quantization(
+                        get(), memory::convert_to_c(data_type)),
+                "could not set source dynamic quantization primitive "
+                "attribute");
+    }
+
     /// Returns post-ops previously set via set_post_ops().
     ///
     /// @returns Post-ops.
@@ -4799,6 +5064,26 @@ struct concat : public primitive {
 
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns the offset in bytes of a source in the destination if the
+        /// source may be written there in place.
+        ///
+        /// The source may be placed in the destination when its image in the
+        /// destination is a dense chunk of memory with exactly the source
+        /// layout. A producer of the source can then write its result
+        /// directly into the destination at the returned offset. If every
+        /// source passed at execution resides at its offset, the CPU
+        /// implementations do not copy anything.
+        ///
+        /// @param idx Source index.
+        /// @returns The offset in bytes of the source in the destination.
+        /// @returns -1 if the source can't be placed in the destination.
+        memory::dim get_src_inplace_offset(int idx) const {
+            memory::dim res;
+            dnnl_status_t status = dnnl_primitive_desc_query(get(),
+                    dnnl::convert_to_c(query::inplace_offset_s64), idx, &res);
+            return status == dnnl_success ? res : -1;
+        }
     };
 
     /// Default constructor. Produces an empty object.
@@ -4946,6 +5231,71 @@ struct primitive_desc : public primitive_desc_base {
     }
 };
 
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_primitive_future_t> {
+    static dnnl_status_t destructor(dnnl_primitive_future_t p) {
+        return dnnl_primitive_future_destroy(p);
+    }
+};
+/// @endcond
+
+/// A primitive being created on a library-owned background thread.
+///
+/// The future keeps a reference to the primitive descriptor, so the
+/// descriptor passed to the constructor does not need to outlive it.
+/// Destroying a future blocks until the creation completes.
+struct primitive_future : public handle<dnnl_primitive_future_t> {
+    /// Default constructor. Constructs an empty object.
+    primitive_future() = default;
+
+    /// Starts creating a primitive asynchronously.
+    ///
+    /// @param pd Primitive descriptor.
+    primitive_future(const primitive_desc_base &pd) : pd_(pd) {
+        dnnl_primitive_future_t result;
+        error::wrap_c_api(dnnl_primitive_create_async(&result, pd_.get()),
+                "could not start an asynchronous primitive creation");
+        reset(result);
+    }
+
+    /// Copy constructor.
+    primitive_future(const primitive_future &) = default;
+    /// Assignment operator.
+    primitive_future &operator=(const primitive_future &) = default;
+
+    /// Destructor. Releases the future before the primitive descriptor
+    /// because the destruction of the last reference to the future waits for
+    /// the creation that uses the descriptor.
+    ~primitive_future() { reset(nullptr); }
+
+    /// Returns whether the creation has completed and get_primitive() will
+    /// not block.
+    ///
+    /// @returns @c true if the creation has completed and @c false
+    ///     otherwise.
+    bool is_ready() const {
+        int ready = 0;
+        error::wrap_c_api(dnnl_primitive_future_is_ready(get(), &ready),
+                "could not query a primitive future");
+        return ready != 0;
+    }
+
+    /// Waits for the creation to complete and returns the primitive. Can be
+    /// called only once.
+    ///
+    /// @returns The created primitive.
+    primitive get_primitive() {
+        dnnl_primitive_t result;
+        error::wrap_c_api(dnnl_primitive_future_get(&result, get()),
+                "could not create a primitive");
+        return primitive(result);
+    }
+
+private:
+    primitive_desc_base pd_;
+};
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_convolution Convolution
@@ -7931,6 +8281,145 @@ struct layer_normalization_backward : public primitive {
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_group_normalization Group Normalization
+///
+/// A primitive to perform group normalization. Channels are split into
+/// groups and normalization is performed within each group across the
+/// channels of the group and the spatial dimensions.
+///
+/// The forward propagation primitive supports in-place operation; that is,
+/// src and dst can refer to the same memory.
+///
+/// @sa @ref dev_guide_group_normalization in developer guide
+///
+/// @{
+
+/// Group normalization forward propagation primitive.
+struct group_normalization_forward : public primitive {
+    /// Primitive descriptor for a group normalization forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization forward
+        /// propagation primitive.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param groups Number of groups the channels are split into.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                memory::dim groups, float epsilon, normalization_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status
+                    = dnnl_group_normalization_forward_primitive_desc_create(
+                            &pd, aengine.get(), dnnl::convert_to_c(aprop_kind),
+                            src_desc.get(), dst_desc.get(), groups, epsilon,
+                            convert_to_c(flags), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a group "
+                        "normalization forward propagation primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return stat_desc(mean); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const { return stat_desc(var); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_prop_kind()const
+        dnnl::prop_kind get_prop_kind() const { return base::get_prop_kind(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_epsilon()const
+        float get_epsilon() const { return base::get_epsilon(); }
+
+        /// Returns the number of groups.
+        /// @return Number of groups.
+        memory::dim get_groups() const { return base::get_group_size(); }
+
+        /// Returns normalization flags.
+        /// @return Normalization flags.
+        normalization_flags get_flags() const {
+            return base::get_flags<normalization_flags>();
+        }
+
+    private:
+        enum {
+            mean = 1,
+            var = 2,
+        };
+        memory::desc stat_desc(int kind) const {
+            const bool use_global_stats
+                    = (get_flags() & normalization_flags::use_global_stats)
+                    != normalization_flags::none;
+            return query_md(
+                    use_global_stats ? query::src_md : query::dst_md, kind);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_forward() = default;
+
+    /// Constructs a group normalization forward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    group_normalization_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a group normalization forward propagation primitive from
+    ///     a cache blob.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    group_normalization_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product Inner Product
 ///
 /// A primitive to compute an inner product.
@@ -8337,6 +8826,14 @@ struct rnn_primitive_desc_base : public primitive_desc {
         return base::query_md(query::exec_arg_md, DNNL_ARG_AUGRU_ATTENTION);
     }
 
+    /// Returns sequence lengths memory descriptor.
+    /// @returns Sequence lengths memory descriptor.
+    /// @returns A zero memory descriptor if the primitive does not use
+    ///          variable sequence lengths.
+    memory::desc seq_lengths_desc() const {
+        return base::query_md(query::exec_arg_md, DNNL_ARG_SEQ_LENGTHS);
+    }
+
     /// Returns source iteration memory descriptor.
     /// @returns Source iteration memory descriptor.
     /// @returns A zero memory descriptor if the primitive does not have a
@@ -8920,35 +9417,85 @@ struct vanilla_rnn_forward : public primitive {
                     dst_layer_desc, dst_iter_desc, nullptr, rnn_flags::undef,
                     alpha, 0.0f, attr, allow_empty) {}
 
-        /// Constructs a primitive descriptor for a vanilla RNN forward
-        /// propagation primitive from a C API primitive descriptor that must
-        /// have a matching kind.
+        /// Constructs a primitive descriptor for a vanilla RNN forward propagation
+        ///     primitive with RNN flags.
         ///
-        /// @param pd C API primitive descriptor for a vanilla RNN forward
-        ///     propagation primitive.
-        primitive_desc(dnnl_primitive_desc_t pd)
-            : rnn_primitive_desc_base(pd, dnnl::prop_kind::forward_training,
-                    dnnl::prop_kind::forward_inference,
-                    dnnl::algorithm::vanilla_rnn) {}
-
-        /// @copydoc dnnl::rnn_primitive_desc_base::src_layer_desc()const
-        memory::desc src_layer_desc() const {
-            return rnn_base::src_layer_desc();
-        }
-
-        /// @copydoc dnnl::rnn_primitive_desc_base::src_iter_desc()const
-        memory::desc src_iter_desc() const { return rnn_base::src_iter_desc(); }
-
-        /// @copydoc dnnl::rnn_primitive_desc_base::weights_layer_desc()const
-        memory::desc weights_layer_desc() const {
-            return rnn_base::weights_layer_desc();
-        }
-
-        /// @copydoc dnnl::rnn_primitive_desc_base::weights_iter_desc()const
-        memory::desc weights_iter_desc() const {
-            return rnn_base::weights_iter_desc();
-        }
-
+        /// The arguments are the same as for the constructor above, with
+        /// the addition of @p flags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind.
+        /// @param activation Activation kind.
+        /// @param direction RNN direction.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param alpha Negative slope if activation is
+        ///     #dnnl::algorithm::eltwise_relu.
+        /// @param flags Unified RNN flags. Set
+        ///     #dnnl::rnn_flags::variable_sequence_length to pass
+        ///     per-minibatch sequence lengths at execution time.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                algorithm activation, rnn_direction direction,
+                const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc, float alpha,
+                rnn_flags flags, const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::vanilla_rnn,
+                    aprop_kind, activation, direction, src_layer_desc,
+                    src_iter_desc, nullptr, nullptr, weights_layer_desc,
+                    weights_iter_desc, nullptr, nullptr, bias_desc,
+                    dst_layer_desc, dst_iter_desc, nullptr, flags, alpha, 0.0f,
+                    attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a vanilla RNN forward
+        /// propagation primitive from a C API primitive descriptor that must
+        /// have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a vanilla RNN forward
+        ///     propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : rnn_primitive_desc_base(pd, dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference,
+                    dnnl::algorithm::vanilla_rnn) {}
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::src_layer_desc()const
+        memory::desc src_layer_desc() const {
+            return rnn_base::src_layer_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::src_iter_desc()const
+        memory::desc src_iter_desc() const { return rnn_base::src_iter_desc(); }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::weights_layer_desc()const
+        memory::desc weights_layer_desc() const {
+            return rnn_base::weights_layer_desc();
+        }
+
+        /// @copydoc dnnl::rnn_primitive_desc_base::weights_iter_desc()const
+        memory::desc weights_iter_desc() const {
+            return rnn_base::weights_iter_desc();
+        }
+
         /// @copydoc dnnl::rnn_primitive_desc_base::bias_desc()const
         memory::desc bias_desc() const { return rnn_base::bias_desc(); }
 
@@ -8965,6 +9512,11 @@ struct vanilla_rnn_forward : public primitive {
             return rnn_base::workspace_desc();
         }
 
+        /// @copydoc dnnl::rnn_primitive_desc_base::seq_lengths_desc()const
+        memory::desc seq_lengths_desc() const {
+            return rnn_base::seq_lengths_desc();
+        }
+
         /// @copydoc dnnl::primitive_desc_base::get_cell_kind()const
         algorithm get_cell_kind() const { return base::get_cell_kind(); }
 
@@ -9391,6 +9943,65 @@ struct lstm_forward : public primitive {
                     dst_layer_desc, dst_iter_desc, &dst_iter_c_desc,
                     rnn_flags::undef, 0.0f, 0.0f, attr, allow_empty) {}
 
+        /// Constructs a primitive descriptor for an LSTM forward propagation
+        ///     primitive with RNN flags.
+        ///
+        /// The arguments are the same as for the constructor above, with
+        /// the addition of @p flags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind.
+        /// @param direction RNN direction.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param src_iter_c_desc Memory descriptor for the input recurrent
+        ///     cell state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param weights_peephole_desc Memory descriptor for the weights
+        ///     applied to the cell states.
+        /// @param weights_projection_desc Memory descriptor for the weights
+        ///     applied to the hidden states to get the recurrent projection.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param dst_iter_c_desc Memory descriptor for the output recurrent
+        ///     cell state vector.
+        /// @param flags Unified RNN flags. Set
+        ///     #dnnl::rnn_flags::variable_sequence_length to pass
+        ///     per-minibatch sequence lengths at execution time.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                rnn_direction direction, const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &src_iter_c_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &weights_peephole_desc,
+                const memory::desc &weights_projection_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc,
+                const memory::desc &dst_iter_c_desc, rnn_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::vanilla_lstm,
+                    aprop_kind, algorithm::undef, direction, src_layer_desc,
+                    src_iter_desc, &src_iter_c_desc, nullptr,
+                    weights_layer_desc, weights_iter_desc,
+                    &weights_peephole_desc, &weights_projection_desc, bias_desc,
+                    dst_layer_desc, dst_iter_desc, &dst_iter_c_desc, flags,
+                    0.0f, 0.0f, attr, allow_empty) {}
+
         /// Constructs a primitive descriptor for an LSTM (with or without
         ///     peephole) forward propagation primitive.
         ///
@@ -9586,6 +10197,11 @@ struct lstm_forward : public primitive {
             return rnn_base::workspace_desc();
         }
 
+        /// @copydoc dnnl::rnn_primitive_desc_base::seq_lengths_desc()const
+        memory::desc seq_lengths_desc() const {
+            return rnn_base::seq_lengths_desc();
+        }
+
         /// @copydoc dnnl::primitive_desc_base::get_cell_kind()const
         algorithm get_cell_kind() const { return base::get_cell_kind(); }
 
@@ -10161,6 +10777,51 @@ struct gru_forward : public primitive {
                     dst_layer_desc, dst_iter_desc, nullptr, rnn_flags::undef,
                     0.0f, 0.0f, attr, allow_empty) {}
 
+        /// Constructs a primitive descriptor for a GRU forward propagation
+        ///     primitive with RNN flags.
+        ///
+        /// The arguments are the same as for the constructor above, with
+        /// the addition of @p flags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind.
+        /// @param direction RNN direction.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param flags Unified RNN flags. Set
+        ///     #dnnl::rnn_flags::variable_sequence_length to pass
+        ///     per-minibatch sequence lengths at execution time.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                rnn_direction direction, const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc, rnn_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::vanilla_gru, aprop_kind,
+                    algorithm::undef, direction, src_layer_desc, src_iter_desc,
+                    nullptr, nullptr, weights_layer_desc, weights_iter_desc,
+                    nullptr, nullptr, bias_desc, dst_layer_desc, dst_iter_desc,
+                    nullptr, flags, 0.0f, 0.0f, attr, allow_empty) {}
+
         /// Constructs a primitive descriptor for a GRU forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -10206,6 +10867,11 @@ struct gru_forward : public primitive {
             return rnn_base::workspace_desc();
         }
 
+        /// @copydoc dnnl::rnn_primitive_desc_base::seq_lengths_desc()const
+        memory::desc seq_lengths_desc() const {
+            return rnn_base::seq_lengths_desc();
+        }
+
         /// @copydoc dnnl::primitive_desc_base::get_cell_kind()const
         algorithm get_cell_kind() const { return base::get_cell_kind(); }
 
@@ -10492,6 +11158,51 @@ struct lbr_gru_forward : public primitive {
                     nullptr, nullptr, bias_desc, dst_layer_desc, dst_iter_desc,
                     nullptr, rnn_flags::undef, 0.0f, 0.0f, attr, allow_empty) {}
 
+        /// Constructs a primitive descriptor for an LBR GRU forward propagation
+        ///     primitive with RNN flags.
+        ///
+        /// The arguments are the same as for the constructor above, with
+        /// the addition of @p flags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind.
+        /// @param direction RNN direction.
+        /// @param src_layer_desc Memory descriptor for the input vector.
+        /// @param src_iter_desc Memory descriptor for the input recurrent
+        ///     hidden state vector.
+        /// @param weights_layer_desc Memory descriptor for the weights
+        ///     applied to the layer input.
+        /// @param weights_iter_desc Memory descriptor for the weights applied
+        ///     to the recurrent input.
+        /// @param bias_desc Bias memory descriptor.
+        /// @param dst_layer_desc Memory descriptor for the output vector.
+        /// @param dst_iter_desc Memory descriptor for the output recurrent
+        ///     hidden state vector.
+        /// @param flags Unified RNN flags. Set
+        ///     #dnnl::rnn_flags::variable_sequence_length to pass
+        ///     per-minibatch sequence lengths at execution time.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                rnn_direction direction, const memory::desc &src_layer_desc,
+                const memory::desc &src_iter_desc,
+                const memory::desc &weights_layer_desc,
+                const memory::desc &weights_iter_desc,
+                const memory::desc &bias_desc,
+                const memory::desc &dst_layer_desc,
+                const memory::desc &dst_iter_desc, rnn_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : rnn_primitive_desc_base(aengine, algorithm::lbr_gru, aprop_kind,
+                    algorithm::undef, direction, src_layer_desc, src_iter_desc,
+                    nullptr, nullptr, weights_layer_desc, weights_iter_desc,
+                    nullptr, nullptr, bias_desc, dst_layer_desc, dst_iter_desc,
+                    nullptr, flags, 0.0f, 0.0f, attr, allow_empty) {}
+
         /// Constructs a primitive descriptor for a LBR GRU forward propagation
         /// primitive from a C API primitive descriptor that must have a
         /// matching kind.
@@ -10537,6 +11248,11 @@ struct lbr_gru_forward : public primitive {
             return rnn_base::workspace_desc();
         }
 
+        /// @copydoc dnnl::rnn_primitive_desc_base::seq_lengths_desc()const
+        memory::desc seq_lengths_desc() const {
+            return rnn_base::seq_lengths_desc();
+        }
+
         /// @copydoc dnnl::primitive_desc_base::get_cell_kind()const
         algorithm get_cell_kind() const { return base::get_cell_kind(); }
 
@@ -12690,6 +13406,276 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+///
+/// A primitive to compute `softmax(scale * Q * K^T + mask) * V` in a single
+/// pass without storing the attention scores in memory.
+///
+/// @sa @ref dev_guide_sdpa in developer guide
+///
+/// @{
+
+/// Scaled dot-product attention.
+struct sdpa : public primitive {
+    /// Primitive descriptor for a scaled dot-product attention primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        ///     attention primitive without an attention mask.
+        ///
+        /// @param aengine Engine to use.
+        /// @param query_desc Queries memory descriptor.
+        /// @param key_desc Keys memory descriptor.
+        /// @param value_desc Values memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scaling factor applied to the scores.
+        /// @param flags Scaled dot-product attention flags.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &query_desc,
+                const memory::desc &key_desc, const memory::desc &value_desc,
+                const memory::desc &dst_desc, float scale,
+                sdpa_flags flags = sdpa_flags::none,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, query_desc, key_desc, value_desc,
+                    nullptr, dst_desc, scale, flags, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        ///     attention primitive with an additive attention mask.
+        ///
+        /// @param aengine Engine to use.
+        /// @param query_desc Queries memory descriptor.
+        /// @param key_desc Keys memory descriptor.
+        /// @param value_desc Values memory descriptor.
+        /// @param mask_desc Attention mask memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scaling factor applied to the scores.
+        /// @param flags Scaled dot-product attention flags.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &query_desc,
+                const memory::desc &key_desc, const memory::desc &value_desc,
+                const memory::desc &mask_desc, const memory::desc &dst_desc,
+                float scale, sdpa_flags flags = sdpa_flags::none,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, query_desc, key_desc, value_desc,
+                    &mask_desc, dst_desc, scale, flags, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention primitive from a C API primitive descriptor that must
+        /// have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a scaled dot-product
+        ///     attention primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::sdpa) {}
+
+        /// Returns a queries memory descriptor.
+        /// @returns Queries memory descriptor.
+        memory::desc query_desc() const { return base::src_desc(0); }
+
+        /// Returns a keys memory descriptor.
+        /// @returns Keys memory descriptor.
+        memory::desc key_desc() const { return base::src_desc(1); }
+
+        /// Returns a values memory descriptor.
+        /// @returns Values memory descriptor.
+        memory::desc value_desc() const { return base::src_desc(2); }
+
+        /// Returns an attention mask memory descriptor.
+        /// @returns Attention mask memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not have
+        ///     an attention mask.
+        memory::desc mask_desc() const { return base::src_desc(3); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns the scaling factor applied to the scores.
+        /// @returns Scaling factor.
+        float get_scale() const { return base::get_alpha(); }
+
+        /// Returns scaled dot-product attention flags.
+        /// @returns Scaled dot-product attention flags.
+        sdpa_flags get_flags() const { return base::get_flags<sdpa_flags>(); }
+
+    private:
+        primitive_desc(const engine &aengine, const memory::desc &query_desc,
+                const memory::desc &key_desc, const memory::desc &value_desc,
+                const memory::desc *mask_desc, const memory::desc &dst_desc,
+                float scale, sdpa_flags flags, const primitive_attr &attr,
+                bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_sdpa_primitive_desc_create(&pd,
+                    aengine.get(), query_desc.get(), key_desc.get(),
+                    value_desc.get(), optional_arg(mask_desc), dst_desc.get(),
+                    scale, convert_to_c(flags), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a "
+                        "scaled dot-product attention primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    sdpa() = default;
+
+    /// Constructs a scaled dot-product attention primitive.
+    /// @param pd Primitive descriptor for a scaled dot-product attention
+    ///     primitive.
+    sdpa(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a scaled dot-product attention primitive from a cache blob.
+    /// @param pd Primitive descriptor for a scaled dot-product attention
+    ///     primitive.
+    /// @param cache_blob Cache blob.
+    sdpa(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_sdpa
+
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+///
+/// A primitive to look up rows of an embedding table and optionally pool the
+/// rows of bags of indices.
+///
+/// @sa @ref dev_guide_embedding_bag in developer guide
+///
+/// @{
+
+/// Embedding bag.
+struct embedding_bag : public primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding lookup without
+        ///     pooling (#dnnl::algorithm::embedding_bag_gather).
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Embedding table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &indices_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, algorithm::embedding_bag_gather,
+                    src_desc, indices_desc, nullptr, dst_desc, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        ///     with pooling.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Embedding bag algorithm kind: either
+        ///     #dnnl::algorithm::embedding_bag_sum, or
+        ///     #dnnl::algorithm::embedding_bag_mean.
+        /// @param src_desc Embedding table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Bag offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    &offsets_desc, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding bag
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding_bag) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// Returns a bag offsets memory descriptor.
+        /// @returns Bag offsets memory descriptor.
+        /// @returns A zero memory descriptor if the primitive does not pool
+        ///     the rows.
+        memory::desc offsets_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc *offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_bag_primitive_desc_create(
+                    &pd, aengine.get(), dnnl::convert_to_c(aalgorithm),
+                    src_desc.get(), indices_desc.get(),
+                    optional_arg(offsets_desc), dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for an "
+                        "embedding bag primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag() = default;
+
+    /// Constructs an embedding bag primitive.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    embedding_bag(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an embedding bag primitive from a cache blob.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    /// @param cache_blob Cache blob.
+    embedding_bag(const primitive_desc &pd,
+            const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -54,6 +54,90 @@ size_t DNNL_API dnnl_engine_get_count(dnnl_engine_kind_t kind);
 dnnl_status_t DNNL_API dnnl_engine_create(
         dnnl_engine_t *engine, dnnl_engine_kind_t kind, size_t index);
 
+/// Returns the number of NUMA nodes that engines of a particular kind can be
+/// bound to.
+///
+/// @param kind Kind of engines.
+/// @returns Count of the NUMA nodes or 0 if engines of the kind do not
+///     support NUMA binding.
+size_t DNNL_API dnnl_engine_get_numa_node_count(dnnl_engine_kind_t kind);
+
+/// Creates an engine bound to a NUMA node.
+///
+/// Memory allocated by the library for such an engine, including memory
+/// objects, scratchpads, and weights packed by primitives, prefers the pages
+/// of the NUMA node. Threads that execute primitives on streams of the engine
+/// are restricted to the CPUs of the node.
+///
+/// @note
+///     Only native CPU engines support NUMA binding.
+///
+/// @param engine Output engine.
+/// @param kind Engine kind.
+/// @param index Engine index that should be between 0 and the count of
+///     engines of the requested kind.
+/// @param numa_node NUMA node that should be between 0 and the count of
+///     NUMA nodes returned by dnnl_engine_get_numa_node_count(). The online
+///     nodes of the system are numbered densely in the order of their system
+///     ids.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_create_on_numa_node(dnnl_engine_t *engine,
+        dnnl_engine_kind_t kind, size_t index, int numa_node);
+
+/// Returns the NUMA node an engine is bound to.
+///
+/// @param engine Engine to query.
+/// @param numa_node Output NUMA node or -1 if the engine is not bound to a
+///     NUMA node.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_get_numa_node(
+        dnnl_engine_t engine, int *numa_node);
+
+/// Sets the capacity in bytes of the scratchpad pool of an engine.
+///
+/// Library-managed scratchpads of primitives created on the engine take their
+/// buffers from the pool and return them to the pool when the primitives are
+/// destroyed, so that new primitives reuse the buffers instead of allocating
+/// memory. The capacity limits the total size of the idle buffers kept by the
+/// pool. Buffers that do not fit are freed. Setting the capacity to 0 frees
+/// all the idle buffers and disables caching. The default capacity is
+/// controlled by the ONEDNN_SCRATCHPAD_POOL_CAPACITY environment variable in
+/// megabytes and is 256 MB if the variable is not set.
+///
+/// @note
+///     Only native CPU engines have a scratchpad pool.
+///
+/// @param engine Engine.
+/// @param capacity Capacity in bytes.
+/// @returns #dnnl_unimplemented if the engine does not have a scratchpad
+///     pool, #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_set_scratchpad_pool_capacity(
+        dnnl_engine_t engine, size_t capacity);
+
+/// Returns the capacity in bytes of the scratchpad pool of an engine.
+///
+/// @param engine Engine to query.
+/// @param capacity Output capacity in bytes.
+/// @returns #dnnl_unimplemented if the engine does not have a scratchpad
+///     pool, #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_get_scratchpad_pool_capacity(
+        dnnl_engine_t engine, size_t *capacity);
+
+/// Returns the statistics of the scratchpad pool of an engine. The counters
+/// are accumulated since the engine was created.
+///
+/// @param engine Engine to query.
+/// @param stats Output statistics.
+/// @returns #dnnl_unimplemented if the engine does not have a scratchpad
+///     pool, #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_get_scratchpad_pool_stats(
+        dnnl_engine_t engine, dnnl_scratchpad_pool_stats_t *stats);
+
 /// Returns the kind of an engine.
 ///
 /// @param engine Engine to query.
@@ -275,6 +275,72 @@ struct engine : public handle<dnnl_engine_t> {
         reset(engine);
     }
 
+    /// Returns the number of NUMA nodes that engines of a particular kind
+    /// can be bound to.
+    ///
+    /// @param akind The kind of engines.
+    /// @returns The number of NUMA nodes or 0 if engines of the kind do not
+    ///     support NUMA binding.
+    static size_t get_numa_node_count(kind akind) {
+        return dnnl_engine_get_numa_node_count(convert_to_c(akind));
+    }
+
+    /// Constructs an engine bound to a NUMA node.
+    ///
+    /// @sa dnnl_engine_create_on_numa_node
+    ///
+    /// @param akind The kind of engine to construct.
+    /// @param index The index of the engine. Must be less than the value
+    ///     returned by #get_count() for this particular kind of engine.
+    /// @param numa_node The NUMA node. Must be less than the value returned
+    ///     by #get_numa_node_count() for this particular kind of engine.
+    engine(kind akind, size_t index, int numa_node) {
+        dnnl_engine_t engine;
+        error::wrap_c_api(dnnl_engine_create_on_numa_node(&engine,
+                                  convert_to_c(akind), index, numa_node),
+                "could not create an engine on a NUMA node");
+        reset(engine);
+    }
+
+    /// Returns the NUMA node the engine is bound to.
+    /// @returns The NUMA node or -1 if the engine is not bound to a node.
+    int get_numa_node() const {
+        int numa_node;
+        error::wrap_c_api(dnnl_engine_get_numa_node(get(), &numa_node),
+                "could not get NUMA node of an engine");
+        return numa_node;
+    }
+
+    /// Sets the capacity in bytes of the scratchpad pool of the engine.
+    ///
+    /// @sa dnnl_engine_set_scratchpad_pool_capacity
+    ///
+    /// @param capacity Capacity in bytes.
+    void set_scratchpad_pool_capacity(size_t capacity) {
+        error::wrap_c_api(
+                dnnl_engine_set_scratchpad_pool_capacity(get(), capacity),
+                "could not set scratchpad pool capacity of an engine");
+    }
+
+    /// Returns the capacity in bytes of the scratchpad pool of the engine.
+    /// @returns The capacity in bytes.
+    size_t get_scratchpad_pool_capacity() const {
+        size_t capacity;
+        error::wrap_c_api(
+                dnnl_engine_get_scratchpad_pool_capacity(get(), &capacity),
+                "could not get scratchpad pool capacity of an engine");
+        return capacity;
+    }
+
+    /// Returns the statistics of the scratchpad pool of the engine.
+    /// @returns The statistics of the pool.
+    dnnl_scratchpad_pool_stats_t get_scratchpad_pool_stats() const {
+        dnnl_scratchpad_pool_stats_t stats;
+        error::wrap_c_api(dnnl_engine_get_scratchpad_pool_stats(get(), &stats),
+                "could not get scratchpad pool statistics of an engine");
+        return stats;
+    }
+
     /// Returns the kind of the engine.
     /// @returns The kind of the engine.
     kind get_kind() const {
@@ -89,6 +89,23 @@ typedef enum {
     dnnl_f64 = 7,
     /// Boolean data type. Size is C++ implementation defined.
     dnnl_boolean = 8,
+    /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+    /// with a 5-bit exponent and a 2-bit mantissa.
+    dnnl_f8_e5m2 = 9,
+    /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+    /// with a 4-bit exponent and a 3-bit mantissa.
+    dnnl_f8_e4m3 = 10,
+    /// 4-bit signed integer. Two values are packed into a byte, the first one
+    /// occupying the least significant half.
+    dnnl_s4 = 11,
+    /// 4-bit unsigned integer. Two values are packed into a byte, the first
+    /// one occupying the least significant half.
+    dnnl_u4 = 12,
+    /// [4-bit NormalFloat](https://arxiv.org/abs/2305.14314): a 4-bit index
+    /// into a table of 16 normally distributed values in [-1, 1]. Two values
+    /// are packed into a byte, the first one occupying the least significant
+    /// half.
+    dnnl_nf4 = 13,
 
     /// Parameter to allow internal only data_types without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -151,6 +168,23 @@ typedef struct dnnl_engine *dnnl_engine_t;
 typedef const struct dnnl_engine *const_dnnl_engine_t;
 #endif
 
+/// Statistics of the pool that recycles library-managed scratchpads of an
+/// engine.
+typedef struct {
+    /// The number of scratchpad buffers allocated by the pool.
+    size_t allocations;
+    /// The number of scratchpad requests served by a cached buffer.
+    size_t reuses;
+    /// The number of buffers freed because the pool was full.
+    size_t evictions;
+    /// The total size in bytes of the buffers held by scratchpads.
+    size_t bytes_in_use;
+    /// The total size in bytes of the idle buffers cached by the pool.
+    size_t bytes_cached;
+    /// The largest total size in bytes of the buffers in use and cached.
+    size_t peak_bytes;
+} dnnl_scratchpad_pool_stats_t;
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream Stream
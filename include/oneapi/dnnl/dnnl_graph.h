@@ -688,6 +688,60 @@ dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache(int flag);
 /// nullptr, and #dnnl_success on success.
 dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache(int *flag);
 
+/// Sets the budget in bytes for the constant tensors held by the constant
+/// tensor cache of the engine kind. When a new constant tensor is added, the
+/// least recently used entries that are not pinned are evicted to fit the
+/// budget. If the new @p size is less than the size of the resident tensors,
+/// the excess entries are evicted. Setting the @p size to 0 clears the cache
+/// and disables it. By default, the budget is unlimited. Concurrently
+/// modifying @p size is safe.
+///
+/// @param eng_kind The engine kind of the cache.
+/// @param size The budget in bytes.
+/// @returns #dnnl_invalid_arguments if the @p eng_kind value is invalid, and
+/// #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_capacity(
+        dnnl_engine_kind_t eng_kind, size_t size);
+
+/// Returns the budget in bytes of the constant tensor cache of the engine
+/// kind.
+///
+/// @param eng_kind The engine kind of the cache.
+/// @param size The budget in bytes.
+/// @returns #dnnl_invalid_arguments if the @p eng_kind value is invalid or
+/// @p size is nullptr, and #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_capacity(
+        dnnl_engine_kind_t eng_kind, size_t *size);
+
+/// Returns the statistics of the constant tensor cache of the engine kind.
+/// The counters are accumulated since the library was loaded.
+///
+/// @param eng_kind The engine kind of the cache.
+/// @param stats Output statistics.
+/// @returns #dnnl_invalid_arguments if the @p eng_kind value is invalid or
+/// @p stats is nullptr, and #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_stats(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_stats_t *stats);
+
+/// Pins or unpins the constant tensors of a compiled partition in the
+/// constant tensor cache. Pinned tensors are never evicted to fit the budget
+/// of the cache, so a frequently executed partition keeps running without
+/// recomputing its constant tensors. The setting is shared by the compiled
+/// partitions returned from the compiled partition cache for the same
+/// partition and inputs.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param pinned Set to a positive value to pin the tensors and to 0 to unpin
+/// them. Negative values are invalid.
+/// @returns #dnnl_invalid_arguments if the @p pinned value is invalid or
+/// @p compiled_partition is nullptr, #dnnl_unimplemented if the backend of
+/// the compiled partition does not use the constant tensor cache, and
+/// #dnnl_success on success.
+dnnl_status_t DNNL_API
+dnnl_graph_compiled_partition_set_constant_tensor_cache_pinned(
+        dnnl_graph_compiled_partition_t compiled_partition, int pinned);
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 /// @} dnnl_graph_api
@@ -257,6 +257,10 @@ public:
         u8 = dnnl_u8,
         /// Boolean data type. Size is C++ implementation defined.
         boolean = dnnl_boolean,
+        /// 8-bit floating point with a 5-bit exponent and a 2-bit mantissa.
+        f8_e5m2 = dnnl_f8_e5m2,
+        /// 8-bit floating point with a 4-bit exponent and a 3-bit mantissa.
+        f8_e4m3 = dnnl_f8_e4m3,
     };
 
     /// Layout type
@@ -667,6 +671,18 @@ public:
         return inplace_options;
     }
 
+    /// Pins or unpins the constant tensors of the compiled partition in the
+    /// constant tensor cache. Pinned tensors are never evicted to fit the
+    /// budget of the cache.
+    ///
+    /// @param pinned Whether the constant tensors are pinned.
+    void set_constant_tensor_cache_pinned(bool pinned) {
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_set_constant_tensor_cache_pinned(
+                        get(), pinned),
+                "could not pin the constant tensors of a compiled partition");
+    }
+
     /// Execute a compiled partition.
     ///
     /// @param astream Stream object to run over.
@@ -736,10 +752,12 @@ public:
         DynamicQuantize = dnnl_graph_op_dynamic_quantize,
         Elu = dnnl_graph_op_elu,
         EluBackward = dnnl_graph_op_elu_backward,
+        EmbeddingBag = dnnl_graph_op_embedding_bag,
         End = dnnl_graph_op_end,
         Exp = dnnl_graph_op_exp,
         GELU = dnnl_graph_op_gelu,
         GELUBackward = dnnl_graph_op_gelu_backward,
+        GroupNorm = dnnl_graph_op_group_norm,
         HardSigmoid = dnnl_graph_op_hard_sigmoid,
         HardSigmoidBackward = dnnl_graph_op_hard_sigmoid_backward,
         HardSwish = dnnl_graph_op_hard_swish,
@@ -775,6 +793,7 @@ public:
         ReLU = dnnl_graph_op_relu,
         ReLUBackward = dnnl_graph_op_relu_backward,
         Reorder = dnnl_graph_op_reorder,
+        RMSNorm = dnnl_graph_op_rms_norm,
         Round = dnnl_graph_op_round,
         Select = dnnl_graph_op_select,
         Sigmoid = dnnl_graph_op_sigmoid,
@@ -1484,6 +1503,47 @@ inline int get_constant_tensor_cache() {
     return result;
 }
 
+/// Statistics of a constant tensor cache.
+using constant_tensor_cache_stats = dnnl_graph_constant_tensor_cache_stats_t;
+
+/// Sets the budget in bytes for the constant tensors held by the constant
+/// tensor cache of the engine kind. When a new constant tensor is added, the
+/// least recently used entries that are not pinned are evicted to fit the
+/// budget. Setting the @p size to 0 clears the cache and disables it. By
+/// default, the budget is unlimited.
+///
+/// @param kind The engine kind of the cache.
+/// @param size The budget in bytes.
+inline void set_constant_tensor_cache_capacity(engine::kind kind, size_t size) {
+    error::wrap_c_api(dnnl_graph_set_constant_tensor_cache_capacity(
+                              static_cast<dnnl_engine_kind_t>(kind), size),
+            "fail to set constant tensor cache capacity");
+}
+
+/// Returns the budget in bytes of the constant tensor cache of the engine
+/// kind.
+///
+/// @param kind The engine kind of the cache.
+inline size_t get_constant_tensor_cache_capacity(engine::kind kind) {
+    size_t size = 0;
+    error::wrap_c_api(dnnl_graph_get_constant_tensor_cache_capacity(
+                              static_cast<dnnl_engine_kind_t>(kind), &size),
+            "fail to get constant tensor cache capacity");
+    return size;
+}
+
+/// Returns the statistics of the constant tensor cache of the engine kind.
+///
+/// @param kind The engine kind of the cache.
+inline constant_tensor_cache_stats get_constant_tensor_cache_stats(
+        engine::kind kind) {
+    constant_tensor_cache_stats stats {};
+    error::wrap_c_api(dnnl_graph_get_constant_tensor_cache_stats(
+                              static_cast<dnnl_engine_kind_t>(kind), &stats),
+            "fail to get constant tensor cache statistics");
+    return stats;
+}
+
 /// @} dnnl_graph_constant_tensor_cache
 
 } // namespace graph
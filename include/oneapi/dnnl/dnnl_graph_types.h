@@ -252,6 +252,9 @@ typedef enum {
     dnnl_graph_op_hard_sigmoid_backward,
     dnnl_graph_op_select,
     dnnl_graph_op_pow,
+    dnnl_graph_op_group_norm,
+    dnnl_graph_op_rms_norm,
+    dnnl_graph_op_embedding_bag,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -454,6 +457,29 @@ typedef const struct dnnl_graph_tensor *const_dnnl_graph_tensor_t;
 
 /// @} dnnl_graph_api_tensor
 
+/// @addtogroup dnnl_graph_api_constant_tensor_cache
+/// @{
+
+/// Statistics of a constant tensor cache.
+typedef struct {
+    /// The number of executions that found their constant tensors in the
+    /// cache.
+    size_t hits;
+    /// The number of executions that computed their constant tensors and
+    /// added them to the cache.
+    size_t misses;
+    /// The number of entries evicted from the cache.
+    size_t evictions;
+    /// The total size in bytes of the constant tensors held by the cache.
+    size_t bytes_resident;
+    /// The number of entries in the cache.
+    size_t num_entries;
+    /// The number of pinned entries in the cache.
+    size_t num_pinned_entries;
+} dnnl_graph_constant_tensor_cache_stats_t;
+
+/// @} dnnl_graph_api_constant_tensor_cache
+
 /// @} dnnl_graph_api
 
 #ifdef __cplusplus
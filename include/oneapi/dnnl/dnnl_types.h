@@ -68,6 +68,16 @@ typedef enum {
     dnnl_sparse_encoding_undef = 0,
     /// Compressed Sparse Row (CSR) encoding.
     dnnl_csr,
+    /// Block Compressed Sparse Row (BSR) encoding, also known as blocked
+    /// CSR. The non-zero values are stored in dense row-major blocks of a
+    /// fixed shape, and the indices and pointers address blocks instead of
+    /// individual elements.
+    dnnl_bsr,
+    /// Grouped encoding. The rows of a dense matrix are split into groups of
+    /// variable sizes, e.g. the tokens routed to each expert of a
+    /// Mixture-of-Experts layer. The offsets give the first row of each
+    /// group.
+    dnnl_grouped,
 } dnnl_sparse_encoding_t;
 #endif
 
@@ -1858,6 +1868,12 @@ typedef enum {
     dnnl_softmax,
     /// A layer normalization primitive.
     dnnl_layer_normalization,
+    /// A scaled dot-product attention primitive.
+    dnnl_sdpa,
+    /// A group normalization primitive.
+    dnnl_group_normalization,
+    /// An embedding bag primitive.
+    dnnl_embedding_bag,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2014,6 +2030,12 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// Embedding lookup without pooling: a destination row per index
+    dnnl_embedding_bag_gather = 0x40000,
+    /// Embedding bag with sum pooling
+    dnnl_embedding_bag_sum,
+    /// Embedding bag with mean pooling
+    dnnl_embedding_bag_mean,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2085,8 +2107,30 @@ typedef enum {
     ///    tensor and then perform backward normalization.
     dnnl_fuse_norm_add_relu = 0x10U,
 
+    /// Use Root Mean Square (RMS) normalization. If specified, the mean is
+    /// assumed to be zero and is neither computed nor used:
+    ///  - on forward propagation the variance is computed as the mean of
+    ///    squared source values, and the #DNNL_ARG_MEAN argument is not used;
+    ///  - on backward propagation the mean is not used either.
+    ///
+    /// Supported by layer normalization only.
+    dnnl_rms_norm = 0x20U,
 } dnnl_normalization_flags_t;
 
+/// Flags for scaled dot-product attention primitive.
+typedef enum {
+    /// Use no flags.
+    dnnl_sdpa_flags_none = 0x0U,
+
+    /// Causal masking
+    ///
+    /// If specified, a query with index `i` does not attend to the keys with
+    /// indices greater than `i + (S_kv - S_q)`, where `S_q` and `S_kv` are
+    /// the numbers of queries and keys respectively. The masked scores are
+    /// skipped rather than computed.
+    dnnl_sdpa_causal_mask = 0x1U,
+} dnnl_sdpa_flags_t;
+
 /// @} dnnl_api_primitives_common
 /// @} dnnl_api_primitives
 
@@ -2164,6 +2208,10 @@ typedef enum {
     dnnl_rnn_flags_undef = 0x0,
     /// Do not add weights gradient to existing diff_weights memory
     dnnl_rnn_flags_diff_weights_overwrite = 0x1,
+    /// Use per-minibatch sequence lengths passed at execution time as
+    /// #DNNL_ARG_SEQ_LENGTHS. Time steps past the length of a sequence are
+    /// not computed, and the final states are taken from the last valid step.
+    dnnl_rnn_flags_variable_sequence_length = 0x2,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2232,6 +2280,18 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// Scheduling mode for the parallel loops of a primitive
+typedef enum {
+    /// The iteration space is split into equal contiguous ranges, one per
+    /// thread, before the loop starts (default).
+    dnnl_scheduling_balanced,
+    /// The iteration space is split into several chunks per thread. Each
+    /// thread processes its own chunks first and then takes the remaining
+    /// chunks of other threads. This mode helps when the cost of iterations
+    /// is uneven or when threads are delayed by other work.
+    dnnl_scheduling_work_stealing,
+} dnnl_scheduling_t;
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
@@ -2285,6 +2345,14 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_primitive_future
+/// An opaque structure to describe a primitive being created asynchronously.
+struct dnnl_primitive_future;
+/// A primitive future handle.
+typedef struct dnnl_primitive_future *dnnl_primitive_future_t;
+/// A constant primitive future handle.
+typedef const struct dnnl_primitive_future *const_dnnl_primitive_future_t;
+
 /// Source argument #0.
 #define DNNL_ARG_SRC_0 1
 /// A special mnemonic for source argument for primitives that have a
@@ -2293,6 +2361,9 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input vector. An alias for
 /// #DNNL_ARG_SRC_0.
 #define DNNL_ARG_SRC_LAYER DNNL_ARG_SRC_0
+/// A special mnemonic for scaled dot-product attention queries. An alias for
+/// #DNNL_ARG_SRC_0.
+#define DNNL_ARG_QUERIES DNNL_ARG_SRC_0
 /// A special mnemonic for reorder source argument. An alias for
 /// #DNNL_ARG_SRC_0.
 #define DNNL_ARG_FROM DNNL_ARG_SRC_0
@@ -2302,18 +2373,39 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input recurrent hidden state vector. An alias
 /// for #DNNL_ARG_SRC_1.
 #define DNNL_ARG_SRC_ITER DNNL_ARG_SRC_1
+/// A special mnemonic for scaled dot-product attention keys. An alias for
+/// #DNNL_ARG_SRC_1.
+#define DNNL_ARG_KEYS DNNL_ARG_SRC_1
+/// A special mnemonic for embedding bag indices. An alias for
+/// #DNNL_ARG_SRC_1.
+#define DNNL_ARG_INDICES DNNL_ARG_SRC_1
 
 /// Source argument #2.
 #define DNNL_ARG_SRC_2 3
 /// A special mnemonic for RNN input recurrent cell state vector. An alias for
 /// #DNNL_ARG_SRC_2.
 #define DNNL_ARG_SRC_ITER_C DNNL_ARG_SRC_2
+/// A special mnemonic for scaled dot-product attention values. An alias for
+/// #DNNL_ARG_SRC_2.
+#define DNNL_ARG_VALUES DNNL_ARG_SRC_2
+/// A special mnemonic for embedding bag offsets. An alias for
+/// #DNNL_ARG_SRC_2.
+#define DNNL_ARG_OFFSETS DNNL_ARG_SRC_2
 
 /// Source argument #3.
 #define DNNL_ARG_SRC_3 4
 /// A special mnemonic for RNN input recurrent cell attention vector. An alias for
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
+/// A special mnemonic for scaled dot-product attention mask. An alias for
+/// #DNNL_ARG_SRC_3.
+#define DNNL_ARG_ATTN_MASK DNNL_ARG_SRC_3
+
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN per-minibatch sequence lengths. An alias for
+/// #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_4
 
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
@@ -2601,6 +2693,7 @@ typedef enum {
     dnnl_query_activation_kind, ///< RNN parameter activation kind
     dnnl_query_kernel, ///< Pooling parameter kernel
     dnnl_query_group_size_s64, ///< Shuffle parameter group size
+    dnnl_query_inplace_offset_s64, ///< Concat parameter in-place offset
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// ukernel C++ API
+
+#ifndef ONEAPI_DNNL_DNNL_UKERNEL_HPP
+#define ONEAPI_DNNL_DNNL_UKERNEL_HPP
+
+#include <utility>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+/// @addtogroup dnnl_api
+/// @{
+
+namespace dnnl {
+
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_brgemm_t> {
+    static dnnl_status_t destructor(dnnl_brgemm_t p) {
+        return dnnl_brgemm_destroy(p);
+    }
+};
+
+template <>
+struct handle_traits<dnnl_brgemm_pack_B_t> {
+    static dnnl_status_t destructor(dnnl_brgemm_pack_B_t p) {
+        return dnnl_brgemm_pack_B_destroy(p);
+    }
+};
+/// @endcond
+
+/// @addtogroup dnnl_api_ukernel Ukernels
+/// Collection of ukernels: low-level building blocks which are called from
+/// user code inside the user's own parallel loops.
+///
+/// @sa @ref dev_guide_ukernel_basic_concepts
+/// @{
+
+/// ukernel namespace
+namespace ukernel {
+
+/// Packing scheme of the B matrix expected by a BRGeMM ukernel.
+enum class pack_type {
+    /// Undefined pack type. A guard value.
+    undef = dnnl_pack_type_undef,
+    /// Plain, not transposed layout. No packing is required.
+    no_trans = dnnl_pack_type_no_trans,
+    /// Plain layout with 32-bit packing along K.
+    pack32 = dnnl_pack_type_pack32,
+};
+
+/// @addtogroup dnnl_api_ukernel_brgemm BRGeMM ukernel
+/// Batch-reduce GeMM ukernel and the routine to pack its B tensor.
+/// @{
+
+/// BRGeMM ukernel.
+struct brgemm : public handle<dnnl_brgemm_t> {
+    /// Default constructor. Produces an empty object.
+    brgemm() = default;
+
+    /// Constructs a BRGeMM ukernel object. Operates by the following formula:
+    /// `C = [A x B]`.
+    ///
+    /// @param M Dimension M of tensor A.
+    /// @param N Dimension N of tensor B.
+    /// @param K Dimension K of tensors A and B.
+    /// @param batch_size Maximum batch size.
+    /// @param lda Leading dimension of tensor A.
+    /// @param ldb Leading dimension of tensor B.
+    /// @param ldc Leading dimension of tensor C.
+    /// @param a_dt Data type of tensor A.
+    /// @param b_dt Data type of tensor B.
+    /// @param c_dt Data type of tensor C.
+    /// @param allow_empty A flag signifying whether construction is allowed
+    ///     to fail without throwing an exception. In this case an empty
+    ///     object will be produced. This flag is optional and defaults to
+    ///     false.
+    brgemm(memory::dim M, memory::dim N, memory::dim K,
+            memory::dim batch_size, memory::dim lda, memory::dim ldb,
+            memory::dim ldc, memory::data_type a_dt, memory::data_type b_dt,
+            memory::data_type c_dt, bool allow_empty = false) {
+        dnnl_brgemm_t brgemm = nullptr;
+        dnnl_status_t status = dnnl_brgemm_create(&brgemm, M, N, K,
+                batch_size, lda, ldb, ldc, memory::convert_to_c(a_dt),
+                memory::convert_to_c(b_dt), memory::convert_to_c(c_dt));
+
+        if (!allow_empty)
+            error::wrap_c_api(
+                    status, "could not create a BRGeMM ukernel object");
+        reset(brgemm);
+    }
+
+    /// Sets adding an intermediate result to the output tensor C instead of
+    /// writing: `C += [A x B]`.
+    ///
+    /// @param add_C Value to indicate addition.
+    void set_add_C(bool add_C) {
+        error::wrap_c_api(dnnl_brgemm_set_add_C(get(), add_C),
+                "could not set add_C attribute");
+    }
+
+    /// Sets post-operations to a BRGeMM ukernel object:
+    /// `D = post-operations(C)`.
+    ///
+    /// @param ldd Leading dimension of tensor D.
+    /// @param d_dt Data type of tensor D.
+    /// @param po Post-operations chain. Only eltwise post-operations are
+    ///     supported.
+    void set_post_ops(memory::dim ldd, memory::data_type d_dt,
+            const post_ops &po = default_post_ops()) {
+        error::wrap_c_api(dnnl_brgemm_set_post_ops(get(), ldd,
+                                  memory::convert_to_c(d_dt), po.get()),
+                "could not set post operations");
+    }
+
+    /// Finalizes initialization of a BRGeMM ukernel object.
+    ///
+    /// This step must be performed prior to querying information from the
+    /// object and generating the kernel.
+    void finalize() {
+        error::wrap_c_api(dnnl_brgemm_finalize(get()),
+                "could not finalize an object");
+    }
+
+    /// Returns the packing type expected by a tensor B of a BRGeMM ukernel
+    /// object with the given data types.
+    ///
+    /// @param a_dt Data type of tensor A.
+    /// @param b_dt Data type of tensor B.
+    static pack_type get_B_pack_type(
+            memory::data_type a_dt, memory::data_type b_dt) {
+        dnnl_pack_type_t c_pack_type;
+        error::wrap_c_api(dnnl_brgemm_get_B_pack_type(&c_pack_type,
+                                  memory::convert_to_c(a_dt),
+                                  memory::convert_to_c(b_dt)),
+                "could not query B pack type");
+        return static_cast<pack_type>(c_pack_type);
+    }
+
+    /// Returns the size of a scratchpad memory needed for the BRGeMM ukernel
+    /// object, in bytes.
+    size_t get_scratchpad_size() const {
+        size_t size;
+        error::wrap_c_api(dnnl_brgemm_get_scratchpad_size(get(), &size),
+                "could not query a scratchpad size from a BRGeMM ukernel "
+                "object");
+        return size;
+    }
+
+    /// Initializes the hardware-specific context of the calling thread.
+    /// Affects the global state for all BRGeMM ukernel objects executed by
+    /// the thread.
+    void set_hw_context() const {
+        error::wrap_c_api(dnnl_brgemm_set_hw_context(get()),
+                "could not set hardware context");
+    }
+
+    /// Releases the hardware-specific context of the calling thread.
+    /// Affects the global state for all BRGeMM ukernel objects executed by
+    /// the thread.
+    static void release_hw_context() {
+        error::wrap_c_api(dnnl_brgemm_release_hw_context(),
+                "could not release hardware context");
+    }
+
+    /// Generates an executable part of a BRGeMM ukernel object.
+    void generate() {
+        error::wrap_c_api(dnnl_brgemm_generate(get()),
+                "could not generate a kernel");
+    }
+
+    /// Executes a BRGeMM ukernel object.
+    ///
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param A_B_offsets Vector of pairs of tensors A and B offsets for
+    ///     each batch, in bytes. The number of batches must coincide with
+    ///     the `batch_size` value passed at object construction stage.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    void execute(const void *A, const void *B,
+            const std::vector<std::pair<memory::dim, memory::dim>> &A_B_offsets,
+            void *C, void *scratchpad) const {
+        error::wrap_c_api(
+                dnnl_brgemm_execute(get(), A, B,
+                        reinterpret_cast<const dnnl_dim_t *>(
+                                A_B_offsets.data()),
+                        C, scratchpad),
+                "could not execute a BRGeMM ukernel object");
+    }
+
+    /// Executes a BRGeMM ukernel object with post-operations.
+    ///
+    /// @param A Base pointer to a tensor A.
+    /// @param B Base pointer to a tensor B.
+    /// @param A_B_offsets Vector of pairs of tensors A and B offsets for
+    ///     each batch, in bytes.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param D Pointer to a tensor D (output buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    void execute(const void *A, const void *B,
+            const std::vector<std::pair<memory::dim, memory::dim>> &A_B_offsets,
+            void *C, void *D, void *scratchpad) const {
+        error::wrap_c_api(
+                dnnl_brgemm_execute_postops(get(), A, B,
+                        reinterpret_cast<const dnnl_dim_t *>(
+                                A_B_offsets.data()),
+                        C, D, scratchpad),
+                "could not execute a BRGeMM ukernel object with "
+                "post-operations");
+    }
+
+private:
+    static const post_ops &default_post_ops() {
+        static const post_ops po;
+        return po;
+    }
+};
+
+/// B matrix packing routine.
+struct brgemm_pack_B : public handle<dnnl_brgemm_pack_B_t> {
+    /// Default constructor. Produces an empty object.
+    brgemm_pack_B() = default;
+
+    /// Constructs a B matrix packing routine object.
+    ///
+    /// @param K Dimension K of tensor B.
+    /// @param N Dimension N of tensor B.
+    /// @param in_ld Leading dimension of the input tensor.
+    /// @param out_ld Leading dimension of the output tensor. Can be 16, 32,
+    ///     48, or 64.
+    /// @param in_dt Data type of the input tensor.
+    /// @param out_dt Data type of the output tensor.
+    /// @param allow_empty A flag signifying whether construction is allowed
+    ///     to fail without throwing an exception. In this case an empty
+    ///     object will be produced. This flag is optional and defaults to
+    ///     false.
+    brgemm_pack_B(memory::dim K, memory::dim N, memory::dim in_ld,
+            memory::dim out_ld, memory::data_type in_dt,
+            memory::data_type out_dt, bool allow_empty = false) {
+        dnnl_brgemm_pack_B_t pack_B = nullptr;
+        dnnl_status_t status = dnnl_brgemm_pack_B_create(&pack_B, K, N, in_ld,
+                out_ld, memory::convert_to_c(in_dt),
+                memory::convert_to_c(out_dt));
+
+        if (!allow_empty)
+            error::wrap_c_api(
+                    status, "could not create a B matrix packing object");
+        reset(pack_B);
+    }
+
+    /// Generates an executable part of a B matrix packing routine object.
+    void generate() {
+        error::wrap_c_api(dnnl_brgemm_pack_B_generate(get()),
+                "could not generate a kernel");
+    }
+
+    /// Executes a B matrix packing routine object.
+    ///
+    /// @param in Pointer to an input buffer.
+    /// @param out Pointer to an output buffer.
+    void execute(const void *in, void *out) const {
+        error::wrap_c_api(dnnl_brgemm_pack_B_execute(get(), in, out),
+                "could not execute a B matrix packing object");
+    }
+};
+
+/// @} dnnl_api_ukernel_brgemm
+
+} // namespace ukernel
+
+/// @} dnnl_api_ukernel
+
+} // namespace dnnl
+
+/// @} dnnl_api
+
+#endif /* ONEAPI_DNNL_DNNL_UKERNEL_HPP */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @file
+/// ukernel C API types definitions
+
+#ifndef ONEAPI_DNNL_DNNL_UKERNEL_TYPES_H
+#define ONEAPI_DNNL_DNNL_UKERNEL_TYPES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @cond DO_NOT_DOCUMENT_THIS
+#include "oneapi/dnnl/dnnl_types.h"
+/// @endcond
+
+/// @addtogroup dnnl_api
+/// @{
+
+/// @addtogroup dnnl_api_ukernel
+/// @{
+
+/// Packing scheme of the B matrix expected by a BRGeMM ukernel.
+typedef enum {
+    /// Undefined pack type. A guard value.
+    dnnl_pack_type_undef = 0,
+    /// Plain, not transposed layout. No packing is required.
+    dnnl_pack_type_no_trans,
+    /// Plain layout with 32-bit packing along K: every 32-bit element of a row
+    /// holds 2 (16-bit data types) or 4 (8-bit data types) consecutive
+    /// elements of a column.
+    dnnl_pack_type_pack32,
+} dnnl_pack_type_t;
+
+/// @addtogroup dnnl_api_ukernel_brgemm
+/// @{
+
+/// @struct dnnl_brgemm
+/// An opaque structure to describe a batch-reduce GeMM ukernel.
+struct dnnl_brgemm;
+
+/// A brgemm ukernel handle.
+typedef struct dnnl_brgemm *dnnl_brgemm_t;
+
+/// A constant brgemm ukernel handle.
+typedef const struct dnnl_brgemm *const_dnnl_brgemm_t;
+
+/// @struct dnnl_brgemm_pack_B
+/// An opaque structure to describe a B matrix packing routine.
+struct dnnl_brgemm_pack_B;
+
+/// A B matrix packing routine handle.
+typedef struct dnnl_brgemm_pack_B *dnnl_brgemm_pack_B_t;
+
+/// A constant B matrix packing routine handle.
+typedef const struct dnnl_brgemm_pack_B *const_dnnl_brgemm_pack_B_t;
+
+/// @} dnnl_api_ukernel_brgemm
+
+/// @} dnnl_api_ukernel
+
+/// @} dnnl_api
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ONEAPI_DNNL_DNNL_UKERNEL_TYPES_H */
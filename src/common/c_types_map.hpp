@@ -141,6 +141,9 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t embedding_bag_gather = dnnl_embedding_bag_gather;
+const alg_kind_t embedding_bag_sum = dnnl_embedding_bag_sum;
+const alg_kind_t embedding_bag_mean = dnnl_embedding_bag_mean;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -153,6 +156,11 @@ const data_type_t f64 = dnnl_f64;
 const data_type_t s32 = dnnl_s32;
 const data_type_t s8 = dnnl_s8;
 const data_type_t u8 = dnnl_u8;
+const data_type_t f8_e5m2 = dnnl_f8_e5m2;
+const data_type_t f8_e4m3 = dnnl_f8_e4m3;
+const data_type_t s4 = dnnl_s4;
+const data_type_t u4 = dnnl_u4;
+const data_type_t nf4 = dnnl_nf4;
 
 // Not exposed through API as all current uses are internal only
 const data_type_t tf32 = static_cast<data_type_t>(1 << 8);
@@ -174,11 +182,19 @@ const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
 } // namespace scratchpad_mode
 
+using scheduling_t = dnnl_scheduling_t;
+namespace scheduling {
+const scheduling_t balanced = dnnl_scheduling_balanced;
+const scheduling_t work_stealing = dnnl_scheduling_work_stealing;
+} // namespace scheduling
+
 #ifdef DNNL_EXPERIMENTAL_SPARSE
 using sparse_encoding_t = dnnl_sparse_encoding_t;
 namespace sparse_encoding {
 const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
+const sparse_encoding_t bsr = dnnl_bsr;
+const sparse_encoding_t grouped = dnnl_grouped;
 } // namespace sparse_encoding
 #else
 // Declare dummy values to avoid guarding internal implementation.
@@ -186,6 +202,8 @@ using sparse_encoding_t = int;
 namespace sparse_encoding {
 const sparse_encoding_t undef = 0;
 const sparse_encoding_t csr = 1;
+const sparse_encoding_t bsr = 2;
+const sparse_encoding_t grouped = 3;
 } // namespace sparse_encoding
 #endif
 
@@ -1702,13 +1720,22 @@ const normalization_flags_t use_scale = dnnl_use_scale;
 const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
+const normalization_flags_t rms_norm = dnnl_rms_norm;
 } // namespace normalization_flags
 
+using sdpa_flags_t = dnnl_sdpa_flags_t;
+namespace sdpa_flags {
+const sdpa_flags_t none = dnnl_sdpa_flags_none;
+const sdpa_flags_t causal_mask = dnnl_sdpa_causal_mask;
+} // namespace sdpa_flags
+
 using rnn_flags_t = dnnl_rnn_flags_t;
 namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
 const rnn_flags_t diff_weights_overwrite
         = dnnl_rnn_flags_diff_weights_overwrite;
+const rnn_flags_t variable_sequence_length
+        = dnnl_rnn_flags_variable_sequence_length;
 } // namespace rnn_flags
 
 using engine_kind_t = dnnl_engine_kind_t;
@@ -1761,6 +1788,9 @@ const primitive_kind_t resampling = dnnl_resampling;
 const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
+const primitive_kind_t sdpa = dnnl_sdpa;
+const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t embedding_bag = dnnl_embedding_bag;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -1811,6 +1841,7 @@ const query_t direction = dnnl_query_direction;
 const query_t activation_kind = dnnl_query_activation_kind;
 const query_t kernel = dnnl_query_kernel;
 const query_t group_size_s64 = dnnl_query_group_size_s64;
+const query_t inplace_offset_s64 = dnnl_query_inplace_offset_s64;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -1887,6 +1918,9 @@ struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
 struct gemm_pd_t;
+struct embedding_bag_pd_t;
+struct group_normalization_fwd_pd_t;
+struct group_normalization_pd_t;
 struct inner_product_bwd_data_pd_t;
 struct inner_product_bwd_weights_pd_t;
 struct inner_product_fwd_pd_t;
@@ -1908,6 +1942,7 @@ struct resampling_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
 struct rnn_pd_t;
+struct sdpa_pd_t;
 struct shuffle_pd_t;
 struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
@@ -58,6 +58,16 @@ struct concat_pd_t : public primitive_desc_t {
         return index == 0 ? &dst_md_ : &glob_zero_md;
     }
 
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::inplace_offset_s64:
+                *(dim_t *)result = src_inplace_offset(idx);
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
     int n_inputs() const override { return n_; }
     int n_outputs() const override { return 1; }
 
@@ -67,6 +77,62 @@ struct concat_pd_t : public primitive_desc_t {
         return index < n_inputs() ? &src_image_mds_[index] : &glob_zero_md;
     }
 
+    /* returns the offset in bytes of the image of the source `index` in the
+     * destination if the source can be placed there in place, i.e. the image
+     * is a dense chunk of the destination with exactly the source layout and
+     * the primitive would copy the data as is. Returns -1 otherwise.
+     *
+     * Producers of such sources may write directly into the destination, in
+     * which case the concat has nothing to do (see srcs_in_place()). */
+    dim_t src_inplace_offset(int index) const {
+        if (index < 0 || index >= n_inputs()) return -1;
+        if (!attr()->scales_.has_default_values()) return -1;
+
+        const memory_desc_wrapper dst_d(dst_md_), src_d(src_mds_[index]);
+        if (!dst_d.is_blocking_desc() || dst_d.offset0() != 0
+                || dst_d.has_runtime_dims_or_strides()
+                || !src_d.is_blocking_desc())
+            return -1;
+
+        const int ndims = dst_md_.ndims;
+        dims_t dims, offsets = {};
+        utils::array_copy(dims, dst_md_.dims, ndims);
+        for (int i = 0; i < index; ++i)
+            offsets[concat_dim_] += src_mds_[i].dims[concat_dim_];
+        dims[concat_dim_] = src_mds_[index].dims[concat_dim_];
+
+        memory_desc_t image_md;
+        if (memory_desc_init_submemory(image_md, dst_md_, dims, offsets)
+                != status::success)
+            return -1;
+        const dim_t offset = image_md.offset0;
+        image_md.offset0 = 0;
+
+        // Strides of unit dimensions do not affect the layout, hence are
+        // ignored in the comparison.
+        memory_desc_t src_md = src_mds_[index];
+        for (int d = 0; d < ndims; ++d) {
+            if (image_md.padded_dims[d] != 1) continue;
+            image_md.format_desc.blocking.strides[d] = 1;
+            src_md.format_desc.blocking.strides[d] = 1;
+        }
+
+        const memory_desc_wrapper image_d(image_md);
+        if (!image_d.is_dense() || image_d != memory_desc_wrapper(src_md))
+            return -1;
+
+        return offset * (dim_t)types::data_type_size(dst_md_.data_type);
+    }
+
+    /* returns true if every source may be written in place (see
+     * src_inplace_offset()), so the concat can be skipped if producers
+     * wrote their outputs into the destination. */
+    bool is_inplace() const {
+        for (int i = 0; i < n_inputs(); ++i)
+            if (src_inplace_offset(i) < 0) return false;
+        return n_inputs() > 0;
+    }
+
 protected:
     int n_, concat_dim_;
     memory_desc_t dst_md_;
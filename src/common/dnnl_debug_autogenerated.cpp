@@ -50,6 +50,11 @@ const char *dnnl_dt2str(dnnl_data_type_t v) {
     if (v == dnnl_u8) return "u8";
     if (v == dnnl_f64) return "f64";
     if (v == dnnl_boolean) return "boolean";
+    if (v == dnnl_f8_e5m2) return "f8_e5m2";
+    if (v == dnnl_f8_e4m3) return "f8_e4m3";
+    if (v == dnnl_s4) return "s4";
+    if (v == dnnl_u4) return "u4";
+    if (v == dnnl_nf4) return "nf4";
     if (v == dnnl_data_type_max) return "data_type_max";
     assert(!"unknown dt");
     return "unknown dt";
@@ -77,6 +82,8 @@ const char *dnnl_engine_kind2str(dnnl_engine_kind_t v) {
 const char *dnnl_sparse_encoding2str(dnnl_sparse_encoding_t v) {
     if (v == dnnl_sparse_encoding_undef) return "undef";
     if (v == dnnl_csr) return "csr";
+    if (v == dnnl_bsr) return "bsr";
+    if (v == dnnl_grouped) return "grouped";
     assert(!"unknown sparse_encoding");
     return "unknown sparse_encoding";
 }
@@ -1591,6 +1598,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_prelu) return "prelu";
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
+    if (v == dnnl_sdpa) return "sdpa";
+    if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_embedding_bag) return "embedding_bag";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -1667,6 +1677,9 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
+    if (v == dnnl_embedding_bag_gather) return "embedding_bag_gather";
+    if (v == dnnl_embedding_bag_sum) return "embedding_bag_sum";
+    if (v == dnnl_embedding_bag_mean) return "embedding_bag_mean";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
@@ -1674,6 +1687,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
     if (v == dnnl_rnn_flags_diff_weights_overwrite) return "rnn_flags_diff_weights_overwrite";
+    if (v == dnnl_rnn_flags_variable_sequence_length) return "rnn_flags_variable_sequence_length";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
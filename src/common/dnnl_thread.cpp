@@ -0,0 +1,35 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+thread_local dnnl_scheduling_t thread_scheduling = dnnl_scheduling_balanced;
+} // namespace
+
+dnnl_scheduling_t get_scheduling() {
+    return thread_scheduling;
+}
+
+void set_scheduling(dnnl_scheduling_t mode) {
+    thread_scheduling = mode;
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -18,9 +18,12 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
 
+#include "trace.hpp"
 #include "utils.hpp"
 #include "z_magic.hpp"
 
@@ -256,6 +259,81 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
     balance211(ny, grp_nthr, grp_ithr, ny_start, ny_end);
 }
 
+// Scheduling mode of the parallel loops started by the calling thread (see
+// dnnl_primitive_attr_set_scheduling()). The mode is set for the duration of
+// a primitive execution.
+dnnl_scheduling_t DNNL_API get_scheduling();
+void DNNL_API set_scheduling(dnnl_scheduling_t mode);
+
+// Work-stealing distribution of `work_amount` items between `nthr` threads.
+// The work is split into `chunks_per_thr` chunks per thread as balance211()
+// does, and every thread owns a contiguous range of chunks. A thread takes
+// its own chunks first and then the remaining chunks of the other threads,
+// so threads that finish early pick up the work of the delayed ones. All the
+// work is done as long as at least one thread keeps calling `next()`.
+struct work_stealing_scheduler_t {
+    work_stealing_scheduler_t(
+            dim_t work_amount, int nthr, dim_t chunks_per_thr = 4)
+        : work_amount_(work_amount)
+        , nthr_(nstl::max(nthr, 1))
+        , nchunks_(nstl::min(work_amount, nthr_ * chunks_per_thr))
+        , slots_(static_cast<slot_t *>(
+                         impl::malloc(nthr_ * sizeof(slot_t), alignof(slot_t))),
+                  impl::free) {
+        // operator new[] does not guarantee the alignment of over-aligned
+        // types before C++17, hence the explicit allocation.
+        assert(slots_);
+        for (int t = 0; t < nthr_; t++) {
+            dim_t start {0}, end {0};
+            balance211(nchunks_, nthr_, t, start, end);
+            slot_t *slot = new (&slots_.get()[t]) slot_t;
+            slot->next.store(start, std::memory_order_relaxed);
+            slot->end = end;
+        }
+    }
+
+    dim_t nchunks() const { return nchunks_; }
+
+    // Returns the index of the next chunk to process by thread `ithr`. The
+    // chunk covers the work items that balance211(work_amount, nchunks,
+    // ichunk) gives. Returns false when no chunks are left.
+    bool next_chunk(int ithr, dim_t &ichunk) {
+        for (int i = 0; i < nthr_; i++) {
+            slot_t &slot = slots_.get()[(ithr + i) % nthr_];
+            if (slot.next.load(std::memory_order_relaxed) >= slot.end)
+                continue;
+            ichunk = slot.next.fetch_add(1, std::memory_order_relaxed);
+            if (ichunk < slot.end) return true;
+        }
+        return false;
+    }
+
+    // Returns the next range of work items [start, end) to process by
+    // thread `ithr`. Returns false when no work is left.
+    bool next(int ithr, dim_t &start, dim_t &end) {
+        dim_t ichunk {0};
+        if (!next_chunk(ithr, ichunk)) return false;
+        balance211(work_amount_, nchunks_, ichunk, start, end);
+        return true;
+    }
+
+private:
+    // Counters take a cache line each to avoid false sharing between the
+    // owners. The type is trivially destructible, so the memory is freed
+    // without destroying the slots.
+    struct alignas(64) slot_t {
+        std::atomic<dim_t> next;
+        dim_t end;
+    };
+
+    dim_t work_amount_;
+    int nthr_;
+    dim_t nchunks_;
+    std::unique_ptr<slot_t, void (*)(void *)> slots_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(work_stealing_scheduler_t);
+};
+
 /* Functions:
  *  - parallel(nthr, f)                  - executes f in parallel using at
  *                                         most nthr threads. If nthr equals
@@ -266,6 +344,9 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *  - for_nd_ext(ithr, nthr, dims..., f) - multidimensional for loop for
  *                                         already created threads that passes
  *                                         ithr and nthr
+ *  - parallel_scheduled(nthr, work, f)  - executes f(ichunk, nchunks) for
+ *                                         all chunks of the work following
+ *                                         the current scheduling mode
  *  - parallel_nd(dims..., f)            - creates a parallel section and then
  *                                         calls for_nd
  *  - parallel_nd_ext(dims..., f)        - creates a parallel section and then
@@ -285,11 +366,25 @@ inline int adjust_num_threads(int nthr, dim_t work_amount) {
 #endif
 }
 
+// Runs a chunk of a parallel section and records it in the execution trace
+// under `trace_name` if it is not null (see common/trace.hpp).
+static inline void parallel_chunk(const std::function<void(int, int)> &f,
+        int ithr, int nthr, const char *trace_name) {
+    if (!trace_name) {
+        f(ithr, nthr);
+        return;
+    }
+    trace::scoped_event_t trace_event("parallel", trace_name, ithr, nthr);
+    f(ithr, nthr);
+}
+
 static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     nthr = adjust_num_threads(nthr, INT64_MAX);
+    const char *trace_name
+            = trace::is_enabled() ? trace::get_current_name() : nullptr;
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     for (int i = 0; i < nthr; ++i) {
-        f(i, nthr);
+        parallel_chunk(f, i, nthr, trace_name);
     }
 #else
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -297,7 +392,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     bool itt_enable = itt::get_itt(itt::__itt_task_level_high);
 #endif
     if (nthr == 1) {
-        f(0, 1);
+        parallel_chunk(f, 0, 1, trace_name);
         return;
     }
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
@@ -309,7 +404,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
 #if defined(DNNL_ENABLE_ITT_TASKS)
         if (ithr_ && itt_enable) itt::primitive_task_start(task_primitive_kind);
 #endif
-        f(ithr_, nthr_);
+        parallel_chunk(f, ithr_, nthr_, trace_name);
 #if defined(DNNL_ENABLE_ITT_TASKS)
         if (ithr_ && itt_enable) itt::primitive_task_end();
 #endif
@@ -324,7 +419,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
                 if (mark_task && itt_enable)
                     itt::primitive_task_start(task_primitive_kind);
 #endif
-                f(ithr, nthr);
+                parallel_chunk(f, ithr, nthr, trace_name);
 #if defined(DNNL_ENABLE_ITT_TASKS)
                 if (mark_task && itt_enable) itt::primitive_task_end();
 #endif
@@ -336,7 +431,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     if (!tp || dnnl_in_parallel()) {
         threadpool_utils::deactivate_threadpool();
         for (int ithr = 0; ithr < nthr; ithr++) {
-            f(ithr, nthr);
+            parallel_chunk(f, ithr, nthr, trace_name);
         }
         threadpool_utils::activate_threadpool(tp);
     } else {
@@ -352,7 +447,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
                 if (itt_enable) itt::primitive_task_start(task_primitive_kind);
 #endif
             }
-            f(ithr, nthr);
+            parallel_chunk(f, ithr, nthr, trace_name);
             if (!is_master) {
 #if defined(DNNL_ENABLE_ITT_TASKS)
                 if (itt_enable) itt::primitive_task_end();
@@ -367,6 +462,26 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
 #endif
 }
 
+// Executes `f(ichunk, nchunks)` for every chunk of `work_amount` items, where
+// the chunk is meant to be processed as for_nd(ichunk, nchunks, ...) does.
+// With the balanced scheduling this is `parallel(nthr, f)`. With the
+// work-stealing one, threads take the chunks from a work_stealing_scheduler_t,
+// so `f` must not rely on `ichunk` being the index of the calling thread.
+static inline void parallel_scheduled(int nthr, dim_t work_amount,
+        const std::function<void(int, int)> &f) {
+    if (nthr == 1 || get_scheduling() != dnnl_scheduling_work_stealing) {
+        parallel(nthr, f);
+        return;
+    }
+    work_stealing_scheduler_t scheduler(work_amount, nthr);
+    const int nchunks = (int)scheduler.nchunks();
+    parallel(nthr, [&](int ithr, int) {
+        dim_t ichunk {0};
+        while (scheduler.next_chunk(ithr, ichunk))
+            f((int)ichunk, nchunks);
+    });
+}
+
 // XXX: IMPORTANT!!!
 // Keep the functions below static.
 //
@@ -607,14 +722,15 @@ static inline void parallel_nd_ext(int nthr, dim_t D0, dim_t D1, dim_t D2,
 static inline void parallel_nd(dim_t D0, const std::function<void(dim_t)> &f) {
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), D0);
     if (nthr)
-        parallel(nthr, [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, f); });
+        parallel_scheduled(nthr, D0,
+                [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, f); });
 }
 static inline void parallel_nd(
         dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
     const dim_t work_amount = D0 * D1;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
-        parallel(nthr,
+        parallel_scheduled(nthr, work_amount,
                 [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, D1, f); });
 }
 static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2,
@@ -622,15 +738,16 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2,
     const dim_t work_amount = D0 * D1 * D2;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
-        parallel(nthr,
-                [&](int ithr, int nthr) { for_nd(ithr, nthr, D0, D1, D2, f); });
+        parallel_scheduled(nthr, work_amount, [&](int ithr, int nthr) {
+            for_nd(ithr, nthr, D0, D1, D2, f);
+        });
 }
 static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
         const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
     const dim_t work_amount = D0 * D1 * D2 * D3;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
-        parallel(nthr, [&](int ithr, int nthr) {
+        parallel_scheduled(nthr, work_amount, [&](int ithr, int nthr) {
             for_nd(ithr, nthr, D0, D1, D2, D3, f);
         });
 }
@@ -639,7 +756,7 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
     const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
-        parallel(nthr, [&](int ithr, int nthr) {
+        parallel_scheduled(nthr, work_amount, [&](int ithr, int nthr) {
             for_nd(ithr, nthr, D0, D1, D2, D3, D4, f);
         });
 }
@@ -650,7 +767,7 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
     const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
     int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
     if (nthr)
-        parallel(nthr, [&](int ithr, int nthr) {
+        parallel_scheduled(nthr, work_amount, [&](int ithr, int nthr) {
             for_nd(ithr, nthr, D0, D1, D2, D3, D4, D5, f);
         });
 }
@@ -25,6 +25,8 @@
 #include "bfloat16.hpp"
 #include "c_types_map.hpp"
 #include "float16.hpp"
+#include "float8.hpp"
+#include "int4.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
 #include "utils.hpp"
@@ -42,6 +44,26 @@ struct typesize_traits {}; /* ::data_type_size -> f32 */
 template <primitive_kind_t>
 struct pkind_traits {}; /* ::desc_type, ::query_d */
 
+template <>
+struct prec_traits<data_type::f8_e5m2> {
+    typedef float8_e5m2_t type;
+};
+template <>
+struct prec_traits<data_type::f8_e4m3> {
+    typedef float8_e4m3_t type;
+};
+template <>
+struct prec_traits<data_type::s4> {
+    typedef int4_t type;
+};
+template <>
+struct prec_traits<data_type::u4> {
+    typedef uint4_t type;
+};
+template <>
+struct prec_traits<data_type::nf4> {
+    typedef nf4_t type;
+};
 template <>
 struct prec_traits<data_type::f16> {
     typedef float16_t type;
@@ -71,6 +93,26 @@ struct prec_traits<data_type::u8> {
     typedef uint8_t type;
 };
 
+template <>
+struct data_traits<float8_e5m2_t> {
+    static constexpr data_type_t data_type = data_type::f8_e5m2;
+};
+template <>
+struct data_traits<float8_e4m3_t> {
+    static constexpr data_type_t data_type = data_type::f8_e4m3;
+};
+template <>
+struct data_traits<int4_t> {
+    static constexpr data_type_t data_type = data_type::s4;
+};
+template <>
+struct data_traits<uint4_t> {
+    static constexpr data_type_t data_type = data_type::u4;
+};
+template <>
+struct data_traits<nf4_t> {
+    static constexpr data_type_t data_type = data_type::nf4;
+};
 template <>
 struct data_traits<float16_t> {
     static constexpr data_type_t data_type = data_type::f16;
@@ -132,6 +174,9 @@ PKIND_TRAITS_INST(binary);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(sdpa);
+PKIND_TRAITS_INST(group_normalization);
+PKIND_TRAITS_INST(embedding_bag);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
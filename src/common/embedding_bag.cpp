@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_EB(cond, msg, ...) \
+    VCONDCHECK(create, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+namespace {
+status_t embedding_bag_desc_init(embedding_bag_desc_t *eb_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc) {
+    VCHECK_EB(!any_null(src_desc, indices_desc, dst_desc), VERBOSE_NULL_ARG);
+    VCHECK_EB(one_of(alg_kind, embedding_bag_gather, embedding_bag_sum,
+                      embedding_bag_mean),
+            VERBOSE_BAD_ALGORITHM);
+
+    auto ed = embedding_bag_desc_t();
+    ed.primitive_kind = primitive_kind::embedding_bag;
+    ed.alg_kind = alg_kind;
+    ed.src_desc = *src_desc;
+    ed.indices_desc = *indices_desc;
+    if (offsets_desc) ed.offsets_desc = *offsets_desc;
+    ed.dst_desc = *dst_desc;
+
+    // Gather produces a row per index, pooling needs the bag boundaries.
+    const bool is_gather = alg_kind == embedding_bag_gather;
+    const bool with_offsets = ed.offsets_desc.ndims != 0;
+    VCHECK_EB(is_gather != with_offsets, VERBOSE_BAD_PARAM, "offsets");
+
+    VCHECK_EB(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src", src_desc->ndims);
+    VCHECK_EB(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS, "indices",
+            indices_desc->ndims);
+    VCHECK_EB(IMPLICATION(with_offsets, ed.offsets_desc.ndims == 1),
+            VERBOSE_BAD_NDIMS, "offsets", ed.offsets_desc.ndims);
+    VCHECK_EB(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst", dst_desc->ndims);
+
+    VCHECK_EB(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+    VCHECK_EB(IMPLICATION(with_offsets,
+                      ed.offsets_desc.data_type == data_type::s32),
+            VERBOSE_INVALID_DATATYPE, "offsets");
+
+    for (auto md : {&ed.src_desc, &ed.indices_desc, &ed.offsets_desc,
+                 &ed.dst_desc})
+        VCHECK_EB(!memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // check: D, and the number of destination rows
+    VCHECK_EB(dst_desc->dims[1] == src_desc->dims[1], VERBOSE_INCONSISTENT_DIM,
+            "dst", 1, "src", 1);
+    VCHECK_EB(IMPLICATION(
+                      is_gather, dst_desc->dims[0] == indices_desc->dims[0]),
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "indices", 0);
+    VCHECK_EB(IMPLICATION(!is_gather,
+                      dst_desc->dims[0] == ed.offsets_desc.dims[0]),
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "offsets", 0);
+
+    *eb_desc = ed;
+    return success;
+}
+} // namespace
+
+status_t dnnl_embedding_bag_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+    auto eb_desc = embedding_bag_desc_t();
+    CHECK(embedding_bag_desc_init(&eb_desc, alg_kind, src_desc, indices_desc,
+            offsets_desc, dst_desc));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&eb_desc, nullptr, attr);
+}
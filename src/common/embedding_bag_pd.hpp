@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_PD_HPP
+#define COMMON_EMBEDDING_BAG_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct embedding_bag_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding_bag;
+
+    typedef embedding_bag_pd_t base_class;
+    typedef embedding_bag_pd_t hint_class;
+
+    const embedding_bag_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_INDICES))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_OFFSETS && with_offsets())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_INDICES: return src_md(1);
+            case DNNL_ARG_OFFSETS: return src_md(2);
+            case DNNL_ARG_DST: return dst_md(0);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(int index = 0) const override {
+        switch (index) {
+            case 0: return &src_md_;
+            case 1: return &indices_md_;
+            case 2: return with_offsets() ? &offsets_md_ : &glob_zero_md;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    const memory_desc_t *indices_md() const { return &indices_md_; }
+    const memory_desc_t *offsets_md() const { return &offsets_md_; }
+
+    int n_inputs() const override { return 2 + with_offsets(); }
+    int n_outputs() const override { return 1; }
+
+    bool with_offsets() const {
+        return !memory_desc_wrapper(offsets_md_).is_zero();
+    }
+    bool is_gather() const {
+        return desc_.alg_kind == alg_kind::embedding_bag_gather;
+    }
+    bool is_mean() const {
+        return desc_.alg_kind == alg_kind::embedding_bag_mean;
+    }
+    // Source scales are either common or per table row.
+    bool with_per_row_scales() const {
+        const auto &s = attr()->scales_.get(DNNL_ARG_SRC);
+        return !s.has_default_values() && s.mask_ != 0;
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md_).has_zero_dim();
+    }
+    // The number of rows in the table.
+    dim_t rows() const { return src_md_.dims[0]; }
+    // The length of the embedding vectors.
+    dim_t D() const { return src_md_.dims[1]; }
+    dim_t n_indices() const { return indices_md_.dims[0]; }
+    // The number of destination rows, a bag per index for gather.
+    dim_t n_bags() const { return dst_md_.dims[0]; }
+
+protected:
+    embedding_bag_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t indices_md_;
+    memory_desc_t offsets_md_;
+    memory_desc_t dst_md_;
+
+    embedding_bag_pd_t(const embedding_bag_desc_t *adesc,
+            const primitive_attr_t *attr, const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , indices_md_(desc_.indices_desc)
+        , offsets_md_(desc_.offsets_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    // Initializes the memory descriptors with `any` format with plain
+    // layouts.
+    status_t set_default_params() {
+        for (auto md : {&src_md_, &indices_md_, &dst_md_})
+            if (md->format_kind == format_kind::any)
+                CHECK(memory_desc_init_by_strides(*md, nullptr));
+        if (with_offsets() && offsets_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(offsets_md_, nullptr));
+        return status::success;
+    }
+
+    // Only source scales are supported, either a common value or a value per
+    // table row.
+    bool attr_scales_ok() const {
+        const auto &scales = attr()->scales_;
+        if (!scales.has_default_values({DNNL_ARG_SRC})) return false;
+        const auto &s = scales.get(DNNL_ARG_SRC);
+        return s.has_default_values()
+                || (utils::one_of(s.mask_, 0, 1 << 0)
+                        && s.has_default_groups()
+                        && s.has_default_data_type());
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
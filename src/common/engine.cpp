@@ -90,6 +90,76 @@ status_t dnnl_engine_create(
     return ef->engine_create(engine, index);
 }
 
+size_t dnnl_engine_get_numa_node_count(engine_kind_t kind) {
+    using namespace dnnl::impl;
+    auto ef = get_engine_factory(kind, get_default_runtime(kind));
+    return ef != nullptr ? ef->numa_node_count() : 0;
+}
+
+status_t dnnl_engine_create_on_numa_node(
+        engine_t **engine, engine_kind_t kind, size_t index, int numa_node) {
+    using namespace dnnl::impl;
+    if (engine == nullptr) return invalid_arguments;
+
+    auto ef = get_engine_factory(kind, get_default_runtime(kind));
+    if (ef == nullptr || index >= ef->count()) return invalid_arguments;
+
+    return ef->engine_create_on_numa_node(engine, index, numa_node);
+}
+
+status_t dnnl_engine_get_numa_node(engine_t *engine, int *numa_node) {
+    using namespace dnnl::impl;
+    if (any_null(engine, numa_node)) return invalid_arguments;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    *numa_node = cpu::get_numa_node(engine);
+#else
+    *numa_node = -1;
+#endif
+    return success;
+}
+
+status_t dnnl_engine_set_scratchpad_pool_capacity(
+        engine_t *engine, size_t capacity) {
+    using namespace dnnl::impl;
+    if (engine == nullptr) return invalid_arguments;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    auto *pool = cpu::get_scratchpad_pool(engine);
+    if (pool == nullptr) return unimplemented;
+    pool->set_capacity(capacity);
+    return success;
+#else
+    return unimplemented;
+#endif
+}
+
+status_t dnnl_engine_get_scratchpad_pool_capacity(
+        engine_t *engine, size_t *capacity) {
+    using namespace dnnl::impl;
+    if (any_null(engine, capacity)) return invalid_arguments;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    auto *pool = cpu::get_scratchpad_pool(engine);
+    if (pool == nullptr) return unimplemented;
+    *capacity = pool->capacity();
+    return success;
+#else
+    return unimplemented;
+#endif
+}
+
+status_t dnnl_engine_get_scratchpad_pool_stats(
+        engine_t *engine, dnnl_scratchpad_pool_stats_t *stats) {
+    using namespace dnnl::impl;
+    if (any_null(engine, stats)) return invalid_arguments;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    auto *pool = cpu::get_scratchpad_pool(engine);
+    if (pool == nullptr) return unimplemented;
+    *stats = pool->stats();
+    return success;
+#else
+    return unimplemented;
+#endif
+}
+
 status_t dnnl_engine_get_kind(engine_t *engine, engine_kind_t *kind) {
     using namespace dnnl::impl;
     if (engine == nullptr) return invalid_arguments;
@@ -184,6 +184,12 @@ inline runtime_kind_t get_cpu_native_runtime() {
 struct engine_factory_t : public c_compatible {
     virtual size_t count() const = 0;
     virtual status_t engine_create(engine_t **engine, size_t index) const = 0;
+    // NUMA binding is supported by native CPU engines only.
+    virtual int numa_node_count() const { return 0; }
+    virtual status_t engine_create_on_numa_node(
+            engine_t **engine, size_t index, int numa_node) const {
+        return status::unimplemented;
+    }
     virtual ~engine_factory_t() = default;
 };
 
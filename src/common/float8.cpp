@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/bit_cast.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float8.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// Describes the encoding of an 8-bit floating point format. Both supported
+// formats share the conversion routines below and differ only in the number
+// of exponent and mantissa bits and in the treatment of the all-ones
+// exponent.
+template <int exp_bits, int mant_bits, bool has_inf>
+struct f8_format_t {
+    static constexpr int bias = (1 << (exp_bits - 1)) - 1;
+    static constexpr uint32_t mant_mask = (1u << mant_bits) - 1;
+    static constexpr uint32_t exp_mask = (1u << exp_bits) - 1;
+    // The largest magnitude encoding that is a finite number.
+    static constexpr uint32_t max_finite
+            = has_inf ? ((exp_mask - 1) << mant_bits) | mant_mask
+                      : (exp_mask << mant_bits) | (mant_mask - 1);
+    static constexpr uint32_t inf = exp_mask << mant_bits;
+    static constexpr uint32_t nan = has_inf
+            ? (exp_mask << mant_bits) | (1u << (mant_bits - 1))
+            : (exp_mask << mant_bits) | mant_mask;
+
+    static uint8_t from_float(float f) {
+        const uint32_t i = utils::bit_cast<uint32_t>(f);
+        const uint32_t sign = (i >> 24) & 0x80;
+        const uint32_t abs = i & 0x7FFFFFFF;
+
+        if (abs > 0x7F800000) return sign | nan;
+        if (abs == 0x7F800000) return sign | (has_inf ? inf : nan);
+
+        const int e = (int)(abs >> 23) - 127;
+        // Float denormals are far below the smallest f8 denormal.
+        if ((abs >> 23) == 0) return sign;
+
+        // The float mantissa with the implicit leading one.
+        const uint32_t m = (abs & 0x7FFFFF) | 0x800000;
+
+        uint32_t shift = 0;
+        uint32_t base = 0;
+        if (e < 1 - bias) {
+            // The result is denormal (or zero): the f8 mantissa is the float
+            // mantissa shifted to the denormal unit 2^(1 - bias - mant_bits).
+            shift = (uint32_t)(23 + (1 - bias - mant_bits) - e);
+            if (shift > 24) return sign;
+        } else {
+            if (e + bias > (int)exp_mask) return sign | (has_inf ? inf : nan);
+            shift = 23 - mant_bits;
+            base = (uint32_t)(e + bias) << mant_bits;
+        }
+
+        // Round to nearest even. A carry out of the mantissa correctly
+        // increments the exponent, also when going from denormal to normal.
+        const uint32_t rem = m & ((1u << shift) - 1);
+        const uint32_t half = 1u << (shift - 1);
+        // For normal results the leading one is encoded by the exponent.
+        uint32_t r = (m >> shift) + (base ? base - (1u << mant_bits) : 0);
+        if (rem > half || (rem == half && (r & 1))) r++;
+
+        if (r > max_finite) return sign | (has_inf ? inf : nan);
+        return sign | r;
+    }
+
+    static float to_float(uint8_t raw) {
+        const uint32_t sign = (uint32_t)(raw & 0x80) << 24;
+        const uint32_t e = (raw >> mant_bits) & exp_mask;
+        const uint32_t m = raw & mant_mask;
+
+        if (has_inf && e == exp_mask) {
+            const uint32_t f = sign | 0x7F800000 | (m ? 0x400000 : 0);
+            return utils::bit_cast<float>(f);
+        }
+        if (!has_inf && e == exp_mask && m == mant_mask)
+            return utils::bit_cast<float>(sign | 0x7FC00000);
+        if (e == 0) {
+            const float v = std::scalbn((float)m, 1 - bias - mant_bits);
+            return sign ? -v : v;
+        }
+
+        const uint32_t f = sign | ((e - bias + 127) << 23)
+                | (m << (23 - mant_bits));
+        return utils::bit_cast<float>(f);
+    }
+};
+
+using e5m2_format_t = f8_format_t<5, 2, true>;
+using e4m3_format_t = f8_format_t<4, 3, false>;
+
+} // namespace
+
+float8_e5m2_t &float8_e5m2_t::operator=(float f) {
+    raw = e5m2_format_t::from_float(f);
+    return *this;
+}
+
+float8_e5m2_t::operator float() const {
+    return e5m2_format_t::to_float(raw);
+}
+
+float8_e4m3_t &float8_e4m3_t::operator=(float f) {
+    raw = e4m3_format_t::from_float(f);
+    return *this;
+}
+
+float8_e4m3_t::operator float() const {
+    return e4m3_format_t::to_float(raw);
+}
+
+void cvt_float_to_float8_e5m2(
+        float8_e5m2_t *out, const float *inp, size_t nelems) {
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = static_cast<float8_e5m2_t>(inp[i]);
+}
+
+void cvt_float8_e5m2_to_float(
+        float *out, const float8_e5m2_t *inp, size_t nelems) {
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = inp[i];
+}
+
+void cvt_float_to_float8_e4m3(
+        float8_e4m3_t *out, const float *inp, size_t nelems) {
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = static_cast<float8_e4m3_t>(inp[i]);
+}
+
+void cvt_float8_e4m3_to_float(
+        float *out, const float8_e4m3_t *inp, size_t nelems) {
+    PRAGMA_OMP_SIMD()
+    for (size_t i = 0; i < nelems; ++i)
+        out[i] = inp[i];
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_FLOAT8_HPP
+#define COMMON_FLOAT8_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dnnl {
+namespace impl {
+
+// 8-bit floating point with 1 sign bit, 5 exponent bits and 2 mantissa bits.
+// Follows IEEE-754 conventions: the exponent bias is 15, infinities and NaNs
+// are encoded with the all-ones exponent. Conversion from float rounds to
+// nearest even; values beyond the largest finite number become infinities.
+struct float8_e5m2_t {
+    uint8_t raw;
+
+    constexpr float8_e5m2_t(uint8_t raw, bool) : raw(raw) {}
+
+    float8_e5m2_t() = default;
+    float8_e5m2_t(float f) { (*this) = f; }
+
+    float8_e5m2_t &operator=(float f);
+
+    operator float() const;
+    float f() { return (float)(*this); }
+};
+
+static_assert(sizeof(float8_e5m2_t) == 1, "float8_e5m2_t must be 1 byte");
+
+// 8-bit floating point with 1 sign bit, 4 exponent bits and 3 mantissa bits.
+// The exponent bias is 7. There are no infinities and the only NaN encodings
+// are S.1111.111, which extends the largest finite number to 448. Conversion
+// from float rounds to nearest even; infinities and values beyond the largest
+// finite number become NaNs.
+struct float8_e4m3_t {
+    uint8_t raw;
+
+    constexpr float8_e4m3_t(uint8_t raw, bool) : raw(raw) {}
+
+    float8_e4m3_t() = default;
+    float8_e4m3_t(float f) { (*this) = f; }
+
+    float8_e4m3_t &operator=(float f);
+
+    operator float() const;
+    float f() { return (float)(*this); }
+};
+
+static_assert(sizeof(float8_e4m3_t) == 1, "float8_e4m3_t must be 1 byte");
+
+void cvt_float_to_float8_e5m2(
+        float8_e5m2_t *out, const float *inp, size_t nelems);
+void cvt_float8_e5m2_to_float(
+        float *out, const float8_e5m2_t *inp, size_t nelems);
+void cvt_float_to_float8_e4m3(
+        float8_e4m3_t *out, const float *inp, size_t nelems);
+void cvt_float8_e4m3_to_float(
+        float *out, const float8_e4m3_t *inp, size_t nelems);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::prop_kind;
+using namespace dnnl::impl::types;
+
+#define VCHECK_GNORM(cond, msg, ...) \
+    VCONDCHECK(create, check, gnorm, (cond), status::invalid_arguments, msg, \
+            ##__VA_ARGS__);
+
+namespace {
+status_t gnorm_desc_init(group_normalization_desc_t *gnorm_desc,
+        prop_kind_t prop_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, dim_t groups, float epsilon,
+        unsigned flags) {
+    VCHECK_GNORM(!any_null(gnorm_desc, src_desc, dst_desc), VERBOSE_NULL_ARG);
+    VCHECK_GNORM(2 <= src_desc->ndims && src_desc->ndims <= 5,
+            VERBOSE_BAD_NDIMS, "src", src_desc->ndims);
+
+    VCHECK_GNORM((flags
+                         & ~(normalization_flags::use_global_stats
+                                 | normalization_flags::use_scale
+                                 | normalization_flags::use_shift))
+                    == 0,
+            VERBOSE_BAD_FLAGS);
+
+    const dim_t C = src_desc->dims[1];
+    VCHECK_GNORM(groups > 0 && C % groups == 0, VERBOSE_BAD_PARAM, "groups");
+    VCHECK_GNORM(!memory_desc_wrapper(src_desc).format_any(),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+
+    const bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides();
+    VCONDCHECK(create, check, gnorm, !runtime_dims_or_strides,
+            status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    VCHECK_GNORM(src_desc->ndims == dst_desc->ndims,
+            VERBOSE_INCONSISTENT_NDIMS, "src", "dst");
+    VCHECK_GNORM(array_cmp(src_desc->dims, dst_desc->dims, src_desc->ndims),
+            VERBOSE_INCONSISTENT_DIM, "src", -1, "dst", -1);
+
+    auto gd = group_normalization_desc_t();
+    gd.primitive_kind = primitive_kind::group_normalization;
+    gd.prop_kind = prop_kind;
+    gd.src_desc = *src_desc;
+    gd.dst_desc = *dst_desc;
+
+    dims_t stat_dims = {src_desc->dims[0], groups};
+    VCHECK_GNORM(memory_desc_init_by_tag(gd.stat_desc, 2, stat_dims,
+                         data_type::f32, format_tag::any)
+                    == success,
+            VERBOSE_UNSUPPORTED_TAG_S, "stats");
+
+    gd.scaleshift_desc = zero_md();
+    if (flags
+            & (normalization_flags::use_scale
+                    | normalization_flags::use_shift)) {
+        dims_t scaleshift_dims = {C};
+        memory_desc_init_by_tag(gd.scaleshift_desc, 1, scaleshift_dims,
+                data_type::f32, dnnl_x);
+    }
+
+    gd.groups = groups;
+    gd.group_norm_epsilon = epsilon;
+    gd.flags = flags;
+
+    *gnorm_desc = gd;
+    return success;
+}
+} // namespace
+
+status_t dnnl_group_normalization_forward_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        prop_kind_t prop_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, dim_t groups, float epsilon,
+        unsigned flags, const primitive_attr_t *attr) {
+    if (!one_of(prop_kind, forward_training, forward_inference))
+        return invalid_arguments;
+
+    auto gnorm_desc = group_normalization_desc_t();
+    CHECK(gnorm_desc_init(&gnorm_desc, prop_kind, src_desc, dst_desc, groups,
+            epsilon, flags));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&gnorm_desc, nullptr, attr);
+}
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/int4.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+uint8_t saturate_and_round(float f, float lo, float hi) {
+    // NaN goes to zero as it happens for the 8-bit integer types.
+    if (!(f == f)) return 0;
+    f = f < lo ? lo : (f > hi ? hi : f);
+    return (uint8_t)((int)std::nearbyint(f) & 0xf);
+}
+} // namespace
+
+uint4_t &uint4_t::operator=(float f) {
+    raw_bits_ = saturate_and_round(f, 0.f, 15.f);
+    return *this;
+}
+
+int4_t &int4_t::operator=(float f) {
+    raw_bits_ = saturate_and_round(f, -8.f, 7.f);
+    return *this;
+}
+
+const float nf4_t::lut[16] = {-1.0f, -0.6961928009986877f, -0.5250730514526367f,
+        -0.39491748809814453f, -0.28444138169288635f, -0.18477343022823334f,
+        -0.09105003625154495f, 0.0f, 0.07958029955625534f, 0.16093020141124725f,
+        0.24611230194568634f, 0.33791524171829224f, 0.44070982933044434f,
+        0.5626170039176941f, 0.7229568362236023f, 1.0f};
+
+nf4_t &nf4_t::operator=(float f) {
+    // The table is sorted, so the nearest value is the first one which is
+    // closer to `f` than its successor.
+    // NaN goes to zero.
+    if (!(f == f)) {
+        raw_bits_ = 7;
+        return *this;
+    }
+
+    uint8_t idx = 0;
+    while (idx < 15 && std::fabs(f - lut[idx + 1]) <= std::fabs(f - lut[idx]))
+        idx++;
+    raw_bits_ = idx;
+    return *this;
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_INT4_HPP
+#define COMMON_INT4_HPP
+
+#include <cstdint>
+
+namespace dnnl {
+namespace impl {
+
+// 4-bit values are stored in pairs: the element with an even offset occupies
+// the low half of a byte and the next element occupies the high half.
+enum class int4_extract_t : uint8_t { low_half = 0, high_half = 4 };
+
+inline int4_extract_t int4_half(int64_t off) {
+    return off % 2 ? int4_extract_t::high_half : int4_extract_t::low_half;
+}
+
+// The types below represent a single unpacked 4-bit value kept in the low half
+// of `raw_bits_`. Use extract() and insert() to access packed data.
+
+// 4-bit unsigned integer. Conversion from float rounds to nearest and
+// saturates to [0, 15].
+struct uint4_t {
+    uint8_t raw_bits_;
+
+    constexpr uint4_t(uint8_t raw_bits, bool) : raw_bits_(raw_bits) {}
+
+    uint4_t() = default;
+    uint4_t(float f) { (*this) = f; }
+
+    uint4_t &operator=(float f);
+
+    operator float() const { return (float)raw_bits_; }
+
+    static uint4_t extract(uint8_t val, int4_extract_t half) {
+        return uint4_t((uint8_t)((val >> (uint8_t)half) & 0xf), true);
+    }
+
+    uint8_t insert(uint8_t dst, int4_extract_t half) const {
+        const uint8_t shift = (uint8_t)half;
+        return (uint8_t)((dst & ~(0xf << shift)) | ((raw_bits_ & 0xf) << shift));
+    }
+};
+
+// 4-bit signed integer. Conversion from float rounds to nearest and saturates
+// to [-8, 7].
+struct int4_t {
+    uint8_t raw_bits_;
+
+    constexpr int4_t(uint8_t raw_bits, bool) : raw_bits_(raw_bits) {}
+
+    int4_t() = default;
+    int4_t(float f) { (*this) = f; }
+
+    int4_t &operator=(float f);
+
+    operator float() const {
+        // Sign-extend the 4-bit value.
+        return (float)((int8_t)(raw_bits_ << 4) >> 4);
+    }
+
+    static int4_t extract(uint8_t val, int4_extract_t half) {
+        return int4_t((uint8_t)((val >> (uint8_t)half) & 0xf), true);
+    }
+
+    uint8_t insert(uint8_t dst, int4_extract_t half) const {
+        const uint8_t shift = (uint8_t)half;
+        return (uint8_t)((dst & ~(0xf << shift)) | ((raw_bits_ & 0xf) << shift));
+    }
+};
+
+// 4-bit NormalFloat: an index into a table of 16 values in [-1, 1] that are
+// the quantiles of the normal distribution. Conversion from float picks the
+// nearest table value.
+struct nf4_t {
+    uint8_t raw_bits_;
+
+    constexpr nf4_t(uint8_t raw_bits, bool) : raw_bits_(raw_bits) {}
+
+    nf4_t() = default;
+    nf4_t(float f) { (*this) = f; }
+
+    nf4_t &operator=(float f);
+
+    operator float() const { return lut[raw_bits_ & 0xf]; }
+
+    static nf4_t extract(uint8_t val, int4_extract_t half) {
+        return nf4_t((uint8_t)((val >> (uint8_t)half) & 0xf), true);
+    }
+
+    uint8_t insert(uint8_t dst, int4_extract_t half) const {
+        const uint8_t shift = (uint8_t)half;
+        return (uint8_t)((dst & ~(0xf << shift)) | ((raw_bits_ & 0xf) << shift));
+    }
+
+    // The table of values in ascending order, used by jit kernels as well.
+    static const float lut[16];
+};
+
+static_assert(sizeof(uint4_t) == 1, "uint4_t must be 1 byte");
+static_assert(sizeof(int4_t) == 1, "int4_t must be 1 byte");
+static_assert(sizeof(nf4_t) == 1, "nf4_t must be 1 byte");
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
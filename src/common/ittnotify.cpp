@@ -78,6 +78,9 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(prelu),
             CASE(softmax),
             CASE(layer_normalization),
+            CASE(sdpa),
+            CASE(group_normalization),
+            CASE(embedding_bag),
     };
 #undef CASE
     int kind_idx = (int)kind;
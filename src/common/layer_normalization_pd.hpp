@@ -75,6 +75,10 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & normalization_flags::use_global_stats;
     }
+    // RMS normalization assumes zero mean, hence the mean is not used.
+    bool use_rms_norm() const {
+        return desc_.flags & normalization_flags::rms_norm;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -91,6 +95,9 @@ struct layer_normalization_pd_t : public primitive_desc_t {
 
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
+    // Number of statistics tensors: mean and variance, or variance only.
+    int n_stats() const { return use_rms_norm() ? 1 : 2; }
+
 protected:
     layer_normalization_desc_t desc_;
     const layer_normalization_fwd_pd_t *hint_fwd_pd_;
@@ -156,6 +163,8 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_MEAN && use_rms_norm()) return arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_are_src()) return arg_usage_t::input;
             if (!stats_are_src() && is_training()) return arg_usage_t::output;
@@ -183,12 +192,14 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
 
     const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &src_md_;
+        if (index == 1 && use_rms_norm()) return &glob_zero_md;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
         return &glob_zero_md;
     }
 
     const memory_desc_t *dst_md(int index = 0) const override {
         if (index == 0) return &dst_md_;
+        if (index == 1 && use_rms_norm()) return &glob_zero_md;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
         return &glob_zero_md;
@@ -199,10 +210,10 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scale() + use_shift();
+        return 1 + n_stats() * stats_are_src() + use_scale() + use_shift();
     }
     int n_outputs() const override {
-        return 1 + 2 * (!stats_are_src()) * is_training();
+        return 1 + n_stats() * (!stats_are_src()) * is_training();
     }
 
 protected:
@@ -242,6 +253,8 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     typedef layer_normalization_fwd_pd_t hint_class;
 
     arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_MEAN && use_rms_norm()) return arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE,
                     DNNL_ARG_DIFF_DST))
             return arg_usage_t::input;
@@ -275,6 +288,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     }
 
     const memory_desc_t *src_md(int index = 0) const override {
+        if (index == 1 && use_rms_norm()) return &glob_zero_md;
         return index == 0 ? &src_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
     }
     const memory_desc_t *diff_dst_md(int index = 0) const override {
@@ -291,7 +305,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_scaleshift_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 4 + use_scale() + use_shift(); }
+    int n_inputs() const override {
+        return 2 + n_stats() + use_scale() + use_shift();
+    }
     int n_outputs() const override {
         return 1
                 + (desc_.prop_kind == prop_kind::backward)
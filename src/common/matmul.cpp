@@ -21,6 +21,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -48,6 +49,41 @@ status_t dnnl_matmul_primitive_desc_create(
     op_d.dst_desc = *dst_md;
 
     const bool with_bias = op_d.bias_desc.ndims != 0;
+
+    // A dynamically quantized source is multiplied in its quantized data type.
+    const data_type_t src_acc_dt
+            = attr && attr->src_dyn_quant_dt_ != data_type::undef
+            ? attr->src_dyn_quant_dt_
+            : src_md->data_type;
+
+    // A grouped source stacks the rows of all groups, and the weights hold a
+    // matrix per group: the source is {M, K}, the weights are {G, K, N} and
+    // the destination is {M, N}.
+    const memory_desc_wrapper src_d(src_md);
+    if (src_d.is_grouped_desc()) {
+        VCHECK_MATMUL(dst_md->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+                dst_md->ndims);
+        VCHECK_MATMUL(weights_md->ndims == 3, VERBOSE_BAD_NDIMS, "weights",
+                weights_md->ndims);
+        VCHECK_MATMUL(!with_bias, VERBOSE_UNSUPPORTED_BIAS_CFG);
+        VCHECK_MATMUL(weights_md->dims[0] == src_d.ngroups(), VERBOSE_BAD_DIM,
+                "weights", 0);
+        VCHECK_MATMUL(dst_md->dims[0] == src_md->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+        VCHECK_MATMUL(dst_md->dims[1] == weights_md->dims[2],
+                VERBOSE_INCONSISTENT_DIM, "dst", 1, "weights", 2);
+        VCHECK_MATMUL(src_md->dims[1] == weights_md->dims[1],
+                VERBOSE_INCONSISTENT_DIM, "src", 1, "weights", 1);
+
+        op_d.accum_data_type = types::default_accum_data_type(src_acc_dt,
+                weights_md->data_type, dst_md->data_type, prop_kind::forward);
+        VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
+                VERBOSE_INVALID_DATATYPE, "accumulation");
+
+        return primitive_desc_create(primitive_desc_iface, engine,
+                (const op_desc_t *)&op_d, nullptr, attr);
+    }
+
     const int ndims = dst_md->ndims;
     VCHECK_MATMUL(ndims >= 2 && ndims <= DNNL_MAX_NDIMS, VERBOSE_BAD_NDIMS,
             "dst", ndims);
@@ -107,7 +143,7 @@ status_t dnnl_matmul_primitive_desc_create(
         }
     }
 
-    op_d.accum_data_type = types::default_accum_data_type(src_md->data_type,
+    op_d.accum_data_type = types::default_accum_data_type(src_acc_dt,
             weights_md->data_type, dst_md->data_type, prop_kind::forward);
     VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
             VERBOSE_INVALID_DATATYPE, "accumulation");
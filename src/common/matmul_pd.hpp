@@ -23,6 +23,7 @@
 
 #include "c_types_map.hpp"
 #include "primitive_desc.hpp"
+#include "type_helpers.hpp"
 #include "utils.hpp"
 
 namespace dnnl {
@@ -127,9 +128,15 @@ struct matmul_pd_t : public primitive_desc_t {
         bool ok = attr()->scales_.has_default_values(supported_args);
         for (int arg : supported_args) {
             const auto &mask = attr()->scales_.get(arg).mask_;
-            if (arg == DNNL_ARG_WEIGHTS)
-                ok = ok && (mask == 0 || mask == (1 << (dst_md()->ndims - 1)));
-            else
+            if (arg == DNNL_ARG_WEIGHTS) {
+                const int n_mask = 1 << (dst_md()->ndims - 1);
+                const int k_mask = 1 << (dst_md()->ndims - 2);
+                // Scales of compressed weights may vary along K as well.
+                if (types::is_4bit(weights_md()->data_type))
+                    ok = ok && (mask & ~(n_mask | k_mask)) == 0;
+                else
+                    ok = ok && (mask == 0 || mask == n_mask);
+            } else
                 ok = ok && (mask == 0);
         }
         return ok;
@@ -72,7 +72,7 @@ size_t memory_desc_map_size(const memory_desc_t *md, int index = 0) {
 dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
         const dnnl::impl::memory_desc_t *md, const std::vector<unsigned> &flags,
         const std::vector<void *> &handles)
-    : engine_(engine), md_(*md) {
+    : engine_(engine), md_(*md), id_(next_id()) {
 
     const size_t nhandles = handles.size();
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> mem_storages(
@@ -92,16 +92,22 @@ dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
 dnnl_memory::dnnl_memory(dnnl::impl::engine_t *engine,
         const dnnl::impl::memory_desc_t *md,
         std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage)
-    : engine_(engine), md_(*md) {
+    : engine_(engine), md_(*md), id_(next_id()) {
     this->reset_memory_storage(std::move(memory_storage));
 }
 
+uint64_t dnnl_memory::next_id() {
+    static std::atomic<uint64_t> counter {0};
+    return ++counter;
+}
+
 status_t dnnl_memory::set_data_handle(void *handle, int index) const {
     using namespace dnnl::impl;
     void *old_handle;
     CHECK(memory_storage(index)->get_data_handle(&old_handle));
     if (handle != old_handle) {
         CHECK(memory_storage(index)->set_data_handle(handle));
+        id_ = next_id();
     }
     return status::success;
 }
@@ -124,6 +130,7 @@ status_t dnnl_memory::reset_memory_storage(
         else
             memory_storages_[0].reset(memory_storage_ptr);
     }
+    id_ = next_id();
 
     return status::success;
 }
@@ -18,6 +18,7 @@
 #define COMMON_MEMORY_HPP
 
 #include <assert.h>
+#include <atomic>
 #include <memory>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -87,6 +88,11 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
 
     size_t get_num_handles() const { return memory_storages_.size(); }
 
+    /** returns an identifier of the memory object and its data handles, a new
+     * one is assigned on creation and whenever a data handle changes, so the
+     * identifiers are never reused within the process */
+    uint64_t id() const { return id_; }
+
 protected:
     dnnl::impl::engine_t *engine_;
     const dnnl::impl::memory_desc_t md_;
@@ -95,8 +101,11 @@ private:
     dnnl_memory() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_memory);
 
+    static uint64_t next_id();
+
     // Number of storages is larger than 1 only for sparse memory.
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> memory_storages_;
+    mutable std::atomic<uint64_t> id_;
 };
 
 #endif
@@ -141,6 +141,80 @@ status_t memory_desc_init_by_csr_encoding(memory_desc_t &memory_desc, int ndims,
     return success;
 }
 
+status_t memory_desc_init_by_bsr_encoding(memory_desc_t &memory_desc, int ndims,
+        const dims_t dims, data_type_t data_type, const dims_t block_dims,
+        dim_t nnz, data_type_t indices_dt, data_type_t pointers_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // This is the only number of dims that is supported at this point.
+    if (ndims > 2) return unimplemented;
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    if (!args_ok || ndims != sparse_desc_t::max_block_ndims)
+        return invalid_arguments;
+
+    // The tensor must consist of whole blocks.
+    dim_t nblocks = 1;
+    for (int d = 0; d < ndims; d++) {
+        if (block_dims[d] <= 0 || dims[d] % block_dims[d] != 0)
+            return invalid_arguments;
+        nblocks *= dims[d] / block_dims[d];
+    }
+    if (nnz < 0 || nnz > nblocks) return invalid_arguments;
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::bsr;
+    md.format_desc.sparse_desc.nnz = nnz;
+    md.format_desc.sparse_desc.metadata_types[0] = indices_dt;
+    md.format_desc.sparse_desc.metadata_types[1] = pointers_dt;
+    array_copy(md.format_desc.sparse_desc.block_dims, block_dims, ndims);
+
+    memory_desc = md;
+
+    return success;
+}
+
+status_t memory_desc_init_by_grouped_encoding(memory_desc_t &memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, dim_t ngroups,
+        data_type_t offsets_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // Groups split the rows of a matrix.
+    if (ndims > 2) return unimplemented;
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    if (!args_ok || ndims != 2 || ngroups <= 0) return invalid_arguments;
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::grouped;
+    // All the values are stored.
+    md.format_desc.sparse_desc.nnz = dims[0] * dims[1];
+    md.format_desc.sparse_desc.metadata_types[0] = offsets_dt;
+    md.format_desc.sparse_desc.ngroups = ngroups;
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_submemory(memory_desc_t &memory_desc,
         const memory_desc_t &parent_memory_desc, const dims_t dims,
         const dims_t offsets) {
@@ -547,6 +621,33 @@ status_t dnnl_memory_desc_create_with_csr_encoding(memory_desc_t **memory_desc,
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_bsr_encoding(memory_desc_t **memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type,
+        const dims_t block_dims, dim_t nnz, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (any_null(memory_desc, block_dims)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_bsr_encoding(*md, ndims, dims, data_type,
+            block_dims, nnz, indices_dt, pointers_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
+status_t dnnl_memory_desc_create_with_grouped_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, dim_t ngroups, data_type_t offsets_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_grouped_encoding(
+            *md, ndims, dims, data_type, ngroups, offsets_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_submemory(memory_desc_t **memory_desc,
         const memory_desc_t *parent_memory_desc, const dims_t dims,
         const dims_t offsets) {
@@ -674,7 +775,9 @@ status_t dnnl_memory_desc_query_v2(
         case query::num_handles_s32:
             if (is_sparse) {
                 switch (md->format_desc.sparse_desc.encoding) {
-                    case sparse_encoding::csr: *(int *)result = 3; break;
+                    case sparse_encoding::csr:
+                    case sparse_encoding::bsr: *(int *)result = 3; break;
+                    case sparse_encoding::grouped: *(int *)result = 2; break;
                     default: assert(!"unknown encoding"); *(int *)result = 0;
                 }
             } else
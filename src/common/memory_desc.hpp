@@ -137,14 +137,21 @@ struct rnn_packed_desc_t {
 
 struct sparse_desc_t {
     static constexpr int max_metadata_types = 2;
+    static constexpr int max_block_ndims = 2;
     // Sparse encoding.
     sparse_encoding_t encoding;
-    // Number of non-zero entries.
+    // Number of non-zero entries. For block encodings it is the number of
+    // non-zero blocks.
     dnnl_dim_t nnz;
     // Metadata types. Each encoding defines how to interpret these.
-    // - CSR: 0th - index data type
-    //        1st - pointer data type
+    // - CSR, BSR: 0th - index data type
+    //             1st - pointer data type
+    // - grouped:  0th - offset data type
     dnnl_data_type_t metadata_types[max_metadata_types];
+    // Block dimensions for block encodings (BSR), zeros otherwise.
+    dnnl_dim_t block_dims[max_block_ndims];
+    // Number of groups for grouped encoding, zero otherwise.
+    dnnl_dim_t ngroups;
 };
 
 // Description of extra information stored in memory
@@ -58,6 +58,9 @@ struct memory_desc_wrapper : public c_compatible {
         return format_kind() == format_kind::rnn_packed;
     }
     bool is_sparse_desc() const { return format_kind() == format_kind::sparse; }
+    bool is_grouped_desc() const {
+        return is_sparse_desc() && encoding() == sparse_encoding::grouped;
+    }
 
     const blocking_desc_t &blocking_desc() const {
         assert(is_blocking_desc());
@@ -92,6 +95,11 @@ struct memory_desc_wrapper : public c_compatible {
         return sparse_desc().nnz;
     }
 
+    dim_t ngroups() const {
+        assert(is_grouped_desc());
+        return sparse_desc().ngroups;
+    }
+
     const memory_extra_desc_t &extra() const { return md_->extra; }
 
     /* some useful function */
@@ -229,6 +237,9 @@ struct memory_desc_wrapper : public c_compatible {
             }
 
             size_t data_size = max_size * data_type_size();
+            // 4-bit data types pack two elements into a byte.
+            if (types::is_4bit(data_type()))
+                data_size = utils::div_up(max_size, 2);
             if (is_additional_buffer()) {
                 // The additional buffers, typically of data type int32_t, float
                 // are stored at the end of data. Pad the data, so that the
@@ -254,6 +265,37 @@ struct memory_desc_wrapper : public c_compatible {
                     }
                     default: assert(!"unknown component"); return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                const dim_t block_size = utils::array_product(
+                        sparse_desc().block_dims, ndims());
+                switch (index) {
+                    // Return size for values, stored as dense blocks.
+                    case 0: return nnz() * block_size * data_type_size();
+                    // Return size for block indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        return nnz() * types::data_type_size(idx_dt);
+                    }
+                    // Return size for pointers to rows of blocks.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        const dim_t nrows
+                                = dims()[0] / sparse_desc().block_dims[0];
+                        return (nrows + 1) * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown component"); return 0;
+                }
+            } else if (sparse_desc().encoding == sparse_encoding::grouped) {
+                switch (index) {
+                    // Return size for values, stored as a dense matrix.
+                    case 0: return nnz() * data_type_size();
+                    // Return size for offsets of the groups.
+                    case 1: {
+                        const auto off_dt = metadata_type(0);
+                        return (ngroups() + 1) * types::data_type_size(off_dt);
+                    }
+                    default: assert(!"unknown component"); return 0;
+                }
             } else {
                 assert(!"unknown sparse encoding");
                 return 0;
@@ -224,6 +224,10 @@ enum {
     key_gemm_tmp_buffer,
     key_gemm_blocked_a,
     key_gemm_blocked_b,
+    key_gnorm_reduction,
+    key_gnorm_tmp_mean,
+    key_gnorm_tmp_scaleshift,
+    key_gnorm_tmp_var,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -234,6 +238,7 @@ enum {
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
     key_matmul_dst_in_acc_dt,
+    key_matmul_src_dyn_quant_scales,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -274,6 +279,13 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_rnn_seq_lengths,
+    key_sdpa_acc,
+    key_sdpa_k_buffer,
+    key_sdpa_q_buffer,
+    key_sdpa_scores,
+    key_sdpa_stats,
+    key_sdpa_v_buffer,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
@@ -28,6 +28,8 @@
 
 #include "bfloat16.hpp"
 #include "float16.hpp"
+#include "float8.hpp"
+#include "int4.hpp"
 #include "internal_defs.hpp"
 #include "z_magic.hpp"
 
@@ -179,6 +181,61 @@ struct numeric_limits<float16_t> {
     }
 };
 
+template <>
+struct numeric_limits<float8_e5m2_t> {
+    static constexpr float8_e5m2_t lowest() {
+        return float8_e5m2_t(0xfb, true);
+    }
+
+    static constexpr float8_e5m2_t max() { return float8_e5m2_t(0x7b, true); }
+
+    static constexpr int digits = 3;
+
+    static constexpr float8_e5m2_t epsilon() {
+        return float8_e5m2_t(((0x0f - (digits - 1)) << (digits - 1)), true);
+    }
+};
+
+template <>
+struct numeric_limits<float8_e4m3_t> {
+    static constexpr float8_e4m3_t lowest() {
+        return float8_e4m3_t(0xfe, true);
+    }
+
+    static constexpr float8_e4m3_t max() { return float8_e4m3_t(0x7e, true); }
+
+    static constexpr int digits = 4;
+
+    static constexpr float8_e4m3_t epsilon() {
+        return float8_e4m3_t(((0x7 - (digits - 1)) << (digits - 1)), true);
+    }
+};
+
+template <>
+struct numeric_limits<int4_t> {
+    static constexpr int4_t lowest() { return int4_t(0x8, true); }
+
+    static constexpr int4_t max() { return int4_t(0x7, true); }
+
+    static constexpr int digits = 3;
+};
+
+template <>
+struct numeric_limits<uint4_t> {
+    static constexpr uint4_t lowest() { return uint4_t(0x0, true); }
+
+    static constexpr uint4_t max() { return uint4_t(0xf, true); }
+
+    static constexpr int digits = 4;
+};
+
+template <>
+struct numeric_limits<nf4_t> {
+    static constexpr nf4_t lowest() { return nf4_t(0x0, true); }
+
+    static constexpr nf4_t max() { return nf4_t(0xf, true); }
+};
+
 template <typename T>
 struct is_integral {
     static constexpr bool value = false;
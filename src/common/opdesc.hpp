@@ -327,6 +327,50 @@ struct layer_normalization_desc_t {
     memory_desc_t diff_dst_desc;
 };
 
+// A descriptor of an embedding bag operation.
+struct embedding_bag_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_embedding_bag.
+    primitive_kind_t primitive_kind;
+    // The kind of the pooling. Possible values: #dnnl_embedding_bag_gather,
+    // #dnnl_embedding_bag_sum, and #dnnl_embedding_bag_mean.
+    alg_kind_t alg_kind;
+    // Embedding table memory descriptor: [rows, D].
+    memory_desc_t src_desc;
+    // Indices of the rows to look up: [n_indices].
+    memory_desc_t indices_desc;
+    // Offsets of the first indices of the bags: [n_bags]. Zero memory
+    // descriptor for #dnnl_embedding_bag_gather.
+    memory_desc_t offsets_desc;
+    // Destination memory descriptor: [n_bags, D] or [n_indices, D] for
+    // #dnnl_embedding_bag_gather.
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a Group Normalization operation.
+struct group_normalization_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_group_normalization.
+    primitive_kind_t primitive_kind;
+    // The kind of propagation. Possible values: #dnnl_forward_training and
+    // #dnnl_forward_inference.
+    prop_kind_t prop_kind;
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+    // Scale and shift data memory descriptor. Uses 1D #dnnl_x format[C].
+    memory_desc_t scaleshift_desc;
+    // Mean and variance data memory descriptor. The 2D tensor of
+    // [N, groups] dimensions with any plain user-provided format.
+    memory_desc_t stat_desc;
+    // Number of groups the channels are split into.
+    dim_t groups;
+    // Group normalization epsilon parameter.
+    float group_norm_epsilon;
+    unsigned flags;
+};
+
 // A descriptor of a Local Response Normalization (LRN) operation.
 struct lrn_desc_t {
     // The kind of primitive. Used for self-identifying the primitive
@@ -558,6 +602,28 @@ struct rnn_desc_t {
     float beta;
 };
 
+// A descriptor of a scaled dot-product attention operation.
+struct sdpa_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_sdpa.
+    primitive_kind_t primitive_kind;
+    // Queries memory descriptor: [batch..., S_q, D].
+    memory_desc_t q_desc;
+    // Keys memory descriptor: [batch..., S_kv, D].
+    memory_desc_t k_desc;
+    // Values memory descriptor: [batch..., S_kv, D_v].
+    memory_desc_t v_desc;
+    // Additive attention mask memory descriptor broadcastable to
+    // [batch..., S_q, S_kv]. Zero memory descriptor if there is no mask.
+    memory_desc_t mask_desc;
+    // Destination memory descriptor: [batch..., S_q, D_v].
+    memory_desc_t dst_desc;
+    // Scaling factor applied to the scores before the mask.
+    float scale;
+    // Flags: #dnnl_sdpa_causal_mask.
+    unsigned flags;
+};
+
 struct op_desc_t {
     union {
         primitive_kind_t kind;
@@ -571,6 +637,8 @@ struct op_desc_t {
         lrn_desc_t lrn;
         batch_normalization_desc_t batch_normalization;
         layer_normalization_desc_t layer_normalization;
+        group_normalization_desc_t group_normalization;
+        embedding_bag_desc_t embedding_bag;
         inner_product_desc_t inner_product;
         rnn_desc_t rnn;
         gemm_desc_t gemm;
@@ -582,6 +650,7 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        sdpa_desc_t sdpa;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -602,6 +671,8 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(lrn_desc_t);
     DECL_CTOR_AND_CONVERTERS(batch_normalization_desc_t);
     DECL_CTOR_AND_CONVERTERS(layer_normalization_desc_t);
+    DECL_CTOR_AND_CONVERTERS(group_normalization_desc_t);
+    DECL_CTOR_AND_CONVERTERS(embedding_bag_desc_t);
     DECL_CTOR_AND_CONVERTERS(inner_product_desc_t);
     DECL_CTOR_AND_CONVERTERS(rnn_desc_t);
     DECL_CTOR_AND_CONVERTERS(gemm_desc_t);
@@ -613,6 +684,7 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(sdpa_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
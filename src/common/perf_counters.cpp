@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/perf_counters.hpp"
+
+namespace dnnl {
+namespace impl {
+
+perf_counters_t::perf_counters_t() {
+    for (int i = 0; i < n_counters; i++)
+        fds_[i] = -1;
+
+#ifdef __linux__
+    const uint64_t configs[n_counters] = {PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+    for (int i = 0; i < n_counters; i++) {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = configs[i];
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // Measure the calling thread and its descendants on any CPU.
+        fds_[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if (fds_[i] < 0) {
+            for (int j = 0; j < i; j++) {
+                close(fds_[j]);
+                fds_[j] = -1;
+            }
+            return;
+        }
+    }
+    is_open_ = true;
+#endif
+}
+
+perf_counters_t::~perf_counters_t() {
+#ifdef __linux__
+    for (int i = 0; i < n_counters; i++)
+        if (fds_[i] >= 0) close(fds_[i]);
+#endif
+}
+
+const perf_counters_t &perf_counters_t::get() {
+    static const perf_counters_t counters;
+    return counters;
+}
+
+bool perf_counters_t::read(uint64_t values[n_counters]) const {
+    if (!is_open_) return false;
+#ifdef __linux__
+    for (int i = 0; i < n_counters; i++) {
+        if (::read(fds_[i], &values[i], sizeof(values[i]))
+                != (ssize_t)sizeof(values[i]))
+            return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERF_COUNTERS_HPP
+#define COMMON_PERF_COUNTERS_HPP
+
+#include <cstdint>
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+
+// Hardware performance counters of the process based on the Linux
+// `perf_event_open` interface. The counters are opened on the first call to
+// `get()` for the calling thread and are inherited by the threads it creates
+// afterwards, so they should be opened before the threading runtime spawns
+// its workers. The values read are the totals over all these threads and
+// count user space events only.
+//
+// The counters are not available on other systems or when the kernel denies
+// the access, see `/proc/sys/kernel/perf_event_paranoid`.
+struct perf_counters_t {
+    enum counter_t {
+        cycles = 0,
+        instructions,
+        // Last level cache misses, each of them transfers a cache line.
+        llc_misses,
+        n_counters
+    };
+
+    static DNNL_API const perf_counters_t &get();
+
+    bool is_open() const { return is_open_; }
+
+    // Fills `values` with the current values of all counters. Returns false
+    // if the counters are not available.
+    bool DNNL_API read(uint64_t values[n_counters]) const;
+
+    ~perf_counters_t();
+
+private:
+    perf_counters_t();
+
+    int fds_[n_counters];
+    bool is_open_ = false;
+
+    perf_counters_t(const perf_counters_t &) = delete;
+    perf_counters_t &operator=(const perf_counters_t &) = delete;
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
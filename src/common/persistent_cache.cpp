@@ -0,0 +1,291 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "cache_blob.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "persistent_cache.hpp"
+#include "primitive.hpp"
+#include "primitive_desc.hpp"
+#include "serialization.hpp"
+#include "serialization_stream.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+// The entry layout on disk is:
+//     | magic | version size | version | id size | id | blob size | blob |
+// All sizes are 64-bit. The version is the library version and git hash, so
+// entries written by other builds are never used. The id is stored to resolve
+// collisions of the file name hash.
+const uint64_t entry_magic = 0x314548434e4e4455ULL; // "UDNNCHE1"
+
+uint64_t fnv1a_hash(const std::vector<uint8_t> &data) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (uint8_t b : data) {
+        h ^= b;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+std::vector<uint8_t> library_version() {
+    const auto *v = dnnl_version();
+    const std::string s = std::to_string(v->major) + "."
+            + std::to_string(v->minor) + "." + std::to_string(v->patch) + "+"
+            + v->hash;
+    return std::vector<uint8_t>(s.begin(), s.end());
+}
+
+int get_pid() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return (int)::getpid();
+#endif
+}
+
+bool read_file(const std::string &path, std::vector<uint8_t> &data) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    bool ok = std::fseek(f, 0, SEEK_END) == 0;
+    const long size = ok ? std::ftell(f) : -1;
+    ok = ok && size > 0 && std::fseek(f, 0, SEEK_SET) == 0;
+    if (ok) {
+        data.resize(size);
+        ok = std::fread(data.data(), size, 1, f) == 1;
+    }
+    std::fclose(f);
+    return ok;
+}
+
+// Reads the fields of an entry from memory. Every read checks the bounds, so
+// a truncated or corrupted entry is detected instead of being trusted.
+struct entry_reader_t {
+    entry_reader_t(const std::vector<uint8_t> &data) : data_(data) {}
+
+    bool read_u64(uint64_t &v) {
+        if (data_.size() - pos_ < sizeof(v)) return false;
+        std::memcpy(&v, data_.data() + pos_, sizeof(v));
+        pos_ += sizeof(v);
+        return true;
+    }
+
+    bool read_bytes(std::vector<uint8_t> &v) {
+        uint64_t size = 0;
+        if (!read_u64(size) || data_.size() - pos_ < size) return false;
+        v.assign(data_.begin() + pos_, data_.begin() + pos_ + size);
+        pos_ += size;
+        return true;
+    }
+
+    bool at_end() const { return pos_ == data_.size(); }
+
+private:
+    const std::vector<uint8_t> &data_;
+    size_t pos_ = 0;
+};
+
+bool write_u64(FILE *f, uint64_t v) {
+    return std::fwrite(&v, sizeof(v), 1, f) == 1;
+}
+
+bool write_bytes(FILE *f, const std::vector<uint8_t> &v) {
+    return write_u64(f, v.size())
+            && (v.empty() || std::fwrite(v.data(), v.size(), 1, f) == 1);
+}
+} // namespace
+
+std::string persistent_cache_t::entry_path(
+        const std::vector<uint8_t> &id) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.blob",
+            (unsigned long long)fnv1a_hash(id));
+#ifdef _WIN32
+    const char sep = '\\';
+#else
+    const char sep = '/';
+#endif
+    std::string path = dir_;
+    if (path.back() != '/' && path.back() != sep) path += sep;
+    return path + name;
+}
+
+std::vector<uint8_t> persistent_cache_t::load(
+        const std::vector<uint8_t> &id) const {
+    if (!is_enabled() || id.empty()) return {};
+
+    std::vector<uint8_t> data;
+    if (!read_file(entry_path(id), data)) return {};
+
+    entry_reader_t reader(data);
+    uint64_t magic = 0;
+    std::vector<uint8_t> version, stored_id, blob;
+    const bool ok = reader.read_u64(magic) && magic == entry_magic
+            && reader.read_bytes(version) && version == library_version()
+            && reader.read_bytes(stored_id) && stored_id == id
+            && reader.read_bytes(blob) && !blob.empty() && reader.at_end();
+
+    // A truncated, foreign or outdated entry is treated as a miss. It is
+    // overwritten once the primitive is created.
+    if (!ok) return {};
+    return blob;
+}
+
+status_t persistent_cache_t::store(const std::vector<uint8_t> &id,
+        const std::vector<uint8_t> &blob) const {
+    if (!is_enabled() || id.empty() || blob.empty()) return status::success;
+
+    const std::string path = entry_path(id);
+    const std::string tmp_path = path + ".tmp."
+            + std::to_string(get_pid()) + "."
+            + std::to_string(
+                    std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+    FILE *f = fopen(tmp_path.c_str(), "wb");
+    if (!f) return status::runtime_error;
+
+    bool ok = write_u64(f, entry_magic) && write_bytes(f, library_version())
+            && write_bytes(f, id) && write_bytes(f, blob);
+    ok = (std::fclose(f) == 0) && ok;
+    // Another process may have stored the same entry in the meantime, which
+    // is fine as the content is identical.
+#ifdef _WIN32
+    // Unlike POSIX, rename() does not replace an existing file on Windows.
+    if (ok) std::remove(path.c_str());
+#endif
+    if (ok) ok = std::rename(tmp_path.c_str(), path.c_str()) == 0;
+    if (!ok) {
+        std::remove(tmp_path.c_str());
+        return status::runtime_error;
+    }
+    return status::success;
+}
+
+status_t persistent_cache_t::store(const std::vector<uint8_t> &id,
+        engine_t *engine, const primitive_t &p) const {
+    if (!is_enabled() || id.empty()) return status::success;
+
+    size_t size = 0;
+    CHECK(p.get_cache_blob_size(engine, &size));
+    if (size == 0) return status::success;
+
+    std::vector<uint8_t> blob(size);
+    cache_blob_t cb(blob.data(), size);
+    CHECK(p.get_cache_blob(engine, cb));
+    return store(id, blob);
+}
+
+void persistent_cache_t::remove(const std::vector<uint8_t> &id) const {
+    if (!is_enabled() || id.empty()) return;
+    std::remove(entry_path(id).c_str());
+}
+
+std::vector<uint8_t> persistent_cache_t::dispatch_id(engine_t *engine,
+        const op_desc_t *op_desc, const primitive_attr_t *attr,
+        const primitive_desc_t *hint_fwd_pd) {
+    if (!op_desc || op_desc->kind == primitive_kind::zero_pad) return {};
+
+    serialization_stream_t sstream;
+    // The prefix keeps the dispatch entries apart from the cache blobs.
+    const char prefix[] = "dispatch";
+    sstream.write(prefix, sizeof(prefix) - 1);
+
+    serialization::serialize_desc(sstream, op_desc);
+    serialization::serialize_attr(sstream, attr ? *attr : primitive_attr_t());
+    if (hint_fwd_pd) {
+        const char *name = hint_fwd_pd->name();
+        sstream.write(name, std::strlen(name));
+        for (const auto &md : hint_fwd_pd->hint_mds(true /* is_hint */))
+            serialization::serialize_md(sstream, md);
+    }
+
+    const auto engine_kind = engine->kind();
+    const auto runtime_kind = engine->runtime_kind();
+    sstream.write(&engine_kind);
+    sstream.write(&runtime_kind);
+    if (engine_kind == engine_kind::gpu) {
+        if (engine->serialize_device(sstream) != status::success) return {};
+    } else {
+        // The implementations accepted by the CPU engine depend on the
+        // effective ISA and on the number of threads through the blocking
+        // heuristics.
+        const auto isa = dnnl_get_effective_cpu_isa();
+        const auto isa_hints = dnnl_get_cpu_isa_hints();
+        const int nthr = dnnl_get_max_threads();
+        sstream.write(&isa);
+        sstream.write(&isa_hints);
+        sstream.write(&nthr);
+    }
+    return sstream.get_data();
+}
+
+int persistent_cache_t::load_impl(
+        const std::vector<uint8_t> &id, std::string &impl_name) const {
+    const auto blob = load(id);
+    int32_t idx = -1;
+    if (blob.size() <= sizeof(idx)) return -1;
+    std::memcpy(&idx, blob.data(), sizeof(idx));
+    impl_name.assign(blob.begin() + sizeof(idx), blob.end());
+    return idx;
+}
+
+status_t persistent_cache_t::store_impl(const std::vector<uint8_t> &id,
+        int impl_idx, const char *impl_name) const {
+    const int32_t idx = impl_idx;
+    std::vector<uint8_t> blob(sizeof(idx));
+    std::memcpy(blob.data(), &idx, sizeof(idx));
+    blob.insert(blob.end(), impl_name, impl_name + std::strlen(impl_name));
+    return store(id, blob);
+}
+
+persistent_cache_t &global_persistent_cache() {
+    // getenv_string_user() is not used as it lowercases the value and limits
+    // its length, which is not suitable for paths.
+    static const std::string dir = []() {
+        std::string value;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+        char buf[4096];
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix) + "PERSISTENT_CACHE_DIR";
+            if (getenv(name.c_str(), buf, sizeof(buf)) > 0) {
+                value = buf;
+                break;
+            }
+        }
+#endif
+        return value;
+    }();
+    static persistent_cache_t cache(dir);
+    return cache;
+}
+
+} // namespace impl
+} // namespace dnnl
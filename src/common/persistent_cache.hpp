@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_CACHE_HPP
+#define COMMON_PERSISTENT_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct op_desc_t;
+struct primitive_desc_t;
+struct primitive_t;
+
+// Process-wide on-disk storage for primitive cache blobs. An entry is keyed by
+// the cache blob ID of a primitive descriptor, which already encodes the
+// operation descriptor, attributes, memory descriptors, device, the position
+// in the implementation list and the library version (including the git
+// hash). The storage is consulted by the primitive cache on a miss, so a warm
+// process restart creates primitives from the stored cache blobs instead of
+// compiling kernels again.
+//
+// The storage also keeps the dispatching decisions: the position in the
+// implementation list of the implementation that accepted an operation
+// descriptor. Primitive descriptor creation tries that implementation first,
+// so a restart skips the initialization of the implementations that reject the
+// descriptor. This is the part that takes effect for the CPU engine, whose
+// just-in-time generated kernels reference process-specific addresses and do
+// not support cache blobs.
+//
+// The storage is enabled by pointing `ONEDNN_PERSISTENT_CACHE_DIR` to an
+// existing writable directory.
+struct persistent_cache_t {
+    persistent_cache_t(const std::string &dir) : dir_(dir) {}
+
+    bool is_enabled() const { return !dir_.empty(); }
+
+    // Returns the stored cache blob associated with `id` or an empty vector
+    // if there is no such entry.
+    std::vector<uint8_t> load(const std::vector<uint8_t> &id) const;
+
+    // Stores `blob` under `id`, replacing the previous entry. The entry is
+    // written to a temporary file which is then atomically renamed, so
+    // concurrent writers and readers never observe a partially written entry.
+    status_t store(const std::vector<uint8_t> &id,
+            const std::vector<uint8_t> &blob) const;
+
+    // Queries a cache blob from the primitive `p` and stores it under `id`.
+    status_t store(const std::vector<uint8_t> &id, engine_t *engine,
+            const primitive_t &p) const;
+
+    // Removes the entry associated with `id`, e.g. when the stored cache blob
+    // turned out to be unusable.
+    void remove(const std::vector<uint8_t> &id) const;
+
+    // Returns the key of the dispatching decision for an operation descriptor,
+    // or an empty vector if the decision is not stored for it.
+    static std::vector<uint8_t> dispatch_id(engine_t *engine,
+            const op_desc_t *op_desc, const primitive_attr_t *attr,
+            const primitive_desc_t *hint_fwd_pd);
+
+    // Returns the position in the implementation list stored under `id` and
+    // the name of the implementation, or -1 if there is no such entry.
+    int load_impl(const std::vector<uint8_t> &id, std::string &impl_name) const;
+
+    status_t store_impl(const std::vector<uint8_t> &id, int impl_idx,
+            const char *impl_name) const;
+
+private:
+    std::string entry_path(const std::vector<uint8_t> &id) const;
+
+    std::string dir_;
+};
+
+persistent_cache_t &global_persistent_cache();
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
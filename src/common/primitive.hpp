@@ -26,6 +26,7 @@
 #include "cache_blob.hpp"
 #include "memory_storage.hpp"
 #include "memory_tracking.hpp"
+#include "persistent_cache.hpp"
 #include "primitive_desc.hpp"
 #include "primitive_exec_types.hpp"
 #include "rw_mutex.hpp"
@@ -103,8 +104,35 @@ protected:
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
+
+            // On a primitive cache miss try the persistent cache unless the
+            // user has provided a cache blob explicitly.
+            const auto &pcache = global_persistent_cache();
+            const bool use_pcache = pcache.is_enabled() && !c.cache_blob;
+            std::vector<uint8_t> stored_blob;
+            cache_blob_t cache_blob = c.cache_blob;
+            if (use_pcache) {
+                stored_blob = pcache.load(c.pd->get_cache_blob_id(c.engine));
+                if (!stored_blob.empty())
+                    cache_blob = cache_blob_t(
+                            stored_blob.data(), stored_blob.size());
+            }
+
             status_t status
-                    = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
+                    = p->init(c.engine, c.use_global_scratchpad, cache_blob);
+            // A stale or corrupted entry must not fail the creation: the
+            // primitive is created from scratch and the entry is replaced.
+            if (!stored_blob.empty() && status != status::success) {
+                p = std::make_shared<impl_type>(c.pd);
+                status = p->init(
+                        c.engine, c.use_global_scratchpad, cache_blob_t());
+                if (status != status::success)
+                    pcache.remove(c.pd->get_cache_blob_id(c.engine));
+                stored_blob.clear();
+            }
+            // Failing to store the entry is not an error for the user.
+            if (use_pcache && stored_blob.empty() && status == status::success)
+                pcache.store(c.pd->get_cache_blob_id(c.engine), c.engine, *p);
             c.is_create_called = true;
             return primitive_cache_iface_t::result_t {std::move(p), status};
         };
@@ -97,6 +97,30 @@ status_t zero_points_t::set(int arg, int mask) {
     return status::success;
 }
 
+status_t zero_points_t::set(int arg, int mask, int ndims,
+        const dims_t group_dims, data_type_t data_type) {
+    const bool is_wei = arg == DNNL_ARG_WEIGHTS;
+    if (!is_wei && (ndims > 0 || data_type != data_type::s32))
+        return status::unimplemented;
+    if (ndims < 0 || ndims > DNNL_MAX_NDIMS
+            || (ndims > 0 && group_dims == nullptr))
+        return status::invalid_arguments;
+    for (int d = 0; d < ndims; ++d)
+        if (group_dims[d] <= 0) return status::invalid_arguments;
+    if (!utils::one_of(data_type, data_type::s32, data_type::s8, data_type::u8,
+                data_type::s4, data_type::u4))
+        return status::unimplemented;
+
+    CHECK(set(arg, mask));
+    if (!is_wei) return status::success;
+
+    data_type_wei = data_type;
+    group_ndims_wei = ndims;
+    utils::array_set(group_dims_wei, 0, DNNL_MAX_NDIMS);
+    if (ndims > 0) utils::array_copy(group_dims_wei, group_dims, ndims);
+    return status::success;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -119,7 +143,21 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             (bool)(~mask & (mask_name)), (mask_field).has_default_values()))
     CHECK_MASK(smask_t::oscale_runtime, output_scales_);
     CHECK_MASK(smask_t::scales, scales_);
+    CHECK_ARG(IMPLICATION((mask & smask_t::scales_runtime_groups)
+                    != smask_t::scales_runtime_groups,
+            scales_.has_default_groups()));
+    CHECK_ARG(IMPLICATION((mask & smask_t::scales_runtime_data_type)
+                    != smask_t::scales_runtime_data_type,
+            scales_.has_default_data_type()));
     CHECK_MASK(smask_t::zero_points, zero_points_);
+    CHECK_ARG(IMPLICATION((mask & smask_t::zero_points_runtime_groups)
+                    != smask_t::zero_points_runtime_groups,
+            zero_points_.has_default_groups()));
+    CHECK_ARG(IMPLICATION((mask & smask_t::zero_points_runtime_data_type)
+                    != smask_t::zero_points_runtime_data_type,
+            zero_points_.has_default_data_type()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::src_dynamic_quantization),
+            src_dyn_quant_dt_ == dnnl::impl::data_type::undef));
     CHECK_MASK(smask_t::post_ops, post_ops_);
     CHECK_MASK(smask_t::rnn_data_qparams, rnn_data_qparams_);
     CHECK_MASK(smask_t::rnn_weights_qparams, rnn_weights_qparams_);
@@ -435,6 +473,45 @@ status_t dnnl_primitive_attr_set_scratchpad_mode(
     return attr->set_scratchpad_mode(scratchpad_mode);
 }
 
+status_t dnnl_primitive_attr_get_shared_weights(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+
+    *value = attr->shared_weights_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_shared_weights(
+        primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+    if (!one_of(value, 0, 1)) return invalid_arguments;
+
+    attr->shared_weights_ = value;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_scheduling(
+        const primitive_attr_t *attr, scheduling_t *mode) {
+    if (any_null(attr, mode)) return invalid_arguments;
+
+    *mode = attr->scheduling_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_scheduling(
+        primitive_attr_t *attr, scheduling_t mode) {
+    if (any_null(attr)) return invalid_arguments;
+    if (!one_of(mode, scheduling::balanced, scheduling::work_stealing))
+        return invalid_arguments;
+
+    attr->scheduling_ = mode;
+
+    return success;
+}
+
 status_t dnnl_primitive_attr_set_scales_mask(
         primitive_attr_t *attr, int arg, int mask) {
     bool ok = attr && mask >= 0 && arg >= 0
@@ -451,6 +528,45 @@ status_t dnnl_primitive_attr_set_zero_points_mask(
     return attr->zero_points_.set(arg, mask);
 }
 
+status_t dnnl_primitive_attr_set_scales(primitive_attr_t *attr, int arg,
+        int mask, int ndims, const dims_t group_dims, data_type_t data_type) {
+    bool ok = attr && mask >= 0 && arg >= 0 && ndims >= 0
+            && IMPLICATION(ndims > 0, group_dims != nullptr)
+            && utils::one_of(data_type, data_type::f32, data_type::bf16,
+                    data_type::f16)
+            && attr->output_scales_.has_default_values();
+    if (!ok) return invalid_arguments;
+    return attr->scales_.set(arg, mask, ndims, group_dims, data_type);
+}
+
+status_t dnnl_primitive_attr_set_zero_points(primitive_attr_t *attr, int arg,
+        int mask, int ndims, const dims_t group_dims, data_type_t data_type) {
+    bool ok = attr && mask >= 0 && ndims >= 0
+            && IMPLICATION(ndims > 0, group_dims != nullptr);
+    if (!ok) return invalid_arguments;
+    return attr->zero_points_.set(arg, mask, ndims, group_dims, data_type);
+}
+
+status_t dnnl_primitive_attr_get_src_dynamic_quantization(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+
+    *data_type = attr->src_dyn_quant_dt_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_dynamic_quantization(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    if (!one_of(data_type, data_type::undef, data_type::s8))
+        return invalid_arguments;
+
+    attr->src_dyn_quant_dt_ = data_type;
+
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_post_ops(
         const primitive_attr_t *attr, const post_ops_t **post_ops) {
     if (any_null(attr, post_ops)) return invalid_arguments;
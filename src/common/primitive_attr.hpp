@@ -184,29 +184,58 @@ struct runtime_scales_t : public c_compatible {
     // runtime_scales_t() = default;
     runtime_scales_t() {}
 
-    status_t set(int mask) {
+    status_t set(int mask) { return set(mask, 0, nullptr, data_type::f32); }
+
+    // Groups split the dimensions selected by the mask: a single scale value
+    // applies to a block of `group_dims` elements. The groups are defined for
+    // the last `ndims` dimensions of the tensor.
+    status_t set(int mask, int ndims, const dims_t group_dims,
+            data_type_t data_type) {
+        if (ndims < 0 || ndims > DNNL_MAX_NDIMS
+                || (ndims > 0 && group_dims == nullptr))
+            return status::invalid_arguments;
+        for (int d = 0; d < ndims; ++d)
+            if (group_dims[d] <= 0) return status::invalid_arguments;
+
         mask_ = mask;
         is_set_ = true;
+        ndims_ = ndims;
+        utils::array_set(group_dims_, 0, DNNL_MAX_NDIMS);
+        if (ndims > 0) utils::array_copy(group_dims_, group_dims, ndims);
+        data_type_ = data_type;
         return status::success;
     }
 
     bool operator==(const runtime_scales_t &rhs) const {
-        return mask_ == rhs.mask_ && is_set_ == rhs.is_set_;
+        return mask_ == rhs.mask_ && is_set_ == rhs.is_set_
+                && ndims_ == rhs.ndims_
+                && utils::array_cmp(group_dims_, rhs.group_dims_, ndims_)
+                && data_type_ == rhs.data_type_;
     }
 
     bool has_default_values() const { return !is_set_; }
 
+    bool has_default_groups() const { return ndims_ == 0; }
+
+    bool has_default_data_type() const { return data_type_ == data_type::f32; }
+
     bool defined() const { return has_default_values(); }
 
     void reset() {
         mask_ = 0;
         is_set_ = false;
+        ndims_ = 0;
+        utils::array_set(group_dims_, 0, DNNL_MAX_NDIMS);
+        data_type_ = data_type::f32;
     }
 
     // TODO: replace with `-1` to remove `is_set_`.
     // Hide `mask_` under `private:` to force interface usage.
     int mask_ = 0;
     bool is_set_ = false;
+    int ndims_ = 0;
+    dims_t group_dims_ = {};
+    data_type_t data_type_ = data_type::f32;
 };
 
 struct arg_scales_t : public c_compatible {
@@ -244,6 +273,12 @@ struct arg_scales_t : public c_compatible {
         return scales_[arg].set(mask);
     }
 
+    status_t set(int arg, int mask, int ndims, const dims_t group_dims,
+            data_type_t data_type) {
+        if (!check_arg(arg)) return status::invalid_arguments;
+        return scales_[arg].set(mask, ndims, group_dims, data_type);
+    }
+
     status_t get(int arg, int *mask, bool *is_set) const {
         if (!check_arg(arg)) return status::invalid_arguments;
         const auto &s = get(arg);
@@ -259,6 +294,18 @@ struct arg_scales_t : public c_compatible {
         return status::success;
     }
 
+    bool has_default_groups() const {
+        for (const auto &s : scales_)
+            if (!s.second.has_default_groups()) return false;
+        return true;
+    }
+
+    bool has_default_data_type() const {
+        for (const auto &s : scales_)
+            if (!s.second.has_default_data_type()) return false;
+        return true;
+    }
+
     bool defined() const { return has_default_values(); }
 
     status_t copy_from(const arg_scales_t &other) {
@@ -267,11 +314,12 @@ struct arg_scales_t : public c_compatible {
             // new object.
             if (scales_.count(it->first) == 1) {
                 auto &entry = scales_[it->first];
-                bool exists = entry.mask_ == it->second.mask_;
-                if (exists) continue;
+                if (entry == it->second) continue;
             }
 
-            CHECK(set(it->first, it->second.mask_));
+            const auto &s = it->second;
+            CHECK(set(it->first, s.mask_, s.ndims_, s.group_dims_,
+                    s.data_type_));
         }
         return status::success;
     }
@@ -302,7 +350,11 @@ struct zero_points_t : public c_compatible {
     bool operator==(const zero_points_t &rhs) const {
         return mask_src == rhs.mask_src && mask_wei == rhs.mask_wei
                 && mask_dst == rhs.mask_dst && is_set_src == rhs.is_set_src
-                && is_set_wei == rhs.is_set_wei && is_set_dst == rhs.is_set_dst;
+                && is_set_wei == rhs.is_set_wei && is_set_dst == rhs.is_set_dst
+                && data_type_wei == rhs.data_type_wei
+                && group_ndims_wei == rhs.group_ndims_wei
+                && utils::array_cmp(
+                        group_dims_wei, rhs.group_dims_wei, group_ndims_wei);
     }
 
     // arg-specific checks
@@ -323,9 +375,34 @@ struct zero_points_t : public c_compatible {
     status_t set(int arg, int mask);
     status_t set(int arg) { return set(arg, 0); }
 
+    // Groups and data types other than s32 are supported for weights only.
+    status_t set(int arg, int mask, int ndims, const dims_t group_dims,
+            data_type_t data_type);
+
+    data_type_t get_data_type(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? data_type_wei : data_type::s32;
+    }
+
+    int get_groups_ndims(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? group_ndims_wei : 0;
+    }
+
+    const dims_t &get_groups(int arg) const {
+        static const dims_t default_groups = {};
+        return arg == DNNL_ARG_WEIGHTS ? group_dims_wei : default_groups;
+    }
+
+    bool has_default_groups() const { return group_ndims_wei == 0; }
+    bool has_default_data_type() const {
+        return data_type_wei == data_type::s32;
+    }
+
 private:
     bool is_set_src = false, is_set_wei = false, is_set_dst = false;
     int mask_src = 0, mask_wei = 0, mask_dst = 0;
+    data_type_t data_type_wei = data_type::s32;
+    int group_ndims_wei = 0;
+    dims_t group_dims_wei = {};
 
     int get_mask(int arg) const {
         int mask = 0;
@@ -626,7 +703,10 @@ private:
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
-        , fpmath_mode_(dnnl::impl::get_fpmath_mode()) {}
+        , fpmath_mode_(dnnl::impl::get_fpmath_mode())
+        , shared_weights_(false)
+        , scheduling_(dnnl::impl::scheduling::balanced)
+        , src_dyn_quant_dt_(dnnl::impl::data_type::undef) {}
 
     dnnl_primitive_attr *clone() const {
         return new dnnl_primitive_attr(*this);
@@ -643,8 +723,11 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         output_scales_ = other.output_scales_;
         scales_ = other.scales_;
         zero_points_ = other.zero_points_;
+        src_dyn_quant_dt_ = other.src_dyn_quant_dt_;
         scratchpad_mode_ = other.scratchpad_mode_;
         fpmath_mode_ = other.fpmath_mode_;
+        shared_weights_ = other.shared_weights_;
+        scheduling_ = other.scheduling_;
         post_ops_.copy_from(other.post_ops_);
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -672,12 +755,19 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         rnn_tparams = 1u << 9,
         sum_dt = 1u << 10,
         rnn_weights_projection_qparams = 1u << 11,
-        gpu_attr = 1u << 12
+        gpu_attr = 1u << 12,
+        scales_runtime_groups = (unsigned)scales_runtime | (1u << 13),
+        scales_runtime_data_type = (unsigned)scales_runtime | (1u << 14),
+        zero_points_runtime_groups = (unsigned)zero_points_runtime | (1u << 15),
+        zero_points_runtime_data_type
+        = (unsigned)zero_points_runtime | (1u << 16),
+        src_dynamic_quantization = 1u << 17,
     };
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_, fpmath_mode_, shared_weights_ and
+     * scheduling_ are not taken into account */
     bool has_default_values(skip_mask_t mask = skip_mask_t::none,
             dnnl::impl::data_type_t dst_dt = dnnl_data_type_undef) const;
 
@@ -687,8 +777,11 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_mode_ == rhs.fpmath_mode_
+                && shared_weights_ == rhs.shared_weights_
+                && scheduling_ == rhs.scheduling_
                 && output_scales_ == rhs.output_scales_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
+                && src_dyn_quant_dt_ == rhs.src_dyn_quant_dt_
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
                 && rnn_weights_qparams_ == rhs.rnn_weights_qparams_
@@ -738,6 +831,15 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
     dnnl::impl::fpmath_mode_t fpmath_mode_;
+    // Weights contents are constant per address, see
+    // dnnl_primitive_attr_set_shared_weights().
+    bool shared_weights_;
+    // Distribution of parallel loop iterations between threads, see
+    // dnnl_primitive_attr_set_scheduling().
+    dnnl::impl::scheduling_t scheduling_;
+    // Data type the source is quantized to at execution time, see
+    // dnnl_primitive_attr_set_src_dynamic_quantization().
+    dnnl::impl::data_type_t src_dyn_quant_dt_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::scales_t rnn_weights_qparams_;
@@ -39,8 +39,9 @@ status_t primitive_desc_create(primitive_desc_iface_t **primitive_desc_iface,
 
     const bool known_primitive_kind = utils::one_of(op_desc->kind,
             batch_normalization, binary, convolution, deconvolution, eltwise,
-            gemm, inner_product, layer_normalization, lrn, matmul, pooling,
-            prelu, reduction, resampling, rnn, shuffle, softmax);
+            embedding_bag, gemm, group_normalization, inner_product,
+            layer_normalization, lrn, matmul, pooling, prelu, reduction,
+            resampling, rnn, sdpa, shuffle, softmax);
     if (!known_primitive_kind) return invalid_arguments;
 
     auto pd_iface = utils::make_unique<primitive_desc_iface_t>(engine, op_desc,
@@ -64,8 +65,8 @@ dnnl_primitive_desc::dnnl_primitive_desc(engine_t *engine,
         const op_desc_t *op_desc, const primitive_attr_t *attr,
         const primitive_desc_t *hint_fwd_pd) {
 
-    pd_iterator_ = utils::make_unique<primitive_desc_iterator_t>(
-            engine, op_desc, attr, hint_fwd_pd);
+    pd_iterator_ = utils::make_unique<primitive_desc_iterator_t>(engine,
+            op_desc, attr, hint_fwd_pd, -1, true /* use_persistent_cache */);
 }
 
 status_t dnnl_primitive_desc::init() {
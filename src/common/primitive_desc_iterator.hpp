@@ -22,6 +22,7 @@
 #include "c_types_map.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
+#include "persistent_cache.hpp"
 #include "primitive_attr.hpp"
 #include "primitive_cache.hpp"
 #include "primitive_hashing.hpp"
@@ -35,7 +36,7 @@ struct primitive_desc_t;
 struct primitive_desc_iterator_t : public c_compatible {
     primitive_desc_iterator_t(engine_t *engine, const op_desc_t *op_desc,
             const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd,
-            int skip_idx = -1)
+            int skip_idx = -1, bool use_persistent_cache = false)
         : idx_(-1)
         , engine_(engine)
         , op_desc_(nullptr)
@@ -44,7 +45,9 @@ struct primitive_desc_iterator_t : public c_compatible {
         , impl_list_(nullptr)
         , last_idx_(0)
         , skip_idx_(skip_idx)
-        , offset_(-1) {
+        , offset_(-1)
+        , use_persistent_cache_(use_persistent_cache
+                  && global_persistent_cache().is_enabled()) {
 
         op_desc_ = (op_desc_t *)std::malloc(sizeof(op_desc_t));
         copy_c_op_desc(op_desc_, op_desc);
@@ -87,6 +90,16 @@ struct primitive_desc_iterator_t : public c_compatible {
         pd_ = primitive_cache().get_pd(key);
         if (pd_) { return *this; }
 
+        // The first implementation is looked up in the persistent cache. The
+        // implementations in front of the stored one rejected the descriptor
+        // when the decision was made, so the iteration continues after it.
+        std::vector<uint8_t> dispatch_id;
+        if (use_persistent_cache_ && offset_ == 0) {
+            dispatch_id = persistent_cache_t::dispatch_id(
+                    engine_, op_desc_, &attr_, hint_fwd_pd_);
+            if (try_stored_impl(dispatch_id)) return *this;
+        }
+
         while (++idx_ != last_idx_) {
             if (idx_ == skip_idx_) continue;
             primitive_desc_t *candidate_pd = nullptr;
@@ -97,6 +110,11 @@ struct primitive_desc_iterator_t : public c_compatible {
                 break;
             }
         }
+
+        // Failing to store the entry is not an error for the user.
+        if (pd_ && !dispatch_id.empty())
+            global_persistent_cache().store_impl(
+                    dispatch_id, idx_, pd_->name());
         return *this;
     }
 
@@ -117,6 +135,7 @@ protected:
     int last_idx_;
     int skip_idx_;
     int offset_;
+    bool use_persistent_cache_;
 
 private:
     primitive_desc_iterator_t(engine_t *engine, int last_idx)
@@ -127,7 +146,8 @@ private:
         , impl_list_(nullptr)
         , last_idx_(last_idx)
         , skip_idx_(-1)
-        , offset_(-1) {}
+        , offset_(-1)
+        , use_persistent_cache_(false) {}
 
     primitive_desc_iterator_t(primitive_desc_iterator_t &&other)
         : idx_(other.idx_)
@@ -138,7 +158,31 @@ private:
         , hint_fwd_pd_(other.hint_fwd_pd_)
         , impl_list_(other.impl_list_)
         , skip_idx_(other.skip_idx_)
-        , offset_(other.offset_) {}
+        , offset_(other.offset_)
+        , use_persistent_cache_(other.use_persistent_cache_) {}
+
+    bool try_stored_impl(const std::vector<uint8_t> &dispatch_id) {
+        if (dispatch_id.empty()) return false;
+
+        std::string name;
+        const int idx = global_persistent_cache().load_impl(dispatch_id, name);
+        if (idx < 0 || idx >= last_idx_ || idx == skip_idx_) return false;
+
+        primitive_desc_t *candidate_pd = nullptr;
+        auto s = impl_list_[idx](&candidate_pd, op_desc_, &attr_, engine_,
+                hint_fwd_pd_, offset_);
+        if (s != status::success) return false;
+
+        // The list may differ from the one the entry was stored for, e.g.
+        // with a different build configuration.
+        pd_.reset(candidate_pd);
+        if (name != pd_->name()) {
+            pd_.reset();
+            return false;
+        }
+        idx_ = idx;
+        return true;
+    }
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(primitive_desc_iterator_t);
 };
@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_future.hpp"
+#include "primitive_iface.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+namespace dnnl {
+namespace impl {
+namespace {
+
+// A pool of background threads that create primitives. The threads are
+// spawned on first use and live until the process terminates. The pool is
+// intentionally never destroyed to avoid joining threads during static
+// destruction (e.g. when the library is being unloaded).
+struct creation_pool_t {
+    static creation_pool_t &get() {
+        static creation_pool_t *pool = new creation_pool_t();
+        return *pool;
+    }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> g(mutex_);
+            tasks_.push_back(std::move(task));
+            if (idle_workers_ == 0 && n_workers_ < max_workers_) {
+                n_workers_++;
+                std::thread(&creation_pool_t::worker, this).detach();
+            }
+        }
+        cv_.notify_one();
+    }
+
+private:
+    creation_pool_t()
+        : max_workers_(std::max(1,
+                getenv_int_user("PRIMITIVE_CREATION_THREADS",
+                        default_max_workers()))) {}
+
+    static int default_max_workers() {
+        const int hw_nthr = (int)std::thread::hardware_concurrency();
+        return std::max(1, std::min(4, hw_nthr));
+    }
+
+    void worker() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            idle_workers_++;
+            cv_.wait(lock, [&]() { return !tasks_.empty(); });
+            idle_workers_--;
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    const int max_workers_;
+    int n_workers_ = 0;
+    int idle_workers_ = 0;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+};
+
+} // namespace
+} // namespace impl
+} // namespace dnnl
+
+dnnl_primitive_future::dnnl_primitive_future(
+        const primitive_desc_iface_t *pd_iface) {
+    // The number of threads is a part of the primitive cache key and may be
+    // used by implementations during creation, hence the background thread
+    // must observe the same value as the calling thread.
+    const int nthr = dnnl_get_max_threads();
+
+    auto task = std::make_shared<std::packaged_task<result_t()>>(
+            [pd_iface, nthr]() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+                omp_set_num_threads(nthr);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+                // No threadpool is active during creation, so the number of
+                // threads is the thread-local maximum concurrency.
+                threadpool_utils::get_threadlocal_max_concurrency() = nthr;
+#else
+                MAYBE_UNUSED(nthr);
+#endif
+                primitive_iface_t *p_iface = nullptr;
+                status_t status = primitive_create(&p_iface, pd_iface);
+                return result_t {p_iface, status};
+            });
+    future_ = task->get_future();
+    creation_pool_t::get().submit([task]() { (*task)(); });
+}
+
+dnnl_primitive_future::~dnnl_primitive_future() {
+    if (!future_.valid()) return;
+    // The primitive was never taken by the user.
+    auto result = future_.get();
+    if (result.first) result.first->release();
+}
+
+bool dnnl_primitive_future::is_ready() const {
+    return !future_.valid()
+            || future_.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+}
+
+status_t dnnl_primitive_future::get(primitive_iface_t **primitive_iface) {
+    if (!future_.valid()) return invalid_arguments;
+    auto result = future_.get();
+    *primitive_iface = result.first;
+    return result.second;
+}
+
+// API
+status_t dnnl_primitive_create_async(dnnl_primitive_future **future,
+        const primitive_desc_iface_t *primitive_desc_iface) {
+    if (utils::any_null(future, primitive_desc_iface))
+        return invalid_arguments;
+    return safe_ptr_assign(
+            *future, new dnnl_primitive_future(primitive_desc_iface));
+}
+
+status_t dnnl_primitive_future_is_ready(
+        const dnnl_primitive_future *future, int *is_ready) {
+    if (utils::any_null(future, is_ready)) return invalid_arguments;
+    *is_ready = future->is_ready();
+    return success;
+}
+
+status_t dnnl_primitive_future_get(
+        primitive_iface_t **primitive_iface, dnnl_primitive_future *future) {
+    if (utils::any_null(primitive_iface, future)) return invalid_arguments;
+    return future->get(primitive_iface);
+}
+
+status_t dnnl_primitive_future_destroy(dnnl_primitive_future *future) {
+    delete future;
+    return success;
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_FUTURE_HPP
+#define COMMON_PRIMITIVE_FUTURE_HPP
+
+#include <future>
+#include <memory>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+// dnnl_primitive_future is a user facing entity that represents a primitive
+// being created on a library-owned background thread.
+//
+// The creation goes through the regular primitive creation path, hence
+// through the primitive cache. The primitive cache stores a shared future for
+// every entry that is being created, so concurrent requests for the same
+// primitive (synchronous or asynchronous) wait for a single in-flight build
+// instead of generating the same kernels again.
+//
+// The primitive descriptor must outlive the future. Destroying a future
+// blocks until the background creation completes.
+struct dnnl_primitive_future : public dnnl::impl::c_compatible {
+    dnnl_primitive_future(const primitive_desc_iface_t *pd_iface);
+    ~dnnl_primitive_future();
+
+    // Returns true if the creation has completed (successfully or not) and
+    // get() will not block.
+    bool is_ready() const;
+
+    // Waits for the creation to complete and returns the created primitive.
+    // The ownership of the primitive is passed to the caller. Can be called
+    // only once.
+    dnnl::impl::status_t get(primitive_iface_t **primitive_iface);
+
+private:
+    using result_t = std::pair<primitive_iface_t *, dnnl::impl::status_t>;
+    std::future<result_t> future_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_future);
+};
+
+#endif
@@ -69,7 +69,9 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
+            CASE(group_normalization)
             CASE(inner_product)
             CASE(layer_normalization)
             CASE(lrn)
@@ -80,6 +82,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
@@ -162,6 +165,9 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            seed = get_array_hash(seed, md.format_desc.sparse_desc.block_dims,
+                    sparse_desc_t::max_block_ndims);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.ngroups);
             break;
 #endif
         default: assert(!"unknown format_kind");
@@ -197,6 +203,10 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.scratchpad_mode_));
     // fpmath_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_mode_));
+    // shared_weights
+    seed = hash_combine(seed, static_cast<size_t>(attr.shared_weights_));
+    // scheduling
+    seed = hash_combine(seed, static_cast<size_t>(attr.scheduling_));
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -208,6 +218,12 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             seed = hash_combine(seed, p.first);
             // scales: mask
             seed = hash_combine(seed, p.second.mask_);
+            // scales: groups
+            seed = hash_combine(seed, p.second.ndims_);
+            seed = get_array_hash(
+                    seed, p.second.group_dims_, p.second.ndims_);
+            // scales: data type
+            seed = hash_combine(seed, static_cast<size_t>(p.second.data_type_));
         }
     }
     // zero_points
@@ -219,7 +235,17 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             attr.zero_points_.get(arg, &mask);
             // zero_points: mask
             seed = hash_combine(seed, mask);
+            // zero_points: groups
+            const int ndims = attr.zero_points_.get_groups_ndims(arg);
+            seed = hash_combine(seed, ndims);
+            seed = get_array_hash(
+                    seed, attr.zero_points_.get_groups(arg), ndims);
+            // zero_points: data type
+            seed = hash_combine(seed,
+                    static_cast<size_t>(attr.zero_points_.get_data_type(arg)));
         }
+    // src_dynamic_quantization
+    seed = hash_combine(seed, static_cast<size_t>(attr.src_dyn_quant_dt_));
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
@@ -436,6 +462,40 @@ size_t get_desc_hash(const layer_normalization_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding_bag desc
+    return seed;
+}
+
+size_t get_desc_hash(const group_normalization_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.scaleshift_desc));
+    seed = hash_combine(seed, get_md_hash(desc.stat_desc));
+    // Groups
+    seed = hash_combine(seed, desc.groups);
+    // Epsilon
+    seed = hash_combine(seed, desc.group_norm_epsilon);
+    // Flags
+    seed = hash_combine(seed, desc.flags);
+    // Combined hash for group_normalization desc
+    return seed;
+}
+
 size_t get_desc_hash(const lrn_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -527,6 +587,23 @@ size_t get_desc_hash(const reduction_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const sdpa_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.q_desc));
+    seed = hash_combine(seed, get_md_hash(desc.k_desc));
+    seed = hash_combine(seed, get_md_hash(desc.v_desc));
+    seed = hash_combine(seed, get_md_hash(desc.mask_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Scale, flags
+    seed = hash_combine(seed, desc.scale);
+    seed = hash_combine(seed, desc.flags);
+    // Combined hash for sdpa desc
+    return seed;
+}
+
 size_t get_desc_hash(const reorder_desc_t &desc) {
     size_t seed = 0;
     // Kinds
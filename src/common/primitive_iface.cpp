@@ -17,12 +17,14 @@
 #include <string>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
 #include "ittnotify.hpp"
 #endif
 
+#include "perf_counters.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
@@ -32,6 +34,7 @@
 #include "scratchpad_debug.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -60,7 +63,7 @@ namespace impl {
 
 status_t primitive_create(primitive_iface_t **primitive_iface,
         const primitive_desc_iface_t *primitive_desc_iface,
-        const cache_blob_t &cache_blob = cache_blob_t()) {
+        const cache_blob_t &cache_blob) {
 
     std::pair<primitive_iface_t *, bool> p_iface;
 
@@ -92,14 +95,46 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
+    // The event covers the submission of the primitive, which is the whole
+    // execution for the synchronous CPU runtimes.
+    trace::scoped_event_t trace_event("primitive",
+            trace::is_enabled() ? primitive_iface->pd()->info() : nullptr, -1,
+            -1, /* is_current = */ true);
+
+    // Parallel loops of the primitive follow the scheduling mode from its
+    // attributes.
+    const scheduling_t prev_scheduling = get_scheduling();
+    set_scheduling(primitive_iface->pd()->attr()->scheduling_);
+
     if (verbose_has_exec_profile()) {
+        // Counters measure the host threads, so they are not reported for
+        // other devices. They are opened along with the verbose settings, so
+        // they are not touched unless requested.
+        const bool with_counters = verbose_has_profile_counters()
+                && stream->engine()->kind() == engine_kind::cpu
+                && perf_counters_t::get().is_open();
+        uint64_t start_values[perf_counters_t::n_counters] = {};
+        uint64_t values[perf_counters_t::n_counters] = {};
+
         stream->wait();
         double start_ms = get_msec();
+        if (with_counters) perf_counters_t::get().read(start_values);
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
+        if (with_counters) perf_counters_t::get().read(values);
         double duration_ms = get_msec() - start_ms;
-        VPROF(start_ms, exec, VERBOSE_profile, primitive_iface->pd()->info(),
-                duration_ms);
+        if (with_counters) {
+            using pc = perf_counters_t;
+            VFORMAT(start_ms, exec, VERBOSE_profile,
+                    "%s,%g,%" PRIu64 ",%" PRIu64 ",%" PRIu64,
+                    primitive_iface->pd()->info(), duration_ms,
+                    values[pc::cycles] - start_values[pc::cycles],
+                    values[pc::instructions] - start_values[pc::instructions],
+                    values[pc::llc_misses] - start_values[pc::llc_misses]);
+        } else {
+            VPROF(start_ms, exec, VERBOSE_profile,
+                    primitive_iface->pd()->info(), duration_ms);
+        }
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
     }
@@ -108,6 +143,8 @@ status_t primitive_execute(
     if (enable_itt) itt::primitive_task_end();
 #endif
 
+    set_scheduling(prev_scheduling);
+
     if (msan_enabled) unpoison_outputs(ctx.args());
 
     return status;
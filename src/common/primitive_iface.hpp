@@ -29,6 +29,9 @@
 
 namespace dnnl {
 namespace impl {
+status_t primitive_create(primitive_iface_t **primitive_iface,
+        const primitive_desc_iface_t *primitive_desc_iface,
+        const cache_blob_t &cache_blob = cache_blob_t());
 status_t primitive_execute(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx);
 }
@@ -330,6 +330,11 @@ status_t rnn_common_fwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 "num_layers != 1");
     }
 
+    // variable sequence lengths are not defined for the attention-based cells
+    VCONDCHECK_RNN(IMPLICATION(flags & rnn_flags::variable_sequence_length,
+                           !is_augru),
+            VERBOSE_BAD_FLAGS);
+
     VCHECK_RNN(
             check_runtime_dims_or_strides({src_layer_desc, src_iter_desc,
                     src_iter_c_desc, weights_layer_desc, weights_iter_desc,
@@ -434,6 +439,10 @@ status_t rnn_common_bwd_desc_init(rnn_desc_t *rnn_desc, prop_kind_t prop_kind,
                 VERBOSE_NULL_ARG);
     }
 
+    // backward propagation with variable sequence lengths is not supported
+    VCONDCHECK_RNN(!(flags & rnn_flags::variable_sequence_length),
+            VERBOSE_BAD_FLAGS);
+
     // check if optional md is provided then diff_md is provided too
     VCONDCHECK_RNN(xnor_md(bias_desc, diff_bias_desc), VERBOSE_NULL_ARG);
     VCONDCHECK_RNN(xnor_md(weights_peephole_desc, diff_weights_peephole_desc),
@@ -24,6 +24,8 @@
 #endif
 
 #include "scratchpad.hpp"
+#include "scratchpad_debug.hpp"
+#include "scratchpad_pool.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -58,6 +60,26 @@ memory_storage_t *create_scratchpad_memory_storage(
     return mem_storage;
 }
 
+scratchpad_pool_t *get_scratchpad_pool(engine_t *engine) {
+    // Protected scratchpads rely on the exact buffer layout.
+    if (scratchpad_debug::is_protect_scratchpad()) return nullptr;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::get_scratchpad_pool(engine);
+#else
+    MAYBE_UNUSED(engine);
+    return nullptr;
+#endif
+}
+
+int get_scratchpad_numa_node(engine_t *engine) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::get_numa_node(engine);
+#else
+    MAYBE_UNUSED(engine);
+    return -1;
+#endif
+}
+
 } // namespace
 
 /*
@@ -65,7 +87,20 @@ memory_storage_t *create_scratchpad_memory_storage(
   a concurrent execution
 */
 struct concurrent_scratchpad_t : public scratchpad_t {
-    concurrent_scratchpad_t(engine_t *engine, size_t size) {
+    concurrent_scratchpad_t(engine_t *engine, size_t size)
+        : pool_(get_scratchpad_pool(engine)) {
+        // The buffer is recycled through the engine pool if there is one, so
+        // that creating a primitive does not need to allocate memory in the
+        // steady state. The engine is retained to keep the pool alive until
+        // the buffer is returned.
+        if (pool_) {
+            engine_ = engine;
+            engine_->retain();
+            mem_storage_ = pool_->acquire(engine, size, size_);
+            if (!mem_storage_) size_ = 0;
+            return;
+        }
+
         auto *mem_storage = create_scratchpad_memory_storage(engine, size);
         size_ = size;
         if (mem_storage == nullptr) size_ = 0;
@@ -73,6 +108,12 @@ struct concurrent_scratchpad_t : public scratchpad_t {
         mem_storage_.reset(mem_storage);
     }
 
+    ~concurrent_scratchpad_t() override {
+        if (!pool_) return;
+        if (mem_storage_) pool_->release(std::move(mem_storage_), size_);
+        engine_->release();
+    }
+
     const memory_storage_t *get_memory_storage() const override {
         return mem_storage_.get();
     }
@@ -80,6 +121,8 @@ struct concurrent_scratchpad_t : public scratchpad_t {
     size_t size() const override { return size_; }
 
 private:
+    scratchpad_pool_t *pool_;
+    engine_t *engine_ = nullptr;
     std::unique_ptr<memory_storage_t> mem_storage_;
     size_t size_;
 
@@ -94,16 +137,21 @@ private:
 struct global_scratchpad_t : public scratchpad_t {
     global_scratchpad_t(engine_t *engine, size_t size) {
         // TODO: check if engine is the same
-        if (size > size_) {
+        // The scratchpad is reallocated when an engine bound to another NUMA
+        // node uses it, so that the memory stays local to the threads.
+        const int numa_node = get_scratchpad_numa_node(engine);
+        if (size > size_ || numa_node != numa_node_) {
             delete mem_storage_;
             // Try to expand the global scratchpad to the necessary size
-            mem_storage_ = create_scratchpad_memory_storage(engine, size);
+            const size_t new_size = nstl::max(size, size_);
+            mem_storage_ = create_scratchpad_memory_storage(engine, new_size);
             if (mem_storage_ == nullptr) {
                 // Recreate scratchpad with original capacity
                 mem_storage_ = create_scratchpad_memory_storage(engine, size_);
                 if (mem_storage_ == nullptr) size_ = 0;
             } else
-                size_ = size;
+                size_ = new_size;
+            numa_node_ = numa_node;
         }
         reference_count_++;
     }
@@ -114,6 +162,7 @@ struct global_scratchpad_t : public scratchpad_t {
             delete mem_storage_;
             mem_storage_ = nullptr;
             size_ = 0;
+            numa_node_ = -1;
         }
     }
 
@@ -126,6 +175,7 @@ struct global_scratchpad_t : public scratchpad_t {
 private:
     thread_local static memory_storage_t *mem_storage_;
     thread_local static size_t size_;
+    thread_local static int numa_node_;
     thread_local static unsigned int reference_count_;
 };
 
@@ -136,6 +186,7 @@ private:
 // Tested by tests/gtests/test_global_scratchad.cpp
 thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
+thread_local int global_scratchpad_t::numa_node_ = -1;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
 /*
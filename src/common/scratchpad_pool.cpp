@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "engine.hpp"
+#include "utils.hpp"
+
+#include "scratchpad_pool.hpp"
+
+namespace dnnl {
+namespace impl {
+
+scratchpad_pool_t::scratchpad_pool_t() : stats_() {
+    static const size_t default_capacity
+            = (size_t)nstl::max(
+                      0, getenv_int_user("SCRATCHPAD_POOL_CAPACITY", 256))
+            << 20;
+    capacity_ = default_capacity;
+}
+
+size_t scratchpad_pool_t::size_class(size_t size) {
+    const size_t min_size = 4096;
+    if (size <= min_size) return min_size;
+
+    size_t pow2 = min_size;
+    while (pow2 <= size / 2)
+        pow2 *= 2;
+    return utils::rnd_up(size, pow2 / 4);
+}
+
+std::unique_ptr<memory_storage_t> scratchpad_pool_t::acquire(
+        engine_t *engine, size_t size, size_t &block_size) {
+    block_size = size_class(size);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = free_blocks_.find(block_size);
+        if (it != free_blocks_.end() && !it->second.empty()) {
+            std::unique_ptr<memory_storage_t> block
+                    = std::move(it->second.back());
+            it->second.pop_back();
+            stats_.reuses++;
+            stats_.bytes_cached -= block_size;
+            stats_.bytes_in_use += block_size;
+            return block;
+        }
+    }
+
+    // Allocate outside of the lock so that other threads are not blocked by
+    // the system allocator.
+    memory_storage_t *mem_storage = nullptr;
+    auto status = engine->create_memory_storage(&mem_storage, block_size);
+    if (status != status::success || mem_storage == nullptr) return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.allocations++;
+    stats_.bytes_in_use += block_size;
+    stats_.peak_bytes = nstl::max(
+            stats_.peak_bytes, stats_.bytes_in_use + stats_.bytes_cached);
+    return std::unique_ptr<memory_storage_t>(mem_storage);
+}
+
+void scratchpad_pool_t::release(
+        std::unique_ptr<memory_storage_t> &&block, size_t block_size) {
+    std::unique_ptr<memory_storage_t> to_free;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.bytes_in_use -= block_size;
+        if (stats_.bytes_cached + block_size > capacity_) {
+            stats_.evictions++;
+            to_free = std::move(block);
+        } else {
+            stats_.bytes_cached += block_size;
+            free_blocks_[block_size].push_back(std::move(block));
+        }
+    }
+    // `to_free` is destroyed outside of the lock.
+}
+
+void scratchpad_pool_t::evict_to_fit(size_t size) {
+    for (auto it = free_blocks_.begin();
+            it != free_blocks_.end() && stats_.bytes_cached > size;) {
+        auto &blocks = it->second;
+        while (!blocks.empty() && stats_.bytes_cached > size) {
+            blocks.pop_back();
+            stats_.bytes_cached -= it->first;
+            stats_.evictions++;
+        }
+        it = blocks.empty() ? free_blocks_.erase(it) : std::next(it);
+    }
+}
+
+void scratchpad_pool_t::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    evict_to_fit(capacity_);
+}
+
+size_t scratchpad_pool_t::capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+dnnl_scratchpad_pool_stats_t scratchpad_pool_t::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace impl
+} // namespace dnnl
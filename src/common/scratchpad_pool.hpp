@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SCRATCHPAD_POOL_HPP
+#define COMMON_SCRATCHPAD_POOL_HPP
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_storage.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A pool of scratchpad buffers of an engine. The requested sizes are rounded
+// up to size classes with a step of a quarter of the size's power of two, so
+// that the buffers of primitives with close scratchpad sizes are
+// interchangeable and at most 25% of a buffer is wasted. Released buffers are
+// cached until their total size reaches the capacity; the rest are freed.
+struct scratchpad_pool_t {
+    scratchpad_pool_t();
+    ~scratchpad_pool_t() = default;
+
+    // Returns a buffer of at least `size` bytes or nullptr if the allocation
+    // fails. `block_size` is set to the actual size of the buffer.
+    std::unique_ptr<memory_storage_t> acquire(
+            engine_t *engine, size_t size, size_t &block_size);
+    void release(std::unique_ptr<memory_storage_t> &&block, size_t block_size);
+
+    void set_capacity(size_t capacity);
+    size_t capacity() const;
+    dnnl_scratchpad_pool_stats_t stats() const;
+
+    static size_t size_class(size_t size);
+
+private:
+    void evict_to_fit(size_t size);
+
+    mutable std::mutex mutex_;
+    size_t capacity_;
+    std::unordered_map<size_t, std::vector<std::unique_ptr<memory_storage_t>>>
+            free_blocks_;
+    dnnl_scratchpad_pool_stats_t stats_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_pool_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_SDPA(cond, msg, ...) \
+    VCONDCHECK(create, check, sdpa, (cond), status::invalid_arguments, msg, \
+            ##__VA_ARGS__);
+
+namespace {
+status_t sdpa_desc_init(sdpa_desc_t *sdpa_desc, const memory_desc_t *q_desc,
+        const memory_desc_t *k_desc, const memory_desc_t *v_desc,
+        const memory_desc_t *mask_desc, const memory_desc_t *dst_desc,
+        float scale, unsigned flags) {
+    VCHECK_SDPA(!any_null(q_desc, k_desc, v_desc, dst_desc), VERBOSE_NULL_ARG);
+
+    auto sd = sdpa_desc_t();
+    sd.primitive_kind = primitive_kind::sdpa;
+    sd.q_desc = *q_desc;
+    sd.k_desc = *k_desc;
+    sd.v_desc = *v_desc;
+    if (mask_desc) sd.mask_desc = *mask_desc;
+    sd.dst_desc = *dst_desc;
+    sd.scale = scale;
+    sd.flags = flags;
+
+    VCHECK_SDPA((flags & ~sdpa_flags::causal_mask) == 0, VERBOSE_BAD_FLAGS);
+
+    const bool with_mask = sd.mask_desc.ndims != 0;
+    const int ndims = q_desc->ndims;
+    VCHECK_SDPA(ndims >= 2 && ndims <= DNNL_MAX_NDIMS, VERBOSE_BAD_NDIMS,
+            "queries", ndims);
+    VCHECK_SDPA(everyone_is(ndims, k_desc->ndims, v_desc->ndims),
+            VERBOSE_INCONSISTENT_NDIMS, "keys", "values");
+    VCHECK_SDPA(dst_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS,
+            "queries", "dst");
+    VCHECK_SDPA(IMPLICATION(with_mask, sd.mask_desc.ndims == ndims),
+            VERBOSE_INCONSISTENT_NDIMS, "queries", "mask");
+
+    for (auto md : {q_desc, k_desc, v_desc, dst_desc})
+        VCHECK_SDPA(!memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // check: S_q, S_kv, D, D_v
+    const int s_idx = ndims - 2;
+    const int d_idx = ndims - 1;
+    VCHECK_SDPA(k_desc->dims[d_idx] == q_desc->dims[d_idx],
+            VERBOSE_INCONSISTENT_DIM, "keys", d_idx, "queries", d_idx);
+    VCHECK_SDPA(v_desc->dims[s_idx] == k_desc->dims[s_idx],
+            VERBOSE_INCONSISTENT_DIM, "values", s_idx, "keys", s_idx);
+    VCHECK_SDPA(dst_desc->dims[s_idx] == q_desc->dims[s_idx],
+            VERBOSE_INCONSISTENT_DIM, "dst", s_idx, "queries", s_idx);
+    VCHECK_SDPA(dst_desc->dims[d_idx] == v_desc->dims[d_idx],
+            VERBOSE_INCONSISTENT_DIM, "dst", d_idx, "values", d_idx);
+
+    // check: batch dimensions match, the mask may be broadcast.
+    for (int d = 0; d < s_idx; ++d) {
+        VCHECK_SDPA(everyone_is(q_desc->dims[d], k_desc->dims[d],
+                            v_desc->dims[d], dst_desc->dims[d]),
+                VERBOSE_INCONSISTENT_DIM, "queries", d, "keys", d);
+        VCHECK_SDPA(IMPLICATION(with_mask,
+                            one_of(sd.mask_desc.dims[d], 1, q_desc->dims[d])),
+                VERBOSE_INVALID_BROADCAST, "mask", d);
+    }
+    VCHECK_SDPA(IMPLICATION(with_mask,
+                        one_of(sd.mask_desc.dims[s_idx], 1,
+                                q_desc->dims[s_idx])),
+            VERBOSE_INVALID_BROADCAST, "mask", s_idx);
+    VCHECK_SDPA(IMPLICATION(with_mask,
+                        one_of(sd.mask_desc.dims[d_idx], 1,
+                                k_desc->dims[s_idx])),
+            VERBOSE_INVALID_BROADCAST, "mask", d_idx);
+
+    *sdpa_desc = sd;
+    return success;
+}
+} // namespace
+
+status_t dnnl_sdpa_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *q_desc, const memory_desc_t *k_desc,
+        const memory_desc_t *v_desc, const memory_desc_t *mask_desc,
+        const memory_desc_t *dst_desc, float scale, unsigned flags,
+        const primitive_attr_t *attr) {
+    auto sdpa_desc = sdpa_desc_t();
+    CHECK(sdpa_desc_init(&sdpa_desc, q_desc, k_desc, v_desc, mask_desc,
+            dst_desc, scale, flags));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&sdpa_desc, nullptr, attr);
+}
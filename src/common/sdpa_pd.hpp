@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SDPA_PD_HPP
+#define COMMON_SDPA_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct sdpa_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::sdpa;
+
+    typedef sdpa_pd_t base_class;
+    typedef sdpa_pd_t hint_class;
+
+    const sdpa_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alpha_f32: *(float *)result = desc()->scale; break;
+            case query::flags: *(unsigned *)result = desc()->flags; break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(
+                    arg, DNNL_ARG_QUERIES, DNNL_ARG_KEYS, DNNL_ARG_VALUES))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ATTN_MASK && with_mask())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_QUERIES: return src_md(0);
+            case DNNL_ARG_KEYS: return src_md(1);
+            case DNNL_ARG_VALUES: return src_md(2);
+            case DNNL_ARG_ATTN_MASK: return src_md(3);
+            case DNNL_ARG_DST: return dst_md(0);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(int index = 0) const override {
+        switch (index) {
+            case 0: return &q_md_;
+            case 1: return &k_md_;
+            case 2: return &v_md_;
+            case 3: return with_mask() ? &mask_md_ : &glob_zero_md;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    const memory_desc_t *qry_md() const { return &q_md_; }
+    const memory_desc_t *key_md() const { return &k_md_; }
+    const memory_desc_t *val_md() const { return &v_md_; }
+    const memory_desc_t *msk_md() const { return &mask_md_; }
+
+    int n_inputs() const override { return 3 + with_mask(); }
+    int n_outputs() const override { return 1; }
+
+    bool with_mask() const { return !memory_desc_wrapper(mask_md_).is_zero(); }
+    bool with_causal_mask() const {
+        return desc_.flags & sdpa_flags::causal_mask;
+    }
+
+    int ndims() const { return q_md_.ndims; }
+    bool has_zero_dim_memory() const {
+        for (auto md : {&q_md_, &k_md_, &v_md_, &dst_md_})
+            if (memory_desc_wrapper(md).has_zero_dim()) return true;
+        return false;
+    }
+    // The product of all the dimensions except the last two.
+    dim_t batch() const {
+        return utils::array_product(q_md_.dims, ndims() - 2);
+    }
+    dim_t queries() const { return q_md_.dims[ndims() - 2]; }
+    dim_t keys() const { return k_md_.dims[ndims() - 2]; }
+    dim_t head_size() const { return q_md_.dims[ndims() - 1]; }
+    dim_t value_head_size() const { return v_md_.dims[ndims() - 1]; }
+
+protected:
+    sdpa_desc_t desc_;
+
+    memory_desc_t q_md_;
+    memory_desc_t k_md_;
+    memory_desc_t v_md_;
+    memory_desc_t mask_md_;
+    memory_desc_t dst_md_;
+
+    sdpa_pd_t(const sdpa_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , q_md_(desc_.q_desc)
+        , k_md_(desc_.k_desc)
+        , v_md_(desc_.v_desc)
+        , mask_md_(desc_.mask_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    // Initializes the memory descriptors with `any` format with plain
+    // layouts.
+    status_t set_default_params() {
+        for (auto md : {&q_md_, &k_md_, &v_md_, &dst_md_})
+            if (md->format_kind == format_kind::any)
+                CHECK(memory_desc_init_by_strides(*md, nullptr));
+        if (with_mask() && mask_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(mask_md_, nullptr));
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -36,8 +36,10 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(inner_product)
         CASE(gemm)
+        CASE(group_normalization)
         CASE(layer_normalization)
         CASE(lrn)
         CASE(matmul)
@@ -47,6 +49,7 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
@@ -135,6 +138,10 @@ void serialize_attr(
     sstream.write(&attr.scratchpad_mode_);
     // fpmath_mode
     sstream.write(&attr.fpmath_mode_);
+    // shared_weights
+    sstream.write(&attr.shared_weights_);
+    // scheduling
+    sstream.write(&attr.scheduling_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -144,6 +151,9 @@ void serialize_attr(
         for (const auto &p : attr.scales_.scales_) {
             sstream.write(&p.first);
             sstream.write(&p.second.mask_);
+            sstream.write(&p.second.ndims_);
+            sstream.write(p.second.group_dims_, p.second.ndims_);
+            sstream.write(&p.second.data_type_);
         }
     }
     // zero_points
@@ -155,7 +165,16 @@ void serialize_attr(
             attr.zero_points_.get(arg, &mask);
             // zero_points: mask
             sstream.write(&mask);
+            // zero_points: groups
+            const int ndims = attr.zero_points_.get_groups_ndims(arg);
+            sstream.write(&ndims);
+            sstream.write(attr.zero_points_.get_groups(arg), ndims);
+            // zero_points: data type
+            const data_type_t dt = attr.zero_points_.get_data_type(arg);
+            sstream.write(&dt);
         }
+    // src_dynamic_quantization
+    sstream.write(&attr.src_dyn_quant_dt_);
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
@@ -344,6 +363,36 @@ void serialize_desc(serialization_stream_t &sstream,
     sstream.write(&desc.flags);
 }
 
+void serialize_desc(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.indices_desc);
+    serialize_md(sstream, desc.offsets_desc);
+    serialize_md(sstream, desc.dst_desc);
+}
+
+void serialize_desc(serialization_stream_t &sstream,
+        const group_normalization_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.prop_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.scaleshift_desc);
+    serialize_md(sstream, desc.stat_desc);
+    // Groups
+    sstream.write(&desc.groups);
+    // Epsilon
+    sstream.write(&desc.group_norm_epsilon);
+    // Flags
+    sstream.write(&desc.flags);
+}
+
 void serialize_desc(serialization_stream_t &sstream, const lrn_desc_t &desc) {
     // Kinds
     sstream.write(&desc.primitive_kind);
@@ -423,6 +472,20 @@ void serialize_desc(
     sstream.write(&desc.eps);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.q_desc);
+    serialize_md(sstream, desc.k_desc);
+    serialize_md(sstream, desc.v_desc);
+    serialize_md(sstream, desc.mask_desc);
+    serialize_md(sstream, desc.dst_desc);
+    // Scale, flags
+    sstream.write(&desc.scale);
+    sstream.write(&desc.flags);
+}
+
 void serialize_desc(
         serialization_stream_t &sstream, const reorder_desc_t &desc) {
     // Kinds
@@ -43,6 +43,10 @@ void serialize_desc(
         serialization_stream_t &sstream, const inner_product_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream,
         const layer_normalization_desc_t &desc);
+void serialize_desc(serialization_stream_t &sstream,
+        const group_normalization_desc_t &desc);
+void serialize_desc(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const lrn_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const matmul_desc_t &desc);
 void serialize_desc(
@@ -50,6 +54,8 @@ void serialize_desc(
 void serialize_desc(serialization_stream_t &sstream, const prelu_desc_t &desc);
 void serialize_desc(
         serialization_stream_t &sstream, const reduction_desc_t &desc);
+void serialize_desc(
+        serialization_stream_t &sstream, const sdpa_desc_t &desc);
 void serialize_desc(
         serialization_stream_t &sstream, const reorder_desc_t &desc);
 void serialize_desc(
@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/profiler.hpp"
+#include "common/trace.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace trace {
+
+namespace {
+
+struct event_t {
+    const char *category;
+    int name_idx;
+    double start_ms;
+    double end_ms;
+    int ithr;
+    int nthr;
+};
+
+struct thread_buffer_t {
+    thread_buffer_t(int tid) : tid_(tid) { events_.reserve(1024); }
+
+    void record(const char *category, const char *name, double start_ms,
+            double end_ms, int ithr, int nthr) {
+        if (events_.size() >= (size_t)max_events_per_thread) {
+            n_dropped_++;
+            return;
+        }
+        events_.push_back(
+                {category, intern(name), start_ms, end_ms, ithr, nthr});
+    }
+
+    int tid_;
+    size_t n_dropped_ = 0;
+    std::vector<event_t> events_;
+    std::vector<std::string> names_;
+
+private:
+    // Names are stored once per thread. A thread mostly records the chunks
+    // of the same primitive in a row, so the last name is checked first to
+    // avoid a lookup and a string allocation per event.
+    int intern(const char *name) {
+        if (name == last_name_ && names_[last_name_idx_] == name)
+            return last_name_idx_;
+        const auto it = name_ids_.find(name);
+        if (it != name_ids_.end()) {
+            last_name_idx_ = it->second;
+        } else {
+            last_name_idx_ = (int)names_.size();
+            names_.emplace_back(name);
+            name_ids_.emplace(names_.back(), last_name_idx_);
+        }
+        last_name_ = name;
+        return last_name_idx_;
+    }
+
+    std::unordered_map<std::string, int> name_ids_;
+    const char *last_name_ = nullptr;
+    int last_name_idx_ = -1;
+};
+
+// Owns the buffers of all the threads, so that the events of the threads
+// which have already exited are kept until the trace is written at the
+// process exit.
+struct registry_t {
+    registry_t() : path_(get_path()), start_ms_(get_msec()) {}
+    ~registry_t() { dump(); }
+
+    void dump() {
+        if (!is_enabled()) return;
+        FILE *f = fopen(path_.c_str(), "w");
+        if (!f) return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        fprintf(f, "{\"traceEvents\":[");
+        const char *sep = "\n";
+        for (const auto &b : buffers_) {
+            fprintf(f,
+                    "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                    "\"tid\":%d,\"args\":{\"name\":\"thread %d\"",
+                    sep, b->tid_, b->tid_);
+            if (b->n_dropped_)
+                fprintf(f, ",\"dropped_events\":%zu", b->n_dropped_);
+            fprintf(f, "}}");
+            sep = ",\n";
+            for (const auto &e : b->events_) {
+                fprintf(f, "%s{\"name\":", sep);
+                print_string(f, b->names_[e.name_idx].c_str());
+                fprintf(f,
+                        ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,"
+                        "\"ts\":%.3f,\"dur\":%.3f",
+                        e.category, b->tid_, 1e3 * (e.start_ms - start_ms_),
+                        1e3 * (e.end_ms - e.start_ms));
+                if (e.ithr >= 0)
+                    fprintf(f, ",\"args\":{\"ithr\":%d,\"nthr\":%d}", e.ithr,
+                            e.nthr);
+                fprintf(f, "}");
+            }
+        }
+        fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+        fclose(f);
+    }
+
+    bool is_enabled() const { return !path_.empty(); }
+
+    thread_buffer_t *register_thread() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const int tid = (int)buffers_.size();
+        buffers_.emplace_back(new thread_buffer_t(tid));
+        return buffers_.back().get();
+    }
+
+private:
+    static std::string get_path() {
+        const int len = 1024;
+        char value[len];
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix) + "TRACE";
+            if (getenv(name.c_str(), value, len) > 0) return value;
+        }
+        return std::string();
+    }
+
+    static void print_string(FILE *f, const char *s) {
+        fputc('"', f);
+        for (; *s; ++s) {
+            if (*s == '"' || *s == '\\') fputc('\\', f);
+            fputc(*s, f);
+        }
+        fputc('"', f);
+    }
+
+    std::string path_;
+    double start_ms_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<thread_buffer_t>> buffers_;
+};
+
+registry_t &registry() {
+    static registry_t r;
+    return r;
+}
+
+thread_local thread_buffer_t *thread_buffer = nullptr;
+thread_local const char *current_name = nullptr;
+
+} // namespace
+
+bool is_enabled() {
+    // Assumes that all threads see the same environment
+    static const bool enabled = registry().is_enabled();
+    return enabled;
+}
+
+const char *get_current_name() {
+    return current_name ? current_name : "parallel";
+}
+
+void record(const char *category, const char *name, double start_ms, int ithr,
+        int nthr) {
+    if (!is_enabled()) return;
+    const double end_ms = get_msec();
+    if (!thread_buffer) thread_buffer = registry().register_thread();
+    thread_buffer->record(category, name, start_ms, end_ms, ithr, nthr);
+}
+
+void dump() {
+    registry().dump();
+}
+
+scoped_event_t::scoped_event_t(const char *category, const char *name,
+        int ithr, int nthr, bool is_current)
+    : category_(is_enabled() ? category : nullptr)
+    , name_(name)
+    , ithr_(ithr)
+    , nthr_(nthr)
+    , is_current_(is_current) {
+    if (!category_) return;
+    if (is_current_) {
+        prev_name_ = current_name;
+        current_name = name_;
+    }
+    start_ms_ = get_msec();
+}
+
+scoped_event_t::~scoped_event_t() {
+    if (!category_) return;
+    record(category_, name_, start_ms_, ithr_, nthr_);
+    if (is_current_) current_name = prev_name_;
+}
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
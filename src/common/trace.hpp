@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TRACE_HPP
+#define COMMON_TRACE_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+namespace dnnl {
+namespace impl {
+namespace trace {
+
+// Execution timeline tracing. When the `ONEDNN_TRACE` environment variable
+// names a file, the library records on every thread the execution of
+// primitives, graph partitions and chunks of parallel sections, and writes
+// the events to that file in the Chrome trace event format at the process
+// exit. The file can be opened with `chrome://tracing` or Perfetto to see how
+// the work is distributed between the threads.
+//
+// The events are kept in per-thread buffers, so recording an event does not
+// take any locks. Each buffer keeps at most `max_events_per_thread` events,
+// the rest are counted and the count is reported in the trace. Event names are
+// stored once per thread. The time stamps come from the same clock as the
+// verbose mode and the profiler (see `get_msec()`).
+
+const int max_events_per_thread = 1 << 18;
+
+// Returns true if tracing is enabled.
+bool DNNL_API is_enabled();
+
+// Returns the name of the primitive executed by the calling thread or
+// "parallel" if there is none. Used to name the chunks of parallel sections.
+const char DNNL_API *get_current_name();
+
+// Records a complete event which started at `start_ms` on the calling thread
+// and lasted until now. The name is copied. The thread index and the number
+// of threads are recorded for chunks of parallel sections when `ithr` is not
+// negative.
+void DNNL_API record(const char *category, const char *name, double start_ms,
+        int ithr = -1, int nthr = -1);
+
+// Writes the events recorded so far to the trace file. Called at the process
+// exit, must not run concurrently with recording.
+void DNNL_API dump();
+
+// Records an event for the lifetime of the object if tracing is enabled.
+// When `is_current` is set, the name is also reported by `get_current_name()`
+// until the end of the event.
+struct scoped_event_t {
+    DNNL_API scoped_event_t(const char *category, const char *name,
+            int ithr = -1, int nthr = -1, bool is_current = false);
+    DNNL_API ~scoped_event_t();
+
+private:
+    const char *category_;
+    const char *name_;
+    const char *prev_name_ = nullptr;
+    int ithr_;
+    int nthr_;
+    bool is_current_;
+    double start_ms_ = 0;
+
+    scoped_event_t(const scoped_event_t &) = delete;
+    scoped_event_t &operator=(const scoped_event_t &) = delete;
+};
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -83,6 +83,13 @@ namespace types {
 inline size_t data_type_size(data_type_t data_type) {
     using namespace data_type;
     switch ((int)data_type) {
+        // 4-bit data types occupy a byte per pair of elements, the size of a
+        // single unpacked element is returned.
+        case s4: return sizeof(prec_traits<s4>::type);
+        case u4: return sizeof(prec_traits<u4>::type);
+        case nf4: return sizeof(prec_traits<nf4>::type);
+        case f8_e5m2: return sizeof(prec_traits<f8_e5m2>::type);
+        case f8_e4m3: return sizeof(prec_traits<f8_e4m3>::type);
         case f16: return sizeof(prec_traits<f16>::type);
         case bf16: return sizeof(prec_traits<bf16>::type);
         case tf32: // the tf32 type is an f32
@@ -97,6 +104,12 @@ inline size_t data_type_size(data_type_t data_type) {
     return (size_t)-1; /* not supposed to be reachable */
 }
 
+// Returns true for the data types which pack two elements into a byte.
+inline bool is_4bit(data_type_t data_type) {
+    using namespace data_type;
+    return utils::one_of(data_type, s4, u4, nf4);
+}
+
 template <typename T>
 inline T max_value(data_type_t data_type) {
     using namespace data_type;
@@ -104,6 +117,11 @@ inline T max_value(data_type_t data_type) {
     case x: \
         return static_cast<T>(nstl::numeric_limits<prec_traits<x>::type>::max())
     switch (data_type) {
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
+        CASE(s4);
+        CASE(u4);
+        CASE(nf4);
         CASE(f16);
         CASE(bf16);
         CASE(s32);
@@ -125,6 +143,11 @@ inline float max_value(data_type_t data_type) {
         return static_cast<float>( \
                 nstl::numeric_limits<prec_traits<x>::type>::max())
     switch (data_type) {
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
+        CASE(s4);
+        CASE(u4);
+        CASE(nf4);
         CASE(f16);
         CASE(bf16);
         CASE(s8);
@@ -240,6 +263,9 @@ inline bool sparse_desc_is_equal(
 
     for (int i = 0; i < sparse_desc_t::max_metadata_types; i++)
         ok = ok && lhs.metadata_types[i] == rhs.metadata_types[i];
+    for (int i = 0; i < sparse_desc_t::max_block_ndims; i++)
+        ok = ok && lhs.block_dims[i] == rhs.block_dims[i];
+    ok = ok && lhs.ngroups == rhs.ngroups;
 
     return ok;
 }
@@ -263,6 +289,9 @@ inline data_type_t default_accum_data_type(
     // true
     if (one_of(src_dt, s8, u8) && (dst_dt != f32 || strict)) return s32;
 
+    if (one_of(f8_e5m2, src_dt, dst_dt)) return f32;
+    if (is_4bit(src_dt) || is_4bit(dst_dt)) return f32;
+    if (one_of(f8_e4m3, src_dt, dst_dt)) return f32;
     if (one_of(f16, src_dt, dst_dt)) return f32;
     if (one_of(bf16, src_dt, dst_dt)) return f32;
     if (one_of(f32, src_dt, dst_dt)) return f32;
@@ -298,6 +327,9 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
 
     if (one_of(bf16, src_dt, wei_dt, dst_dt)) return f32;
     if (one_of(f16, src_dt, wei_dt, dst_dt)) return f32;
+    if (one_of(f8_e5m2, src_dt, wei_dt, dst_dt)) return f32;
+    if (one_of(f8_e4m3, src_dt, wei_dt, dst_dt)) return f32;
+    if (is_4bit(src_dt) || is_4bit(wei_dt) || is_4bit(dst_dt)) return f32;
 
     return data_type::undef;
 }
@@ -341,6 +373,30 @@ inline void cvt_to_float<float16_t>(
     cvt_float16_to_float(out, inp, nelems);
 }
 
+template <>
+inline void cvt_from_float<float8_e5m2_t>(
+        float8_e5m2_t *out, const float *inp, size_t nelems) {
+    cvt_float_to_float8_e5m2(out, inp, nelems);
+}
+
+template <>
+inline void cvt_to_float<float8_e5m2_t>(
+        float *out, const float8_e5m2_t *inp, size_t nelems) {
+    cvt_float8_e5m2_to_float(out, inp, nelems);
+}
+
+template <>
+inline void cvt_from_float<float8_e4m3_t>(
+        float8_e4m3_t *out, const float *inp, size_t nelems) {
+    cvt_float_to_float8_e4m3(out, inp, nelems);
+}
+
+template <>
+inline void cvt_to_float<float8_e4m3_t>(
+        float *out, const float8_e4m3_t *inp, size_t nelems) {
+    cvt_float8_e4m3_to_float(out, inp, nelems);
+}
+
 inline void cvt_from_float(
         data_type_t dt, void *out, const float *inp, size_t nelems) {
     switch (dt) {
@@ -350,6 +406,12 @@ inline void cvt_from_float(
         case data_type::f16:
             cvt_from_float((float16_t *)out, inp, nelems);
             break;
+        case data_type::f8_e5m2:
+            cvt_from_float((float8_e5m2_t *)out, inp, nelems);
+            break;
+        case data_type::f8_e4m3:
+            cvt_from_float((float8_e4m3_t *)out, inp, nelems);
+            break;
         default: assert(!"unimplemented");
     }
 }
@@ -514,6 +576,31 @@ inline bool operator==(
      return ret;
 }
 
+inline bool operator==(
+        const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
+inline bool operator==(const group_normalization_desc_t &lhs,
+        const group_normalization_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(scaleshift_desc)
+            && COMPARE_DESC_MEMBERS(stat_desc)
+            && COMPARE_DESC_MEMBERS(groups)
+            && COMPARE_FLOAT_DESC_MEMBERS(group_norm_epsilon)
+            && COMPARE_DESC_MEMBERS(flags);
+    return ret;
+}
+
 inline bool operator==(const lrn_desc_t &lhs, const lrn_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind)
@@ -580,6 +667,18 @@ inline bool operator==(
     return ret;
 }
 
+inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(q_desc)
+            && COMPARE_DESC_MEMBERS(k_desc)
+            && COMPARE_DESC_MEMBERS(v_desc)
+            && COMPARE_DESC_MEMBERS(mask_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_FLOAT_DESC_MEMBERS(scale)
+            && COMPARE_DESC_MEMBERS(flags);
+    return ret;
+}
+
 inline bool operator==(const reorder_desc_t &lhs, const reorder_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && DEREF_AND_COMPARE_DESC_MEMBERS(src_md)
@@ -922,7 +1021,8 @@ inline bool memory_desc_sanity_check(int ndims, const dims_t dims,
     if (ndims == 0) return true;
 
     bool ok = dims != nullptr && 0 < ndims && ndims <= DNNL_MAX_NDIMS
-            && utils::one_of(data_type, f16, bf16, f32, f64, s32, s8, u8);
+            && utils::one_of(data_type, f16, bf16, f32, f64, s32, s8, u8,
+                    f8_e5m2, f8_e4m3, s4, u4, nf4);
     if (!ok) return false;
 
     bool has_runtime_dims = false;
@@ -954,7 +1054,9 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(convolution);
         CASE_OP_DESC(deconvolution);
         CASE_OP_DESC(eltwise);
+        CASE_OP_DESC(embedding_bag);
         CASE_OP_DESC(gemm);
+        CASE_OP_DESC(group_normalization);
         CASE_OP_DESC(inner_product);
         CASE_OP_DESC(layer_normalization);
         CASE_OP_DESC(lrn);
@@ -964,6 +1066,7 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(reduction);
         CASE_OP_DESC(resampling);
         CASE_OP_DESC(rnn);
+        CASE_OP_DESC(sdpa);
         CASE_OP_DESC(shuffle);
         CASE_OP_DESC(softmax);
 
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "common/c_types_map.hpp"
+#include "cpu/platform.hpp"
+
+// The ukernel API is implemented for x64 CPUs only, see
+// cpu/x64/brgemm/capi/brgemm_api.cpp. Other builds report that nothing is
+// supported. Objects can never be created, so destructors are no-ops.
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE || !DNNL_X64
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+status_t dnnl_brgemm_create(dnnl_brgemm_t *brgemm, dim_t M, dim_t N, dim_t K,
+        dim_t batch_size, dim_t lda, dim_t ldb, dim_t ldc, data_type_t a_dt,
+        data_type_t b_dt, data_type_t c_dt) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_set_add_C(dnnl_brgemm_t brgemm, int add_C) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_set_post_ops(dnnl_brgemm_t brgemm, dim_t ldd,
+        data_type_t d_dt, const post_ops_t *post_ops) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_finalize(dnnl_brgemm_t brgemm) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_get_B_pack_type(
+        dnnl_pack_type_t *pack_type, data_type_t a_dt, data_type_t b_dt) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_get_scratchpad_size(
+        const_dnnl_brgemm_t brgemm, size_t *size) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_set_hw_context(const_dnnl_brgemm_t brgemm) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_release_hw_context() {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_generate(dnnl_brgemm_t brgemm) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_execute(const_dnnl_brgemm_t brgemm, const void *A_ptr,
+        const void *B_ptr, const dim_t *A_B_offsets, void *C_ptr,
+        void *scratchpad_ptr) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_execute_postops(const_dnnl_brgemm_t brgemm,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        void *C_ptr, void *D_ptr, void *scratchpad_ptr) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_destroy(dnnl_brgemm_t brgemm) {
+    return success;
+}
+
+status_t dnnl_brgemm_pack_B_create(dnnl_brgemm_pack_B_t *pack_B, dim_t K,
+        dim_t N, dim_t in_ld, dim_t out_ld, data_type_t in_dt,
+        data_type_t out_dt) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_pack_B_generate(dnnl_brgemm_pack_B_t pack_B) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_pack_B_execute(
+        const_dnnl_brgemm_pack_B_t pack_B, const void *in_ptr, void *out_ptr) {
+    return unimplemented;
+}
+
+status_t dnnl_brgemm_pack_B_destroy(dnnl_brgemm_pack_B_t pack_B) {
+    return success;
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include "oneapi/dnnl/dnnl_version.h"
 
 #include "c_types_map.hpp"
+#include "perf_counters.hpp"
 #include "verbose.hpp"
 
 #include "batch_normalization_pd.hpp"
@@ -40,6 +41,8 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
+#include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
@@ -50,6 +53,7 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
@@ -111,11 +115,19 @@ void print_header(int verbosity_flag_hint = verbose_t::none) {
                "domain is enabled\n");
 #endif
 
+        // The columns are present only when the execution lines have them.
+        const bool with_counters = (verbose.get() & verbose_t::profile_counters)
+                && perf_counters_t::get().is_open();
+        if (verbose.get() & verbose_t::profile_counters)
+            printf("onednn_verbose,info,cpu,hardware counters are %s\n",
+                    with_counters ? "enabled" : "unavailable");
+
         printf("onednn_verbose,info,prim_template:");
         printf("%soperation,engine,primitive,implementation,prop_"
                "kind,memory_descriptors,attributes,auxiliary,problem_desc,exec_"
-               "time\n",
-                get_verbose_timestamp() ? "timestamp," : "");
+               "time%s\n",
+                get_verbose_timestamp() ? "timestamp," : "",
+                with_counters ? ",cycles,instructions,llc_misses" : "");
     }
 }
 
@@ -136,7 +148,10 @@ uint32_t get_verbose(int verbosity_flag_hint = verbose_t::none) {
             if (s == "1") return k |= verbose_t::exec_profile;
             if (s == "2")
                 return k |= verbose_t::exec_profile | verbose_t::create_profile;
-            if (s == "all" || s == "-1") return k |= verbose_t::all;
+            // Counters change the output format, so they are requested
+            // explicitly only
+            if (s == "all" || s == "-1")
+                return k |= verbose_t::all & ~verbose_t::profile_counters;
             if (s == "error") return k |= verbose_t::error;
             if (s == "check")
                 return k |= verbose_t::create_check | verbose_t::exec_check;
@@ -148,6 +163,10 @@ uint32_t get_verbose(int verbosity_flag_hint = verbose_t::none) {
             // Enable profiling to external libraries
             if (s == "profile_externals")
                 return k |= verbose_t::profile_externals;
+            // Append hardware counters to execution profiling
+            if (s == "profile_counters")
+                return k |= verbose_t::exec_profile
+                        | verbose_t::profile_counters;
             // we extract debug info debug_info=XX. ignore if debuginfo is invalid.
             if (s.rfind("debuginfo=", 0) == 0)
                 return k |= verbose_t::make_debuginfo(
@@ -165,6 +184,10 @@ uint32_t get_verbose(int verbosity_flag_hint = verbose_t::none) {
 
         // We parse for explicit flags
         verbose.set(val);
+
+        // Counters are opened as early as possible to be inherited by the
+        // threads created afterwards.
+        if (val & verbose_t::profile_counters) perf_counters_t::get();
     }
 
     print_header(verbosity_flag_hint);
@@ -194,6 +217,9 @@ bool verbose_has_exec_profile() {
 bool verbose_has_profile_externals() {
     return get_verbose() & verbose_t::profile_externals;
 };
+bool verbose_has_profile_counters() {
+    return get_verbose() & verbose_t::profile_counters;
+};
 int verbose_debuginfo() {
     return get_verbose() >> 24;
 }
@@ -279,12 +305,14 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::use_shift) s += "H";
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
+    if (flags & normalization_flags::rms_norm) s += "M";
     return s;
 }
 
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
+    if (flags & rnn_flags::variable_sequence_length) s += "V";
     return s;
 }
 
@@ -354,7 +382,8 @@ std::string md2fmt_tag_str(const memory_desc_t *md) {
 //  - o        -- indicates there is non-trivial padding offset
 //  - 0        -- indicates there is non-trivial offset0
 //  - fmt_kind -- format kind (blocked, wino, etc...)
-//  - encoding -- sparse encoding (csr, etc...)
+//  - encoding -- sparse encoding (csr, etc...), followed by the block
+//                dimensions for bsr (bsr4x2)
 //  - fmt      -- extended format string (format_kind specific)
 //  - extra    -- shows extra fields (underspecified)
 std::string md2fmt_str(const memory_desc_t *md) {
@@ -377,7 +406,12 @@ std::string md2fmt_str(const memory_desc_t *md) {
     ss << (offset0 ? "0" : "") << ":" << mdw.format_kind() << ":";
 
     if (mdw.is_blocking_desc()) ss << md2fmt_tag_str(md);
-    if (mdw.is_sparse_desc()) ss << mdw.encoding();
+    if (mdw.is_sparse_desc()) {
+        ss << mdw.encoding();
+        if (mdw.encoding() == sparse_encoding::bsr)
+            ss << mdw.sparse_desc().block_dims[0] << "x"
+               << mdw.sparse_desc().block_dims[1];
+    }
 
     ss << mdw.extra();
 
@@ -432,8 +466,22 @@ std::string md2desc_str(const memory_desc_t *md) {
     return s;
 }
 
+namespace {
+// Prints the data type and groups only when they are not default:
+// `mask[:dt[:G0xG1...]]`.
+void print_dt_and_groups(std::ostream &ss, data_type_t dt,
+        data_type_t default_dt, int ndims, const dims_t groups) {
+    if (dt == default_dt && ndims == 0) return;
+    ss << ":" << dnnl_dt2str(dt);
+    for (int d = 0; d < ndims; ++d)
+        ss << (d == 0 ? ":" : "x") << groups[d];
+}
+} // namespace
+
 std::ostream &operator<<(std::ostream &ss, const runtime_scales_t &oscale) {
     ss << oscale.mask_;
+    print_dt_and_groups(ss, oscale.data_type_, data_type::f32, oscale.ndims_,
+            oscale.group_dims_);
     return ss;
 }
 
@@ -487,8 +535,8 @@ std::string arg2str(int arg) {
 }
 
 std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
-    // scratchpad and fpmath mode are not a part of
-    // has_default_values(). Check them first.
+    // scratchpad, fpmath, shared weights and scheduling modes are not a part
+    // of has_default_values(). Check them first.
     const scratchpad_mode_t &spm = attr->scratchpad_mode_;
     if (spm != scratchpad_mode_t::dnnl_scratchpad_mode_library) {
         ss << "attr-scratchpad:" << dnnl_scratchpad_mode2str(spm) << " ";
@@ -497,6 +545,9 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
     if (fpm != fpmath_mode_t::dnnl_fpmath_mode_strict) {
         ss << "attr-fpmath:" << dnnl_fpmath_mode2str(fpm) << " ";
     }
+    if (attr->shared_weights_) ss << "attr-shared-weights:true ";
+    if (attr->scheduling_ == scheduling::work_stealing)
+        ss << "attr-scheduling:work_stealing ";
 
     if (attr->has_default_values()) return ss;
 
@@ -531,11 +582,16 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             zp.get(arg, &mask);
 
             ss << delim << arg2str(arg) << ":" << mask;
+            print_dt_and_groups(ss, zp.get_data_type(arg), data_type::s32,
+                    zp.get_groups_ndims(arg), zp.get_groups(arg));
             delim = attr_delim;
         }
         ss << " ";
     }
 
+    if (attr->src_dyn_quant_dt_ != data_type::undef)
+        ss << "attr-src-dyn-quant:" << attr->src_dyn_quant_dt_ << " ";
+
     const post_ops_t &po = attr->post_ops_;
     if (!po.has_default_values()) {
         std::string delim = empty_delim;
@@ -768,8 +824,9 @@ static std::string init_info_layer_normalization(
 
     auto src_md = pd->src_md();
     auto dst_md = pd->is_fwd() ? pd->dst_md() : pd->diff_dst_md();
-    auto stats_md = pd->is_fwd() && !pd->stats_are_src() ? pd->dst_md(1)
-                                                         : pd->src_md(1);
+    // Variance is always present while mean is dropped by RMS normalization.
+    auto stats_md = pd->is_fwd() && !pd->stats_are_src() ? pd->dst_md(2)
+                                                         : pd->src_md(2);
     ss << "src_" << src_md << " dst_" << dst_md;
     if (stats_md) ss << " stats_" << stats_md;
     if (pd->is_bwd()) ss << " diff_src_" << pd->diff_src_md();
@@ -782,6 +839,48 @@ static std::string init_info_layer_normalization(
     return ss.str();
 }
 
+template <typename pd_t>
+static std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->src_md();
+    auto idx_md = pd->indices_md();
+    auto dst_md = pd->dst_md();
+    ss << "src_" << src_md << " idx_" << idx_md;
+    if (pd->with_offsets()) ss << " off_" << pd->offsets_md();
+    ss << " dst_" << dst_md << ",";
+
+    ss << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(idx_md) << ":"
+       << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+static std::string init_info_group_normalization(
+        const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << ","
+       << pd->desc()->prop_kind << ",";
+
+    auto src_md = pd->src_md();
+    auto dst_md = pd->dst_md();
+    auto stats_md = !pd->stats_are_src() ? pd->dst_md(1) : pd->src_md(1);
+    ss << "src_" << src_md << " dst_" << dst_md;
+    if (stats_md) ss << " stats_" << stats_md;
+    ss << ",";
+
+    ss << pd->attr() << ",";
+    ss << "flags:" << normalization_flags2str(pd->desc()->flags) << ",";
+    ss << "g" << pd->desc()->groups << md2desc_str(src_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 static std::string init_info_lrn(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -905,6 +1004,30 @@ static std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+static std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto q_md = pd->qry_md();
+    auto k_md = pd->key_md();
+    auto v_md = pd->val_md();
+    auto dst_md = pd->dst_md();
+    ss << "q_" << q_md << " k_" << k_md << " v_" << v_md;
+    if (pd->with_mask()) ss << " msk_" << pd->msk_md();
+    ss << " dst_" << dst_md << ",";
+
+    ss << pd->attr() << ",";
+    ss << "scale:" << pd->desc()->scale;
+    if (pd->with_causal_mask()) ss << " causal";
+    ss << ",";
+    ss << md2dim_str(q_md) << ":" << md2dim_str(k_md) << ":"
+       << md2dim_str(v_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 static std::string init_info_reorder(const engine_t *e, pd_t *pd) {
     std::stringstream ss;
@@ -1088,6 +1211,8 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
+            CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
@@ -1098,6 +1223,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
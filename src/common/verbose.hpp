@@ -132,6 +132,8 @@ struct verbose_t {
         exec_check = 1 << 6,
         exec_profile = 1 << 7,
         profile_externals = 1 << 8,
+        // Hardware counters on execution profile lines.
+        profile_counters = 1 << 9,
         // the upper 8 bits are reserved for devinfo levels
         debuginfo = 1 << 24,
         //
@@ -148,6 +150,7 @@ bool verbose_has_create_profile();
 bool verbose_has_exec_check();
 bool verbose_has_exec_profile();
 bool verbose_has_profile_externals();
+bool verbose_has_profile_counters();
 
 int verbose_debuginfo();
 
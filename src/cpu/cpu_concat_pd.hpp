@@ -21,6 +21,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/concat_pd.hpp"
+#include "common/primitive_exec_types.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 #include "cpu/cpu_engine.hpp"
@@ -31,6 +32,21 @@ namespace cpu {
 
 struct cpu_concat_pd_t : public concat_pd_t {
     using concat_pd_t::concat_pd_t;
+
+    /* returns true if every source passed at execution already resides at its
+     * in-place offset in the destination (see src_inplace_offset()), i.e. the
+     * producers wrote the data there and there is nothing to copy. */
+    bool srcs_in_place(const exec_ctx_t &ctx) const {
+        const auto dst = static_cast<const char *>(ctx.host_ptr(DNNL_ARG_DST));
+        if (dst == nullptr) return false;
+        for (int i = 0; i < n_inputs(); ++i) {
+            const dim_t offset = src_inplace_offset(i);
+            if (offset < 0
+                    || ctx.host_ptr(DNNL_ARG_MULTIPLE_SRC + i) != dst + offset)
+                return false;
+        }
+        return n_inputs() > 0;
+    }
 };
 
 } // namespace cpu
@@ -49,6 +49,7 @@
 #include "cpu/x64/jit_brgemm_conv_bwd.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_strided.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
 #include "cpu/x64/jit_sse41_1x1_convolution.hpp"
 #include "cpu/x64/jit_sse41_convolution.hpp"
 #include "cpu/x64/jit_uni_dw_convolution.hpp"
@@ -85,6 +86,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx, true>)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t<avx512_core>)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core, true>)
@@ -118,6 +120,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx, true>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16, true>)
@@ -139,6 +142,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx, true>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16, true>)
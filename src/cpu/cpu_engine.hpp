@@ -26,6 +26,7 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/scratchpad_pool.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -58,6 +59,8 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
+DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
 DECLARE_IMPL_LIST(lrn);
@@ -67,6 +70,7 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
 
@@ -93,6 +97,8 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
+            CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
             CASE(lrn);
@@ -102,6 +108,7 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
             default: assert(!"unknown primitive kind"); return empty_list;
@@ -111,9 +118,36 @@ public:
     // clang-format on
 };
 
+// Identifies a CPU engine bound to a NUMA node.
+struct numa_engine_id_impl_t : public engine_id_impl_t {
+    numa_engine_id_impl_t(runtime_kind_t runtime_kind, int numa_node)
+        : engine_id_impl_t(engine_kind::cpu, runtime_kind, 0)
+        , numa_node_(numa_node) {}
+
+private:
+    bool compare_resource(const engine_id_impl_t *id_impl) const override {
+        const auto *typed_id
+                = utils::downcast<const numa_engine_id_impl_t *>(id_impl);
+        return numa_node_ == typed_id->numa_node_;
+    }
+
+    size_t hash_resource() const override {
+        return hash_combine(0, numa_node_);
+    }
+
+    int numa_node_;
+};
+
 class cpu_engine_t : public engine_t {
 public:
-    cpu_engine_t() : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0) {}
+    cpu_engine_t(int numa_node = -1)
+        : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0)
+        , numa_node_(numa_node) {}
+
+    // Returns the NUMA node the engine is bound to or -1 if it is not bound.
+    int numa_node() const { return numa_node_; }
+
+    scratchpad_pool_t &scratchpad_pool() { return scratchpad_pool_; }
 
     /* implementation part */
 
@@ -148,14 +182,39 @@ public:
     device_id_t device_id() const override { return std::make_tuple(0, 0, 0); }
 
     engine_id_t engine_id() const override {
-        // Non-sycl CPU engine doesn't have device and context.
-        return {};
+        // Non-sycl CPU engine doesn't have device and context. Engines bound
+        // to different NUMA nodes must not share primitives as the
+        // primitives keep memory on the node they were executed on.
+        if (numa_node_ < 0) return {};
+        return engine_id_t(
+                new numa_engine_id_impl_t(runtime_kind(), numa_node_));
     }
 
 protected:
     ~cpu_engine_t() override = default;
+
+private:
+    int numa_node_;
+    scratchpad_pool_t scratchpad_pool_;
 };
 
+// Returns the NUMA node of a native CPU engine or -1 for other engines.
+inline int get_numa_node(const engine_t *engine) {
+    if (engine->kind() != engine_kind::cpu
+            || !is_native_runtime(engine->runtime_kind()))
+        return -1;
+    return static_cast<const cpu_engine_t *>(engine)->numa_node();
+}
+
+// Returns the scratchpad pool of a native CPU engine or nullptr for other
+// engines.
+inline scratchpad_pool_t *get_scratchpad_pool(engine_t *engine) {
+    if (engine->kind() != engine_kind::cpu
+            || !is_native_runtime(engine->runtime_kind()))
+        return nullptr;
+    return &static_cast<cpu_engine_t *>(engine)->scratchpad_pool();
+}
+
 class cpu_engine_factory_t : public engine_factory_t {
 public:
     size_t count() const override { return 1; }
@@ -163,6 +222,22 @@ public:
         assert(index == 0);
         *engine = new cpu_engine_t();
 
+#if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
+        dnnl::impl::cpu::aarch64::acl_thread_utils::set_acl_threading();
+#endif
+        return status::success;
+    };
+
+    int numa_node_count() const override {
+        return platform::get_numa_node_count();
+    }
+    status_t engine_create_on_numa_node(
+            engine_t **engine, size_t index, int numa_node) const override {
+        assert(index == 0);
+        if (numa_node < 0 || numa_node >= numa_node_count())
+            return status::invalid_arguments;
+        *engine = new cpu_engine_t(numa_node);
+
 #if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
         dnnl::impl::cpu::aarch64::acl_thread_utils::set_acl_threading();
 #endif
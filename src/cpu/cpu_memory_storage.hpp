@@ -25,6 +25,7 @@
 #include "common/stream.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_engine.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -86,6 +87,19 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
+        const int numa_node = get_numa_node(engine());
+        if (numa_node >= 0) {
+            // Whole pages are allocated so that binding them to the node
+            // does not affect neighboring allocations.
+            const size_t aligned_size = utils::rnd_up(size, PAGE_4K);
+            void *ptr = malloc(aligned_size, PAGE_4K);
+            if (!ptr) return status::out_of_memory;
+            data_ = decltype(data_)(ptr, destroy);
+            // Binding is a hint, the memory is usable if it fails.
+            platform::bind_memory_to_numa_node(ptr, aligned_size, numa_node);
+            return status::success;
+        }
+
         void *ptr = malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
         data_ = decltype(data_)(ptr, destroy);
@@ -27,6 +27,9 @@
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/cpu_engine.hpp"
+#include "cpu/platform.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -54,6 +57,22 @@ struct cpu_stream_t : public stream_t {
     void after_exec_hook() override {
         threadpool_utils::deactivate_threadpool();
     }
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // The calling thread and its OpenMP team are bound to the CPUs of the
+    // NUMA node of the engine for the time of an execution only, so the
+    // affinity of the application threads is kept intact.
+    void before_exec_hook() override {
+        const int numa_node = get_numa_node(engine());
+        if (numa_node < 0) return;
+        parallel(0, [&](int, int) {
+            platform::bind_thread_to_numa_node(numa_node);
+        });
+    }
+
+    void after_exec_hook() override {
+        if (get_numa_node(engine()) < 0) return;
+        parallel(0, [&](int, int) { platform::restore_thread_affinity(); });
+    }
 #endif
 };
 
@@ -25,6 +25,7 @@
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
@@ -84,6 +85,9 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(ref_matmul_int8_t)
         // These implementations are enabled only when DNNL_EXPERIMENTAL_SPARSE
         // macro is defined.
+        CPU_INSTANCE_SPARSE_X64(brgemm_grouped_matmul_t<avx512_core_amx>)
+        CPU_INSTANCE_SPARSE_X64(brgemm_grouped_matmul_t<avx512_core_bf16>)
+        CPU_INSTANCE_SPARSE_X64(brgemm_grouped_matmul_t<avx512_core>)
         CPU_INSTANCE_SPARSE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE_SPARSE(ref_sparse_matmul_t)
         /* eol */
@@ -177,6 +177,17 @@ private:
     }
 };
 
+// Returns true if the offsets of a grouped source with `ngroups` groups are
+// non-decreasing and address rows in [0, nrows). The offsets are known at
+// execution time only.
+inline bool grouped_offsets_ok(
+        const int32_t *offsets, dim_t ngroups, dim_t nrows) {
+    if (offsets[0] < 0 || offsets[ngroups] > nrows) return false;
+    for (dim_t g = 0; g < ngroups; g++)
+        if (offsets[g] > offsets[g + 1]) return false;
+    return true;
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -42,8 +42,13 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
     CHECK(status);
 
+    // Scales of compressed weights are applied during decompression.
+    const bool with_wei_decomp
+            = types::is_4bit(pd()->weights_md()->data_type);
+    const primitive_attr_t *wei_attr
+            = with_wei_decomp ? &default_attr() : pd()->attr();
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
-    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER_ATTR(wei_attr, wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
@@ -72,6 +77,52 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const int bia_mask
             = utils::get_dims_mask(dst_d.dims(), bia_d.dims(), ndims);
 
+    // weights decompression section
+    const auto &attr_zp = pd()->attr()->zero_points_;
+    const auto &wei_decomp_scales = pd()->attr()->scales_.get(DNNL_ARG_WEIGHTS);
+    const bool with_wei_decomp_scales
+            = with_wei_decomp && !wei_decomp_scales.has_default_values();
+    const bool with_wei_decomp_zp
+            = with_wei_decomp && !attr_zp.has_default_values(DNNL_ARG_WEIGHTS);
+    const void *wei_decomp_scales_ptr
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *wei_decomp_zp_ptr = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+    if ((with_wei_decomp_scales && !wei_decomp_scales_ptr)
+            || (with_wei_decomp_zp && !wei_decomp_zp_ptr))
+        return status::invalid_arguments;
+
+    // Returns the offset of the scale or zero point for the (k, n) element of
+    // weights. Only K and N bits can be set in the mask.
+    auto get_wei_decomp_off = [&](int mask, int groups_ndims,
+                                      const dims_t groups, dim_t k, dim_t n) {
+        const bool per_k = mask & (1 << (ndims - 2));
+        const bool per_n = mask & (1 << (ndims - 1));
+        const dim_t group_k = groups_ndims > 0 ? groups[0] : 1;
+        const dim_t group_n = groups_ndims > 0 ? groups[1] : 1;
+        const dim_t n_groups = per_n ? N / group_n : 1;
+        return (per_k ? k / group_k * n_groups : 0)
+                + (per_n ? n / group_n : 0);
+    };
+
+    auto decompress = [&](float w, dim_t k, dim_t n) {
+        if (with_wei_decomp_zp) {
+            const auto off = get_wei_decomp_off(attr_zp.get(DNNL_ARG_WEIGHTS),
+                    attr_zp.get_groups_ndims(DNNL_ARG_WEIGHTS),
+                    attr_zp.get_groups(DNNL_ARG_WEIGHTS), k, n);
+            w -= io::load_float_value(attr_zp.get_data_type(DNNL_ARG_WEIGHTS),
+                    wei_decomp_zp_ptr, off);
+        }
+        if (with_wei_decomp_scales) {
+            const auto off = get_wei_decomp_off(wei_decomp_scales.mask_,
+                    wei_decomp_scales.ndims_, wei_decomp_scales.group_dims_, k,
+                    n);
+            w *= io::load_float_value(
+                    wei_decomp_scales.data_type_, wei_decomp_scales_ptr, off);
+        }
+        return w;
+    };
+
     // mm kernel
     auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
         float acc = 0;
@@ -90,8 +141,9 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             const auto weights_off = weights_d.off_v(weights_dims_idx);
             const float s
                     = io::load_float_value(src_d.data_type(), src, src_off);
-            const float w = io::load_float_value(
+            float w = io::load_float_value(
                     weights_d.data_type(), weights, weights_off);
+            if (with_wei_decomp) w = decompress(w, k, n);
             acc += s * w;
         }
         return acc;
@@ -109,8 +161,8 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto &attr_scales = pd()->attr()->scales_;
     const bool with_src_scales
             = !attr_scales.get(DNNL_ARG_SRC).has_default_values();
-    const bool with_wei_scales
-            = !attr_scales.get(DNNL_ARG_WEIGHTS).has_default_values();
+    const bool with_wei_scales = !with_wei_decomp
+            && !attr_scales.get(DNNL_ARG_WEIGHTS).has_default_values();
     const bool with_dst_scales
             = !attr_scales.get(DNNL_ARG_DST).has_default_values();
     const dim_t wei_scale_stride
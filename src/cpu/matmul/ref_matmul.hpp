@@ -49,10 +49,32 @@ struct ref_matmul_t : public primitive_t {
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
 
-            bool ok = is_dense_data() && utils::one_of(src_type, f32, bf16, f16)
-                    && utils::one_of(wei_type, f32, bf16, f16)
-                    && utils::one_of(dst_type, f32, bf16, f16)
-                    && src_type == wei_type
+            const bool is_f8_src = utils::one_of(src_type, f8_e5m2, f8_e4m3);
+            const bool is_f8_wei = utils::one_of(wei_type, f8_e5m2, f8_e4m3);
+            const bool is_4bit_wei = types::is_4bit(wei_type);
+            const auto wei_decomp_skip_mask = is_4bit_wei
+                    ? smask_t::scales_runtime_groups
+                            | smask_t::scales_runtime_data_type
+                            | smask_t::zero_points_runtime_groups
+                            | smask_t::zero_points_runtime_data_type
+                    : smask_t::none;
+
+            bool ok = is_dense_data()
+                    && utils::one_of(
+                            src_type, f32, bf16, f16, f8_e5m2, f8_e4m3)
+                    && utils::one_of(wei_type, f32, bf16, f16, f8_e5m2,
+                            f8_e4m3, s4, u4, nf4)
+                    && utils::one_of(
+                            dst_type, f32, bf16, f16, f8_e5m2, f8_e4m3)
+                    // f8 weights can be used with any floating-point source
+                    // and are up-converted on the fly.
+                    && IMPLICATION(
+                            !is_f8_wei && !is_4bit_wei, src_type == wei_type)
+                    // 4-bit weights are decompressed on the fly using
+                    // grouped scales and zero points.
+                    && IMPLICATION(
+                            is_4bit_wei, utils::one_of(src_type, f32, bf16, f16))
+                    && IMPLICATION(is_f8_src, is_f8_wei)
                     && IMPLICATION(src_type == f32, dst_type == f32)
                     && IMPLICATION(src_type == bf16,
                             utils::one_of(dst_type, f32, bf16))
@@ -67,15 +89,47 @@ struct ref_matmul_t : public primitive_t {
                                     && IMPLICATION(src_type == bf16,
                                             utils::one_of(bia_type, f32, bf16)))
                     && platform::has_data_type_support(src_type)
+                    && platform::has_data_type_support(wei_type)
                     && attr()->has_default_values(smask_t::scales_runtime
-                                    | smask_t::post_ops | smask_t::sum_dt,
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | wei_decomp_skip_mask,
                             dst_type)
+                    && IMPLICATION(is_4bit_wei, wei_decomp_attr_ok())
                     && attr_.post_ops_.check_sum_consistency(dst_type,
                             /* is_int8 */ false)
                     && attr_scales_ok() && set_default_formats()
                     && attr_.set_default_formats(dst_md(0)) == status::success;
             return ok ? status::success : status::unimplemented;
         }
+
+    private:
+        // Scales and zero points of compressed weights may be set per N, per
+        // K, or per groups along both. Zero points are supported for weights
+        // only.
+        bool wei_decomp_attr_ok() const {
+            const int ndims = dst_md()->ndims;
+            const int kn_mask = (1 << (ndims - 1)) | (1 << (ndims - 2));
+            const dim_t K = weights_md()->dims[ndims - 2];
+            const dim_t N = weights_md()->dims[ndims - 1];
+            auto groups_ok = [&](int groups_ndims, const dims_t groups) {
+                if (groups_ndims == 0) return true;
+                return groups_ndims == 2 && K % groups[0] == 0
+                        && N % groups[1] == 0;
+            };
+
+            const auto &sc = attr()->scales_;
+            const auto &zp = attr()->zero_points_;
+            const auto &wei_sc = sc.get(DNNL_ARG_WEIGHTS);
+            for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST})
+                if (!sc.get(arg).has_default_groups()
+                        || !sc.get(arg).has_default_data_type()
+                        || !zp.has_default_values(arg))
+                    return false;
+            return groups_ok(wei_sc.ndims_, wei_sc.group_dims_)
+                    && (zp.get(DNNL_ARG_WEIGHTS) & ~kn_mask) == 0
+                    && groups_ok(zp.get_groups_ndims(DNNL_ARG_WEIGHTS),
+                            zp.get_groups(DNNL_ARG_WEIGHTS));
+        }
     };
 
     ref_matmul_t(const pd_t *apd) : primitive_t(apd) {}
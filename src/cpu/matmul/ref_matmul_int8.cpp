@@ -83,8 +83,27 @@ status_t ref_matmul_int8_t::execute_ref(const exec_ctx_t &ctx) const {
     const int dst_zp_idx_mult
             = !pd()->attr()->zero_points_.common(DNNL_ARG_DST);
 
+    // src dynamic quantization: every row of src is quantized to s8 with a
+    // scale derived from the maximum absolute value of the row
+    const bool with_src_dyn_quant
+            = pd()->attr()->src_dyn_quant_dt_ == data_type::s8;
+    auto src_dyn_quant_scale = [&](const dims_t dst_dims_idx, dim_t m) {
+        dims_t src_dims_idx;
+        utils::copy_dims_with_mask(src_dims_idx, dst_dims_idx, ndims, src_mask);
+        src_dims_idx[ndims - 2] = m;
+        float absmax = 0.f;
+        for (dim_t k = 0; k < K; ++k) {
+            src_dims_idx[ndims - 1] = k;
+            const float s = io::load_float_value(
+                    src_d.data_type(), src, src_d.off_v(src_dims_idx));
+            absmax = nstl::max(absmax, ::fabsf(s));
+        }
+        return nstl::max(absmax / 127.f, FLT_MIN);
+    };
+
     // mm kernel
-    auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
+    auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n,
+                       float src_inv_scale) {
         int acc = 0;
         dims_t src_dims_idx, weights_dims_idx;
         utils::copy_dims_with_mask(src_dims_idx, dst_dims_idx, ndims, src_mask);
@@ -99,7 +118,12 @@ status_t ref_matmul_int8_t::execute_ref(const exec_ctx_t &ctx) const {
             wei_k_dim = k;
             const auto src_off = src_d.off_v(src_dims_idx);
             const auto weights_off = weights_d.off_v(weights_dims_idx);
-            int s = io::load_int_value(src_d.data_type(), src, src_off);
+            int s = with_src_dyn_quant
+                    ? saturate_and_round<int8_t>(
+                            io::load_float_value(
+                                    src_d.data_type(), src, src_off)
+                            * src_inv_scale)
+                    : io::load_int_value(src_d.data_type(), src, src_off);
             int w = io::load_int_value(
                     weights_d.data_type(), weights, weights_off);
             if (src_zero_point) {
@@ -140,8 +164,12 @@ status_t ref_matmul_int8_t::execute_ref(const exec_ctx_t &ctx) const {
         // account for M, N dims for index calculations
         const size_t l_offset = mb * M * N + m * N + n;
         utils::l_dims_by_l_offset(dst_dims_idx, l_offset, dst_d.dims(), ndims);
-        int acc = ker(dst_dims_idx, m, n);
+        const float src_dyn_scale = with_src_dyn_quant
+                ? src_dyn_quant_scale(dst_dims_idx, m)
+                : 1.f;
+        int acc = ker(dst_dims_idx, m, n, 1.f / src_dyn_scale);
         float d = static_cast<int>(acc);
+        if (with_src_dyn_quant) d *= src_dyn_scale;
         if (with_src_scales) d *= src_scales[0];
         if (with_wei_scales) d *= wei_scales[wei_scale_stride * n];
         if (bias) d += ker_bias(dst_dims_idx);
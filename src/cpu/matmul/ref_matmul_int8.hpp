@@ -48,17 +48,29 @@ struct ref_matmul_int8_t : public primitive_t {
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
 
-            bool ok = utils::one_of(src_type, s8, u8) && wei_type == s8
+            const bool with_src_dyn_quant = attr()->src_dyn_quant_dt_ == s8;
+
+            bool ok = is_dense_data()
+                    && (with_src_dyn_quant ? utils::one_of(src_type, f32, bf16)
+                                           : utils::one_of(src_type, s8, u8))
+                    && wei_type == s8
                     && IMPLICATION(with_bias(),
                             utils::one_of(bia_type, f32, bf16, s32, s8, u8))
                     && utils::one_of(dst_type, f32, bf16, s32, s8, u8)
                     && attr()->has_default_values(smask_t::scales_runtime
                                     | smask_t::zero_points_runtime
-                                    | smask_t::post_ops | smask_t::sum_dt,
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | smask_t::src_dynamic_quantization,
                             dst_type)
                     && attr_.post_ops_.check_sum_consistency(dst_type,
                             /* is_int8 */ true)
                     && attr_scales_ok() && attr_zero_points_ok()
+                    && IMPLICATION(with_src_dyn_quant,
+                            utils::one_of(dst_type, f32, bf16)
+                                    && attr()->scales_.get(DNNL_ARG_SRC)
+                                               .has_default_values()
+                                    && attr()->zero_points_.has_default_values(
+                                            DNNL_ARG_SRC))
                     && set_default_formats()
                     && attr_.set_default_formats(dst_md(0)) == status::success;
             return ok ? status::success : status::unimplemented;
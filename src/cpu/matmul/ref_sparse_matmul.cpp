@@ -14,10 +14,16 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 namespace dnnl {
@@ -26,6 +32,13 @@ namespace cpu {
 namespace matmul {
 
 status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_md_d(pd()->src_md());
+    const memory_desc_wrapper wei_md_d(pd()->weights_md());
+    const auto encoding = src_md_d.is_sparse_desc() ? src_md_d.encoding()
+                                                    : wei_md_d.encoding();
+    if (encoding == sparse_encoding::bsr) return execute_bsr(ctx);
+    if (encoding == sparse_encoding::grouped) return execute_grouped(ctx);
+
     status_t status = status::success;
     auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
     CHECK(status);
@@ -82,6 +95,111 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+status_t ref_sparse_matmul_t::execute_bsr(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t M = dst_d.dims()[0];
+    const dim_t N = dst_d.dims()[1];
+    const dim_t K = src_d.dims()[1];
+
+    const bool is_src_sparse = src_d.is_sparse_desc();
+    const memory_desc_wrapper &sparse_d = is_src_sparse ? src_d : wei_d;
+    const memory_desc_wrapper &dense_d = is_src_sparse ? wei_d : src_d;
+    const dim_t R = sparse_d.sparse_desc().block_dims[0];
+    const dim_t C = sparse_d.sparse_desc().block_dims[1];
+
+    const int sparse_arg = is_src_sparse ? DNNL_ARG_SRC : DNNL_ARG_WEIGHTS;
+    const int dense_arg = is_src_sparse ? DNNL_ARG_WEIGHTS : DNNL_ARG_SRC;
+    const auto values = CTX_IN_MEM(const void *, sparse_arg, 0);
+    const auto indices = CTX_IN_MEM(const int32_t *, sparse_arg, 1);
+    const auto pointers = CTX_IN_MEM(const int32_t *, sparse_arg, 2);
+    const auto dense = CTX_IN_MEM(const void *, dense_arg);
+
+    const auto values_dt = sparse_d.data_type();
+    const auto dense_dt = dense_d.data_type();
+
+    // The values of a block `p` are stored densely starting at `p * R * C`.
+    const auto value = [&](dim_t p, dim_t r, dim_t c) {
+        return io::load_float_value(values_dt, values, (p * R + r) * C + c);
+    };
+
+    // Each row of the destination is accumulated in f32 and converted once.
+    parallel_nd(M, [&](dim_t m) {
+        std::vector<float> acc(N, 0.f);
+        if (is_src_sparse) {
+            // The row `m` of the source is the row `m % R` of the blocks in
+            // the row of blocks `m / R`.
+            const dim_t mb = m / R;
+            const dim_t r = m % R;
+            for (dim_t p = pointers[mb]; p < pointers[mb + 1]; p++)
+                for (dim_t c = 0; c < C; c++) {
+                    const float a = value(p, r, c);
+                    const dim_t k = indices[p] * C + c;
+                    for (dim_t n = 0; n < N; n++)
+                        acc[n] += a
+                                * io::load_float_value(
+                                        dense_dt, dense, k * N + n);
+                }
+        } else {
+            for_(dim_t kb = 0; kb < K / R; kb++)
+            for (dim_t p = pointers[kb]; p < pointers[kb + 1]; p++)
+                for (dim_t r = 0; r < R; r++) {
+                    const float a = io::load_float_value(
+                            dense_dt, dense, m * K + kb * R + r);
+                    for (dim_t c = 0; c < C; c++)
+                        acc[indices[p] * C + c] += a * value(p, r, c);
+                }
+        }
+        for (dim_t n = 0; n < N; n++)
+            io::store_float_value(dst_d.data_type(), acc[n], dst, m * N + n);
+    });
+
+    return status::success;
+}
+
+status_t ref_sparse_matmul_t::execute_grouped(const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t M = dst_d.dims()[0];
+    const dim_t N = dst_d.dims()[1];
+    const dim_t K = src_d.dims()[1];
+    const dim_t G = src_d.ngroups();
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC, 0);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    if (!grouped_offsets_ok(offsets, G, M)) return status::invalid_arguments;
+
+    // Rows that belong to no group are not written.
+    parallel_nd(M, [&](dim_t m) {
+        const dim_t g = std::upper_bound(offsets, offsets + G + 1, m) - offsets
+                - 1;
+        if (g < 0 || g >= G || m >= offsets[g + 1]) return;
+
+        for (dim_t n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (dim_t k = 0; k < K; k++)
+                acc += io::load_float_value(
+                               src_d.data_type(), src, m * K + k)
+                        * io::load_float_value(
+                                wei_d.data_type(), wei, wei_d.off(g, k, n));
+            io::store_float_value(dst_d.data_type(), acc, dst, m * N + n);
+        }
+    });
+
+    return status::success;
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
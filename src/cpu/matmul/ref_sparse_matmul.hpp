@@ -22,6 +22,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/platform.hpp"
+
 #include "cpu/matmul/cpu_matmul_pd.hpp"
 
 namespace dnnl {
@@ -44,8 +46,20 @@ struct ref_sparse_matmul_t : public primitive_t {
             memory_desc_wrapper src_d(src_md());
             memory_desc_wrapper wei_d(weights_md(0));
 
-            const bool ok
-                    = utils::everyone_is(f32, src_type, wei_type, dst_type)
+            if (src_d.is_grouped_desc()) {
+                const bool ok = grouped_data_types_ok(
+                                        src_type, wei_type, dst_type)
+                        && src_d.metadata_type(0) == s32
+                        && attr()->has_default_values() && set_default_formats()
+                        && memory_desc_wrapper(weights_md(0))
+                                   .is_blocking_desc()
+                        && memory_desc_wrapper(dst_md()).matches_one_of_tag(
+                                format_tag::ab);
+                return ok ? status::success : status::unimplemented;
+            }
+
+            const bool ok = data_types_ok(src_d, wei_d, src_type, wei_type,
+                                    dst_type)
                     && utils::one_of(true, wei_d.is_sparse_desc(),
                             src_d.is_sparse_desc())
                     && IMPLICATION(
@@ -61,6 +75,41 @@ struct ref_sparse_matmul_t : public primitive_t {
             return ok ? status::success : status::unimplemented;
         }
 
+        // CSR supports only f32. BSR additionally supports bf16 and int8
+        // data types, which is what block-pruned models use.
+        bool data_types_ok(const memory_desc_wrapper &src_d,
+                const memory_desc_wrapper &wei_d, data_type_t src_type,
+                data_type_t wei_type, data_type_t dst_type) const {
+            using namespace data_type;
+            if (utils::everyone_is(f32, src_type, wei_type, dst_type))
+                return true;
+
+            const bool is_bsr = (src_d.is_sparse_desc()
+                                        && src_d.encoding()
+                                                == sparse_encoding::bsr)
+                    || (wei_d.is_sparse_desc()
+                            && wei_d.encoding() == sparse_encoding::bsr);
+            if (!is_bsr) return false;
+
+            const bool is_bf16 = utils::everyone_is(bf16, src_type, wei_type)
+                    && utils::one_of(dst_type, f32, bf16);
+            const bool is_int8 = utils::one_of(src_type, s8, u8)
+                    && wei_type == s8 && utils::one_of(dst_type, f32, s32);
+            return (is_bf16 || is_int8)
+                    && platform::has_data_type_support(src_type);
+        }
+
+        // The grouped source is dense, so it supports the usual floating
+        // point data types of the matmul.
+        bool grouped_data_types_ok(data_type_t src_type, data_type_t wei_type,
+                data_type_t dst_type) const {
+            using namespace data_type;
+            if (src_type != wei_type || !utils::one_of(src_type, f32, bf16))
+                return false;
+            return utils::one_of(dst_type, f32, src_type)
+                    && platform::has_data_type_support(src_type);
+        }
+
         bool formats_ok(const memory_desc_wrapper &src_d,
                 const memory_desc_wrapper &wei_d) const {
             if (!memory_desc_wrapper(dst_md()).matches_one_of_tag(
@@ -80,6 +129,9 @@ struct ref_sparse_matmul_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    status_t execute_bsr(const exec_ctx_t &ctx) const;
+    status_t execute_grouped(const exec_ctx_t &ctx) const;
 };
 
 } // namespace matmul
@@ -20,6 +20,18 @@
 
 #include "cpu/platform.hpp"
 
+#if defined(__linux__)
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include <algorithm>
 
@@ -275,6 +287,146 @@ size_t get_timestamp() {
 #endif
 }
 
+#if defined(__linux__)
+namespace {
+// Parses a sysfs list such as "0-3,8,10-11".
+std::vector<int> parse_sysfs_list(const std::string &list) {
+    std::vector<int> result;
+    std::istringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        int first = 0, last = 0;
+        const int n = std::sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (n < 1) continue;
+        if (n == 1) last = first;
+        for (int i = first; i <= last; i++)
+            result.push_back(i);
+    }
+    return result;
+}
+
+std::vector<int> read_sysfs_list(const std::string &path) {
+    std::ifstream file(path);
+    std::string list;
+    if (!(file >> list)) return {};
+    return parse_sysfs_list(list);
+}
+
+// The library numbers the online nodes densely: node ids may have gaps, for
+// example when a node is offline, and index `i` refers to the `i`-th online
+// node.
+struct numa_topology_t {
+    numa_topology_t() {
+        const std::string root = "/sys/devices/system/node/";
+        node_ids = read_sysfs_list(root + "online");
+        for (int id : node_ids)
+            node_cpus.push_back(read_sysfs_list(
+                    root + "node" + std::to_string(id) + "/cpulist"));
+    }
+
+    bool is_valid_node(int node) const {
+        return node >= 0 && node < (int)node_ids.size();
+    }
+
+    // System ids of the online nodes.
+    std::vector<int> node_ids;
+    // CPUs of every online node, empty for nodes without CPUs.
+    std::vector<std::vector<int>> node_cpus;
+};
+
+// The affinity mask of the calling thread before the first binding, see
+// bind_thread_to_numa_node() and restore_thread_affinity().
+struct saved_affinity_t {
+    bool saved = false;
+    cpu_set_t mask;
+};
+
+saved_affinity_t &saved_affinity() {
+    static thread_local saved_affinity_t affinity;
+    return affinity;
+}
+
+const numa_topology_t &numa_topology() {
+    static const numa_topology_t topology;
+    return topology;
+}
+} // namespace
+#endif
+
+int get_numa_node_count() {
+#if defined(__linux__)
+    const int count = (int)numa_topology().node_ids.size();
+    return count > 0 ? count : 1;
+#else
+    return 1;
+#endif
+}
+
+status_t bind_memory_to_numa_node(void *ptr, size_t size, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+    const auto &topology = numa_topology();
+    if (!topology.is_valid_node(node)) return status::invalid_arguments;
+    if (size == 0) return status::success;
+    const int node_id = topology.node_ids[node];
+
+    // MPOL_PREFERRED falls back to other nodes instead of failing when the
+    // preferred node is out of memory.
+    constexpr int mpol_preferred = 1;
+    constexpr size_t bits_per_word = 8 * sizeof(unsigned long);
+    unsigned long node_mask[(1024 + bits_per_word - 1) / bits_per_word] = {};
+    if (node_id >= (int)(sizeof(node_mask) * 8)) return status::runtime_error;
+    node_mask[node_id / bits_per_word] = 1UL << (node_id % bits_per_word);
+
+    const long rc = ::syscall(SYS_mbind, ptr, size, mpol_preferred, node_mask,
+            sizeof(node_mask) * 8, 0);
+    return rc == 0 ? status::success : status::runtime_error;
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+    UNUSED(node);
+    return status::unimplemented;
+#endif
+}
+
+status_t bind_thread_to_numa_node(int node) {
+#if defined(__linux__) && defined(__GLIBC__)
+    const auto &topology = numa_topology();
+    if (!topology.is_valid_node(node) || topology.node_cpus[node].empty())
+        return status::invalid_arguments;
+
+    auto &affinity = saved_affinity();
+    if (!affinity.saved) {
+        if (::sched_getaffinity(0, sizeof(affinity.mask), &affinity.mask) != 0)
+            return status::runtime_error;
+        affinity.saved = true;
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : topology.node_cpus[node])
+        if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpu_set);
+    return ::sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0
+            ? status::success
+            : status::runtime_error;
+#else
+    UNUSED(node);
+    return status::unimplemented;
+#endif
+}
+
+status_t restore_thread_affinity() {
+#if defined(__linux__) && defined(__GLIBC__)
+    auto &affinity = saved_affinity();
+    if (!affinity.saved) return status::success;
+    affinity.saved = false;
+    return ::sched_setaffinity(0, sizeof(affinity.mask), &affinity.mask) == 0
+            ? status::success
+            : status::runtime_error;
+#else
+    return status::success;
+#endif
+}
+
 } // namespace platform
 } // namespace cpu
 } // namespace impl
@@ -168,8 +168,8 @@ bool DNNL_API has_data_type_support(data_type_t data_type);
 bool DNNL_API has_training_support(data_type_t data_type);
 float DNNL_API s8s8_weights_scale_factor();
 
-unsigned get_per_core_cache_size(int level);
-unsigned get_num_cores();
+unsigned DNNL_API get_per_core_cache_size(int level);
+unsigned DNNL_API get_num_cores();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 unsigned DNNL_API get_max_threads_to_use();
 #endif
@@ -182,6 +182,22 @@ int get_vector_register_size();
 
 size_t get_timestamp();
 
+// NUMA topology and placement. The topology is detected once from sysfs on
+// Linux; other systems report a single node and binding is not supported.
+// Nodes are numbered densely from 0 in the order of the online nodes of the
+// system, so the numbers may differ from the system node ids.
+//
+// Returns the number of online NUMA nodes of the system.
+int get_numa_node_count();
+// Makes `node` the preferred node for the pages of [ptr, ptr + size) that
+// have not been touched yet. The range should be page aligned.
+status_t bind_memory_to_numa_node(void *ptr, size_t size, int node);
+// Restricts the calling thread to the CPUs of `node`. The affinity mask the
+// thread had before the first binding is saved.
+status_t bind_thread_to_numa_node(int node);
+// Restores the affinity mask saved by bind_thread_to_numa_node(), if any.
+status_t restore_thread_affinity();
+
 } // namespace platform
 
 // XXX: find a better place for these values?
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/primitive_hashing.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/prepacked_weights_registry.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+prepacked_weights_registry_t::key_t::key_t(uint64_t user_mem_id,
+        const memory_desc_t &user_md, const memory_desc_t &packed_md,
+        int numa_node)
+    : user_mem_id_(user_mem_id)
+    , user_md_(user_md)
+    , packed_md_(packed_md)
+    , numa_node_(numa_node) {
+    hash_ = hash_combine(0, user_mem_id_);
+    hash_ = hash_combine(hash_, primitive_hashing::get_md_hash(user_md_));
+    hash_ = hash_combine(hash_, primitive_hashing::get_md_hash(packed_md_));
+    hash_ = hash_combine(hash_, numa_node_);
+}
+
+prepacked_weights_registry_t &prepacked_weights_registry_t::get() {
+    static prepacked_weights_registry_t registry;
+    return registry;
+}
+
+status_t prepacked_weights_registry_t::get_or_pack(
+        std::shared_ptr<const void> &packed, const key_t &key,
+        const pack_func_t &pack) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            packed = it->second.lock();
+            if (packed) return status::success;
+        }
+    }
+
+    const bool bind = key.numa_node_ >= 0;
+    const size_t size = memory_desc_wrapper(key.packed_md_).size();
+    const size_t alloc_size = bind ? utils::rnd_up(size, PAGE_4K) : size;
+    void *ptr = impl::malloc(
+            alloc_size, bind ? PAGE_4K : platform::get_cache_line_size());
+    if (!ptr) return status::out_of_memory;
+    std::shared_ptr<const void> result(ptr, [](const void *p) {
+        impl::free(const_cast<void *>(p));
+    });
+    // Binding is a hint, the buffer is usable if it fails.
+    if (bind)
+        platform::bind_memory_to_numa_node(ptr, alloc_size, key.numa_node_);
+    CHECK(pack(ptr));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    evict_expired();
+    auto &entry = entries_[key];
+    packed = entry.lock();
+    if (!packed) {
+        entry = result;
+        packed = std::move(result);
+    }
+    return status::success;
+}
+
+void prepacked_weights_registry_t::evict_expired() {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.expired())
+            it = entries_.erase(it);
+        else
+            ++it;
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_PREPACKED_WEIGHTS_REGISTRY_HPP
+#define CPU_PREPACKED_WEIGHTS_REGISTRY_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// A process-wide registry of weights reordered ahead of time.
+//
+// Primitives created with the shared weights attribute look up the packed
+// weights by the identifier of the user weights memory object, the user
+// weights memory descriptor, the memory descriptor of the internal layout, and
+// the NUMA node of the engine. Primitives that apply the same transformation
+// to the same weights get the same buffer, so the weights are reordered and
+// stored once per NUMA node no matter how many primitives use them.
+//
+// The memory identifier changes when the object is recreated or its data
+// handle is changed, so new weights are packed again even if they reuse the
+// address of the released ones.
+//
+// The registry keeps weak references only: a packed buffer is released once
+// the last primitive that holds it is destroyed.
+struct prepacked_weights_registry_t {
+    struct key_t {
+        key_t(uint64_t user_mem_id, const memory_desc_t &user_md,
+                const memory_desc_t &packed_md, int numa_node);
+
+        bool operator==(const key_t &rhs) const {
+            return user_mem_id_ == rhs.user_mem_id_ && user_md_ == rhs.user_md_
+                    && packed_md_ == rhs.packed_md_
+                    && numa_node_ == rhs.numa_node_;
+        }
+
+        size_t hash() const { return hash_; }
+
+        // See memory_t::id().
+        uint64_t user_mem_id_;
+        memory_desc_t user_md_;
+        memory_desc_t packed_md_;
+        // The packed buffer is bound to the node unless it is -1.
+        int numa_node_;
+
+    private:
+        size_t hash_;
+    };
+
+    // Fills the packed buffer passed as an argument.
+    using pack_func_t = std::function<status_t(void *)>;
+
+    static prepacked_weights_registry_t &get();
+
+    // Returns the packed weights for `key` in `packed`. On a miss allocates
+    // a buffer for `key.packed_md_` and fills it with `pack`. Packing runs
+    // outside of the registry lock, so concurrent misses on the same key may
+    // pack twice; only the first result is kept.
+    status_t get_or_pack(std::shared_ptr<const void> &packed,
+            const key_t &key, const pack_func_t &pack);
+
+private:
+    struct key_hash_t {
+        size_t operator()(const key_t &key) const { return key.hash(); }
+    };
+
+    prepacked_weights_registry_t() = default;
+
+    // Drops the entries whose buffers have been released.
+    void evict_expired();
+
+    std::mutex mutex_;
+    std::unordered_map<key_t, std::weak_ptr<const void>, key_hash_t> entries_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(prepacked_weights_registry_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
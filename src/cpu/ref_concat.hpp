@@ -118,6 +118,7 @@ struct ref_concat_t : public primitive_t {
         using namespace memory_tracking::names;
         engine_t *engine = ctx.stream()->engine();
         const auto n = pd()->n_inputs();
+        if (pd()->srcs_in_place(ctx)) return status::success;
 
         auto execute_reorder = [&](const std::shared_ptr<primitive_t> &reorder,
                                        const memory_arg_t &src,
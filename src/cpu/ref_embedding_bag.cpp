@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_embedding_bag.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_INDICES);
+    auto offsets = pd()->with_offsets()
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS)
+            : nullptr;
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper idx_d(pd()->indices_md());
+    const memory_desc_wrapper off_d(pd()->offsets_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t D = pd()->D();
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t n_bags = pd()->n_bags();
+    const bool per_row_scales = pd()->with_per_row_scales();
+    const bool is_gather = pd()->is_gather();
+    const bool is_mean = pd()->is_mean();
+
+    parallel_nd(n_bags, D, [&](dim_t bag, dim_t d) {
+        // A bag spans indices [offsets[bag], offsets[bag + 1]), the last bag
+        // ends with the indices. Gather makes a bag of a single index.
+        const dim_t beg = is_gather ? bag : offsets[off_d.off(bag)];
+        const dim_t end = is_gather
+                ? bag + 1
+                : (bag + 1 < n_bags ? offsets[off_d.off(bag + 1)] : n_indices);
+
+        float acc = 0.f;
+        for (dim_t i = beg; i < end; ++i) {
+            const dim_t row = indices[idx_d.off(i)];
+            const float scale = src_scales[per_row_scales ? row : 0];
+            acc += scale
+                    * io::load_float_value(
+                            src_d.data_type(), src, src_d.off(row, d));
+        }
+        if (is_mean && end > beg) acc /= static_cast<float>(end - beg);
+
+        io::store_float_value(dst_d.data_type(), acc, dst, dst_d.off(bag, d));
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_group_normalization.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#define DATA_OFF(f, n, c, d, h, w) \
+    (ndims == 2) ? (f).off(n, c) \
+                 : ((ndims == 3) ? (f).off(n, c, w) \
+                                 : ((ndims == 4) ? (f).off(n, c, h, w) \
+                                                 : (f).off(n, c, d, h, w)))
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_group_normalization_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper sc_d(pd()->weights_md());
+
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+    auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
+    auto mean = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+    auto variance = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const int ndims = pd()->ndims();
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t Cg = pd()->C_per_group();
+    const dim_t D = pd()->D();
+    const dim_t H = pd()->H();
+    const dim_t W = pd()->W();
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool save_stats = pd()->is_training();
+    const bool calculate_stats = !pd()->stats_are_src();
+
+    /* fast return */
+    if (this->pd()->has_zero_dim_memory()) {
+        if (calculate_stats && save_stats) {
+            for (dim_t n = 0; n < N; n++)
+                for (dim_t g = 0; g < G; g++) {
+                    mean[stat_d.off(n, g)] = 0;
+                    variance[stat_d.off(n, g)] = 0;
+                }
+        }
+        return status::success;
+    }
+
+    parallel_nd(N, G, [&](dim_t n, dim_t g) {
+        const auto s_off = stat_d.off(n, g);
+        float v_mean = calculate_stats ? 0 : mean[s_off];
+        float v_variance = calculate_stats ? 0 : variance[s_off];
+
+        if (calculate_stats) {
+            // Groups may be large, accumulate in double to keep precision.
+            const dim_t group_size = Cg * D * H * W;
+            double sum = 0;
+            for_(dim_t c = g * Cg; c < (g + 1) * Cg; ++c)
+            for_(dim_t d = 0; d < D; ++d)
+            for_(dim_t h = 0; h < H; ++h)
+            for (dim_t w = 0; w < W; ++w) {
+                const auto off = DATA_OFF(src_d, n, c, d, h, w);
+                sum += io::load_float_value(src_d.data_type(), src, off);
+            }
+            v_mean = static_cast<float>(sum / group_size);
+
+            double sum_sq = 0;
+            for_(dim_t c = g * Cg; c < (g + 1) * Cg; ++c)
+            for_(dim_t d = 0; d < D; ++d)
+            for_(dim_t h = 0; h < H; ++h)
+            for (dim_t w = 0; w < W; ++w) {
+                const auto off = DATA_OFF(src_d, n, c, d, h, w);
+                const float m = io::load_float_value(
+                                        src_d.data_type(), src, off)
+                        - v_mean;
+                sum_sq += m * m;
+            }
+            v_variance = static_cast<float>(sum_sq / group_size);
+
+            if (save_stats) {
+                mean[s_off] = v_mean;
+                variance[s_off] = v_variance;
+            }
+        }
+
+        const float sqrt_variance = sqrtf(v_variance + eps);
+        for (dim_t c = g * Cg; c < (g + 1) * Cg; ++c) {
+            const float sm = (scale ? scale[sc_d.off(c)] : 1.f) / sqrt_variance;
+            const float sv = shift ? shift[sc_d.off(c)] : 0;
+            for_(dim_t d = 0; d < D; ++d)
+            for_(dim_t h = 0; h < H; ++h)
+            for (dim_t w = 0; w < W; ++w) {
+                const auto s_off = DATA_OFF(src_d, n, c, d, h, w);
+                const auto d_off = DATA_OFF(dst_d, n, c, d, h, w);
+                float s = io::load_float_value(src_d.data_type(), src, s_off);
+                float val = sm * (s - v_mean) + sv;
+                val *= src_scales[0];
+
+                ref_post_ops_t::args_t args;
+                args.ctx = &ctx;
+                args.l_offset = ((n * C + c) * D + d) * H * W + h * W + w;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops->execute(val, args);
+
+                val *= dst_scales[0];
+                io::store_float_value(dst_d.data_type(), val, dst, d_off);
+            }
+        }
+    });
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -56,9 +56,20 @@ inline float load_float_value(data_type_t dt, const void *ptr, dim_t idx) {
         return static_cast<float>( \
                 reinterpret_cast<const typename prec_traits<dt>::type *>( \
                         ptr)[idx]);
+    // 4-bit values are addressed by the element index, two elements per byte.
+#define CASE_4BIT(dt) \
+    case dt: \
+        return static_cast<float>(prec_traits<dt>::type::extract( \
+                reinterpret_cast<const uint8_t *>(ptr)[idx / 2], \
+                int4_half(idx)));
 
     using namespace data_type;
     switch (dt) {
+        CASE_4BIT(s4);
+        CASE_4BIT(u4);
+        CASE_4BIT(nf4);
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
         CASE(bf16);
         CASE(f16);
         CASE(f32);
@@ -68,10 +79,13 @@ inline float load_float_value(data_type_t dt, const void *ptr, dim_t idx) {
         default: assert(!"bad data_type");
     }
 
+#undef CASE_4BIT
 #undef CASE
     return NAN;
 }
 
+// Note: a store of a 4-bit value rewrites the whole byte, hence adjacent
+// elements must not be stored concurrently.
 inline void store_float_value(data_type_t dt, float val, void *ptr, dim_t idx) {
     assert(ptr);
 #define CASE(dt) \
@@ -80,9 +94,20 @@ inline void store_float_value(data_type_t dt, float val, void *ptr, dim_t idx) {
         *(reinterpret_cast<type_ *>(ptr) + idx) \
                 = cpu::saturate_and_round<type_>(val); \
     } break;
+#define CASE_4BIT(dt) \
+    case dt: { \
+        auto &byte = reinterpret_cast<uint8_t *>(ptr)[idx / 2]; \
+        byte = typename prec_traits<dt>::type(val).insert( \
+                byte, int4_half(idx)); \
+    } break;
 
     using namespace data_type;
     switch (dt) {
+        CASE_4BIT(s4);
+        CASE_4BIT(u4);
+        CASE_4BIT(nf4);
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
         CASE(bf16);
         CASE(f16);
         CASE(f32);
@@ -92,6 +117,7 @@ inline void store_float_value(data_type_t dt, float val, void *ptr, dim_t idx) {
         default: assert(!"bad data_type");
     }
 
+#undef CASE_4BIT
 #undef CASE
 }
 
@@ -39,7 +39,9 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
-    auto mean = pd()->stats_are_src()
+    const bool use_rms_norm = pd()->use_rms_norm();
+    auto mean = use_rms_norm ? nullptr
+            : pd()->stats_are_src()
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
             : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
     auto variance = pd()->stats_are_src()
@@ -61,7 +63,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     if (this->pd()->has_zero_dim_memory()) {
         if (calculate_stats && save_stats) {
             for (dim_t n = 0; n < N; n++) {
-                mean[n] = 0;
+                if (mean) mean[n] = 0;
                 variance[n] = 0;
             }
         }
@@ -70,16 +72,19 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
 
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
-        auto v_mean = calculate_stats ? 0 : mean[s_off];
+        auto v_mean = (calculate_stats || use_rms_norm) ? 0 : mean[s_off];
         auto v_variance = calculate_stats ? 0 : variance[s_off];
 
         if (calculate_stats) {
-            for (dim_t c = 0; c < C; ++c) {
-                const auto s_off = src_d.off_l(n * C + c);
-                float s = io::load_float_value(src_d.data_type(), src, s_off);
-                v_mean += s;
+            if (!use_rms_norm) {
+                for (dim_t c = 0; c < C; ++c) {
+                    const auto s_off = src_d.off_l(n * C + c);
+                    float s = io::load_float_value(
+                            src_d.data_type(), src, s_off);
+                    v_mean += s;
+                }
+                v_mean /= C;
             }
-            v_mean /= C;
 
             for (dim_t c = 0; c < C; ++c) {
                 const auto s_off = src_d.off_l(n * C + c);
@@ -104,7 +109,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
 
         if (calculate_stats) {
             if (save_stats) {
-                mean[s_off] = v_mean;
+                if (mean) mean[s_off] = v_mean;
                 variance[s_off] = v_variance;
             }
         }
@@ -127,7 +132,9 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
     const auto use_shift = pd()->use_shift();
 
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
-    auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    const bool use_rms_norm = pd()->use_rms_norm();
+    auto mean = use_rms_norm ? nullptr
+                             : CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
     auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
     auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
     auto scale = CTX_IN_MEM(float *, DNNL_ARG_SCALE);
@@ -177,7 +184,8 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
                 float s = io::load_float_value(src_d.data_type(), src, src_off);
                 float dd = io::load_float_value(
                         diff_dst_d.data_type(), diff_dst, diff_dst_off);
-                diff_gamma += (s - mean[stat_off]) * dd * inv_sqrt_variance;
+                const float m = mean ? mean[stat_off] : 0.f;
+                diff_gamma += (s - m) * dd * inv_sqrt_variance;
                 diff_beta += dd;
             }
 
@@ -188,6 +196,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
 
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
+        const float v_mean = mean ? mean[s_off] : 0.f;
         float inv_sqrt_variance = 1.f / sqrtf(variance[s_off] + eps);
         float dd_gamma = 0.f;
         float dd_gamma_x = 0.f;
@@ -200,7 +209,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
                 float dd = io::load_float_value(
                         diff_dst_d.data_type(), diff_dst, diff_dst_off);
                 dd_gamma += dd * gamma;
-                dd_gamma_x += dd * gamma * (s - mean[s_off]);
+                dd_gamma_x += dd * gamma * (s - v_mean);
             }
             dd_gamma_x *= inv_sqrt_variance;
         }
@@ -215,8 +224,9 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
             float d_src = dd * gamma;
             if (calculate_diff_stats) {
                 float s = io::load_float_value(src_d.data_type(), src, src_off);
-                d_src -= dd_gamma / C;
-                d_src -= (s - mean[s_off]) * dd_gamma_x * inv_sqrt_variance / C;
+                // With RMS normalization the mean is not a function of src.
+                if (!use_rms_norm) d_src -= dd_gamma / C;
+                d_src -= (s - v_mean) * dd_gamma_x * inv_sqrt_variance / C;
             }
             d_src *= inv_sqrt_variance;
             io::store_float_value(
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto qry = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    auto msk = pd()->with_mask() ? CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK)
+                                 : nullptr;
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    float *scores_base
+            = ctx.get_scratchpad_grantor().template get<float>(key_sdpa_scores);
+
+    const memory_desc_wrapper q_d(pd()->qry_md());
+    const memory_desc_wrapper k_d(pd()->key_md());
+    const memory_desc_wrapper v_d(pd()->val_md());
+    const memory_desc_wrapper m_d(pd()->msk_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const int ndims = pd()->ndims();
+    const dim_t MB = pd()->batch();
+    const dim_t SQ = pd()->queries();
+    const dim_t SKV = pd()->keys();
+    const dim_t D = pd()->head_size();
+    const dim_t DV = pd()->value_head_size();
+    const float scale = pd()->desc()->scale;
+    const bool causal = pd()->with_causal_mask();
+    // The query `i` attends to the keys up to `i + causal_shift`, so the last
+    // query sees all the keys when there are more keys than queries.
+    const dim_t causal_shift = SKV - SQ;
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(MB * SQ, nthr, ithr, start, end);
+
+        float *scores = scores_base + ithr * SKV;
+        dims_t pos, kv_pos, m_pos;
+
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t mb = iwork / SQ;
+            const dim_t i = iwork % SQ;
+
+            // The batch position is shared by all the tensors except the
+            // mask, which may be broadcast.
+            utils::l_dims_by_l_offset(pos, mb, q_d.dims(), ndims - 2);
+            utils::array_copy(kv_pos, pos, ndims - 2);
+            if (msk) {
+                for (int d = 0; d < ndims - 2; d++)
+                    m_pos[d] = m_d.dims()[d] == 1 ? 0 : pos[d];
+                m_pos[ndims - 2] = m_d.dims()[ndims - 2] == 1 ? 0 : i;
+            }
+            pos[ndims - 2] = i;
+
+            const dim_t n_keys = causal
+                    ? nstl::max(dim_t(0), nstl::min(SKV, i + causal_shift + 1))
+                    : SKV;
+
+            float max_score = -INFINITY;
+            for (dim_t j = 0; j < n_keys; j++) {
+                kv_pos[ndims - 2] = j;
+                float s = 0.f;
+                for (dim_t d = 0; d < D; d++) {
+                    pos[ndims - 1] = d;
+                    kv_pos[ndims - 1] = d;
+                    s += io::load_float_value(
+                                 q_d.data_type(), qry, q_d.off_v(pos))
+                            * io::load_float_value(
+                                    k_d.data_type(), key, k_d.off_v(kv_pos));
+                }
+                s *= scale;
+                if (msk) {
+                    m_pos[ndims - 1] = m_d.dims()[ndims - 1] == 1 ? 0 : j;
+                    s += io::load_float_value(
+                            m_d.data_type(), msk, m_d.off_v(m_pos));
+                }
+                scores[j] = s;
+                max_score = nstl::max(max_score, s);
+            }
+
+            // A row without a single key to attend to produces zeros.
+            float sum = 0.f;
+            if (max_score != -INFINITY) {
+                for (dim_t j = 0; j < n_keys; j++) {
+                    scores[j] = expf(scores[j] - max_score);
+                    sum += scores[j];
+                }
+            }
+
+            for (dim_t dv = 0; dv < DV; dv++) {
+                kv_pos[ndims - 1] = dv;
+                float acc = 0.f;
+                for (dim_t j = 0; j < n_keys && sum > 0.f; j++) {
+                    kv_pos[ndims - 2] = j;
+                    acc += scores[j]
+                            * io::load_float_value(
+                                    v_d.data_type(), val, v_d.off_v(kv_pos));
+                }
+                pos[ndims - 1] = dv;
+                io::store_float_value(dst_d.data_type(),
+                        sum > 0.f ? acc / sum : 0.f, dst, dst_d.off_v(pos));
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SDPA_HPP
+#define CPU_REF_SDPA_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_sdpa_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const auto dt_ok = [](data_type_t dt) {
+                return utils::one_of(dt, f32, bf16, f16)
+                        && platform::has_data_type_support(dt);
+            };
+
+            bool ok = dt_ok(qry_md()->data_type) && dt_ok(key_md()->data_type)
+                    && dt_ok(val_md()->data_type)
+                    && dt_ok(dst_md()->data_type)
+                    && IMPLICATION(with_mask(), dt_ok(msk_md()->data_type))
+                    && attr()->has_default_values()
+                    && set_default_params() == status::success;
+            if (!ok) return status::unimplemented;
+
+            for (int i = 0; i < n_inputs(); i++)
+                if (!memory_desc_wrapper(src_md(i)).is_blocking_desc())
+                    return status::unimplemented;
+            if (!memory_desc_wrapper(dst_md()).is_blocking_desc())
+                return status::unimplemented;
+
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+
+    private:
+        void init_scratchpad() {
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    memory_tracking::names::key_sdpa_scores, nthr_ * keys());
+        }
+    };
+
+    ref_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -27,15 +27,31 @@ regular_impl_list_map() {
     static const std::map<reorder_impl_key_t, const void *> the_map = {
             {{f32, bf16, 0}, &regular_f32_bf16_impl_list_map()},
             {{f32, f16, 0}, &regular_f32_f16_impl_list_map()},
+            {{f32, f8_e5m2, 0}, &regular_f32_f8_impl_list_map()},
+            {{f32, f8_e4m3, 0}, &regular_f32_f8_impl_list_map()},
             {{f32, f32, 0}, &regular_f32_f32_impl_list_map()},
             {{f32, s32, 0}, &regular_f32_s32_impl_list_map()},
             {{f32, s8, 0}, &regular_f32_s8_impl_list_map()},
             {{f32, u8, 0}, &regular_f32_u8_impl_list_map()},
+            {{f32, s4, 0}, &regular_int4_impl_list_map()},
+            {{f32, u4, 0}, &regular_int4_impl_list_map()},
+            {{f32, nf4, 0}, &regular_int4_impl_list_map()},
+            {{bf16, s4, 0}, &regular_int4_impl_list_map()},
+            {{bf16, u4, 0}, &regular_int4_impl_list_map()},
+            {{bf16, nf4, 0}, &regular_int4_impl_list_map()},
+            {{f16, s4, 0}, &regular_int4_impl_list_map()},
+            {{f16, u4, 0}, &regular_int4_impl_list_map()},
+            {{f16, nf4, 0}, &regular_int4_impl_list_map()},
             {{bf16, data_type::undef, 0}, &regular_bf16_impl_list_map()},
             {{f16, data_type::undef, 0}, &regular_f16_impl_list_map()},
+            {{f8_e5m2, data_type::undef, 0}, &regular_f8_impl_list_map()},
+            {{f8_e4m3, data_type::undef, 0}, &regular_f8_impl_list_map()},
             {{s32, data_type::undef, 0}, &regular_s32_impl_list_map()},
             {{s8, data_type::undef, 0}, &regular_s8_impl_list_map()},
             {{u8, data_type::undef, 0}, &regular_u8_impl_list_map()},
+            {{s4, data_type::undef, 0}, &regular_int4_impl_list_map()},
+            {{u4, data_type::undef, 0}, &regular_int4_impl_list_map()},
+            {{nf4, data_type::undef, 0}, &regular_int4_impl_list_map()},
     };
     return the_map;
 }
@@ -34,6 +34,8 @@ const impl_list_map_t &regular_f16_impl_list_map() {
             REG_SR(f16, any, f32, any, fmt_order::any, spec::reference)
             REG_SR(f16, any, s8, any, fmt_order::any, spec::reference)
             REG_SR(f16, any, u8, any, fmt_order::any, spec::reference)
+            REG_SR(f16, any, f8_e5m2, any, fmt_order::any, spec::reference)
+            REG_SR(f16, any, f8_e4m3, any, fmt_order::any, spec::reference)
 
             nullptr,
         }},
@@ -31,6 +31,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
 
 #include "cpu/simple_q10n.hpp"
@@ -61,6 +62,7 @@ namespace spec {
 struct direct_copy {};
 struct direct_copy_except_dim_0 {};
 struct reference {};
+struct reference_4bit {}; // {s4, u4, nf4: packed data}
 struct conv_req_comp {}; // {s8, u8: asymmetric quantization}
 } // namespace spec
 
@@ -2125,6 +2127,91 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
     }
 };
 
+template <SIMPLE_REORDER_TEMPL_DECL>
+struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
+        typename utils::enable_if<tag_i == format_tag::any
+                        && tag_o == format_tag::any
+                        && order_keep == fmt_order::any,
+                spec::reference_4bit>::type> {
+    static bool is_applicable(const memory_desc_wrapper &input_d,
+            const memory_desc_wrapper &output_d, const primitive_attr_t *attr) {
+        int src_scales_mask = -1;
+        int dst_scales_mask = -1;
+        CHECK(get_scales_mask(attr, &src_scales_mask, &dst_scales_mask));
+
+        for (auto smask : {src_scales_mask, dst_scales_mask}) {
+            for (; smask > 0 && !(smask & 0x1); smask >>= 1)
+                ;
+            for (; smask > 0 && smask & 0x1; smask >>= 1)
+                ;
+            if (smask != 0) return false;
+        }
+
+        using skip_mask_t = dnnl_primitive_attr::skip_mask_t;
+        // Zero padding of packed data is not supported.
+        return input_d.is_blocking_desc() && output_d.is_blocking_desc()
+                && !output_d.is_additional_buffer()
+                && !input_d.is_additional_buffer()
+                && IMPLICATION(types::is_4bit(type_o),
+                        output_d.nelems(true) == output_d.nelems())
+                && attr->has_default_values(skip_mask_t::scales_runtime
+                        | skip_mask_t::zero_points_runtime);
+    }
+
+    GET_SCRATCHPAD_SIZE_ZERO();
+
+    static status_t execute(const cpu_reorder_pd_t *pd, const exec_ctx_t &ctx) {
+        DECLARE_COMMON_PARAMS();
+
+        // Packed elements are accessed by their logical offsets, so typed
+        // pointers must not be indexed directly.
+        auto ker = [&](dim_t e) {
+            const dim_t dm = (e / D_rest) % D_mask;
+            const float src_scale = src_scales[src_scales_mask == 0 ? 0 : dm];
+            const float dst_scale = dst_scales[dst_scales_mask == 0 ? 0 : dm];
+
+            float f = io::load_float_value(type_i, input, input_d.off_l(e));
+            f = src_scale * (f - src_zp);
+            f = f * dst_scale + dst_zp;
+            io::store_float_value(type_o, f, output, output_d.off_l(e));
+        };
+
+        const dim_t nelems = input_d.nelems();
+        if (!types::is_4bit(type_o)) {
+            ctx.zero_pad_output(DNNL_ARG_TO);
+            parallel_nd(nelems, ker);
+        } else if (is_row_major_dense(output_d)) {
+            // Every thread writes whole bytes of the destination.
+            parallel_nd(utils::div_up(nelems, 2), [&](dim_t p) {
+                ker(2 * p);
+                if (2 * p + 1 < nelems) ker(2 * p + 1);
+            });
+        } else {
+            // Two halves of a byte may belong to logically distant elements,
+            // so the destination is written by a single thread.
+            for (dim_t e = 0; e < nelems; ++e)
+                ker(e);
+        }
+
+        return status::success;
+    }
+
+private:
+    // Returns true if the logical offset of an element matches its physical
+    // offset up to an even shift.
+    static bool is_row_major_dense(const memory_desc_wrapper &md) {
+        if (md.blocking_desc().inner_nblks != 0 || md.offset0() % 2 != 0)
+            return false;
+        dim_t stride = 1;
+        for (int d = md.ndims() - 1; d >= 0; --d) {
+            if (md.dims()[d] == 1) continue;
+            if (md.blocking_desc().strides[d] != stride) return false;
+            stride *= md.dims()[d];
+        }
+        return true;
+    }
+};
+
 /* high level class declaration */
 
 template <SIMPLE_REORDER_TEMPL_DECL, typename spec = void>
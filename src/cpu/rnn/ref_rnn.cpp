@@ -29,6 +29,9 @@
 
  */
 
+#include <algorithm>
+#include <cstring>
+
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
@@ -238,6 +241,11 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                   return dnnl_success;
               };
 
+    // With variable sequence lengths a cell computes only the rows that are
+    // active at its time step.
+    rnn_conf_t step_rnn;
+    if (rnn.is_var_seq_len) step_rnn = rnn;
+
     // We run the grid of computation
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
@@ -252,6 +260,17 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             const int iter
                     = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
 
+            if (rnn.is_var_seq_len) {
+                step_rnn.mb = rnn.seq_active_mb[iter];
+                if (step_rnn.mb == 0) continue;
+                // The brgemm kernels are generated for whole blocks of rows,
+                // so the rows of the last block that have finished already
+                // are computed as well. Their results are never read.
+                if (rnn.is_brgemm)
+                    step_rnn.M_blocks = utils::div_up(step_rnn.mb, rnn.m_block);
+            }
+            const rnn_conf_t &cell_rnn = rnn.is_var_seq_len ? step_rnn : rnn;
+
             // We set parameters to the cell execution call
 
             // dst_layer is equal to dst_iter. To avoid
@@ -312,13 +331,14 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 
             // because the c state is always f32 and require no
             // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
+            // and last iteration. With variable sequence lengths the rows
+            // are reordered, so the c state goes through the workspace.
+            if (iter == 0 && src_iter_c_ && !rnn.is_var_seq_len) {
                 cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
                         src_iter_c_mdw.off(lay, dir, 0, 0));
                 cell_position |= c_state_first_iter;
             }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            if (iter == rnn.n_iter - 1 && dst_iter_c_ && !rnn.is_var_seq_len) {
                 cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
                         dst_iter_c_mdw.off(lay, dir, 0, 0));
                 cell_position |= c_state_last_iter;
@@ -338,7 +358,8 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             }
 
 #if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
+            CHECK((this->*cell_func)(ctx, cell_rnn, cell_position,
+                    cell_dst_layer,
                     cell_dst_iter_c,
                     SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
                     SAFE_PTR(diff_augru_attention, iter, 0, 0),
@@ -368,7 +389,7 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                     scratch_src_iter_, cell_dst_iter, amx_scratchpad,
                     addr_batch_global));
 #else
-            CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
+            CHECK((this->*cell_func)(cell_rnn, cell_position, cell_dst_layer,
                     cell_dst_iter_c,
                     SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
                     SAFE_PTR(diff_augru_attention, iter, 0, 0),
@@ -462,11 +483,25 @@ void copy_init_layer_fwd_template(const rnn_conf_t &rnn,
     const AOC<src_data_t, 4> ws_states_layer(ws_states_layer_, rnn.n_dir,
             rnn.n_iter + 1, rnn.mb, rnn.ws_states_layer_ld);
 
+    // With variable sequence lengths the input of the row `b` is taken from
+    // the user minibatch element user_mb(b), and the right-to-left direction
+    // starts from its last valid time step. The time steps past the sequence
+    // length are zeroed for the brgemm cell which may compute finished rows.
     parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
-        auto xxt = xt_ + xt_d.blk_off(it, b);
+        const int len = rnn.seq_len(b);
+        if (it >= len) {
+            for (int dir : {0, rnn.n_dir - 1}) {
+                src_data_t *ws_ptr = &(ws_states_layer(dir, it + 1, b, 0));
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < rnn.slc; c++)
+                    ws_ptr[c] = 0;
+            }
+            return;
+        }
+        auto xxt = xt_ + xt_d.blk_off(it, rnn.user_mb(b));
         src_data_t *ws_l2r_ptr = &(ws_states_layer(0, it + 1, b, 0));
         src_data_t *ws_r2l_ptr
-                = &(ws_states_layer(rnn.n_dir - 1, rnn.n_iter - it, b, 0));
+                = &(ws_states_layer(rnn.n_dir - 1, len - it, b, 0));
         if (rnn.exec_dir != r2l) {
             if (rnn.is_bf32()) {
                 cvt_float_to_bfloat16(
@@ -621,15 +656,27 @@ void copy_init_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
             *(static_cast<bfloat16_t *>(ws_states_iter_c)) = 0.0f;
     };
 
+    // The c state is read from the user memory directly unless the rows are
+    // reordered because of variable sequence lengths.
+    const bool copy_c_state = rnn.is_var_seq_len && src_iter_c_;
     if (src_iter_) {
         parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
                 [&](dim_t lay, dim_t dir, dim_t b) {
+                    const int ub = rnn.user_mb(b);
                     const auto *ss
-                            = &src_iter_[src_iter_d.blk_off(lay, dir, b, 0)];
+                            = &src_iter_[src_iter_d.blk_off(lay, dir, ub, 0)];
                     auto *dd = &ws_states_iter(lay + 1, dir, 0, b, 0);
                     PRAGMA_OMP_SIMD()
                     for (int s = 0; s < rnn.sic; s++)
                         dd[s] = maybe_q(ss[s]);
+                    if (copy_c_state)
+                        std::memcpy(const_cast<void *>(ws_states_iter_c_aoc(
+                                            lay + 1, dir, 0, b, 0)),
+                                inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                                        src_iter_c_d.blk_off(lay, dir, ub, 0)),
+                                rnn.dhc
+                                        * types::data_type_size(
+                                                rnn.src_iter_c_dt));
                 });
     } else {
         parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
@@ -787,26 +834,38 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
 
     // if skip_dst_iter_copy, then the data for the last iteration is
     // in dst_iter, not in workspace
+    // With variable sequence lengths the output of the row `b` goes to the
+    // user minibatch element user_mb(b), and the time steps past the
+    // sequence length are filled with zeros.
+    const dim_t dst_layer_c = dst_layer_d.dims()[2];
     parallel_nd(rnn.n_iter - (rnn.skip_dst_iter_copy() ? 1 : 0), rnn.mb,
             [&](dim_t it, dim_t b) {
+                const int len = rnn.seq_len(b);
+                const int ub = rnn.user_mb(b);
+                if (it >= len) {
+                    auto *dd = &dst_layer_[dst_layer_d.blk_off(it, ub, 0)];
+                    for (dim_t s = 0; s < dst_layer_c; s++)
+                        dd[s] = (dst_layer_dt)0.f;
+                    return;
+                }
                 int dir = 0;
                 if (rnn.exec_dir != r2l) {
                     const auto *ss
                             = &ws_states_layer(rnn.n_layer, dir, it + 1, b, 0);
                     auto *dd = &dst_layer_[dst_layer_d.blk_off(
-                            it, b, dir * rnn.dlc)];
+                            it, ub, dir * rnn.dlc)];
                     copy_vec(dd, ss);
                     dir = 1;
                 }
                 if (rnn.exec_dir != l2r) {
                     const auto *ss = &ws_states_layer(
-                            rnn.n_layer, dir, rnn.n_iter - it, b, 0);
+                            rnn.n_layer, dir, len - it, b, 0);
                     if (rnn.exec_dir == bi_sum) {
-                        auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
+                        auto *dd = &dst_layer_[dst_layer_d.blk_off(it, ub, 0)];
                         acc_vec(dd, ss);
                     } else {
                         auto *dd = &dst_layer_[dst_layer_d.blk_off(
-                                it, b, dir * rnn.dlc)];
+                                it, ub, dir * rnn.dlc)];
                         copy_vec(dd, ss);
                     }
                 }
@@ -928,12 +987,26 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
     // layer is in dst_layer, not in workspace.
     const auto n_layer_in_ws = rnn.n_layer - rnn.skip_dst_layer_copy();
 
+    // With variable sequence lengths the final states are taken from the
+    // last valid time step of each row, including the c state which is
+    // written to the workspace in this case.
+    const auto ws_states_iter_c = rnn_utils::make_raw_aoc(ws_states_iter_c_,
+            types::data_type_size(rnn.dst_iter_c_dt), rnn.n_layer + 1,
+            rnn.n_dir, rnn.n_iter + 1, rnn.mb, rnn.ws_states_iter_c_ld);
+    const bool copy_c_state = rnn.is_var_seq_len && dst_iter_c_;
+
     parallel_nd(n_layer_in_ws, rnn.n_dir, rnn.mb,
             [&](dim_t lay, dim_t dir, dim_t b) {
-                const auto *ss
-                        = &ws_states_iter(lay + 1, dir, rnn.n_iter, b, 0);
-                auto *dd = dst_iter_ + dst_iter_d.blk_off(lay, dir, b, 0);
+                const int len = rnn.seq_len(b);
+                const int ub = rnn.user_mb(b);
+                const auto *ss = &ws_states_iter(lay + 1, dir, len, b, 0);
+                auto *dd = dst_iter_ + dst_iter_d.blk_off(lay, dir, ub, 0);
                 copy_vec(dd, ss);
+                if (copy_c_state)
+                    std::memcpy(inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                                        dst_iter_c_d.blk_off(lay, dir, ub, 0)),
+                            ws_states_iter_c(lay + 1, dir, len, b, 0),
+                            rnn.dhc * types::data_type_size(rnn.dst_iter_c_dt));
             });
 
     if (rnn.skip_dst_layer_copy()) {
@@ -1159,11 +1232,58 @@ rnn_weights_assign_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 }
 
 //********************* Execution function *********************//
+
+// Sorts the rows of the minibatch by decreasing sequence length and counts
+// the rows active at each time step. The sort is stable, so rows of equal
+// length keep the user order.
+static status_t init_var_seq_len(
+        rnn_conf_t &rnn, const int32_t *seq_lengths, int *buf) {
+    if (seq_lengths == nullptr) return status::invalid_arguments;
+    for (int b = 0; b < rnn.mb; b++)
+        if (seq_lengths[b] < 0 || seq_lengths[b] > rnn.n_iter)
+            return status::invalid_arguments;
+
+    int *order = buf;
+    int *lengths = buf + rnn.mb;
+    int *active_mb = buf + 2 * rnn.mb;
+    for (int b = 0; b < rnn.mb; b++)
+        order[b] = b;
+    std::stable_sort(order, order + rnn.mb, [&](int a, int b) {
+        return seq_lengths[a] > seq_lengths[b];
+    });
+    for (int b = 0; b < rnn.mb; b++)
+        lengths[b] = seq_lengths[order[b]];
+
+    int n_active = rnn.mb;
+    for (int it = 0; it < rnn.n_iter; it++) {
+        while (n_active > 0 && lengths[n_active - 1] <= it)
+            n_active--;
+        active_mb[it] = n_active;
+    }
+
+    rnn.seq_order = order;
+    rnn.seq_lengths = lengths;
+    rnn.seq_active_mb = active_mb;
+    return status::success;
+}
+
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
         data_type_t acc_type>
 status_t _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
         const exec_ctx_t &ctx) const {
-    const rnn_conf_t &rnn = this->pd()->rnn_;
+    auto scratchpad = ctx.get_scratchpad_grantor();
+
+    // The configuration is extended with the rows order when variable
+    // sequence lengths are used.
+    rnn_conf_t var_seq_rnn;
+    if (pd()->rnn_.is_var_seq_len) {
+        var_seq_rnn = pd()->rnn_;
+        CHECK(init_var_seq_len(var_seq_rnn,
+                CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS),
+                scratchpad.template get<int>(key_rnn_seq_lengths)));
+    }
+    const rnn_conf_t &rnn
+            = pd()->rnn_.is_var_seq_len ? var_seq_rnn : pd()->rnn_;
     auto src_layer = CTX_IN_MEM(const src_layer_t *, DNNL_ARG_SRC_LAYER);
     auto augru_attention
             = CTX_IN_MEM(const src_layer_t *, DNNL_ARG_AUGRU_ATTENTION);
@@ -1201,7 +1321,6 @@ status_t _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             iter_weights_n_comp + rnn.weights_iter_comp_offset);
     auto w_projection_comp = reinterpret_cast<const float *>(
             projection_weights_n_comp + rnn.weights_projection_comp_offset);
-    auto scratchpad = ctx.get_scratchpad_grantor();
 
     auto ptr_wei_layer
             = scratchpad.template get<weights_t *>(key_rnn_ptrs_wei_layer);
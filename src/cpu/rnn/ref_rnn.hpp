@@ -171,6 +171,12 @@ struct _ref_rnn_common_t : public primitive_t {
                     this->arg_md(DNNL_ARG_BIAS));
             if (!ok) return status::unimplemented;
 
+            // Variable sequence lengths are supported for the forward
+            // floating-point configurations only.
+            if (rnn_.is_var_seq_len
+                    && (aprop != prop_kind::forward || rnn_.is_int8_conf()))
+                return status::unimplemented;
+
             if (rnn_.is_bf16_conf()) {
                 if (!utils::one_of(
                             rnn_.bias_dt, data_type::bf16, data_type::f32)
@@ -302,7 +308,12 @@ struct _ref_rnn_common_t : public primitive_t {
             ok = ok
                     && IMPLICATION(one_of(this->desc()->prop_kind,
                                            forward_training, backward),
-                            (rnn_.is_bf16_conf() || rnn_.is_f32_conf()));
+                            (rnn_.is_bf16_conf() || rnn_.is_f32_conf()))
+                    // Variable sequence lengths are supported for the forward
+                    // floating-point configurations only.
+                    && IMPLICATION(rnn_.is_var_seq_len,
+                            aprop == prop_kind::forward
+                                    && !rnn_.is_int8_conf());
 
             if (!ok) return status::unimplemented;
 
@@ -532,6 +543,11 @@ struct _ref_rnn_common_t : public primitive_t {
                     key_rnn_diff_ht, rnn_.scratch_diff_ht_size);
             scratchpad.template book<scratch_t>(
                     key_rnn_cell, rnn_.scratch_cell_size);
+            // rows order, rows lengths and the number of active rows per
+            // time step
+            if (rnn_.is_var_seq_len)
+                scratchpad.template book<int>(
+                        key_rnn_seq_lengths, 2 * rnn_.mb + rnn_.n_iter);
 
 #if DNNL_X64
             if (rnn_.is_brgemm) {
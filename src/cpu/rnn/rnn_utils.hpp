@@ -381,6 +381,24 @@ struct rnn_conf_t {
 
     bool diff_weights_overwrite = false;
 
+    // Variable sequence lengths. The rows of the minibatch are processed in
+    // the order of decreasing sequence length, so that the rows active at a
+    // time step always form a prefix of the minibatch. The pointers are set
+    // at execution time and are null otherwise.
+    bool is_var_seq_len = false;
+    const int *seq_order = nullptr; // user minibatch index of each row
+    const int *seq_lengths = nullptr; // sequence length of each row
+    const int *seq_active_mb = nullptr; // number of active rows per time step
+
+    // Returns the sequence length of the row `b`.
+    inline int seq_len(int b) const {
+        return is_var_seq_len ? seq_lengths[b] : n_iter;
+    }
+    // Returns the user minibatch index of the row `b`.
+    inline int user_mb(int b) const {
+        return is_var_seq_len ? seq_order[b] : b;
+    }
+
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
     }
@@ -427,23 +445,25 @@ struct rnn_conf_t {
     inline bool is_bf32() const { return is_cell_bf16_amx() && is_f32_conf(); }
 
     inline bool skip_src_layer_copy() const {
-        return (exec_dir == l2r) && !is_bf32()
+        return (exec_dir == l2r) && !is_bf32() && !is_var_seq_len
                 && utils::one_of(dt_conf, s8s8s8f32, f32s8f32f32, s8s8s8s8,
                         f32s8f32s8, u8u8u8u8, u8u8u8f32, f32u8f32u8,
                         f32u8f32f32, all_f32, all_bf16);
     }
     inline bool skip_src_iter_copy() const {
         return (exec_dir == l2r) && (src_iter_ld_ > 0) && !is_bf32()
+                && !is_var_seq_len
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16);
     }
     inline bool skip_dst_layer_copy() const {
-        return (exec_dir == l2r) && !is_bf32()
+        return (exec_dir == l2r) && !is_bf32() && !is_var_seq_len
                 && utils::one_of(dt_conf, s8s8s8s8, f32s8f32s8, u8u8u8u8,
                         f32u8f32u8, all_f32, all_bf16);
     }
     inline bool skip_dst_iter_copy() const {
         return (exec_dir == l2r) && (dst_iter_ld_ > 0) && !is_bf32()
+                && !is_var_seq_len
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16);
     }
@@ -648,6 +668,7 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             && !memory_desc_wrapper(rd.weights_projection_desc).is_zero();
     rnn.is_augru
             = utils::one_of(rd.cell_kind, dnnl_lbr_augru, dnnl_vanilla_augru);
+    rnn.is_var_seq_len = rd.flags & rnn_flags::variable_sequence_length;
     rnn.bias_dt = bias_d.is_zero() ? data_type::f32 : bias_d.data_type();
     rnn.src_iter_c_dt = src_iter_c_d.is_zero() ? data_type::f32
                                                : src_iter_c_d.data_type();
@@ -829,7 +850,9 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             = dst_layer_d.blocking_desc().strides[0]
             == (rnn.dst_layer_ld_ * rnn.mb);
 
-    rnn.merge_gemm_layer = (!rnn.is_brgemm)
+    // With variable sequence lengths the number of rows changes from one time
+    // step to another, so the layer GEMM cannot be merged across time steps.
+    rnn.merge_gemm_layer = (!rnn.is_brgemm && !rnn.is_var_seq_len)
             ? ((rnn.is_fwd && rnn.src_layer_is_trivial_stride)
                       || ((rd.prop_kind == prop_kind::backward)
                               && dst_layer_is_trivial_stride))
@@ -873,6 +896,13 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
 
     rnn.diff_weights_overwrite = rd.flags & rnn_flags::diff_weights_overwrite;
 
+    // Packed GEMMs are set up for the full minibatch size.
+    if (rnn.is_var_seq_len) {
+        rnn.use_layer_packed_gemm = false;
+        rnn.use_iter_packed_gemm = false;
+        rnn.use_projection_packed_gemm = false;
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // XXX: Threadpool runtime may use different number of threads at execute
     // and create stages. GEMM packed API is not aware of number of threads as
@@ -39,6 +39,7 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
     const int concat_dim = pd()->concat_dim();
     auto o_base_ptr = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
     if (o_base_ptr == nullptr) return status::success;
+    if (pd()->srcs_in_place(ctx)) return status::success;
 
     for (int a = 0; a < num_arrs; ++a) {
         const memory_desc_wrapper i_d(pd()->src_md(a));
@@ -76,6 +76,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
     auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
 
+    const bool use_rms_norm = pd()->use_rms_norm();
     float *mean, *variance;
     if (pd()->use_tmp_stats()) {
         mean = scratchpad.template get<float>(key_lnorm_tmp_mean);
@@ -89,6 +90,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                         CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
                 : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
     }
+    if (use_rms_norm) mean = nullptr;
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
@@ -114,7 +116,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 + N_start * C_padded * src_d.data_type_size();
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
-        float *const __restrict mean_ptr = &mean[N_start];
+        float *const __restrict mean_ptr = mean ? &mean[N_start] : nullptr;
         float *const __restrict var_ptr = &variance[N_start];
         const size_t block_size = N_end - N_start;
         // Note: manual unrolling for scale and shift due to clang issue.
@@ -122,13 +124,15 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
         for (size_t offset = 0; offset < block_size; offset++) {
             float v_mean = 0, v_variance = 0;
             if (calculate_stats) {
-                PRAGMA_OMP_SIMD(reduction(+ : v_mean))
-                for (dim_t c = 0; c < C; ++c) {
-                    float s = io::load_float_value(
-                            src_dt, src_ptr, c + C * offset);
-                    v_mean += s;
+                if (!use_rms_norm) {
+                    PRAGMA_OMP_SIMD(reduction(+ : v_mean))
+                    for (dim_t c = 0; c < C; ++c) {
+                        float s = io::load_float_value(
+                                src_dt, src_ptr, c + C * offset);
+                        v_mean += s;
+                    }
+                    v_mean /= C;
                 }
-                v_mean /= C;
 
                 PRAGMA_OMP_SIMD(reduction(+ : v_variance))
                 for (dim_t c = 0; c < C; ++c) {
@@ -139,7 +143,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 }
                 v_variance /= C;
             } else {
-                v_mean = mean_ptr[offset];
+                v_mean = use_rms_norm ? 0.f : mean_ptr[offset];
                 v_variance = var_ptr[offset];
             }
 
@@ -188,7 +192,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 }
             }
             if (calculate_stats && save_stats) {
-                mean_ptr[offset] = v_mean;
+                if (mean_ptr) mean_ptr[offset] = v_mean;
                 var_ptr[offset] = v_variance;
             }
         }
@@ -200,7 +204,7 @@ status_t simple_layer_normalization_bwd_t::pd_t::init(engine_t *engine) {
     using namespace data_type;
     const memory_desc_wrapper src_d(src_md());
 
-    const bool ok = is_bwd() && !has_zero_dim_memory()
+    const bool ok = is_bwd() && !has_zero_dim_memory() && !use_rms_norm()
             && utils::one_of(src_md()->data_type, f32, bf16, f16)
             && utils::one_of(diff_dst_md()->data_type, f32, bf16, f16)
             && utils::one_of(diff_src_md()->data_type, f32, bf16, f16)
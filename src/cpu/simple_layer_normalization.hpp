@@ -100,8 +100,9 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
         // reorder input stats
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->use_rms_norm())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -109,8 +110,9 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
         if (status != status::success) return status;
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, {&mean, true}, ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->use_rms_norm())
+                reorder_stat(ctx, engine, {&mean, true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {&variance, true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -108,6 +108,7 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.b_zp_compensations = post_ops_data.b_zp_compensations;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_src_dyn_quant_scales = post_ops_data.src_dyn_quant_scales;
     assert(brg_kernel);
     (*brg_kernel)(&brgemm_p);
 }
@@ -142,6 +143,7 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.b_zp_compensations = post_ops_data.b_zp_compensations;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_src_dyn_quant_scales = post_ops_data.src_dyn_quant_scales;
     assert(brg_kernel);
     (*brg_kernel)(&brgemm_p);
 }
@@ -354,6 +356,8 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
                     {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST});
     if (!scales_ok) return status::unimplemented;
 
+    brg->with_src_dyn_quant = attr->src_dyn_quant_dt_ != data_type::undef;
+
     auto init_zp_type
             = [&](brgemm_broadcast_t &zp_type, int mem_arg) -> status_t {
         auto zero_points = attr->zero_points_;
@@ -399,6 +403,11 @@ status_t brgemm_desc_set_attr(brgemm_t *brg, const brgemm_attr_t &brgattr) {
             && brg->layout != brgemm_row_major)
         return status::unimplemented;
 
+    // per-row scales of dynamically quantized A are applied by the regular
+    // brgemm kernel only
+    if (brgattr.use_uker && brg->with_src_dyn_quant)
+        return status::unimplemented;
+
     brg->brgattr = brgattr;
 
     if (brgattr.fpmath_mode != fpmath_mode::strict) maybe_try_bf32(brg);
@@ -667,6 +676,7 @@ int brgemm_cmp(const brgemm_t &lhs, const brgemm_t &rhs) {
 
     CMP_BRGEMM_FIELD(is_oc_scale);
     CMP_BRGEMM_FIELD(with_dst_scales);
+    CMP_BRGEMM_FIELD(with_src_dyn_quant);
 
     // Compare all non-pointer parameters of brgemm_attr_t except derived
     CMP_BRGEMM_FIELD(brgattr.max_bs);
@@ -226,6 +226,9 @@ struct brgemm_t {
 
     int is_oc_scale = 0;
     bool with_dst_scales = false;
+    // A rows are dynamically quantized, C rows are multiplied by per-row
+    // scales before any other post-op
+    bool with_src_dyn_quant = false;
 
     brgemm_attr_t brgattr;
 
@@ -398,6 +401,7 @@ struct brgemm_kernel_params_t {
     size_t skip_accm = 0;
     int32_t zp_a_val = 1;
     const void *ptr_dst_scales = nullptr;
+    const void *ptr_src_dyn_quant_scales = nullptr;
 };
 
 template <cpu_isa_t isa, typename Vmm>
@@ -488,6 +492,8 @@ private:
 /// @param dst_scales - Vector of inverted scale factor values for matix C,
 ///     common scale vector type only is supported, it must be broadcasted to
 ///     vector of simd width length.
+/// @param src_dyn_quant_scales - Per-row scale factor values for matrix A
+///     when A is dynamically quantized, one value per row of matrix C.
 ///
 struct brgemm_post_ops_data_t {
     brgemm_post_ops_data_t() = default;
@@ -500,7 +506,8 @@ struct brgemm_post_ops_data_t {
             const void *b_zp_compensations = nullptr,
             const void *c_zp_values = nullptr, bool skip_accumulation = false,
             int32_t zp_a_val = 1, bool do_only_comp = false,
-            bool do_only_zp_a_val = false, const float *dst_scales = nullptr)
+            bool do_only_zp_a_val = false, const float *dst_scales = nullptr,
+            const float *src_dyn_quant_scales = nullptr)
         : bias(bias)
         , scales(scales)
         , binary_post_ops_rhs(binary_post_ops_rhs)
@@ -515,7 +522,8 @@ struct brgemm_post_ops_data_t {
         , zp_a_val {zp_a_val}
         , do_only_comp {do_only_comp}
         , do_only_zp_a_val {do_only_zp_a_val}
-        , dst_scales(dst_scales) {}
+        , dst_scales(dst_scales)
+        , src_dyn_quant_scales(src_dyn_quant_scales) {}
 
     const void *bias = nullptr;
     const float *scales = nullptr;
@@ -532,6 +540,7 @@ struct brgemm_post_ops_data_t {
     const bool do_only_comp = false;
     const bool do_only_zp_a_val = false;
     const float *dst_scales = nullptr;
+    const float *src_dyn_quant_scales = nullptr;
 };
 
 } // namespace x64
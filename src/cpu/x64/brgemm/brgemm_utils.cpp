@@ -69,6 +69,7 @@ void init_common_conf(brgemm_t *brg, brgemm_batch_kind_t type, float alpha,
     brg->sum_scale = 0;
     brg->sum_zp = 0;
     brg->with_scales = false;
+    brg->with_src_dyn_quant = false;
 
     if (strides != nullptr) {
         brg->stride_a = strides->stride_a;
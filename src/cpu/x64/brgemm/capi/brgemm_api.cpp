@@ -0,0 +1,381 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/capi/brgemm_api.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+using brgemm_matmul_conf_t = matmul::brgemm_matmul_conf_t;
+
+status_t dnnl_brgemm::set_add_C(int add_C) {
+    if (finalized_) return invalid_arguments;
+    if (!one_of(add_C, 0, 1)) return invalid_arguments;
+    beta_ = add_C ? 1.f : 0.f;
+    return success;
+}
+
+status_t dnnl_brgemm::set_post_ops(
+        dim_t ldd, data_type_t d_dt, const post_ops_t *post_ops) {
+    if (finalized_) return invalid_arguments;
+    if (ldd < N_) return invalid_arguments;
+
+    if (post_ops) {
+        for (int i = 0; i < post_ops->len(); i++)
+            if (!post_ops->entry_[i].is_eltwise()) return unimplemented;
+        CHECK(attr_.set_post_ops(*post_ops));
+    }
+    ldd_ = ldd;
+    d_dt_ = d_dt;
+    with_post_ops_ = true;
+    return success;
+}
+
+status_t dnnl_brgemm::finalize() {
+    using namespace data_type;
+    if (finalized_) return success;
+
+    const bool is_int8 = one_of(a_dt_, u8, s8);
+    if (c_dt_ != (is_int8 ? s32 : f32)) return unimplemented;
+
+    auto desc_init = [&](cpu_isa_t isa) {
+        brg_ = brgemm_t();
+        return brgemm_desc_init(&brg_, isa, brgemm_offs, a_dt_, b_dt_,
+                false /*transA*/, false /*transB*/, brgemm_row_major, 1.f,
+                beta_, lda_, ldb_, ldc_, M_, N_, K_);
+    };
+    status_t st = desc_init(isa_undef);
+    // The AMX kernels do not support K tails smaller than the VNNI
+    // granularity. The AVX-512 kernels do and expect the same packing of B,
+    // so they are used instead. f16 has no such fallback as the AVX-512
+    // kernels expect B without the VNNI packing.
+    const dim_t vnni_granularity
+            = (dim_t)data_type_vnni_granularity(a_dt_);
+    if (st == unimplemented && a_dt_ != f16 && K_ % vnni_granularity != 0) {
+        const cpu_isa_t isa = is_int8 ? avx512_core_vnni : avx512_core_bf16;
+        if (mayiuse(isa)) st = desc_init(isa);
+    }
+    CHECK(st);
+    // Compensation for s8 A on hardware without native s8s8 support requires
+    // the matmul-specific packing of B, so it is not exposed.
+    if (brg_.req_s8s8_compensation) return unimplemented;
+
+    const dims_t dims = {M_, N_};
+    const dims_t strides = {ldd_, 1};
+    CHECK(memory_desc_init_by_strides(dst_md_, 2, dims, d_dt_, strides));
+    CHECK(brgemm_desc_set_postops(&brg_, &attr_, &dst_md_, (int)ldd_));
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = (int)batch_size_;
+    CHECK(brgemm_desc_set_attr(&brg_, brgattr));
+
+    if (brg_.is_tmm) CHECK(brgemm_init_tiles(brg_, palette_));
+
+    finalized_ = true;
+    return success;
+}
+
+status_t dnnl_brgemm::get_B_pack_type(
+        dnnl_pack_type_t *pack_type, data_type_t a_dt, data_type_t b_dt) {
+    using namespace data_type;
+    if (everyone_is(f32, a_dt, b_dt)) {
+        *pack_type = dnnl_pack_type_no_trans;
+    } else if (everyone_is(bf16, a_dt, b_dt)) {
+        *pack_type = dnnl_pack_type_pack32;
+    } else if (everyone_is(f16, a_dt, b_dt)) {
+        // Only the AMX kernel expects f16 data in VNNI layout.
+        *pack_type = mayiuse(avx512_core_amx_fp16) ? dnnl_pack_type_pack32
+                                                   : dnnl_pack_type_no_trans;
+    } else if (one_of(a_dt, u8, s8) && one_of(b_dt, u8, s8)) {
+        *pack_type = dnnl_pack_type_pack32;
+    } else {
+        *pack_type = dnnl_pack_type_undef;
+        return unimplemented;
+    }
+    return success;
+}
+
+size_t dnnl_brgemm::get_scratchpad_size() const {
+    return (size_t)brg_.get_wsp_buffer_size();
+}
+
+status_t dnnl_brgemm::set_hw_context() const {
+    if (brg_.is_tmm) return amx_tile_configure(palette_);
+    return success;
+}
+
+status_t dnnl_brgemm::generate() {
+    if (!finalized_) return invalid_arguments;
+    if (kernel_) return success;
+
+    brgemm_kernel_t *kernel = nullptr;
+    CHECK(brgemm_kernel_create(&kernel, brg_));
+    CHECK(safe_ptr_assign(kernel_, kernel));
+    return success;
+}
+
+bool dnnl_brgemm::kernel_writes_D() const {
+    return attr_.post_ops_.len() > 0 || d_dt_ != c_dt_;
+}
+
+namespace {
+// Converts pairs of A and B offsets into batch elements. Batches of up to
+// `max_stack_size` elements are kept on the stack to avoid a memory
+// allocation on every kernel call.
+struct batch_t {
+    batch_t(const dim_t *A_B_offsets, int bs) : ptr_(stack_) {
+        if (bs > max_stack_size) {
+            heap_.resize(bs);
+            ptr_ = heap_.data();
+        }
+        for (int i = 0; i < bs; i++) {
+            ptr_[i].offset.A = A_B_offsets[2 * i];
+            ptr_[i].offset.B = A_B_offsets[2 * i + 1];
+        }
+    }
+
+    const brgemm_batch_element_t *get() const { return ptr_; }
+
+private:
+    static constexpr int max_stack_size = 32;
+    brgemm_batch_element_t stack_[max_stack_size];
+    std::vector<brgemm_batch_element_t> heap_;
+    brgemm_batch_element_t *ptr_;
+};
+} // namespace
+
+status_t dnnl_brgemm::execute(const void *A_ptr, const void *B_ptr,
+        const dim_t *A_B_offsets, void *C_ptr, void *scratchpad_ptr) const {
+    if (!kernel_) return invalid_arguments;
+
+    const int bs = brg_.brgattr.max_bs;
+    const batch_t batch(A_B_offsets, bs);
+    brgemm_kernel_execute(kernel_.get(), bs, A_ptr, B_ptr, batch.get(), C_ptr,
+            scratchpad_ptr);
+    return success;
+}
+
+status_t dnnl_brgemm::execute(const void *A_ptr, const void *B_ptr,
+        const dim_t *A_B_offsets, void *C_ptr, void *D_ptr,
+        void *scratchpad_ptr) const {
+    if (!kernel_ || !with_post_ops_) return invalid_arguments;
+
+    if (!kernel_writes_D()) {
+        // Tensors C and D have the same data type and there is nothing to
+        // apply: the kernel stores the result to C only.
+        CHECK(execute(A_ptr, B_ptr, A_B_offsets, C_ptr, scratchpad_ptr));
+        if (C_ptr == D_ptr) return success;
+
+        const size_t dt_size = types::data_type_size(c_dt_);
+        for (dim_t m = 0; m < M_; m++)
+            std::memcpy((char *)D_ptr + m * ldd_ * dt_size,
+                    (const char *)C_ptr + m * ldc_ * dt_size, N_ * dt_size);
+        return success;
+    }
+
+    const int bs = brg_.brgattr.max_bs;
+    const batch_t batch(A_B_offsets, bs);
+    const brgemm_post_ops_data_t post_ops_data;
+    brgemm_kernel_execute_postops(kernel_.get(), bs, A_ptr, B_ptr, batch.get(),
+            C_ptr, D_ptr, post_ops_data, scratchpad_ptr);
+    return success;
+}
+
+status_t dnnl_brgemm_pack_B::init() {
+    using namespace data_type;
+    if (K_ <= 0 || N_ <= 0 || in_ld_ < N_) return invalid_arguments;
+    // The copy routines are generated for these block sizes only.
+    if (!one_of(out_ld_, 16, 32, 48, 64)) return invalid_arguments;
+    if (in_dt_ != out_dt_) return unimplemented;
+    if (!one_of(in_dt_, f32, bf16, f16, u8, s8)) return unimplemented;
+    if (!mayiuse(avx512_core)) return unimplemented;
+    // Packing f16 is meaningful for the AMX kernel only, see
+    // dnnl_brgemm::get_B_pack_type().
+    if (in_dt_ == f16 && !mayiuse(avx512_core_amx_fp16)) return unimplemented;
+
+    const bool is_int8 = one_of(in_dt_, u8, s8);
+    const dim_t dt_size = types::data_type_size(in_dt_);
+
+    bmc_ = zero<brgemm_matmul_conf_t>();
+    bmc_.isa = avx512_core;
+    bmc_.src_dt = is_int8 ? u8 : in_dt_;
+    bmc_.wei_dt = in_dt_;
+    bmc_.orig_wei_dt = in_dt_;
+    // The copy routines support an arbitrary row stride of the input only
+    // for the `acbd` tag, which is the plain layout of a single matrix.
+    bmc_.wei_tag = format_tag::acbd;
+    bmc_.copy_B_wei_stride = in_ld_ * dt_size;
+    bmc_.K = K_;
+    bmc_.N = N_;
+    bmc_.K_blk = K_;
+    bmc_.N_blk = out_ld_;
+    bmc_.N_tail = N_ % out_ld_;
+    bmc_.wei_n_blk = (int)out_ld_;
+    bmc_.LDB = out_ld_;
+    bmc_.b_dt_sz = dt_size;
+    bmc_.tr_b_dt_sz = dt_size;
+    bmc_.src_zp_type = brgemm_broadcast_t::none;
+    bmc_.wei_zp_type = brgemm_broadcast_t::none;
+    return success;
+}
+
+status_t dnnl_brgemm_pack_B::generate() {
+    if (kernel_) return success;
+    return matmul::create_brgemm_matmul_copy_b(kernel_, &bmc_);
+}
+
+status_t dnnl_brgemm_pack_B::execute(const void *in_ptr, void *out_ptr) const {
+    if (!kernel_) return invalid_arguments;
+
+    const dim_t dt_size = types::data_type_size(in_dt_);
+    const dim_t K_padded
+            = rnd_up(K_, (dim_t)data_type_vnni_granularity(in_dt_));
+
+    auto ctx = matmul::jit_brgemm_matmul_copy_b_t::ctx_t();
+    ctx.current_K_start = 0;
+    ctx.current_K_iters = K_;
+    for (dim_t n = 0; n < N_; n += out_ld_) {
+        const dim_t n_blk_idx = n / out_ld_;
+        ctx.src = (const char *)in_ptr + n * dt_size;
+        ctx.tr_src = (char *)out_ptr + n_blk_idx * K_padded * out_ld_ * dt_size;
+        ctx.current_N_blk = nstl::min(out_ld_, N_ - n);
+        (*kernel_)(&ctx);
+    }
+    return success;
+}
+
+status_t dnnl_brgemm_create(dnnl_brgemm_t *brgemm, dim_t M, dim_t N, dim_t K,
+        dim_t batch_size, dim_t lda, dim_t ldb, dim_t ldc, data_type_t a_dt,
+        data_type_t b_dt, data_type_t c_dt) {
+    if (brgemm == nullptr) return invalid_arguments;
+    if (M <= 0 || N <= 0 || K <= 0 || batch_size <= 0)
+        return invalid_arguments;
+    if (lda < K || ldb < N || ldc < N) return invalid_arguments;
+
+    return safe_ptr_assign(*brgemm,
+            new dnnl_brgemm(
+                    M, N, K, batch_size, lda, ldb, ldc, a_dt, b_dt, c_dt));
+}
+
+status_t dnnl_brgemm_set_add_C(dnnl_brgemm_t brgemm, int add_C) {
+    if (brgemm == nullptr) return invalid_arguments;
+    return brgemm->set_add_C(add_C);
+}
+
+status_t dnnl_brgemm_set_post_ops(dnnl_brgemm_t brgemm, dim_t ldd,
+        data_type_t d_dt, const post_ops_t *post_ops) {
+    if (brgemm == nullptr) return invalid_arguments;
+    return brgemm->set_post_ops(ldd, d_dt, post_ops);
+}
+
+status_t dnnl_brgemm_finalize(dnnl_brgemm_t brgemm) {
+    if (brgemm == nullptr) return invalid_arguments;
+    return brgemm->finalize();
+}
+
+status_t dnnl_brgemm_get_B_pack_type(
+        dnnl_pack_type_t *pack_type, data_type_t a_dt, data_type_t b_dt) {
+    if (pack_type == nullptr) return invalid_arguments;
+    return dnnl_brgemm::get_B_pack_type(pack_type, a_dt, b_dt);
+}
+
+status_t dnnl_brgemm_get_scratchpad_size(
+        const_dnnl_brgemm_t brgemm, size_t *size) {
+    if (any_null(brgemm, size)) return invalid_arguments;
+    if (!brgemm->is_finalized()) return invalid_arguments;
+    *size = brgemm->get_scratchpad_size();
+    return success;
+}
+
+status_t dnnl_brgemm_set_hw_context(const_dnnl_brgemm_t brgemm) {
+    if (brgemm == nullptr) return invalid_arguments;
+    if (!brgemm->is_finalized()) return invalid_arguments;
+    return brgemm->set_hw_context();
+}
+
+status_t dnnl_brgemm_release_hw_context() {
+    if (mayiuse(avx512_core_amx)) return amx_tile_release();
+    return success;
+}
+
+status_t dnnl_brgemm_generate(dnnl_brgemm_t brgemm) {
+    if (brgemm == nullptr) return invalid_arguments;
+    return brgemm->generate();
+}
+
+status_t dnnl_brgemm_execute(const_dnnl_brgemm_t brgemm, const void *A_ptr,
+        const void *B_ptr, const dim_t *A_B_offsets, void *C_ptr,
+        void *scratchpad_ptr) {
+    if (any_null(brgemm, A_ptr, B_ptr, A_B_offsets, C_ptr))
+        return invalid_arguments;
+    return brgemm->execute(A_ptr, B_ptr, A_B_offsets, C_ptr, scratchpad_ptr);
+}
+
+status_t dnnl_brgemm_execute_postops(const_dnnl_brgemm_t brgemm,
+        const void *A_ptr, const void *B_ptr, const dim_t *A_B_offsets,
+        void *C_ptr, void *D_ptr, void *scratchpad_ptr) {
+    if (any_null(brgemm, A_ptr, B_ptr, A_B_offsets, C_ptr, D_ptr))
+        return invalid_arguments;
+    return brgemm->execute(
+            A_ptr, B_ptr, A_B_offsets, C_ptr, D_ptr, scratchpad_ptr);
+}
+
+status_t dnnl_brgemm_destroy(dnnl_brgemm_t brgemm) {
+    delete brgemm;
+    return success;
+}
+
+status_t dnnl_brgemm_pack_B_create(dnnl_brgemm_pack_B_t *pack_B, dim_t K,
+        dim_t N, dim_t in_ld, dim_t out_ld, data_type_t in_dt,
+        data_type_t out_dt) {
+    if (pack_B == nullptr) return invalid_arguments;
+
+    auto _pack_B = utils::make_unique<dnnl_brgemm_pack_B>(
+            K, N, in_ld, out_ld, in_dt, out_dt);
+    if (!_pack_B) return out_of_memory;
+    CHECK(_pack_B->init());
+    *pack_B = _pack_B.release();
+    return success;
+}
+
+status_t dnnl_brgemm_pack_B_generate(dnnl_brgemm_pack_B_t pack_B) {
+    if (pack_B == nullptr) return invalid_arguments;
+    return pack_B->generate();
+}
+
+status_t dnnl_brgemm_pack_B_execute(
+        const_dnnl_brgemm_pack_B_t pack_B, const void *in_ptr, void *out_ptr) {
+    if (any_null(pack_B, in_ptr, out_ptr)) return invalid_arguments;
+    return pack_B->execute(in_ptr, out_ptr);
+}
+
+status_t dnnl_brgemm_pack_B_destroy(dnnl_brgemm_pack_B_t pack_B) {
+    delete pack_B;
+    return success;
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_BRGEMM_CAPI_BRGEMM_API_HPP
+#define CPU_X64_BRGEMM_CAPI_BRGEMM_API_HPP
+
+#include <memory>
+
+#include "oneapi/dnnl/dnnl_ukernel.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+
+// Implementation of the public ukernel API on top of the internal brgemm
+// kernel and the B matrix copy routines of the brgemm-based matmul.
+
+struct dnnl_brgemm : public dnnl::impl::c_compatible {
+    dnnl_brgemm(dnnl::impl::dim_t M, dnnl::impl::dim_t N, dnnl::impl::dim_t K,
+            dnnl::impl::dim_t batch_size, dnnl::impl::dim_t lda,
+            dnnl::impl::dim_t ldb, dnnl::impl::dim_t ldc,
+            dnnl::impl::data_type_t a_dt, dnnl::impl::data_type_t b_dt,
+            dnnl::impl::data_type_t c_dt)
+        : M_(M)
+        , N_(N)
+        , K_(K)
+        , batch_size_(batch_size)
+        , lda_(lda)
+        , ldb_(ldb)
+        , ldc_(ldc)
+        , ldd_(ldc)
+        , a_dt_(a_dt)
+        , b_dt_(b_dt)
+        , c_dt_(c_dt)
+        , d_dt_(c_dt) {}
+
+    dnnl::impl::status_t set_add_C(int add_C);
+    dnnl::impl::status_t set_post_ops(dnnl::impl::dim_t ldd,
+            dnnl::impl::data_type_t d_dt,
+            const dnnl::impl::post_ops_t *post_ops);
+    dnnl::impl::status_t finalize();
+
+    static dnnl::impl::status_t get_B_pack_type(dnnl_pack_type_t *pack_type,
+            dnnl::impl::data_type_t a_dt, dnnl::impl::data_type_t b_dt);
+
+    size_t get_scratchpad_size() const;
+    dnnl::impl::status_t set_hw_context() const;
+    dnnl::impl::status_t generate();
+
+    dnnl::impl::status_t execute(const void *A_ptr, const void *B_ptr,
+            const dnnl::impl::dim_t *A_B_offsets, void *C_ptr,
+            void *scratchpad_ptr) const;
+    dnnl::impl::status_t execute(const void *A_ptr, const void *B_ptr,
+            const dnnl::impl::dim_t *A_B_offsets, void *C_ptr, void *D_ptr,
+            void *scratchpad_ptr) const;
+
+    bool is_finalized() const { return finalized_; }
+    bool is_generated() const { return kernel_ != nullptr; }
+
+private:
+    dnnl::impl::dim_t M_, N_, K_, batch_size_;
+    dnnl::impl::dim_t lda_, ldb_, ldc_, ldd_;
+    dnnl::impl::data_type_t a_dt_, b_dt_, c_dt_, d_dt_;
+    float beta_ = 0.f;
+
+    // The brgemm descriptor keeps pointers to the attributes and to the
+    // destination memory descriptor, so they live in the object.
+    dnnl::impl::primitive_attr_t attr_;
+    dnnl::impl::memory_desc_t dst_md_ = dnnl::impl::types::zero_md();
+    bool with_post_ops_ = false;
+
+    dnnl::impl::cpu::x64::brgemm_t brg_;
+    bool finalized_ = false;
+    std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> kernel_;
+    char palette_[dnnl::impl::cpu::x64::AMX_PALETTE_SIZE] = {};
+
+    // Returns true if the kernel writes tensor D by itself. Otherwise the
+    // result is computed in tensor C and copied to tensor D.
+    bool kernel_writes_D() const;
+};
+
+struct dnnl_brgemm_pack_B : public dnnl::impl::c_compatible {
+    dnnl_brgemm_pack_B(dnnl::impl::dim_t K, dnnl::impl::dim_t N,
+            dnnl::impl::dim_t in_ld, dnnl::impl::dim_t out_ld,
+            dnnl::impl::data_type_t in_dt, dnnl::impl::data_type_t out_dt)
+        : K_(K)
+        , N_(N)
+        , in_ld_(in_ld)
+        , out_ld_(out_ld)
+        , in_dt_(in_dt)
+        , out_dt_(out_dt) {}
+
+    // Checks the arguments and sets up the copy routine configuration.
+    dnnl::impl::status_t init();
+    dnnl::impl::status_t generate();
+    dnnl::impl::status_t execute(const void *in_ptr, void *out_ptr) const;
+
+    bool is_generated() const { return kernel_ != nullptr; }
+
+private:
+    dnnl::impl::dim_t K_, N_, in_ld_, out_ld_;
+    dnnl::impl::data_type_t in_dt_, out_dt_;
+
+    dnnl::impl::cpu::x64::matmul::brgemm_matmul_conf_t bmc_;
+    std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t>
+            kernel_;
+};
+
+#endif
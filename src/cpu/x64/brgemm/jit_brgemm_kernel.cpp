@@ -158,6 +158,8 @@ private:
     const reg64_t reg_aux_zp_comp_a = reg_rdb_loop;
     const reg64_t reg_zp_comp_b = reg_rdb_loop;
     const reg64_t reg_aux_zp_comp_b = reg_rdb_loop;
+    const reg64_t reg_src_dyn_quant_scales = reg_rdb_loop;
+    const reg64_t reg_aux_src_dyn_quant_scales = reg_rdb_loop;
     const reg64_t reg_zp_c_values = reg_rdb_loop;
     const reg64_t reg_aux_zp_c_values = reg_rdb_loop;
 
@@ -207,7 +209,9 @@ private:
     constexpr static int reg_zp_a_val_offs_ = 168;
     constexpr static int reg_do_comp_offs_ = 176;
     constexpr static int reg_dst_scales_offs_ = 184;
-    constexpr static int stack_space_needed_ = 192;
+    constexpr static int reg_src_dyn_quant_scales_offs_ = 192;
+    constexpr static int reg_aux_src_dyn_quant_scales_offs_ = 200;
+    constexpr static int stack_space_needed_ = 208;
 
     bool is_ldb_loop_ = false;
     bool with_binary_non_scalar_bcast_ = false;
@@ -342,6 +346,8 @@ private:
     int bdb_zp_comp_a_offset(int bd_block2) const noexcept;
     int zp_comp_b_offset(int bd) const noexcept;
     int bdb_zp_comp_b_offset(int bd_block2) const noexcept;
+    int src_dyn_quant_scales_offset(int bd) const noexcept;
+    int bdb_src_dyn_quant_scales_offset(int bd_block2) const noexcept;
     int zp_c_values_offset(int ld, bool is_tail = false) const noexcept;
 
     bool n_bcast_1_load = false;
@@ -514,6 +520,18 @@ int jit_brgemm_kernel_t<isa, Wmm>::bdb_zp_comp_b_offset(
     return zp_comp_b_offset(bd_block2 * brg.bd_block);
 }
 
+template <cpu_isa_t isa, typename Wmm>
+int jit_brgemm_kernel_t<isa, Wmm>::src_dyn_quant_scales_offset(
+        int bd) const noexcept {
+    return sizeof(float) * bd;
+}
+
+template <cpu_isa_t isa, typename Wmm>
+int jit_brgemm_kernel_t<isa, Wmm>::bdb_src_dyn_quant_scales_offset(
+        int bd_block2) const noexcept {
+    return src_dyn_quant_scales_offset(bd_block2 * brg.bd_block);
+}
+
 template <cpu_isa_t isa, typename Wmm>
 int jit_brgemm_kernel_t<isa, Wmm>::zp_c_values_offset(
         int ld, bool is_tail) const noexcept {
@@ -635,6 +653,13 @@ void jit_brgemm_kernel_t<isa, Wmm>::advance_bdb_post_op_regs(int adj_bd_block) {
         add(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(1));
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
     }
+    if (brg.with_src_dyn_quant) {
+        mov(reg_aux_src_dyn_quant_scales,
+                ptr[rsp + reg_aux_src_dyn_quant_scales_offs_]);
+        add(reg_aux_src_dyn_quant_scales, bdb_src_dyn_quant_scales_offset(1));
+        mov(ptr[rsp + reg_aux_src_dyn_quant_scales_offs_],
+                reg_aux_src_dyn_quant_scales);
+    }
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -647,6 +672,15 @@ void jit_brgemm_kernel_t<isa, Wmm>::restore_bdb_post_op_regs(int bd_block2) {
             sub(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(bd_block2 - 1));
             mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
         }
+        if (brg.with_src_dyn_quant) {
+            post_processed = true;
+            mov(reg_aux_src_dyn_quant_scales,
+                    ptr[rsp + reg_aux_src_dyn_quant_scales_offs_]);
+            sub(reg_aux_src_dyn_quant_scales,
+                    bdb_src_dyn_quant_scales_offset(bd_block2 - 1));
+            mov(ptr[rsp + reg_aux_src_dyn_quant_scales_offs_],
+                    reg_aux_src_dyn_quant_scales);
+        }
     }
     if (post_processed) mov(reg_buf, ptr[rsp + reg_buf_offs_]);
 }
@@ -705,6 +739,14 @@ void jit_brgemm_kernel_t<isa, Wmm>::advance_bd_block2_post_op_regs(
         add(reg_zp_comp_b, bdb_zp_comp_b_offset(bd_block2));
         mov(ptr[rsp + reg_zp_comp_b_offs_], reg_zp_comp_b);
     }
+    if (brg.with_src_dyn_quant) {
+        mov(reg_src_dyn_quant_scales,
+                ptr[rsp + reg_src_dyn_quant_scales_offs_]);
+        add(reg_src_dyn_quant_scales,
+                bdb_src_dyn_quant_scales_offset(bd_block2));
+        mov(ptr[rsp + reg_src_dyn_quant_scales_offs_],
+                reg_src_dyn_quant_scales);
+    }
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -741,6 +783,12 @@ void jit_brgemm_kernel_t<isa, Wmm>::copy_post_ops_stack_values_to_aux(
         mov(reg_zp_comp_b, ptr[rsp + reg_zp_comp_b_offs_]);
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_zp_comp_b);
     }
+    if (brg.with_src_dyn_quant) {
+        mov(reg_src_dyn_quant_scales,
+                ptr[rsp + reg_src_dyn_quant_scales_offs_]);
+        mov(ptr[rsp + reg_aux_src_dyn_quant_scales_offs_],
+                reg_src_dyn_quant_scales);
+    }
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -809,6 +857,13 @@ void jit_brgemm_kernel_t<isa, Wmm>::read_params() {
         mov(ptr[rsp + reg_dst_scales_offs_], reg_dst_scales);
     }
 
+    if (brg.with_src_dyn_quant) {
+        mov(reg_src_dyn_quant_scales,
+                ptr[param1 + GET_OFF(ptr_src_dyn_quant_scales)]);
+        mov(ptr[rsp + reg_src_dyn_quant_scales_offs_],
+                reg_src_dyn_quant_scales);
+    }
+
     mov(reg_do_post_ops, ptr[param1 + GET_OFF(do_post_ops)]);
     mov(ptr[rsp + reg_do_post_ops_offs_], reg_do_post_ops);
 
@@ -1043,6 +1098,23 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators_apply_post_ops(
         }
     }
 
+    if (brg.with_src_dyn_quant) {
+        mov(reg_aux_src_dyn_quant_scales,
+                ptr[rsp + reg_aux_src_dyn_quant_scales_offs_]);
+        for (int bd = 0; bd < bd_block; bd++) {
+            auto vmm_row_scale = vmm_tmp(0);
+            uni_vbroadcastss(vmm_row_scale,
+                    ptr[reg_aux_src_dyn_quant_scales
+                            + src_dyn_quant_scales_offset(bd)]);
+            for (int ld = 0; ld < ld_block2; ld++) {
+                auto vmm = accm(ld_block2, bd, ld);
+                if (dq2ps_required && !brg.with_scales)
+                    uni_vcvtdq2ps(vmm, vmm);
+                uni_vmulps(vmm, vmm, vmm_row_scale);
+            }
+        }
+    }
+
     if (brg.with_bias) { mov(reg_aux_bias, ptr[rsp + reg_aux_bias_offs_]); }
     for (int ld = 0; ld < ld_block2; ld++) {
         auto vmm_bias = vmm_tmp(0);
@@ -1054,7 +1126,8 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators_apply_post_ops(
         }
         for (int bd = 0; bd < bd_block; bd++) {
             auto vmm = accm(ld_block2, bd, ld);
-            if (dq2ps_required && !brg.with_scales) uni_vcvtdq2ps(vmm, vmm);
+            if (dq2ps_required && !brg.with_scales && !brg.with_src_dyn_quant)
+                uni_vcvtdq2ps(vmm, vmm);
             if (brg.with_bias) uni_vaddps(vmm, vmm, vmm_bias);
         }
     }
@@ -1307,7 +1380,7 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators(int bd_block2,
     const bool are_post_ops_applicable = one_of(true, brg.with_eltwise,
             brg.with_binary, brg.with_scales, brg.with_bias, brg.with_sum,
             brg.dt_d != brg.dt_c, brg.req_s8s8_compensation, has_zero_points,
-            brg.with_dst_scales);
+            brg.with_dst_scales, brg.with_src_dyn_quant);
     const bool need_to_apply_alpha_beta = brg.beta != 0.f || brg.alpha != 1.f;
 
     maybe_set_avx_mask(is_ld_tail);
@@ -1386,8 +1459,9 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators(int bd_block2,
                     }
                     if (bdb < bd_block2 - 1) {
                         advance_bdb_post_op_regs(adj_bd_block);
-                        post_processed
-                                |= brg.zp_type_b != brgemm_broadcast_t::none;
+                        post_processed |= one_of(true,
+                                brg.zp_type_b != brgemm_broadcast_t::none,
+                                brg.with_src_dyn_quant);
                     }
                     if (post_processed) mov(reg_buf, ptr[rsp + reg_buf_offs_]);
                 }
@@ -1455,12 +1529,12 @@ void jit_brgemm_kernel_t<isa, Wmm>::restore_A_B_matrices() {
         mov(reg_aux1_A, reg_A);
         mov(reg_aux1_B, reg_B);
 
-        if (restore_reg_batch) {
-            if (brg.type == brgemm_offs)
-                mov(reg_offs_batch, ptr[rsp + origin_offs_batch_offs_]);
-            else
-                mov(reg_strd_batch, ptr[rsp + origin_strd_batch_offs_]);
-        }
+        // reg_offs_batch shares the register with reg_aux1_A, so it is
+        // reloaded even for a single batch element.
+        if (brg.type == brgemm_offs)
+            mov(reg_offs_batch, ptr[rsp + origin_offs_batch_offs_]);
+        else if (restore_reg_batch)
+            mov(reg_strd_batch, ptr[rsp + origin_strd_batch_offs_]);
     }
 }
 
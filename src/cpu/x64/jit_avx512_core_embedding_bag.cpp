@@ -0,0 +1,279 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_avx512_core_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace data_type;
+using namespace Xbyak;
+
+jit_embedding_bag_kernel_t::jit_embedding_bag_kernel_t(
+        const embedding_bag_pd_t *pd)
+    : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, avx512_core)
+    , src_dt_(pd->src_md()->data_type)
+    , dst_dt_(pd->dst_md()->data_type)
+    , D_(pd->D())
+    , row_stride_(memory_desc_wrapper(pd->src_md()).blocking_desc().strides[0]
+              * types::data_type_size(src_dt_))
+    , per_row_scales_(pd->with_per_row_scales()) {}
+
+void jit_embedding_bag_kernel_t::load(
+        const Zmm &zmm, const RegExp &addr, bool tail) {
+    const Zmm zmm_in = tail ? zmm | k_tail_ | T_z : zmm;
+    switch (src_dt_) {
+        case f32: vmovups(zmm_in, zword[addr]); break;
+        case bf16:
+            vpmovzxwd(zmm_in, yword[addr]);
+            vpslld(zmm, zmm, 16);
+            break;
+        case f16: vcvtph2ps(zmm_in, yword[addr]); break;
+        case s8:
+            vpmovsxbd(zmm_in, xword[addr]);
+            vcvtdq2ps(zmm, zmm);
+            break;
+        case u8:
+            vpmovzxbd(zmm_in, xword[addr]);
+            vcvtdq2ps(zmm, zmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_embedding_bag_kernel_t::store(
+        const Zmm &zmm, const RegExp &addr, bool tail) {
+    const Ymm ymm = Ymm(zmm.getIdx());
+    switch (dst_dt_) {
+        case f32:
+            if (tail)
+                vmovups(zword[addr] | k_tail_, zmm);
+            else
+                vmovups(zword[addr], zmm);
+            return;
+        case bf16: vcvtneps2bf16(ymm, zmm); break;
+        case f16: vcvtps2ph(ymm, zmm, _op_mxcsr); break;
+        default: assert(!"unsupported data type");
+    }
+    if (tail)
+        vmovdqu16(yword[addr] | k_tail_, ymm);
+    else
+        vmovdqu16(yword[addr], ymm);
+}
+
+// Pools the columns [col, col + n_vecs * simd_w_) of the bag. The last vector
+// is partial if `tail` is not zero.
+void jit_embedding_bag_kernel_t::compute_block(
+        dim_t col, int n_vecs, int tail) {
+    const dim_t src_dt_size = types::data_type_size(src_dt_);
+    const dim_t dst_dt_size = types::data_type_size(dst_dt_);
+    const dim_t col_off = col * src_dt_size;
+    const dim_t block_bytes
+            = ((n_vecs - 1) * simd_w_ + (tail ? tail : simd_w_)) * src_dt_size;
+    const int cache_line = 64;
+
+    for (int v = 0; v < n_vecs; v++)
+        vpxord(zmm_acc(v), zmm_acc(v), zmm_acc(v));
+
+    Label l_loop, l_store;
+    xor_(reg_i_, reg_i_);
+    test(reg_bag_size_, reg_bag_size_);
+    jz(l_store, T_NEAR);
+
+    L(l_loop);
+    {
+        // Prefetch the columns of the upcoming row while the current one is
+        // processed. The lookups are random, so the hardware prefetcher does
+        // not help.
+        Label l_no_prefetch;
+        lea(reg_pf_, ptr[reg_i_ + prefetch_distance]);
+        cmp(reg_pf_, reg_n_left_);
+        jge(l_no_prefetch, T_NEAR);
+        movsxd(reg_pf_, dword[reg_indices_ + reg_pf_ * sizeof(int32_t)]);
+        imul(reg_pf_, reg_pf_, row_stride_);
+        for (dim_t off = 0; off < block_bytes; off += cache_line)
+            prefetcht0(ptr[reg_table_ + reg_pf_ + col_off + off]);
+        L(l_no_prefetch);
+
+        movsxd(reg_row_, dword[reg_indices_ + reg_i_ * sizeof(int32_t)]);
+        if (per_row_scales_)
+            vbroadcastss(zmm_scale_, dword[reg_scales_ + reg_row_ * 4]);
+        imul(reg_row_, reg_row_, row_stride_);
+
+        for (int v = 0; v < n_vecs; v++) {
+            const bool is_tail = tail && v == n_vecs - 1;
+            const Zmm zmm_row = zmm_tmp(v);
+            load(zmm_row,
+                    reg_table_ + reg_row_ + col_off + v * simd_w_ * src_dt_size,
+                    is_tail);
+            if (per_row_scales_)
+                vfmadd231ps(zmm_acc(v), zmm_row, zmm_scale_);
+            else
+                vaddps(zmm_acc(v), zmm_acc(v), zmm_row);
+        }
+
+        inc(reg_i_);
+        cmp(reg_i_, reg_bag_size_);
+        jl(l_loop, T_NEAR);
+    }
+
+    L(l_store);
+    for (int v = 0; v < n_vecs; v++) {
+        const bool is_tail = tail && v == n_vecs - 1;
+        vmulps(zmm_acc(v), zmm_acc(v), zmm_factor_);
+        store(zmm_acc(v), reg_dst_ + (col + v * simd_w_) * dst_dt_size,
+                is_tail);
+    }
+}
+
+void jit_embedding_bag_kernel_t::generate() {
+    preamble();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    mov(reg_table_, ptr[reg_param_ + PARAM_OFF(table)]);
+    mov(reg_indices_, ptr[reg_param_ + PARAM_OFF(indices)]);
+    mov(reg_scales_, ptr[reg_param_ + PARAM_OFF(scales)]);
+    mov(reg_dst_, ptr[reg_param_ + PARAM_OFF(dst)]);
+    mov(reg_bag_size_, ptr[reg_param_ + PARAM_OFF(bag_size)]);
+    mov(reg_n_left_, ptr[reg_param_ + PARAM_OFF(n_indices_left)]);
+    vbroadcastss(zmm_factor_, ptr[reg_param_ + PARAM_OFF(factor)]);
+#undef PARAM_OFF
+
+    const int tail = D_ % simd_w_;
+    if (tail) {
+        mov(reg_tmp_.cvt32(), (1 << tail) - 1);
+        kmovw(k_tail_, reg_tmp_.cvt32());
+    }
+
+    const dim_t block = max_vecs_ * simd_w_;
+    for (dim_t col = 0; col < D_; col += block) {
+        const dim_t len = nstl::min(block, D_ - col);
+        compute_block(col, static_cast<int>(utils::div_up(len, simd_w_)),
+                static_cast<int>(len % simd_w_));
+    }
+
+    postamble();
+}
+
+status_t jit_avx512_core_embedding_bag_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = src_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+    const bool ok = mayiuse(avx512_core)
+            && utils::one_of(src_dt, f32, bf16, f16, s8, u8)
+            && utils::one_of(dst_dt, f32, bf16, f16)
+            && IMPLICATION(dst_dt == bf16, mayiuse(avx512_core_bf16))
+            && attr()->has_default_values(skip_mask_t::scales_runtime)
+            && attr_scales_ok() && set_default_params() == status::success;
+    if (!ok) return status::unimplemented;
+
+    // The kernel works with dense rows of the table and the destination and
+    // with contiguous indices. The row offsets are immediate operands.
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper idx_d(indices_md());
+    const memory_desc_wrapper off_d(offsets_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const bool layouts_ok = src_d.is_blocking_desc()
+            && dst_d.is_blocking_desc()
+            && src_d.blocking_desc().inner_nblks == 0
+            && dst_d.blocking_desc().inner_nblks == 0
+            && src_d.blocking_desc().strides[1] == 1
+            && dst_d.blocking_desc().strides[1] == 1
+            && src_d.blocking_desc().strides[0] * src_d.data_type_size()
+                    <= INT32_MAX
+            && idx_d.is_dense()
+            && IMPLICATION(with_offsets(), off_d.is_blocking_desc());
+    if (!layouts_ok) return status::unimplemented;
+
+    return status::success;
+}
+
+status_t jit_avx512_core_embedding_bag_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, new jit_embedding_bag_kernel_t(pd())));
+    return kernel_->create_kernel();
+}
+
+status_t jit_avx512_core_embedding_bag_t::execute(
+        const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_INDICES);
+    auto offsets = pd()->with_offsets()
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS)
+            : nullptr;
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper idx_d(pd()->indices_md());
+    const memory_desc_wrapper off_d(pd()->offsets_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    src += src_d.offset0() * src_d.data_type_size();
+    indices += idx_d.offset0();
+
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t n_bags = pd()->n_bags();
+    const bool is_gather = pd()->is_gather();
+    const bool is_mean = pd()->is_mean();
+    const float common_scale
+            = pd()->with_per_row_scales() ? 1.f : src_scales[0];
+
+    // Every thread takes a contiguous range of bags, so the prefetched rows
+    // belong to its own upcoming bags.
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(n_bags, nthr, ithr, start, end);
+
+        jit_embedding_bag_kernel_t::call_params_t p;
+        p.table = src;
+        p.scales = src_scales;
+        for (dim_t bag = start; bag < end; ++bag) {
+            const dim_t beg = is_gather ? bag : offsets[off_d.off(bag)];
+            const dim_t fin = is_gather ? bag + 1
+                    : bag + 1 < n_bags  ? offsets[off_d.off(bag + 1)]
+                                        : n_indices;
+            const dim_t bag_size = fin - beg;
+
+            p.indices = indices + beg;
+            p.dst = dst + dst_d.blk_off(bag) * dst_d.data_type_size();
+            p.bag_size = bag_size;
+            p.n_indices_left = n_indices - beg;
+            p.factor = is_mean && bag_size > 0
+                    ? common_scale / static_cast<float>(bag_size)
+                    : common_scale;
+            (*kernel_)(&p);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
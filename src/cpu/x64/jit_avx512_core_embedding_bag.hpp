@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX512_CORE_EMBEDDING_BAG_HPP
+#define CPU_X64_JIT_AVX512_CORE_EMBEDDING_BAG_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Pools the table rows of a single bag into a destination row:
+//     dst = factor * sum_i(scales[idx[i]] * table[idx[i], :]).
+// The rows are processed in blocks of columns that fit the accumulators. The
+// kernel prefetches the rows selected by the indices `prefetch_distance`
+// positions ahead, which may belong to the next bags.
+struct jit_embedding_bag_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_embedding_bag_kernel_t)
+
+    struct call_params_t {
+        const void *table;
+        const int32_t *indices;
+        // Per-row scales, ignored when the scales are common.
+        const float *scales;
+        void *dst;
+        // The number of indices in the bag.
+        dim_t bag_size;
+        // The number of valid indices starting from `indices`, bounds the
+        // prefetch of the upcoming rows.
+        dim_t n_indices_left;
+        // Applied to the pooled row: the common scale and the mean factor.
+        float factor;
+    };
+
+    jit_embedding_bag_kernel_t(const embedding_bag_pd_t *pd);
+
+    // The number of indices to look ahead when prefetching rows.
+    static constexpr int prefetch_distance = 8;
+
+private:
+    static constexpr int simd_w_ = cpu_isa_traits<avx512_core>::vlen
+            / sizeof(float);
+    static constexpr int max_vecs_ = 16;
+    static constexpr int n_tmp_vecs_ = 12;
+
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+    const dim_t D_;
+    const dim_t row_stride_;
+    const bool per_row_scales_;
+
+    const Xbyak::Reg64 reg_param_ = abi_param1;
+    const Xbyak::Reg64 reg_table_ = r8;
+    const Xbyak::Reg64 reg_indices_ = r9;
+    const Xbyak::Reg64 reg_scales_ = r10;
+    const Xbyak::Reg64 reg_dst_ = r11;
+    const Xbyak::Reg64 reg_bag_size_ = r12;
+    const Xbyak::Reg64 reg_n_left_ = r13;
+    const Xbyak::Reg64 reg_i_ = r14;
+    const Xbyak::Reg64 reg_row_ = r15;
+    const Xbyak::Reg64 reg_pf_ = rax;
+    const Xbyak::Reg64 reg_tmp_ = rbx;
+
+    const Xbyak::Opmask k_tail_ = k1;
+    const Xbyak::Zmm zmm_scale_ = Xbyak::Zmm(28);
+    const Xbyak::Zmm zmm_factor_ = Xbyak::Zmm(29);
+
+    Xbyak::Zmm zmm_acc(int i) const { return Xbyak::Zmm(i); }
+    Xbyak::Zmm zmm_tmp(int i) const {
+        return Xbyak::Zmm(max_vecs_ + i % n_tmp_vecs_);
+    }
+
+    void load(const Xbyak::Zmm &zmm, const Xbyak::RegExp &addr, bool tail);
+    void store(const Xbyak::Zmm &zmm, const Xbyak::RegExp &addr, bool tail);
+    void compute_block(dim_t col, int n_vecs, int tail);
+
+    void generate() override;
+};
+
+struct jit_avx512_core_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", avx512_core, ""),
+                jit_avx512_core_embedding_bag_t);
+
+        status_t init(engine_t *engine);
+    };
+
+    jit_avx512_core_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_embedding_bag_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,679 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <functional>
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Returns the offset of the matrix with the flat batch index `mb`. Broadcast
+// dimensions of `mdw` do not contribute to the offset.
+dim_t batch_offset(const memory_desc_wrapper &mdw, const dims_t batch_dims,
+        int batch_ndims, dim_t mb) {
+    dim_t off = mdw.offset0();
+    for (int d = batch_ndims - 1; d >= 0; d--) {
+        const dim_t pos = mb % batch_dims[d];
+        mb /= batch_dims[d];
+        if (mdw.dims()[d] != 1) off += pos * mdw.blocking_desc().strides[d];
+    }
+    return off;
+}
+
+void cvt_to_f32(data_type_t dt, float *out, const void *inp, dim_t nelems) {
+    switch (dt) {
+        case f32:
+            std::memcpy(out, inp, nelems * sizeof(float));
+            break;
+        case bf16:
+            cvt_bfloat16_to_float(out, (const bfloat16_t *)inp, nelems);
+            break;
+        case f16:
+            cvt_float16_to_float(out, (const float16_t *)inp, nelems);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void cvt_from_f32(data_type_t dt, void *out, const float *inp, dim_t nelems) {
+    switch (dt) {
+        case f32:
+            std::memcpy(out, inp, nelems * sizeof(float));
+            break;
+        case bf16: cvt_float_to_bfloat16((bfloat16_t *)out, inp, nelems); break;
+        case f16: cvt_float_to_float16((float16_t *)out, inp, nelems); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+jit_brgemm_sdpa_softmax_kernel_t<isa>::jit_brgemm_sdpa_softmax_kernel_t(
+        const brgemm_sdpa_conf_t &conf)
+    : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+    , conf_(conf)
+    , mask_dt_size_(
+              conf.with_mask ? types::data_type_size(conf.mask_dt) : 0) {}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_softmax_kernel_t<isa>::load_mask(
+        const Vmm &vmm, bool scalar) {
+    const Xbyak::Xmm xmm(vmm.getIdx());
+    switch (conf_.mask_dt) {
+        case f32:
+            if (scalar)
+                vmovss(xmm, ptr[reg_mask]);
+            else
+                vmovups(vmm, ptr[reg_mask]);
+            break;
+        case bf16:
+            if (scalar) {
+                movzx(reg_tmp.cvt32(), word[reg_mask]);
+                shl(reg_tmp.cvt32(), 16);
+                vmovd(xmm, reg_tmp.cvt32());
+            } else {
+                vpmovzxwd(vmm, ptr[reg_mask]);
+                vpslld(vmm, vmm, 16);
+            }
+            break;
+        case f16:
+            if (scalar) {
+                movzx(reg_tmp.cvt32(), word[reg_mask]);
+                vmovd(xmm, reg_tmp.cvt32());
+                vcvtph2ps(xmm, xmm);
+            } else
+                vcvtph2ps(vmm, ptr[reg_mask]);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_softmax_kernel_t<isa>::horizontal_op(
+        const Vmm &vmm, const Vmm &vtmp, op_t op) {
+    const auto perform_op = [&]() {
+        if (op == op_t::max)
+            vmaxps(vmm, vmm, vtmp);
+        else
+            vaddps(vmm, vmm, vtmp);
+    };
+    if (is_superset(isa, avx512_core)) {
+        const Xbyak::Zmm zmm(vmm.getIdx()), ztmp(vtmp.getIdx());
+        vshuff32x4(ztmp, zmm, zmm, 0x4E); // 256-bit shuffle
+        perform_op();
+        vshuff32x4(ztmp, zmm, zmm, 0xB1); // 128/256-bit shuffle
+        perform_op();
+    } else {
+        const Xbyak::Ymm ymm(vmm.getIdx()), ytmp(vtmp.getIdx());
+        vperm2f128(ytmp, ymm, ymm, 0x1); // 128/256-bit shuffle
+        perform_op();
+    }
+    vshufps(vtmp, vmm, vmm, 0x4E); // 64/128-bit shuffle
+    perform_op();
+    vshufps(vtmp, vmm, vmm, 0xB1); // 32/64-bit shuffle
+    perform_op();
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_softmax_kernel_t<isa>::generate() {
+    const bool with_mask = conf_.with_mask;
+    const bool mask_bcast = conf_.m_str_k == 0;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    exp_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+            alg_kind::eltwise_exp, 0.f, 0.f, 1.f, false, reg_table));
+
+    // Iterates over `reg_cnt` elements starting at `reg_scores` with full
+    // vectors first and single elements for the tail. The mask pointer moves
+    // along unless it is broadcast.
+    const auto row_loop = [&](const std::function<void(bool)> &body) {
+        Xbyak::Label vec_loop, scalar_loop, done;
+        L(vec_loop);
+        {
+            cmp(reg_cnt, simd_w_);
+            jl(scalar_loop, T_NEAR);
+            body(false);
+            add(reg_scores, vlen);
+            if (with_mask && !mask_bcast)
+                add(reg_mask, simd_w_ * mask_dt_size_);
+            sub(reg_cnt, simd_w_);
+            jmp(vec_loop, T_NEAR);
+        }
+        L(scalar_loop);
+        {
+            cmp(reg_cnt, 0);
+            jle(done, T_NEAR);
+            body(true);
+            add(reg_scores, sizeof(float));
+            if (with_mask && !mask_bcast) add(reg_mask, mask_dt_size_);
+            dec(reg_cnt);
+            jmp(scalar_loop, T_NEAR);
+        }
+        L(done);
+    };
+
+    preamble();
+    exp_injector_->load_table_addr();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    mov(reg_scores, ptr[reg_param + PARAM_OFF(scores)]);
+    mov(reg_mask, ptr[reg_param + PARAM_OFF(mask)]);
+    mov(reg_n_valid, ptr[reg_param + PARAM_OFF(n_valid)]);
+    mov(reg_n, ptr[reg_param + PARAM_OFF(n)]);
+    mov(reg_max, ptr[reg_param + PARAM_OFF(max)]);
+    mov(reg_sum, ptr[reg_param + PARAM_OFF(sum)]);
+#undef PARAM_OFF
+
+    mov(reg_tmp.cvt32(), float2int(conf_.scale));
+    vmovd(xmm_tmp, reg_tmp.cvt32());
+    vbroadcastss(vmm_scale, xmm_tmp);
+    mov(reg_tmp.cvt32(), float2int(-INFINITY));
+    vmovd(xmm_tmp, reg_tmp.cvt32());
+    vbroadcastss(vmm_max, xmm_tmp);
+    vbroadcastss(vmm_tail_acc, xmm_tmp);
+    vxorps(vmm_zero, vmm_zero, vmm_zero);
+    if (with_mask && mask_bcast) {
+        load_mask(vmm_mask, true);
+        vbroadcastss(vmm_mask, xmm_mask);
+    }
+
+    // Scale, mask and the maximum. Single elements update the first lane of
+    // a separate accumulator since scalar instructions zero the upper lanes.
+    push(reg_scores);
+    mov(reg_cnt, reg_n_valid);
+    row_loop([&](bool scalar) {
+        if (scalar) {
+            vmovss(xmm_s, ptr[reg_scores]);
+            vmulss(xmm_s, xmm_s, Xbyak::Xmm(vmm_scale.getIdx()));
+            if (with_mask) {
+                if (!mask_bcast) load_mask(vmm_tmp, true);
+                vaddss(xmm_s, xmm_s, mask_bcast ? xmm_mask : xmm_tmp);
+            }
+            vmovss(ptr[reg_scores], xmm_s);
+            vmaxss(xmm_tail_acc, xmm_tail_acc, xmm_s);
+        } else {
+            vmulps(vmm_s, vmm_scale, ptr[reg_scores]);
+            if (with_mask) {
+                if (!mask_bcast) load_mask(vmm_tmp, false);
+                vaddps(vmm_s, vmm_s, mask_bcast ? vmm_mask : vmm_tmp);
+            }
+            vmovups(ptr[reg_scores], vmm_s);
+            vmaxps(vmm_max, vmm_max, vmm_s);
+        }
+    });
+    pop(reg_scores);
+    horizontal_op(vmm_max, vmm_tmp, op_t::max);
+    vmaxss(xmm_max, xmm_max, xmm_tail_acc);
+    vmaxss(xmm_max, xmm_max, ptr[reg_max]);
+    vmovss(ptr[reg_max], xmm_max);
+
+    // Nothing to attend to so far: the whole row is zeroed.
+    Xbyak::Label no_keys, zero_fill;
+    mov(reg_tmp.cvt32(), float2int(-INFINITY));
+    vmovd(xmm_tmp, reg_tmp.cvt32());
+    vucomiss(xmm_max, xmm_tmp);
+    je(no_keys, T_NEAR);
+
+    // Exponents and their sum.
+    vbroadcastss(vmm_max, xmm_max);
+    vxorps(vmm_sum, vmm_sum, vmm_sum);
+    vxorps(vmm_tail_acc, vmm_tail_acc, vmm_tail_acc);
+    mov(reg_cnt, reg_n_valid);
+    row_loop([&](bool scalar) {
+        if (scalar) {
+            vmovss(xmm_s, ptr[reg_scores]);
+            vsubss(xmm_s, xmm_s, xmm_max);
+        } else {
+            vmovups(vmm_s, ptr[reg_scores]);
+            vsubps(vmm_s, vmm_s, vmm_max);
+        }
+        exp_injector_->compute_vector(vmm_s.getIdx());
+        if (scalar) {
+            vmovss(ptr[reg_scores], xmm_s);
+            vaddss(xmm_tail_acc, xmm_tail_acc, xmm_s);
+        } else {
+            vmovups(ptr[reg_scores], vmm_s);
+            vaddps(vmm_sum, vmm_sum, vmm_s);
+        }
+    });
+    horizontal_op(vmm_sum, vmm_tmp, op_t::sum);
+    vaddss(xmm_sum, xmm_sum, xmm_tail_acc);
+    vmovss(ptr[reg_sum], xmm_sum);
+    mov(reg_cnt, reg_n);
+    sub(reg_cnt, reg_n_valid);
+    jmp(zero_fill, T_NEAR);
+
+    L(no_keys);
+    vxorps(xmm_sum, xmm_sum, xmm_sum);
+    vmovss(ptr[reg_sum], xmm_sum);
+    mov(reg_cnt, reg_n);
+
+    // The scores of the keys that are not attended to.
+    L(zero_fill);
+    row_loop([&](bool scalar) {
+        if (scalar)
+            vmovss(ptr[reg_scores], Xbyak::Xmm(vmm_zero.getIdx()));
+        else
+            vmovups(ptr[reg_scores], vmm_zero);
+    });
+
+    postamble();
+    exp_injector_->prepare_table();
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::pd_t::init(engine_t *engine) {
+    const auto dt_ok = [](data_type_t dt) {
+        return one_of(dt, f32, bf16, f16)
+                && platform::has_data_type_support(dt);
+    };
+
+    const bool ok = mayiuse(isa) && dt_ok(qry_md()->data_type)
+            && dt_ok(key_md()->data_type) && dt_ok(val_md()->data_type)
+            && dt_ok(dst_md()->data_type)
+            && IMPLICATION(with_mask(), dt_ok(msk_md()->data_type))
+            && attr()->has_default_values()
+            && set_default_params() == status::success
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    CHECK(init_conf());
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::pd_t::init_conf() {
+    const memory_desc_wrapper q_d(qry_md());
+    const memory_desc_wrapper k_d(key_md());
+    const memory_desc_wrapper v_d(val_md());
+    const memory_desc_wrapper m_d(msk_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    const int nd = ndims();
+    const auto &q_str = q_d.blocking_desc().strides;
+    const auto &k_str = k_d.blocking_desc().strides;
+    const auto &v_str = v_d.blocking_desc().strides;
+    const auto &m_str = m_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+
+    // Queries, values and destination must have contiguous rows. Keys may
+    // have contiguous rows as well as contiguous columns.
+    const bool layouts_ok = q_d.is_plain() && k_d.is_plain() && v_d.is_plain()
+            && dst_d.is_plain() && IMPLICATION(with_mask(), m_d.is_plain())
+            && q_str[nd - 1] == 1 && v_str[nd - 1] == 1
+            && dst_str[nd - 1] == 1
+            && (k_str[nd - 1] == 1 || k_str[nd - 2] == 1);
+    if (!layouts_ok) return status::unimplemented;
+
+    auto &c = conf_;
+    c.MB = batch();
+    c.SQ = queries();
+    c.SKV = keys();
+    c.D = head_size();
+    c.DV = value_head_size();
+
+    c.q_dt = q_d.data_type();
+    c.k_dt = k_d.data_type();
+    c.v_dt = v_d.data_type();
+    c.mask_dt = with_mask() ? m_d.data_type() : data_type::undef;
+    c.dst_dt = dst_d.data_type();
+    c.with_mask = with_mask();
+    c.causal = with_causal_mask();
+    c.scale = desc()->scale;
+
+    c.ld_q = q_str[nd - 2];
+    c.ld_v = v_str[nd - 2];
+    c.ld_dst = dst_str[nd - 2];
+    c.k_str_s = k_str[nd - 2];
+    c.k_str_d = k_str[nd - 1];
+    c.m_str_q = with_mask() && m_d.dims()[nd - 2] != 1 ? m_str[nd - 2] : 0;
+    c.m_str_k = with_mask() && m_d.dims()[nd - 1] != 1 ? m_str[nd - 1] : 0;
+    // The softmax kernel reads the mask along the keys with vector loads.
+    if (!one_of(c.m_str_k, 0, 1)) return status::unimplemented;
+
+    // Keys are used directly only when they are already transposed, i.e.
+    // the key vectors are columns of a row-major matrix. Otherwise the keys
+    // and the values of a head are converted once for all its queries.
+    c.use_q_buf = c.q_dt != f32;
+    c.use_k_buf = c.k_dt != f32 || c.k_str_s != 1 || c.SKV == 1;
+    c.use_v_buf = c.v_dt != f32;
+
+    c.nthr = dnnl_get_max_threads();
+
+    // Choose the blocks so that the per-thread working set stays in L2.
+    const dim_t l2_size = platform::get_per_core_cache_size(2);
+    c.q_block = nstl::min(c.SQ, dim_t(64));
+    c.kv_block = nstl::min(c.SKV, dim_t(256));
+    const auto working_set = [&]() {
+        return (dim_t)sizeof(float)
+                * (c.q_block * c.kv_block + c.q_block * c.DV
+                        + c.q_block * c.D + c.D * c.kv_block
+                        + c.kv_block * c.DV);
+    };
+    while (working_set() > l2_size / 2 && c.kv_block > 32)
+        c.kv_block = div_up(c.kv_block, 2);
+    while (working_set() > l2_size / 2 && c.q_block > 8)
+        c.q_block = div_up(c.q_block, 2);
+    // Make sure there is enough work for all the threads.
+    while (c.MB * div_up(c.SQ, c.q_block) < c.nthr && c.q_block > 8)
+        c.q_block = div_up(c.q_block, 2);
+
+    c.nb_q = div_up(c.SQ, c.q_block);
+    c.q_tail = c.SQ % c.q_block;
+    c.kv_tail = c.SKV % c.kv_block;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    for_(int is_pv = 0; is_pv < 2; is_pv++)
+    for_(int m_tail = 0; m_tail < 2; m_tail++)
+    for (int kv_tail = 0; kv_tail < 2; kv_tail++) {
+        const dim_t M = m_tail ? c.q_tail : c.q_block;
+        const dim_t KV = kv_tail ? c.kv_tail : c.kv_block;
+        if (M == 0 || KV == 0) continue;
+
+        brgemm_t &brg = brg_descs_[get_brg_kernel_idx(is_pv, m_tail, kv_tail)];
+        if (is_pv) {
+            // acc[M x DV] += P[M x KV] * V[KV x DV]
+            const dim_t LDB = c.use_v_buf ? c.DV : c.ld_v;
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32, false,
+                    false, brgemm_row_major, 1.f, 1.f, c.kv_block, LDB, c.DV,
+                    M, c.DV, KV));
+        } else {
+            // S[M x KV] = Q[M x D] * K^T[D x KV]
+            const dim_t LDA = c.use_q_buf ? c.D : c.ld_q;
+            const dim_t LDB = c.use_k_buf ? c.SKV : c.k_str_d;
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32, false,
+                    false, brgemm_row_major, 1.f, 0.f, LDA, LDB, c.kv_block, M,
+                    KV, c.D));
+        }
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.template book<float>(
+            key_sdpa_scores, c.nthr * c.q_block * c.kv_block);
+    scratchpad.template book<float>(key_sdpa_acc, c.nthr * c.q_block * c.DV);
+    // The running maximum and sum of the exponents for each query.
+    scratchpad.template book<float>(key_sdpa_stats, c.nthr * 2 * c.q_block);
+    if (c.use_q_buf)
+        scratchpad.template book<float>(
+                key_sdpa_q_buffer, c.nthr * c.q_block * c.D);
+    // Keys and values of a whole head. The keys buffer also keeps a row of
+    // converted keys for transposition.
+    if (c.use_k_buf)
+        scratchpad.template book<float>(
+                key_sdpa_k_buffer, c.nthr * (c.D * c.SKV + c.D));
+    if (c.use_v_buf)
+        scratchpad.template book<float>(
+                key_sdpa_v_buffer, c.nthr * c.SKV * c.DV);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::init(engine_t *engine) {
+    for (int i = 0; i < 8; i++) {
+        const brgemm_t &brg = pd()->brg_descs_[i];
+        if (brg.bcast_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[i], ker));
+    }
+    CHECK(safe_ptr_assign(softmax_kernel_,
+            new jit_brgemm_sdpa_softmax_kernel_t<isa>(pd()->conf_)));
+    return softmax_kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto qry = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    auto key = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    auto val = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    auto msk = pd()->with_mask() ? CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK)
+                                 : nullptr;
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    float *stats_base = scratchpad.template get<float>(key_sdpa_stats);
+    float *q_buf_base = scratchpad.template get<float>(key_sdpa_q_buffer);
+    float *k_buf_base = scratchpad.template get<float>(key_sdpa_k_buffer);
+    float *v_buf_base = scratchpad.template get<float>(key_sdpa_v_buffer);
+
+    const auto &c = pd()->conf_;
+    const memory_desc_wrapper q_d(pd()->qry_md());
+    const memory_desc_wrapper k_d(pd()->key_md());
+    const memory_desc_wrapper v_d(pd()->val_md());
+    const memory_desc_wrapper m_d(pd()->msk_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const int batch_ndims = pd()->ndims() - 2;
+    const dims_t &batch_dims = q_d.dims();
+    const size_t q_dt_size = types::data_type_size(c.q_dt);
+    const size_t k_dt_size = types::data_type_size(c.k_dt);
+    const size_t mask_dt_size
+            = msk ? types::data_type_size(c.mask_dt) : size_t(0);
+    const size_t v_dt_size = types::data_type_size(c.v_dt);
+    const size_t dst_dt_size = types::data_type_size(c.dst_dt);
+    // The query `i` attends to the keys up to `i + causal_shift`.
+    const dim_t causal_shift = c.SKV - c.SQ;
+
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(c.MB * c.nb_q, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *scores = scores_base + ithr * c.q_block * c.kv_block;
+        float *acc = acc_base + ithr * c.q_block * c.DV;
+        float *row_max = stats_base + ithr * 2 * c.q_block;
+        float *row_sum = row_max + c.q_block;
+        float *q_buf
+                = c.use_q_buf ? q_buf_base + ithr * c.q_block * c.D : nullptr;
+        float *k_buf = c.use_k_buf
+                ? k_buf_base + ithr * (c.D * c.SKV + c.D)
+                : nullptr;
+        float *v_buf
+                = c.use_v_buf ? v_buf_base + ithr * c.SKV * c.DV : nullptr;
+
+        brgemm_batch_element_t batch;
+        typename jit_brgemm_sdpa_softmax_kernel_t<isa>::call_params_t p;
+        // The batch whose keys and values are in the buffers. A thread
+        // processes consecutive blocks of queries, so the keys and values are
+        // converted once per head in most cases.
+        dim_t buf_mb = -1;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t mb = iwork / c.nb_q;
+            const dim_t i0 = (iwork % c.nb_q) * c.q_block;
+            const dim_t M = nstl::min(c.q_block, c.SQ - i0);
+            const bool m_tail = M < c.q_block;
+
+            const dim_t q_off = batch_offset(q_d, batch_dims, batch_ndims, mb);
+            const dim_t k_off = batch_offset(k_d, batch_dims, batch_ndims, mb);
+            const dim_t v_off = batch_offset(v_d, batch_dims, batch_ndims, mb);
+            const dim_t m_off = msk
+                    ? batch_offset(m_d, batch_dims, batch_ndims, mb)
+                    : 0;
+            const dim_t dst_off
+                    = batch_offset(dst_d, batch_dims, batch_ndims, mb);
+
+            if (mb != buf_mb) {
+                // Keys are transposed to D x SKV.
+                if (c.use_k_buf && c.k_str_s == 1) {
+                    for (dim_t d = 0; d < c.D; d++)
+                        cvt_to_f32(c.k_dt, k_buf + d * c.SKV,
+                                key + (k_off + d * c.k_str_d) * k_dt_size,
+                                c.SKV);
+                } else if (c.use_k_buf) {
+                    float *k_row = k_buf + c.D * c.SKV;
+                    for (dim_t j = 0; j < c.SKV; j++) {
+                        cvt_to_f32(c.k_dt, k_row,
+                                key + (k_off + j * c.k_str_s) * k_dt_size,
+                                c.D);
+                        for (dim_t d = 0; d < c.D; d++)
+                            k_buf[d * c.SKV + j] = k_row[d];
+                    }
+                }
+                if (c.use_v_buf)
+                    for (dim_t j = 0; j < c.SKV; j++)
+                        cvt_to_f32(c.v_dt, v_buf + j * c.DV,
+                                val + (v_off + j * c.ld_v) * v_dt_size, c.DV);
+                buf_mb = mb;
+            }
+
+            const float *A_q = nullptr;
+            if (c.use_q_buf) {
+                for (dim_t r = 0; r < M; r++)
+                    cvt_to_f32(c.q_dt, q_buf + r * c.D,
+                            qry + (q_off + (i0 + r) * c.ld_q) * q_dt_size,
+                            c.D);
+                A_q = q_buf;
+            } else
+                A_q = (const float *)qry + q_off + i0 * c.ld_q;
+
+            for (dim_t r = 0; r < M; r++) {
+                row_max[r] = -INFINITY;
+                row_sum[r] = 0.f;
+            }
+            std::memset(acc, 0, M * c.DV * sizeof(float));
+
+            // With the causal mask the blocks to the right of the last row's
+            // diagonal are skipped completely.
+            const dim_t n_keys = c.causal
+                    ? nstl::max(dim_t(0),
+                            nstl::min(c.SKV, i0 + M + causal_shift))
+                    : c.SKV;
+
+            for (dim_t k0 = 0; k0 < n_keys; k0 += c.kv_block) {
+                const dim_t N = nstl::min(c.kv_block, c.SKV - k0);
+                const bool kv_tail = N < c.kv_block;
+
+                batch.ptr.A = A_q;
+                batch.ptr.B = c.use_k_buf ? k_buf + k0
+                                          : (const float *)key + k_off + k0;
+                brgemm_kernel_execute(
+                        brg_kernels_[pd_t::get_brg_kernel_idx(
+                                                    false, m_tail, kv_tail)]
+                                .get(),
+                        1, &batch, scores);
+
+                // Online softmax: the accumulated output is rescaled every
+                // time the running maximum of a row changes.
+                for (dim_t r = 0; r < M; r++) {
+                    const dim_t i = i0 + r;
+                    const float old_max = row_max[r];
+                    float blk_sum = 0.f;
+
+                    p.scores = scores + r * c.kv_block;
+                    p.mask = msk ? msk
+                                    + (m_off + i * c.m_str_q + k0 * c.m_str_k)
+                                            * mask_dt_size
+                                 : nullptr;
+                    p.n_valid = c.causal
+                            ? nstl::max(dim_t(0),
+                                    nstl::min(N, i + causal_shift + 1 - k0))
+                            : N;
+                    p.n = N;
+                    p.max = &row_max[r];
+                    p.sum = &blk_sum;
+                    (*softmax_kernel_)(&p);
+
+                    // Nothing to attend to so far.
+                    if (row_max[r] == -INFINITY) continue;
+
+                    const float factor = expf(old_max - row_max[r]);
+                    if (factor != 1.f) {
+                        float *a = acc + r * c.DV;
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t dv = 0; dv < c.DV; dv++)
+                            a[dv] *= factor;
+                    }
+                    row_sum[r] = row_sum[r] * factor + blk_sum;
+                }
+
+                batch.ptr.A = scores;
+                batch.ptr.B = c.use_v_buf
+                        ? v_buf + k0 * c.DV
+                        : (const float *)val + v_off + k0 * c.ld_v;
+                brgemm_kernel_execute(
+                        brg_kernels_[pd_t::get_brg_kernel_idx(
+                                                    true, m_tail, kv_tail)]
+                                .get(),
+                        1, &batch, acc);
+            }
+
+            // A row without a single key to attend to produces zeros.
+            for (dim_t r = 0; r < M; r++) {
+                float *a = acc + r * c.DV;
+                const float inv_sum
+                        = row_sum[r] > 0.f ? 1.f / row_sum[r] : 0.f;
+                PRAGMA_OMP_SIMD()
+                for (dim_t dv = 0; dv < c.DV; dv++)
+                    a[dv] *= inv_sum;
+                cvt_from_f32(c.dst_dt,
+                        dst + (dst_off + (i0 + r) * c.ld_dst) * dst_dt_size,
+                        a, c.DV);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_sdpa_t<avx512_core>;
+template struct brgemm_sdpa_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct brgemm_sdpa_conf_t {
+    dim_t MB, SQ, SKV, D, DV;
+    // Number of queries and keys processed by one brgemm call.
+    dim_t q_block, kv_block;
+    dim_t nb_q, q_tail, kv_tail;
+
+    data_type_t q_dt, k_dt, v_dt, mask_dt, dst_dt;
+    bool with_mask, causal;
+    float scale;
+
+    // Matrices that are not f32 or not laid out as brgemm expects them are
+    // copied into per-thread f32 buffers.
+    bool use_q_buf, use_k_buf, use_v_buf;
+
+    // Row strides of the matrices. Keys have the strides along both the
+    // sequence and the head dimensions since both layouts are supported.
+    dim_t ld_q, ld_v, ld_dst;
+    dim_t k_str_s, k_str_d;
+    // Mask strides; zero for broadcast dimensions.
+    dim_t m_str_q, m_str_k;
+
+    int nthr;
+};
+
+// Updates a row of scores of a block of keys for the online softmax: the
+// scores of the first `n_valid` keys are scaled, the mask is added and the
+// running maximum is updated, then the scores are replaced with their
+// exponents shifted by the maximum. The scores of the remaining keys up to
+// `n` are zeroed. If the maximum stays -inf, the whole row is zeroed.
+template <cpu_isa_t isa>
+struct jit_brgemm_sdpa_softmax_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_sdpa_softmax_kernel_t)
+
+    struct call_params_t {
+        float *scores;
+        const void *mask;
+        dim_t n_valid;
+        dim_t n;
+        // The running maximum of the row, updated in place.
+        float *max;
+        // The sum of the computed exponents.
+        float *sum;
+    };
+
+    jit_brgemm_sdpa_softmax_kernel_t(const brgemm_sdpa_conf_t &conf);
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    enum class op_t { max, sum };
+
+    const brgemm_sdpa_conf_t conf_;
+    const int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const size_t mask_dt_size_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
+
+    const reg64_t reg_param = abi_param1;
+    // The exponent injector keeps its table address in rax.
+    const reg64_t reg_table = rax;
+    const reg64_t reg_scores = r8;
+    const reg64_t reg_mask = r9;
+    const reg64_t reg_n_valid = r10;
+    const reg64_t reg_n = r11;
+    const reg64_t reg_cnt = r12;
+    const reg64_t reg_max = r13;
+    const reg64_t reg_sum = r14;
+    const reg64_t reg_tmp = r15;
+
+    // Vmm(0) - Vmm(2) are used by the exponent injector.
+    const Vmm vmm_scale = Vmm(4);
+    const Vmm vmm_max = Vmm(5);
+    const Vmm vmm_sum = Vmm(6);
+    const Vmm vmm_mask = Vmm(7);
+    const Vmm vmm_s = Vmm(8);
+    const Vmm vmm_tmp = Vmm(9);
+    const Vmm vmm_tail_acc = Vmm(10);
+    const Vmm vmm_zero = Vmm(11);
+    const Xbyak::Xmm xmm_max = Xbyak::Xmm(5);
+    const Xbyak::Xmm xmm_sum = Xbyak::Xmm(6);
+    const Xbyak::Xmm xmm_mask = Xbyak::Xmm(7);
+    const Xbyak::Xmm xmm_s = Xbyak::Xmm(8);
+    const Xbyak::Xmm xmm_tmp = Xbyak::Xmm(9);
+    const Xbyak::Xmm xmm_tail_acc = Xbyak::Xmm(10);
+
+    void load_mask(const Vmm &vmm, bool scalar);
+    void horizontal_op(const Vmm &vmm, const Vmm &vtmp, op_t op);
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brgemm:", isa, ""), brgemm_sdpa_t);
+
+        status_t init(engine_t *engine);
+
+        // The kernels computing the scores, Q x K^T, are indexed by the tails
+        // along the queries and keys; the kernels accumulating the output,
+        // P x V, are indexed by the tails along the queries and the reduction.
+        static int get_brg_kernel_idx(bool is_pv, bool m_tail, bool kv_tail) {
+            return 4 * is_pv + 2 * m_tail + kv_tail;
+        }
+
+        brgemm_sdpa_conf_t conf_;
+        brgemm_t brg_descs_[8];
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[8];
+    std::unique_ptr<jit_brgemm_sdpa_softmax_kernel_t<isa>> softmax_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,475 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Returns the estimated cost of F(m x m, 3 x 3) relative to the direct
+// convolution. Both are counted in multiply-adds per pair of input and
+// output channels for one tile.
+float wino_relative_cost(const jit_brgemm_wino_conv_conf_t &jcp, int m) {
+    const float alpha = m + 2;
+    const dim_t tiles = div_up(jcp.oh, m) * div_up(jcp.ow, m);
+    // The points of the partial tiles outside the image are computed too.
+    const float util = (float)(jcp.oh * jcp.ow) / (tiles * m * m);
+
+    const float gemm = alpha * alpha;
+    // The source transform is shared by all the output channels and the
+    // destination transform by all the input channels.
+    const float src_trans = 2.f * alpha * alpha * alpha / jcp.oc;
+    const float dst_trans = alpha * m * (alpha + m) / jcp.ic;
+    // The weights are transformed at every execution.
+    const float wei_trans = 3.f * alpha * (alpha + 3) / (jcp.mb * tiles);
+
+    return (gemm + src_trans + dst_trans + wei_trans) / (9.f * m * m * util);
+}
+
+// Winograd pays off for convolutions with enough channels to hide the cost
+// of the transforms and enough tiles to amortize the weights transform. The
+// transforms are memory bound and the GEMMs are smaller than the ones of the
+// direct implementations, so the arithmetic savings must be substantial.
+bool is_impl_optimal(
+        const jit_brgemm_wino_conv_conf_t &jcp, const convolution_desc_t &cd) {
+    if (cd.alg_kind == alg_kind::convolution_winograd) return true;
+
+    const dim_t min_channels = 64;
+    const float max_relative_cost = 0.5f;
+    return jcp.ic >= min_channels && jcp.oc >= min_channels
+            && wino_relative_cost(jcp, jcp.m) < max_relative_cost;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const bool is_bf16 = isa == avx512_core_bf16;
+    const data_type_t wei_type = is_bf16 ? bf16 : f32;
+    const data_type_t dst_type = invariant_dst_md()->data_type;
+
+    bool ok = is_fwd() && mayiuse(isa)
+            && one_of(desc()->alg_kind, alg_kind::convolution_auto,
+                    alg_kind::convolution_winograd)
+            && ndims() == 4
+            && expect_data_types(wei_type, wei_type, data_type::undef,
+                    dst_type, f32)
+            && IMPLICATION(!is_bf16, dst_type == f32)
+            && IMPLICATION(is_bf16, one_of(dst_type, f32, bf16))
+            && IMPLICATION(
+                    with_bias(), one_of(bias_md_.data_type, f32, wei_type))
+            && attr()->has_default_values(skip_mask_t::post_ops, dst_type)
+            && !has_zero_dim_memory()
+            && set_default_formats_common(nhwc, hwio, nhwc);
+    if (!ok) return status::unimplemented;
+
+    {
+        using namespace injector;
+        static constexpr bool sum_at_pos_0_only = true;
+        static constexpr bool sum_requires_scale_one = false;
+        static constexpr bool sum_requires_zp_zero = true;
+        const memory_desc_wrapper dst_d(dst_md_);
+        // The tiles are computed for the points outside the image, so only
+        // the broadcasts that do not depend on the spatial position are
+        // supported.
+        const bcast_set_t bcast_set {broadcasting_strategy_t::scalar,
+                broadcasting_strategy_t::per_oc};
+        ok = post_ops_ok(post_ops_ok_args_t(avx512_core,
+                {binary, eltwise, sum}, attr()->post_ops_, &dst_d,
+                sum_at_pos_0_only, sum_requires_scale_one,
+                sum_requires_zp_zero, true, bcast_set));
+        if (!ok) return status::unimplemented;
+    }
+    CHECK(attr_.set_default_formats(&dst_md_));
+
+    CHECK(init_conf());
+    if (!is_impl_optimal(jcp_, *desc())) return status::unimplemented;
+    if (!set_default_alg_kind(alg_kind::convolution_winograd))
+        return status::unimplemented;
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_conf() {
+    const memory_desc_wrapper src_d(&src_md_);
+    const memory_desc_wrapper wei_d(&weights_md_);
+    const memory_desc_wrapper dst_d(&dst_md_);
+
+    const bool shape_ok = !with_groups() && KH() == 3 && KW() == 3
+            && KSH() == 1 && KSW() == 1 && KDH() == 0 && KDW() == 0
+            && padT() >= 0 && padL() >= 0;
+    const bool layout_ok = src_d.matches_tag(nhwc) && dst_d.matches_tag(nhwc)
+            && wei_d.is_plain();
+    if (!shape_ok || !layout_ok) return status::unimplemented;
+
+    auto &jcp = jcp_;
+    const bool is_bf16 = isa == avx512_core_bf16;
+
+    jcp.mb = MB();
+    jcp.ic = IC();
+    jcp.oc = OC();
+    jcp.ih = IH();
+    jcp.iw = IW();
+    jcp.oh = OH();
+    jcp.ow = OW();
+    jcp.t_pad = padT();
+    jcp.l_pad = padL();
+
+    jcp.src_dt = src_md_.data_type;
+    jcp.wei_dt = weights_md_.data_type;
+    jcp.bia_dt = with_bias() ? bias_md_.data_type : data_type::undef;
+    jcp.dst_dt = dst_md_.data_type;
+    jcp.wino_dt = is_bf16 ? bf16 : f32;
+
+    jcp.src_n_stride = src_d.blocking_desc().strides[0];
+    jcp.src_h_stride = src_d.blocking_desc().strides[2];
+    jcp.src_w_stride = src_d.blocking_desc().strides[3];
+    jcp.dst_n_stride = dst_d.blocking_desc().strides[0];
+    jcp.dst_h_stride = dst_d.blocking_desc().strides[2];
+    jcp.dst_w_stride = dst_d.blocking_desc().strides[3];
+
+    const auto &po = attr()->post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    jcp.with_bias = with_bias();
+    jcp.with_sum = sum_idx != -1;
+    jcp.sum_scale = jcp.with_sum ? po.entry_[sum_idx].sum.scale : 0.f;
+    jcp.with_eltwise = po.find(primitive_kind::eltwise) != -1;
+    jcp.with_binary = po.find(primitive_kind::binary) != -1;
+    jcp.post_ops = po;
+
+    // The transformed operands are rounded to bf16, and the transforms of
+    // F(4x4, 3x3) and F(6x6, 3x3) amplify the rounding error by an order of
+    // magnitude. The transforms of F(2x2, 3x3) have coefficients of 0, 1/2
+    // and 1 only, which keeps the error close to the one of the direct
+    // convolution.
+    const bool use_6x3
+            = wino_relative_cost(jcp, 6) < wino_relative_cost(jcp, 4);
+    jcp.m = is_bf16 ? 2 : use_6x3 ? 6 : 4;
+    jcp.alpha = jcp.m + 2;
+    jcp.tiles_h = div_up(jcp.oh, jcp.m);
+    jcp.tiles_w = div_up(jcp.ow, jcp.m);
+    jcp.nb_tiles = jcp.tiles_h * jcp.tiles_w;
+
+    const dim_t max_tile_block = 32;
+    jcp.tile_block = nstl::min(jcp.nb_tiles, max_tile_block);
+    jcp.nb_tile_blocks = div_up(jcp.nb_tiles, jcp.tile_block);
+    jcp.tile_tail = jcp.nb_tiles % jcp.tile_block;
+
+    jcp.icp = is_bf16 ? rnd_up(jcp.ic, 2) : jcp.ic;
+
+    // The block must be a multiple of the vector length unless it is the
+    // only one.
+    const dim_t max_oc_block = 64;
+    jcp.oc_block = nstl::min(jcp.oc, max_oc_block);
+    jcp.nb_oc = div_up(jcp.oc, jcp.oc_block);
+    jcp.oc_tail = jcp.oc % jcp.oc_block;
+
+    jcp.nthr = dnnl_get_max_threads();
+    const dim_t tile_work = jcp.mb * jcp.nb_tile_blocks;
+    jcp.nb_oc_chunks = tile_work >= jcp.nthr
+            ? 1
+            : nstl::min(jcp.nb_oc, div_up<dim_t>(jcp.nthr, tile_work));
+
+    // The offsets within the tiles are immediate operands of the kernels.
+    const dim_t alpha2 = jcp.alpha * jcp.alpha;
+    const dim_t max_src_off = (alpha2 - 1) * jcp.tile_block * jcp.icp
+            * types::data_type_size(jcp.wino_dt);
+    const dim_t max_dst_off = (jcp.m - 1)
+            * (jcp.dst_h_stride + jcp.dst_w_stride)
+            * types::data_type_size(jcp.dst_dt);
+    if (nstl::max(max_src_off, max_dst_off) > INT32_MAX)
+        return status::unimplemented;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &jcp = jcp_;
+
+    // wino_dst[p][M x N] = wino_src[p][M x K] * wino_wei[p][K x N] for every
+    // point p of the transform domain, M is the tiles and K is the input
+    // channels.
+    for_(int m_tail = 0; m_tail < 2; m_tail++)
+    for (int n_tail = 0; n_tail < 2; n_tail++) {
+        const dim_t M = m_tail ? jcp.tile_tail : jcp.tile_block;
+        const dim_t N = n_tail ? jcp.oc_tail : jcp.oc_block;
+        if (M == 0 || N == 0) continue;
+
+        brgemm_t &brg = brg_descs_[get_brg_kernel_idx(m_tail, n_tail)];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, jcp.wino_dt,
+                jcp.wino_dt, false, false, brgemm_row_major, 1.f, 0.f,
+                jcp.icp, jcp.oc, jcp.oc_block, M, N, jcp.icp));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &jcp = jcp_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    const dim_t alpha2 = jcp.alpha * jcp.alpha;
+    const size_t wino_dt_size = types::data_type_size(jcp.wino_dt);
+    scratchpad.book(key_wino_U, alpha2 * jcp.icp * jcp.oc, wino_dt_size);
+    scratchpad.book(key_wino_V,
+            jcp.nthr * alpha2 * jcp.tile_block * jcp.icp, wino_dt_size);
+    scratchpad.template book<float>(
+            key_wino_M, jcp.nthr * alpha2 * jcp.tile_block * jcp.oc_block);
+    // The tiles crossing the borders of the image are copied to a zero-padded
+    // buffer before the transform.
+    scratchpad.book(key_conv_tr_src, jcp.nthr * alpha2 * jcp.ic,
+            types::data_type_size(jcp.src_dt));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::init(engine_t *engine) {
+    for (int i = 0; i < 4; i++) {
+        const brgemm_t &brg = pd()->brg_descs_[i];
+        if (brg.bcast_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[i], ker));
+    }
+
+    CHECK(safe_ptr_assign(
+            src_trans_, new jit_avx512_core_wino_src_trans_t(pd()->jcp_)));
+    CHECK(src_trans_->create_kernel());
+    CHECK(safe_ptr_assign(dst_trans_,
+            new jit_avx512_core_wino_dst_trans_t(pd()->jcp_, *pd()->dst_md())));
+    return dst_trans_->create_kernel();
+}
+
+// The transformed weights are laid out as alpha x alpha matrices icp x oc.
+// For bf16 pairs of input channels are interleaved as the VNNI layout of
+// the brgemm B matrix requires.
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_weights(
+        const exec_ctx_t &ctx, char *wino_wei) const {
+    auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const dim_t *strides = wei_d.blocking_desc().strides;
+    const dim_t alpha2 = jcp.alpha * jcp.alpha;
+    const dim_t vnni = jcp.wino_dt == bf16 ? 2 : 1;
+
+    parallel_nd(jcp.icp, jcp.oc, [&](dim_t ic, dim_t oc) {
+        float g[9] = {0.f};
+        float u[8 * 8] = {0.f};
+        if (ic < jcp.ic) {
+            for_(int kh = 0; kh < 3; kh++)
+            for (int kw = 0; kw < 3; kw++) {
+                const dim_t off = wei_d.offset0() + oc * strides[0]
+                        + ic * strides[1] + kh * strides[2] + kw * strides[3];
+                g[kh * 3 + kw] = io::load_float_value(jcp.wei_dt, wei, off);
+            }
+            wino_conv_transform_weights(jcp.m, g, u);
+        }
+
+        const dim_t off
+                = (ic / vnni * jcp.oc + oc) * vnni + ic % vnni;
+        for (dim_t p = 0; p < alpha2; p++)
+            io::store_float_value(
+                    jcp.wino_dt, u[p], wino_wei, p * jcp.icp * jcp.oc + off);
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &jcp = pd()->jcp_;
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(jcp.post_ops, ctx);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *wino_wei = scratchpad.template get<char>(key_wino_U);
+    char *wino_src_base = scratchpad.template get<char>(key_wino_V);
+    float *wino_dst_base = scratchpad.template get<float>(key_wino_M);
+    char *src_pad_base = scratchpad.template get<char>(key_conv_tr_src);
+
+    transform_weights(ctx, wino_wei);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t src_dt_size = types::data_type_size(jcp.src_dt);
+    const size_t dst_dt_size = types::data_type_size(jcp.dst_dt);
+    const size_t bia_dt_size
+            = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+    const size_t wino_dt_size = types::data_type_size(jcp.wino_dt);
+    const dim_t vnni = jcp.wino_dt == bf16 ? 2 : 1;
+
+    const int alpha = jcp.alpha;
+    const dim_t alpha2 = alpha * alpha;
+    const dim_t wino_src_size = alpha2 * jcp.tile_block * jcp.icp;
+    const dim_t wino_dst_size = alpha2 * jcp.tile_block * jcp.oc_block;
+    const dim_t src_pad_size = alpha2 * jcp.ic;
+    const dim_t nb_oc_per_chunk = div_up(jcp.nb_oc, jcp.nb_oc_chunks);
+    const dim_t work_amount = jcp.mb * jcp.nb_tile_blocks * jcp.nb_oc_chunks;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *wino_src = wino_src_base + ithr * wino_src_size * wino_dt_size;
+        float *wino_dst = wino_dst_base + ithr * wino_dst_size;
+        char *src_pad = src_pad_base + ithr * src_pad_size * src_dt_size;
+
+        brgemm_batch_element_t batch;
+        jit_avx512_core_wino_src_trans_t::call_params_t src_args;
+        jit_avx512_core_wino_dst_trans_t::call_params_t dst_args;
+        dst_args.post_ops_binary_rhs_arg_vec
+                = post_ops_binary_rhs_arg_vec.data();
+        dst_args.dst_orig = dst;
+
+        dim_t n {0}, tb {0}, occ {0};
+        nd_iterator_init(start, n, jcp.mb, tb, jcp.nb_tile_blocks, occ,
+                jcp.nb_oc_chunks);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t tile_start = tb * jcp.tile_block;
+            const dim_t nt
+                    = nstl::min(jcp.tile_block, jcp.nb_tiles - tile_start);
+            const char *src_n = src
+                    + (src_d.offset0() + n * jcp.src_n_stride) * src_dt_size;
+
+            for (dim_t t = 0; t < nt; t++) {
+                const dim_t tile = tile_start + t;
+                const dim_t ih0 = (tile / jcp.tiles_w) * jcp.m - jcp.t_pad;
+                const dim_t iw0 = (tile % jcp.tiles_w) * jcp.m - jcp.l_pad;
+                const bool is_inside = ih0 >= 0 && iw0 >= 0
+                        && ih0 + alpha <= jcp.ih && iw0 + alpha <= jcp.iw;
+
+                if (is_inside) {
+                    src_args.src = src_n
+                            + (ih0 * jcp.src_h_stride + iw0 * jcp.src_w_stride)
+                                    * src_dt_size;
+                    src_args.row_stride = jcp.src_h_stride * src_dt_size;
+                    src_args.col_stride = jcp.src_w_stride * src_dt_size;
+                } else {
+                    const size_t pixel_size = jcp.ic * src_dt_size;
+                    for_(int y = 0; y < alpha; y++)
+                    for (int x = 0; x < alpha; x++) {
+                        char *pad = src_pad + (y * alpha + x) * pixel_size;
+                        const dim_t ih = ih0 + y, iw = iw0 + x;
+                        if (ih >= 0 && ih < jcp.ih && iw >= 0 && iw < jcp.iw)
+                            std::memcpy(pad,
+                                    src_n
+                                            + (ih * jcp.src_h_stride
+                                                      + iw * jcp.src_w_stride)
+                                                    * src_dt_size,
+                                    pixel_size);
+                        else
+                            std::memset(pad, 0, pixel_size);
+                    }
+                    src_args.src = src_pad;
+                    src_args.row_stride = alpha * pixel_size;
+                    src_args.col_stride = pixel_size;
+                }
+                src_args.wino_src = wino_src + t * jcp.icp * wino_dt_size;
+                (*src_trans_)(&src_args);
+            }
+
+            const dim_t ocb_start = occ * nb_oc_per_chunk;
+            const dim_t ocb_end
+                    = nstl::min(jcp.nb_oc, ocb_start + nb_oc_per_chunk);
+            for (dim_t ocb = ocb_start; ocb < ocb_end; ocb++) {
+                const dim_t oc = ocb * jcp.oc_block;
+                const dim_t oc_work = nstl::min(jcp.oc_block, jcp.oc - oc);
+                const brgemm_kernel_t *kernel
+                        = brg_kernels_[pd_t::get_brg_kernel_idx(
+                                               nt < jcp.tile_block,
+                                               oc_work < jcp.oc_block)]
+                                  .get();
+
+                for (dim_t p = 0; p < alpha2; p++) {
+                    batch.ptr.A = wino_src
+                            + p * jcp.tile_block * jcp.icp * wino_dt_size;
+                    batch.ptr.B = wino_wei
+                            + (p * jcp.icp * jcp.oc + oc * vnni) * wino_dt_size;
+                    brgemm_kernel_execute(kernel, 1, &batch,
+                            wino_dst + p * jcp.tile_block * jcp.oc_block);
+                }
+
+                for (dim_t t = 0; t < nt; t++) {
+                    const dim_t tile = tile_start + t;
+                    const dim_t oh0 = (tile / jcp.tiles_w) * jcp.m;
+                    const dim_t ow0 = (tile % jcp.tiles_w) * jcp.m;
+                    const dim_t dst_off = dst_d.offset0()
+                            + n * jcp.dst_n_stride + oh0 * jcp.dst_h_stride
+                            + ow0 * jcp.dst_w_stride + oc;
+
+                    dst_args.wino_dst = wino_dst + t * jcp.oc_block;
+                    dst_args.dst = dst + dst_off * dst_dt_size;
+                    dst_args.bias = jcp.with_bias ? bias + oc * bia_dt_size
+                                                  : nullptr;
+                    dst_args.oc_work = oc_work;
+                    dst_args.valid_h = nstl::min<dim_t>(jcp.m, jcp.oh - oh0);
+                    dst_args.valid_w = nstl::min<dim_t>(jcp.m, jcp.ow - ow0);
+                    (*dst_trans_)(&dst_args);
+                }
+            }
+
+            nd_iterator_step(n, jcp.mb, tb, jcp.nb_tile_blocks, occ,
+                    jcp.nb_oc_chunks);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_wino_convolution_fwd_t<avx512_core>;
+template struct brgemm_wino_convolution_fwd_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd convolution F(m x m, 3 x 3), m = 4 or 6, for 2D 3x3 convolutions
+// with unit strides. The source tiles and the weights are transformed into
+// the Winograd domain, where each of the alpha x alpha points is a GEMM
+// computed by brgemm, and the results are transformed back together with
+// the bias and the post-ops.
+template <cpu_isa_t isa>
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm_wino:", isa, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // The kernels are indexed by the tails along the tiles and the
+        // output channels.
+        static int get_brg_kernel_idx(bool m_tail, bool n_tail) {
+            return 2 * m_tail + n_tail;
+        }
+
+        jit_brgemm_wino_conv_conf_t jcp_;
+        brgemm_t brg_descs_[4];
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void transform_weights(const exec_ctx_t &ctx, char *wino_wei) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[4];
+    std::unique_ptr<jit_avx512_core_wino_src_trans_t> src_trans_;
+    std::unique_ptr<jit_avx512_core_wino_dst_trans_t> dst_trans_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
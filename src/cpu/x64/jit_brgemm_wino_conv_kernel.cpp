@@ -0,0 +1,506 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace data_type;
+using namespace Xbyak;
+
+namespace {
+
+// The transform matrices of F(2x2, 3x3) with the interpolation points 0, 1,
+// -1, of F(4x4, 3x3) with the points 0, 1, -1, 2, -2 and of F(6x6, 3x3) with
+// the points 0, 1, -1, 2, -2, 1/2, -1/2. B^T is alpha x alpha, G is alpha x 3
+// and A^T is m x alpha.
+const float BT_2x3[4 * 4] = {
+        1.f, 0.f, -1.f, 0.f, //
+        0.f, 1.f, 1.f, 0.f, //
+        0.f, -1.f, 1.f, 0.f, //
+        0.f, 1.f, 0.f, -1.f, //
+};
+
+const float G_2x3[4 * 3] = {
+        1.f, 0.f, 0.f, //
+        1.f / 2, 1.f / 2, 1.f / 2, //
+        1.f / 2, -1.f / 2, 1.f / 2, //
+        0.f, 0.f, 1.f, //
+};
+
+const float AT_2x3[2 * 4] = {
+        1.f, 1.f, 1.f, 0.f, //
+        0.f, 1.f, -1.f, -1.f, //
+};
+
+const float BT_4x3[6 * 6] = {
+        4.f, 0.f, -5.f, 0.f, 1.f, 0.f, //
+        0.f, -4.f, -4.f, 1.f, 1.f, 0.f, //
+        0.f, 4.f, -4.f, -1.f, 1.f, 0.f, //
+        0.f, -2.f, -1.f, 2.f, 1.f, 0.f, //
+        0.f, 2.f, -1.f, -2.f, 1.f, 0.f, //
+        0.f, 4.f, 0.f, -5.f, 0.f, 1.f, //
+};
+
+const float G_4x3[6 * 3] = {
+        1.f / 4, 0.f, 0.f, //
+        -1.f / 6, -1.f / 6, -1.f / 6, //
+        -1.f / 6, 1.f / 6, -1.f / 6, //
+        1.f / 24, 1.f / 12, 1.f / 6, //
+        1.f / 24, -1.f / 12, 1.f / 6, //
+        0.f, 0.f, 1.f, //
+};
+
+const float AT_4x3[4 * 6] = {
+        1.f, 1.f, 1.f, 1.f, 1.f, 0.f, //
+        0.f, 1.f, -1.f, 2.f, -2.f, 0.f, //
+        0.f, 1.f, 1.f, 4.f, 4.f, 0.f, //
+        0.f, 1.f, -1.f, 8.f, -8.f, 1.f, //
+};
+
+const float BT_6x3[8 * 8] = {
+        1.f, 0.f, -21.f / 4, 0.f, 21.f / 4, 0.f, -1.f, 0.f, //
+        0.f, 1.f, 1.f, -17.f / 4, -17.f / 4, 1.f, 1.f, 0.f, //
+        0.f, -1.f, 1.f, 17.f / 4, -17.f / 4, -1.f, 1.f, 0.f, //
+        0.f, 1.f / 2, 1.f / 4, -5.f / 2, -5.f / 4, 2.f, 1.f, 0.f, //
+        0.f, -1.f / 2, 1.f / 4, 5.f / 2, -5.f / 4, -2.f, 1.f, 0.f, //
+        0.f, 2.f, 4.f, -5.f / 2, -5.f, 1.f / 2, 1.f, 0.f, //
+        0.f, -2.f, 4.f, 5.f / 2, -5.f, -1.f / 2, 1.f, 0.f, //
+        0.f, -1.f, 0.f, 21.f / 4, 0.f, -21.f / 4, 0.f, 1.f, //
+};
+
+const float G_6x3[8 * 3] = {
+        1.f, 0.f, 0.f, //
+        -2.f / 9, -2.f / 9, -2.f / 9, //
+        -2.f / 9, 2.f / 9, -2.f / 9, //
+        1.f / 90, 1.f / 45, 2.f / 45, //
+        1.f / 90, -1.f / 45, 2.f / 45, //
+        32.f / 45, 16.f / 45, 8.f / 45, //
+        32.f / 45, -16.f / 45, 8.f / 45, //
+        0.f, 0.f, 1.f, //
+};
+
+const float AT_6x3[6 * 8] = {
+        1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 0.f, //
+        0.f, 1.f, -1.f, 2.f, -2.f, 1.f / 2, -1.f / 2, 0.f, //
+        0.f, 1.f, 1.f, 4.f, 4.f, 1.f / 4, 1.f / 4, 0.f, //
+        0.f, 1.f, -1.f, 8.f, -8.f, 1.f / 8, -1.f / 8, 0.f, //
+        0.f, 1.f, 1.f, 16.f, 16.f, 1.f / 16, 1.f / 16, 0.f, //
+        0.f, 1.f, -1.f, 32.f, -32.f, 1.f / 32, -1.f / 32, 1.f, //
+};
+
+const float *get_BT(int m) {
+    return m == 2 ? BT_2x3 : m == 4 ? BT_4x3 : BT_6x3;
+}
+const float *get_G(int m) {
+    return m == 2 ? G_2x3 : m == 4 ? G_4x3 : G_6x3;
+}
+const float *get_AT(int m) {
+    return m == 2 ? AT_2x3 : m == 4 ? AT_4x3 : AT_6x3;
+}
+
+} // namespace
+
+void wino_conv_transform_weights(int m, const float *g, float *u) {
+    const int alpha = m + 2;
+    const float *G = get_G(m);
+
+    // tmp = G g, then u = tmp G^T.
+    float tmp[8 * 3];
+    for_(int a = 0; a < alpha; a++)
+    for (int kw = 0; kw < 3; kw++) {
+        float s = 0.f;
+        for (int kh = 0; kh < 3; kh++)
+            s += G[a * 3 + kh] * g[kh * 3 + kw];
+        tmp[a * 3 + kw] = s;
+    }
+    for_(int a = 0; a < alpha; a++)
+    for (int b = 0; b < alpha; b++) {
+        float s = 0.f;
+        for (int kw = 0; kw < 3; kw++)
+            s += tmp[a * 3 + kw] * G[b * 3 + kw];
+        u[a * alpha + b] = s;
+    }
+}
+
+Address jit_wino_trans_kernel_base_t::coeff(float c) {
+    size_t idx = 0;
+    while (idx < coeffs_.size() && coeffs_[idx] != c)
+        idx++;
+    if (idx == coeffs_.size()) coeffs_.push_back(c);
+    return zword_b[reg_coeffs_ + idx * sizeof(float)];
+}
+
+void jit_wino_trans_kernel_base_t::apply_matrix(
+        const float *mat, int rows, int cols, int in_idx, int out_idx) {
+    for (int i = 0; i < rows; i++) {
+        const Zmm out(out_idx + i);
+        bool is_first = true;
+        for (int j = 0; j < cols; j++) {
+            const float c = mat[i * cols + j];
+            if (c == 0.f) continue;
+            const Zmm in(in_idx + j);
+            if (is_first) {
+                if (c == 1.f)
+                    vmovaps(out, in);
+                else
+                    vmulps(out, in, coeff(c));
+                is_first = false;
+            } else if (c == 1.f)
+                vaddps(out, out, in);
+            else if (c == -1.f)
+                vsubps(out, out, in);
+            else
+                vfmadd231ps(out, in, coeff(c));
+        }
+        if (is_first) vpxord(out, out, out);
+    }
+}
+
+void jit_wino_trans_kernel_base_t::emit_coeffs() {
+    align(64);
+    L(l_coeffs_);
+    for (float c : coeffs_)
+        dd(float2int(c));
+}
+
+jit_avx512_core_wino_src_trans_t::jit_avx512_core_wino_src_trans_t(
+        const jit_brgemm_wino_conv_conf_t &jcp)
+    : jit_wino_trans_kernel_base_t(jit_name()), jcp_(jcp) {}
+
+void jit_avx512_core_wino_src_trans_t::load(
+        const Zmm &zmm, const Address &addr, bool tail) {
+    const Zmm zmm_in = tail ? zmm | k_load_ | T_z : zmm;
+    if (jcp_.src_dt == bf16) {
+        vpmovzxwd(zmm_in, addr);
+        vpslld(zmm, zmm, 16);
+    } else
+        vmovups(zmm_in, addr);
+}
+
+void jit_avx512_core_wino_src_trans_t::store(
+        const Address &addr, const Zmm &zmm, bool tail) {
+    if (jcp_.wino_dt == bf16) {
+        const Ymm ymm(zmm.getIdx());
+        vcvtneps2bf16(ymm, zmm);
+        if (tail)
+            vmovdqu16(addr | k_store_, ymm);
+        else
+            vmovdqu16(addr, ymm);
+    } else {
+        if (tail)
+            vmovups(addr | k_store_, zmm);
+        else
+            vmovups(addr, zmm);
+    }
+}
+
+// Transforms a vector of input channels of the tile. The rows are transformed
+// first and kept on the stack, then the columns.
+void jit_avx512_core_wino_src_trans_t::compute_vec(bool tail) {
+    const int alpha = jcp_.alpha;
+    const int vlen = cpu_isa_traits<avx512_core>::vlen;
+    const size_t wino_dt_size = types::data_type_size(jcp_.wino_dt);
+    const dim_t p_stride = jcp_.tile_block * jcp_.icp * wino_dt_size;
+    const float *BT = get_BT(jcp_.m);
+    const int in_idx = 0, out_idx = alpha;
+
+    mov(reg_row_, reg_src_);
+    for (int r = 0; r < alpha; r++) {
+        mov(reg_col_, reg_row_);
+        for (int c = 0; c < alpha; c++) {
+            load(Zmm(in_idx + c), ptr[reg_col_], tail);
+            if (c < alpha - 1) add(reg_col_, reg_col_stride_);
+        }
+        apply_matrix(BT, alpha, alpha, in_idx, out_idx);
+        for (int j = 0; j < alpha; j++)
+            vmovups(ptr[rsp + (r * alpha + j) * vlen], Zmm(out_idx + j));
+        if (r < alpha - 1) add(reg_row_, reg_row_stride_);
+    }
+
+    for (int j = 0; j < alpha; j++) {
+        for (int r = 0; r < alpha; r++)
+            vmovups(Zmm(in_idx + r), ptr[rsp + (r * alpha + j) * vlen]);
+        apply_matrix(BT, alpha, alpha, in_idx, out_idx);
+        for (int i = 0; i < alpha; i++)
+            store(ptr[reg_wino_ + (i * alpha + j) * p_stride],
+                    Zmm(out_idx + i), tail);
+    }
+}
+
+void jit_avx512_core_wino_src_trans_t::generate() {
+    const int alpha = jcp_.alpha;
+    const int stack_size = alpha * alpha * cpu_isa_traits<avx512_core>::vlen;
+
+    preamble();
+    sub(rsp, stack_size);
+    load_coeffs();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    mov(reg_src_, ptr[reg_param_ + PARAM_OFF(src)]);
+    mov(reg_wino_, ptr[reg_param_ + PARAM_OFF(wino_src)]);
+    mov(reg_row_stride_, ptr[reg_param_ + PARAM_OFF(row_stride)]);
+    mov(reg_col_stride_, ptr[reg_param_ + PARAM_OFF(col_stride)]);
+#undef PARAM_OFF
+
+    // The padding of the channels up to icp is filled with zeros: the load
+    // mask covers the ic channels and the store mask covers icp channels.
+    const dim_t nb_full = jcp_.ic / simd_w_;
+    const int load_tail = jcp_.ic % simd_w_;
+    const int store_tail = static_cast<int>(jcp_.icp - nb_full * simd_w_);
+    if (store_tail) {
+        mov(reg_tmp_.cvt32(), (1 << load_tail) - 1);
+        kmovw(k_load_, reg_tmp_.cvt32());
+        mov(reg_tmp_.cvt32(), (1 << store_tail) - 1);
+        kmovw(k_store_, reg_tmp_.cvt32());
+    }
+
+    if (nb_full > 0) {
+        Label l_loop;
+        mov(reg_cnt_, nb_full);
+        L(l_loop);
+        {
+            compute_vec(false);
+            add(reg_src_, simd_w_ * types::data_type_size(jcp_.src_dt));
+            add(reg_wino_, simd_w_ * types::data_type_size(jcp_.wino_dt));
+            dec(reg_cnt_);
+            jnz(l_loop, T_NEAR);
+        }
+    }
+    if (store_tail) compute_vec(true);
+
+    add(rsp, stack_size);
+    postamble();
+
+    emit_coeffs();
+}
+
+jit_avx512_core_wino_dst_trans_t::jit_avx512_core_wino_dst_trans_t(
+        const jit_brgemm_wino_conv_conf_t &jcp, const memory_desc_t &dst_md)
+    : jit_wino_trans_kernel_base_t(jit_name()), jcp_(jcp) {
+    if (jcp_.with_eltwise || jcp_.with_binary) {
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = true;
+        static constexpr size_t helper_vmm_idx = 31;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+        const size_t tail_size = jcp_.oc % simd_w_;
+        const binary_injector::rhs_arg_static_params_t rhs_arg_static_params {
+                helper_vmm_idx, r14, r15, rbx, preserve_gpr, preserve_vmm,
+                PARAM_OFF(post_ops_binary_rhs_arg_vec), PARAM_OFF(dst_orig),
+                memory_desc_wrapper(dst_md), tail_size, k_tail_,
+                use_exact_tail_scalar_bcast};
+        const binary_injector::static_params_t binary_static_params {
+                reg_param_, rhs_arg_static_params};
+        const eltwise_injector::static_params_t eltwise_static_params {
+                true, rax, k1};
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<avx512_core>>(this,
+                jcp_.post_ops, binary_static_params, eltwise_static_params);
+#undef PARAM_OFF
+    }
+}
+
+void jit_avx512_core_wino_dst_trans_t::load(
+        const Zmm &zmm, const Address &addr, data_type_t dt, bool tail) {
+    const Zmm zmm_in = tail ? zmm | k_tail_ | T_z : zmm;
+    if (dt == bf16) {
+        vpmovzxwd(zmm_in, addr);
+        vpslld(zmm, zmm, 16);
+    } else
+        vmovups(zmm_in, addr);
+}
+
+void jit_avx512_core_wino_dst_trans_t::store(
+        const Address &addr, const Zmm &zmm, bool tail) {
+    if (jcp_.dst_dt == bf16) {
+        const Ymm ymm(zmm.getIdx());
+        vcvtneps2bf16(ymm, zmm);
+        if (tail)
+            vmovdqu16(addr | k_tail_, ymm);
+        else
+            vmovdqu16(addr, ymm);
+    } else {
+        if (tail)
+            vmovups(addr | k_tail_, zmm);
+        else
+            vmovups(addr, zmm);
+    }
+}
+
+void jit_avx512_core_wino_dst_trans_t::apply_postops(int col, bool tail) {
+    if (!postops_injector_) return;
+
+    const size_t dst_dt_size = types::data_type_size(jcp_.dst_dt);
+    binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+    if (jcp_.with_binary) {
+        for (int r = 0; r < jcp_.m; r++) {
+            const size_t vmm_idx = out_idx_ + r;
+            rhs_arg_params.vmm_idx_to_out_reg.emplace(vmm_idx, reg_dst_);
+            rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(vmm_idx,
+                    (r * jcp_.dst_h_stride + col * jcp_.dst_w_stride)
+                            * dst_dt_size);
+            if (tail) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+        }
+    }
+    postops_injector_->compute_vector_range(
+            out_idx_, out_idx_ + jcp_.m, rhs_arg_params);
+}
+
+// Transforms a vector of output channels of the tile. The rows are transformed
+// first and kept on the stack, then the columns, which are stored to the
+// destination after the post-ops.
+void jit_avx512_core_wino_dst_trans_t::compute_vec(bool tail) {
+    const int m = jcp_.m;
+    const int alpha = jcp_.alpha;
+    const int vlen = cpu_isa_traits<avx512_core>::vlen;
+    const dim_t p_stride = jcp_.tile_block * jcp_.oc_block * sizeof(float);
+    const size_t dst_dt_size = types::data_type_size(jcp_.dst_dt);
+    const float *AT = get_AT(m);
+    const int in_idx = 0;
+
+    const auto dst_addr = [&](int r, int c) {
+        return ptr[reg_dst_
+                + (r * jcp_.dst_h_stride + c * jcp_.dst_w_stride)
+                        * dst_dt_size];
+    };
+
+    for (int i = 0; i < alpha; i++) {
+        for (int j = 0; j < alpha; j++) {
+            const Zmm zmm = tail ? Zmm(in_idx + j) | k_tail_ | T_z
+                                 : Zmm(in_idx + j);
+            vmovups(zmm, ptr[reg_wino_ + (i * alpha + j) * p_stride]);
+        }
+        apply_matrix(AT, m, alpha, in_idx, out_idx_);
+        for (int c = 0; c < m; c++)
+            vmovups(ptr[rsp + (i * m + c) * vlen], Zmm(out_idx_ + c));
+    }
+
+    if (jcp_.with_bias) load(zmm_bias_, ptr[reg_bias_], jcp_.bia_dt, tail);
+
+    for (int c = 0; c < m; c++) {
+        // The first row and column of a tile are always inside the image.
+        Label l_skip_col;
+        if (c > 0) {
+            cmp(reg_valid_w_, c);
+            jle(l_skip_col, T_NEAR);
+        }
+
+        for (int i = 0; i < alpha; i++)
+            vmovups(Zmm(in_idx + i), ptr[rsp + (i * m + c) * vlen]);
+        apply_matrix(AT, m, alpha, in_idx, out_idx_);
+
+        for (int r = 0; r < m; r++) {
+            const Zmm zmm_out(out_idx_ + r);
+            if (jcp_.with_bias) vaddps(zmm_out, zmm_out, zmm_bias_);
+            if (!jcp_.with_sum) continue;
+
+            Label l_skip_row;
+            if (r > 0) {
+                cmp(reg_valid_h_, r);
+                jle(l_skip_row, T_NEAR);
+            }
+            load(zmm_prev_dst_, dst_addr(r, c), jcp_.dst_dt, tail);
+            if (jcp_.sum_scale == 1.f)
+                vaddps(zmm_out, zmm_out, zmm_prev_dst_);
+            else
+                vfmadd231ps(zmm_out, zmm_prev_dst_, coeff(jcp_.sum_scale));
+            L(l_skip_row);
+        }
+
+        apply_postops(c, tail);
+
+        for (int r = 0; r < m; r++) {
+            Label l_skip_row;
+            if (r > 0) {
+                cmp(reg_valid_h_, r);
+                jle(l_skip_row, T_NEAR);
+            }
+            store(dst_addr(r, c), Zmm(out_idx_ + r), tail);
+            L(l_skip_row);
+        }
+
+        L(l_skip_col);
+    }
+}
+
+void jit_avx512_core_wino_dst_trans_t::generate() {
+    const int stack_size
+            = jcp_.alpha * jcp_.m * cpu_isa_traits<avx512_core>::vlen;
+    const size_t dst_dt_size = types::data_type_size(jcp_.dst_dt);
+    const size_t bia_dt_size
+            = jcp_.with_bias ? types::data_type_size(jcp_.bia_dt) : 0;
+
+    preamble();
+    sub(rsp, stack_size);
+    load_coeffs();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+    mov(reg_wino_, ptr[reg_param_ + PARAM_OFF(wino_dst)]);
+    mov(reg_dst_, ptr[reg_param_ + PARAM_OFF(dst)]);
+    if (jcp_.with_bias) mov(reg_bias_, ptr[reg_param_ + PARAM_OFF(bias)]);
+    mov(reg_oc_work_, ptr[reg_param_ + PARAM_OFF(oc_work)]);
+    mov(reg_valid_h_, ptr[reg_param_ + PARAM_OFF(valid_h)]);
+    mov(reg_valid_w_, ptr[reg_param_ + PARAM_OFF(valid_w)]);
+#undef PARAM_OFF
+
+    // Only the last block of channels may have a tail.
+    const int tail = jcp_.oc % simd_w_;
+    if (tail) {
+        mov(reg_tmp_.cvt32(), (1 << tail) - 1);
+        kmovw(k_tail_, reg_tmp_.cvt32());
+    }
+
+    Label l_loop, l_tail, l_end;
+    L(l_loop);
+    {
+        cmp(reg_oc_work_, simd_w_);
+        jl(l_tail, T_NEAR);
+        compute_vec(false);
+        add(reg_wino_, simd_w_ * sizeof(float));
+        add(reg_dst_, simd_w_ * dst_dt_size);
+        if (jcp_.with_bias) add(reg_bias_, simd_w_ * bia_dt_size);
+        sub(reg_oc_work_, simd_w_);
+        jmp(l_loop, T_NEAR);
+    }
+    L(l_tail);
+    if (tail) {
+        cmp(reg_oc_work_, 0);
+        jle(l_end, T_NEAR);
+        compute_vec(true);
+    }
+    L(l_end);
+
+    add(rsp, stack_size);
+    postamble();
+
+    if (jcp_.with_eltwise) postops_injector_->prepare_table();
+    emit_coeffs();
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,201 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_KERNEL_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_KERNEL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_brgemm_wino_conv_conf_t {
+    dim_t mb, ic, oc, ih, iw, oh, ow;
+    dim_t t_pad, l_pad;
+
+    // The output tile size of F(m x m, 3 x 3) and the input tile size,
+    // alpha = m + 2. Every point of the alpha x alpha transform domain is
+    // a separate GEMM: [tiles x icp] x [icp x oc].
+    int m, alpha;
+    dim_t tiles_h, tiles_w, nb_tiles;
+
+    // The number of tiles of an image transformed and multiplied at once,
+    // the M dimension of the GEMMs.
+    dim_t tile_block, nb_tile_blocks, tile_tail;
+    // The input channels padded to the VNNI granularity of the GEMMs.
+    dim_t icp;
+    dim_t oc_block, nb_oc, oc_tail;
+    // The output channel blocks are split between the threads when there
+    // are not enough tiles to keep all of them busy.
+    dim_t nb_oc_chunks;
+
+    // Strides of the activations in elements.
+    dim_t src_n_stride, src_h_stride, src_w_stride;
+    dim_t dst_n_stride, dst_h_stride, dst_w_stride;
+
+    data_type_t src_dt, wei_dt, bia_dt, dst_dt;
+    // The data type of the transformed source and weights.
+    data_type_t wino_dt;
+
+    bool with_bias, with_sum, with_eltwise, with_binary;
+    float sum_scale;
+    post_ops_t post_ops;
+
+    int nthr;
+};
+
+// Transforms the weights g of a pair of input and output channels into the
+// Winograd domain: u = G g G^T, where g is 3 x 3 and u is alpha x alpha.
+void wino_conv_transform_weights(int m, const float *g, float *u);
+
+// Common part of the transform kernels: emits multiplications by the
+// constant transform matrices.
+struct jit_wino_trans_kernel_base_t : public jit_generator {
+    jit_wino_trans_kernel_base_t(const char *name)
+        : jit_generator(name, nullptr, MAX_CODE_SIZE, true, avx512_core) {}
+
+protected:
+    static constexpr int simd_w_
+            = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+
+    const Xbyak::Reg64 reg_coeffs_ = rsi;
+
+    // Emits out(i) = sum_j mat[i][j] * in(j) for i < rows and j < cols, the
+    // matrix is row-major. The inputs and outputs are the registers starting
+    // from `in_idx` and `out_idx` respectively.
+    void apply_matrix(const float *mat, int rows, int cols, int in_idx,
+            int out_idx);
+    // Returns the broadcast operand of the coefficient `c`.
+    Xbyak::Address coeff(float c);
+
+    void load_coeffs() { mov(reg_coeffs_, l_coeffs_); }
+    void emit_coeffs();
+
+private:
+    std::vector<float> coeffs_;
+    Xbyak::Label l_coeffs_;
+};
+
+// Transforms an input tile d into the Winograd domain, V = B^T d B, for all
+// the input channels. The alpha x alpha points of V are written into
+// separate matrices of the transformed source, which are the A matrices of
+// the GEMMs.
+struct jit_avx512_core_wino_src_trans_t : public jit_wino_trans_kernel_base_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_wino_src_trans_t)
+
+    struct call_params_t {
+        const void *src;
+        void *wino_src;
+        // The strides between the rows and the columns of the tile, in
+        // bytes. They differ for the tiles copied to the padded buffer.
+        dim_t row_stride;
+        dim_t col_stride;
+    };
+
+    jit_avx512_core_wino_src_trans_t(const jit_brgemm_wino_conv_conf_t &jcp);
+
+private:
+    const jit_brgemm_wino_conv_conf_t &jcp_;
+
+    const Xbyak::Reg64 reg_param_ = abi_param1;
+    const Xbyak::Reg64 reg_src_ = r8;
+    const Xbyak::Reg64 reg_wino_ = r9;
+    const Xbyak::Reg64 reg_row_stride_ = r10;
+    const Xbyak::Reg64 reg_col_stride_ = r11;
+    const Xbyak::Reg64 reg_row_ = r12;
+    const Xbyak::Reg64 reg_col_ = r13;
+    const Xbyak::Reg64 reg_cnt_ = r14;
+    const Xbyak::Reg64 reg_tmp_ = rax;
+
+    const Xbyak::Opmask k_load_ = k1;
+    const Xbyak::Opmask k_store_ = k2;
+
+    void load(const Xbyak::Zmm &zmm, const Xbyak::Address &addr, bool tail);
+    void store(const Xbyak::Address &addr, const Xbyak::Zmm &zmm, bool tail);
+    void compute_vec(bool tail);
+
+    void generate() override;
+};
+
+// Transforms a tile of the GEMM results back, Y = A^T M A, and applies the
+// bias and the post-ops to the m x m output points. The points outside the
+// output image are neither read nor written.
+struct jit_avx512_core_wino_dst_trans_t : public jit_wino_trans_kernel_base_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_wino_dst_trans_t)
+
+    struct call_params_t {
+        const float *wino_dst;
+        void *dst;
+        const void *bias;
+        // The number of output channels to process.
+        dim_t oc_work;
+        // The number of rows and columns of the tile inside the image.
+        dim_t valid_h;
+        dim_t valid_w;
+        const void *post_ops_binary_rhs_arg_vec;
+        const void *dst_orig;
+    };
+
+    jit_avx512_core_wino_dst_trans_t(const jit_brgemm_wino_conv_conf_t &jcp,
+            const memory_desc_t &dst_md);
+
+private:
+    const jit_brgemm_wino_conv_conf_t &jcp_;
+
+    const Xbyak::Reg64 reg_param_ = abi_param1;
+    const Xbyak::Reg64 reg_wino_ = r8;
+    const Xbyak::Reg64 reg_dst_ = r9;
+    const Xbyak::Reg64 reg_bias_ = r10;
+    const Xbyak::Reg64 reg_oc_work_ = r11;
+    const Xbyak::Reg64 reg_valid_h_ = r12;
+    const Xbyak::Reg64 reg_valid_w_ = r13;
+    const Xbyak::Reg64 reg_tmp_ = rdx;
+
+    const Xbyak::Opmask k_tail_ = k2;
+    const Xbyak::Zmm zmm_prev_dst_ = Xbyak::Zmm(16);
+    const Xbyak::Zmm zmm_bias_ = Xbyak::Zmm(30);
+
+    // The registers holding the output points of a column of the tile.
+    static constexpr int out_idx_ = 8;
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<avx512_core>>
+            postops_injector_;
+
+    void load(const Xbyak::Zmm &zmm, const Xbyak::Address &addr,
+            data_type_t dt, bool tail);
+    void store(const Xbyak::Address &addr, const Xbyak::Zmm &zmm, bool tail);
+    void apply_postops(int col, bool tail);
+    void compute_vec(bool tail);
+
+    void generate() override;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
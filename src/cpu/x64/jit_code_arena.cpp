@@ -0,0 +1,223 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+#include <map>
+#include <mutex>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_code_arena.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace jit_code_arena {
+
+namespace {
+
+enum class mode_t { disabled = 0, enabled = 1, huge_pages = 2 };
+
+mode_t get_mode() {
+    static const mode_t mode = [] {
+        const int val = getenv_int_user("JIT_CODE_ARENA", 1);
+        return utils::one_of(val, 0, 1, 2) ? static_cast<mode_t>(val)
+                                           : mode_t::enabled;
+    }();
+    return mode;
+}
+
+// The size of a huge page.
+constexpr size_t block_size = 2 * 1024 * 1024;
+// Larger kernels keep their own code buffer to bound the space wasted at the
+// end of a block.
+constexpr size_t max_code_size = block_size / 8;
+// Kernels start at a cache line boundary as they do in separate buffers.
+constexpr size_t code_alignment = 64;
+
+#ifdef __linux__
+uint8_t *map_block(bool use_huge_pages) {
+    const int prot = PROT_READ | PROT_WRITE | PROT_EXEC;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (!use_huge_pages) {
+        void *p = mmap(nullptr, block_size, prot, flags, -1, 0);
+        return p == MAP_FAILED ? nullptr : static_cast<uint8_t *>(p);
+    }
+
+    // Transparent huge pages require the block to be aligned to its size, so
+    // twice as much is mapped and the unaligned head and tail are returned.
+    void *p = mmap(nullptr, 2 * block_size, prot, flags, -1, 0);
+    if (p == MAP_FAILED) return nullptr;
+    uint8_t *raw = static_cast<uint8_t *>(p);
+    uint8_t *base = reinterpret_cast<uint8_t *>(
+            utils::rnd_up(reinterpret_cast<uintptr_t>(raw), block_size));
+    if (base != raw) munmap(raw, base - raw);
+    munmap(base + block_size, raw + block_size - base);
+#ifdef MADV_HUGEPAGE
+    madvise(base, block_size, MADV_HUGEPAGE);
+#endif
+    return base;
+}
+
+void unmap_block(uint8_t *base) {
+    munmap(base, block_size);
+}
+#else
+uint8_t *map_block(bool) {
+    return nullptr;
+}
+
+void unmap_block(uint8_t *) {}
+#endif
+
+struct arena_t {
+    uint8_t *alloc(size_t size) {
+        size = utils::rnd_up(size, code_alignment);
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        // The space released by destroyed kernels is reused first.
+        for (auto &b : blocks_) {
+            uint8_t *code = b.second.take_hole(size);
+            if (code) return code;
+        }
+
+        if (current_ == nullptr || current_->used + size > block_size) {
+            uint8_t *base = map_block(get_mode() == mode_t::huge_pages);
+            if (base == nullptr) return nullptr;
+            // The previous block is kept until its last kernel is released.
+            release_if_unused(current_);
+            current_ = &blocks_[reinterpret_cast<uintptr_t>(base)];
+            current_->base = base;
+        }
+
+        uint8_t *code = current_->base + current_->used;
+        current_->used += size;
+        current_->kernels[code] = size;
+        return code;
+    }
+
+    void free(uint8_t *code) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = blocks_.upper_bound(reinterpret_cast<uintptr_t>(code));
+        assert(it != blocks_.begin());
+        block_t &block = (--it)->second;
+        auto kernel = block.kernels.find(code);
+        assert(kernel != block.kernels.end());
+        const size_t size = kernel->second;
+        block.kernels.erase(kernel);
+
+        if (!block.kernels.empty()) {
+            block.add_hole(code, size);
+        } else if (&block == current_) {
+            // The current block is filled again from the beginning.
+            block.used = 0;
+            block.holes.clear();
+        } else {
+            release_if_unused(&block);
+        }
+    }
+
+private:
+    struct block_t {
+        uint8_t *base = nullptr;
+        // The size of the space given out from the beginning of the block.
+        size_t used = 0;
+        // The sizes of the kernels by their addresses.
+        std::map<uint8_t *, size_t> kernels;
+        // The sizes of the released ranges below `used` by their addresses.
+        std::map<uint8_t *, size_t> holes;
+
+        // Places a kernel in the first hole it fits in.
+        uint8_t *take_hole(size_t size) {
+            for (auto it = holes.begin(); it != holes.end(); ++it) {
+                if (it->second < size) continue;
+                uint8_t *code = it->first;
+                const size_t rest = it->second - size;
+                holes.erase(it);
+                if (rest > 0) holes[code + size] = rest;
+                kernels[code] = size;
+                return code;
+            }
+            return nullptr;
+        }
+
+        // Merges the released range with the adjacent holes, so that large
+        // kernels can be placed in the space of several small ones.
+        void add_hole(uint8_t *code, size_t size) {
+            auto next = holes.find(code + size);
+            if (next != holes.end()) {
+                size += next->second;
+                holes.erase(next);
+            }
+            auto prev = holes.lower_bound(code);
+            if (prev != holes.begin()) {
+                --prev;
+                if (prev->first + prev->second == code) {
+                    code = prev->first;
+                    size += prev->second;
+                    holes.erase(prev);
+                }
+            }
+            if (code + size == base + used)
+                used = static_cast<size_t>(code - base);
+            else
+                holes[code] = size;
+        }
+    };
+
+    void release_if_unused(block_t *block) {
+        if (block == nullptr || !block->kernels.empty()) return;
+        unmap_block(block->base);
+        blocks_.erase(reinterpret_cast<uintptr_t>(block->base));
+    }
+
+    std::mutex mutex_;
+    // Blocks by their base addresses, to find the block of a kernel.
+    std::map<uintptr_t, block_t> blocks_;
+    // The block new kernels are placed in when they fit in no hole.
+    block_t *current_ = nullptr;
+};
+
+arena_t &arena() {
+    // The arena is never destroyed since kernels owned by static objects may
+    // be destroyed after it.
+    static arena_t *instance = new arena_t();
+    return *instance;
+}
+
+} // namespace
+
+uint8_t *alloc(size_t size) {
+    if (get_mode() == mode_t::disabled) return nullptr;
+    if (size == 0 || size > max_code_size) return nullptr;
+    return arena().alloc(size);
+}
+
+void free(uint8_t *code) {
+    if (code == nullptr) return;
+    arena().free(code);
+}
+
+} // namespace jit_code_arena
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_CODE_ARENA_HPP
+#define CPU_X64_JIT_CODE_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// The jit code arena packs the code of finished kernels into large shared
+// executable blocks instead of a separate mapping per kernel. This removes
+// mostly empty pages and reduces iTLB pressure when many small kernels are
+// alive. The space of a destroyed kernel, e.g. of a primitive evicted from the
+// primitive cache, is reused by new kernels, and a block is unmapped when the
+// last kernel placed in it is destroyed.
+//
+// The arena is controlled by the ONEDNN_JIT_CODE_ARENA environment variable:
+// - 0: disabled, every kernel keeps its own code buffer;
+// - 1: enabled (default);
+// - 2: enabled, blocks are backed by transparent huge pages when possible.
+namespace jit_code_arena {
+
+// Returns a readable, writable and executable buffer of `size` bytes aligned
+// to a cache line, or nullptr if the arena is disabled, the kernel is too
+// large to be packed, or the memory cannot be mapped.
+uint8_t DNNL_API *alloc(size_t size);
+
+// Releases a buffer returned by alloc().
+void DNNL_API free(uint8_t *code);
+
+} // namespace jit_code_arena
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
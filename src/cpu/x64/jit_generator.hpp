@@ -18,6 +18,7 @@
 #define CPU_X64_JIT_GENERATOR_HPP
 
 #include <limits.h>
+#include <cstring>
 #include <vector>
 
 #include "common/bit_cast.hpp"
@@ -26,6 +27,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_code_arena.hpp"
 
 #include "cpu/jit_utils/jit_utils.hpp"
 
@@ -2655,7 +2657,20 @@ public:
                   /*allocator=*/this)
         , max_cpu_isa_(max_cpu_isa) {}
 
-    virtual ~jit_generator() {}
+    virtual ~jit_generator() {
+        if (code_in_arena_) {
+            jit_code_arena::free(top_);
+            // Nothing is left for the Xbyak::CodeArray destructor to release.
+            top_ = nullptr;
+            maxSize_ = 0;
+        }
+    }
+
+    // The arena memory is executable for its whole lifetime, so its
+    // protection must not be changed on behalf of a single kernel.
+    bool useProtect() const override {
+        return !code_in_arena_ && Xbyak::MmapAllocator::useProtect();
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
@@ -2674,6 +2689,11 @@ public:
     }
 
     virtual status_t create_kernel() {
+        // Some kernels are created by both their constructor and their owner.
+        // The code is generated once: a second pass would only append code
+        // that is never called, and the code moved to the jit code arena
+        // cannot grow.
+        if (jit_ker_) return status::success;
         int err_code = Xbyak::GetError();
         if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
         if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
@@ -2684,7 +2704,24 @@ public:
 
 private:
     const cpu_isa_t max_cpu_isa_;
+    bool code_in_arena_ = false;
+
+    // Moves the generated code from its own buffer to the shared jit code
+    // arena. Only auto-grow buffers are moved: their absolute addresses are
+    // resolved by ready(), so the code does not depend on its location yet.
+    void move_code_to_arena() {
+        if (!isAutoGrow() || hasUndefinedLabel() || !is_initialized()) return;
+        uint8_t *code = jit_code_arena::alloc(size_);
+        if (code == nullptr) return;
+        std::memcpy(code, top_, size_);
+        Xbyak::MmapAllocator::free(top_);
+        top_ = code;
+        maxSize_ = size_;
+        code_in_arena_ = true;
+    }
+
     const Xbyak::uint8 *getCode() {
+        move_code_to_arena();
         this->ready();
         if (!is_initialized()) return nullptr;
         const Xbyak::uint8 *code = CodeGenerator::getCode();
@@ -0,0 +1,678 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_group_normalization.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+using namespace data_type;
+using namespace Xbyak;
+
+namespace {
+
+cpu_isa_t get_gnorm_isa() {
+    return mayiuse(avx512_core) ? avx512_core : avx2;
+}
+
+cpu_isa_t get_gnorm_io_isa(cpu_isa_t isa, bool has_f16, bool has_bf16) {
+    // The same choice as in the layer normalization kernels: xf16 data on
+    // avx2 relies on avx2_vnni_2 conversions.
+    if (!(has_f16 || has_bf16)) return isa;
+    if (!is_superset(isa, avx512_core)) return avx2_vnni_2;
+    return has_f16 ? avx512_core_fp16
+                   : mayiuse(avx512_core_bf16) ? avx512_core_bf16
+                                               : avx512_core;
+}
+
+bool is_nspc(const group_normalization_pd_t *pd) {
+    using namespace format_tag;
+    const auto tag = utils::pick(pd->ndims() - 2, nc, nwc, nhwc, ndhwc);
+    return memory_desc_wrapper(pd->src_md()).matches_tag(tag);
+}
+
+} // namespace
+
+// Code generator shared by the statistics and data kernels. Both kernels walk
+// `rows` rows of `len_` dense elements: a single channel of the spatial
+// dimension with the plain layout or all channels of a spatial point with the
+// channels-last layout.
+//
+// The statistics are collected in a single pass over the data. To avoid the
+// cancellation of E[x^2] - E[x]^2 the kernel accumulates the sums of
+// d = x - k and d^2, where k is a value of the group (its first element)
+// which is close to the mean for real data.
+template <cpu_isa_t isa>
+struct jit_gnorm_generator_t : public jit_generator {
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    struct stat_args_t {
+        const void *src;
+        const float *pivot;
+        float *sum;
+        float *sum_sq;
+        size_t rows;
+    };
+
+    struct data_args_t {
+        const void *src;
+        void *dst;
+        const float *mean;
+        const float *a;
+        const float *b;
+        const float *dst_scales;
+        size_t rows;
+    };
+
+    jit_gnorm_generator_t(const char *name, const group_normalization_pd_t *pd)
+        : jit_generator(name, nullptr, MAX_CODE_SIZE, true, isa)
+        , gen_pd_(pd)
+        , src_dt_(pd->src_md()->data_type)
+        , dst_dt_(pd->dst_md()->data_type)
+        , is_nspc_(is_nspc(pd))
+        , simd_w_(vlen_ / sizeof(float))
+        , len_(is_nspc_ ? pd->C() : pd->SP())
+        , tail_(len_ % simd_w_) {
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx_,
+                vmm_tail_mask_.getIdx(), reg_tmp_);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
+                bf16_emu_zmm_2_idx_, bf16_emu_zmm_3_idx_, reg_tmp_,
+                bf16_emu_zmm_4_idx_);
+        const auto io_isa = get_gnorm_io_isa(isa,
+                utils::one_of(f16, src_dt_, dst_dt_),
+                utils::one_of(bf16, src_dt_, dst_dt_));
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {src_dt_, dst_dt_, f32}, io_conf, io_tail_conf, io_bf16_conf);
+    }
+
+protected:
+    static constexpr int unroll_ = 4;
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    const AddressFrame &vmmword = (isa == avx2) ? yword : zword;
+
+    const group_normalization_pd_t *gen_pd_;
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+    const bool is_nspc_;
+    const dim_t simd_w_;
+    const dim_t len_;
+    const dim_t tail_;
+
+    const Reg64 reg_param_ = abi_param1;
+    const Reg64 reg_src_ = r8;
+    const Reg64 reg_dst_ = r9;
+    // Per-channel parameters: the pivot in the statistics kernel and the
+    // multiplier in the data kernel.
+    const Reg64 reg_a_ = r10;
+    // The sums in the statistics kernel and the addend in the data kernel.
+    const Reg64 reg_b_ = r11;
+    // The sums of squares in the statistics kernel and the means in the data
+    // kernel.
+    const Reg64 reg_sum_sq_ = r15;
+    const Reg64 reg_mean_ = r15;
+    const Reg64 reg_rows_ = r12;
+    const Reg64 reg_idx_ = r13;
+    const Reg64 reg_tmp_ = r14;
+    const Reg64 reg_table_ = rbx;
+
+    const Vmm vmm_tail_mask_ = Vmm(0);
+    const Vmm vmm_a_ = Vmm(13);
+    const Vmm vmm_b_ = Vmm(14);
+    const Vmm vmm_tmp_ = Vmm(15);
+    // The accumulators are not used by the data kernel.
+    const Vmm vmm_dst_scale_ = Vmm(1 + unroll_);
+    const Vmm vmm_mean_ = Vmm(1 + unroll_ + 1);
+
+    const int bf16_emu_zmm_1_idx_ = 28;
+    const int bf16_emu_zmm_2_idx_ = 29;
+    const int bf16_emu_zmm_3_idx_ = 30;
+    const int bf16_emu_zmm_4_idx_ = 31;
+    const int tail_opmask_idx_ = 1;
+    const int injector_opmask_idx_ = 2;
+
+    Vmm vmm_x(int i) const { return Vmm(1 + i); }
+    Vmm vmm_sum(int i) const { return Vmm(1 + unroll_ + i); }
+    Vmm vmm_sum_sq(int i) const { return Vmm(1 + 2 * unroll_ + i); }
+
+    Address data_addr(const Reg64 &base, data_type_t dt, dim_t off) const {
+        const int dt_size = static_cast<int>(types::data_type_size(dt));
+        return vmmword[base + reg_idx_ * dt_size + off * dt_size];
+    }
+    Address src_addr(dim_t off) const {
+        return data_addr(reg_src_, src_dt_, off);
+    }
+    Address dst_addr(dim_t off) const {
+        return data_addr(reg_dst_, dst_dt_, off);
+    }
+    Address a_addr(dim_t off) const { return data_addr(reg_a_, f32, off); }
+    Address b_addr(dim_t off) const { return data_addr(reg_b_, f32, off); }
+    Address mean_addr(dim_t off) const {
+        return data_addr(reg_mean_, f32, off);
+    }
+    Address sum_sq_addr(dim_t off) const {
+        return data_addr(reg_sum_sq_, f32, off);
+    }
+
+    // Calls `block(n_vecs, off, tail)` to process a row, `off` is the offset
+    // of the first vector of the block relative to `reg_idx_`.
+    template <typename F>
+    void loop_over_row(F block) {
+        const dim_t n_full = len_ / simd_w_;
+        const dim_t len_unrolled = utils::rnd_dn(n_full, unroll_) * simd_w_;
+        const int n_rem = static_cast<int>(n_full % unroll_);
+
+        xor_(reg_idx_, reg_idx_);
+        if (len_unrolled > 0) {
+            Label unroll_loop;
+            L(unroll_loop);
+            block(unroll_, 0, false);
+            add(reg_idx_, unroll_ * simd_w_);
+            cmp(reg_idx_, len_unrolled);
+            jl(unroll_loop, T_NEAR);
+        }
+        if (n_rem > 0) block(n_rem, 0, false);
+        if (tail_ > 0) block(1, n_rem * simd_w_, true);
+    }
+
+    void zero_tail(const Vmm &vmm) {
+        if (is_superset(isa, avx512_core))
+            vmovups(vmm | Opmask(tail_opmask_idx_) | T_z, vmm);
+        else
+            uni_vandps(vmm, vmm, vmm_tail_mask_);
+    }
+
+    // Horizontal sum, the result is in the lowest element.
+    void reduce(const Vmm &vmm, const Vmm &vmm_tmp) {
+        if (is_superset(isa, avx512_core)) {
+            vshuff32x4(vmm_tmp, vmm, vmm, 0x4E); // 256-bit shuffle
+            vaddps(vmm, vmm, vmm_tmp);
+            vshuff32x4(vmm_tmp, vmm, vmm, 0xB1); // 128/256-bit shuffle
+            vaddps(vmm, vmm, vmm_tmp);
+        } else {
+            vperm2f128(vmm_tmp, vmm, vmm, 0x1); // 128/256-bit shuffle
+            vaddps(vmm, vmm, vmm_tmp);
+        }
+        vshufps(vmm_tmp, vmm, vmm, 0x4E); // 64/128-bit shuffle
+        vaddps(vmm, vmm, vmm_tmp);
+        vshufps(vmm_tmp, vmm, vmm, 0xB1); // 32/64-bit shuffle
+        vaddps(vmm, vmm, vmm_tmp);
+    }
+
+    void accumulate(int i, dim_t off, bool tail) {
+        const Vmm vmm_src = vmm_x(i);
+        const Vmm vmm_s = vmm_sum(i);
+        const Vmm vmm_sq = vmm_sum_sq(i);
+        if (is_nspc_) {
+            io_[f32]->load(a_addr(off), vmm_tmp_, tail);
+            uni_vsubps(vmm_src, vmm_src, vmm_tmp_);
+            io_[f32]->load(b_addr(off), vmm_s, tail);
+            io_[f32]->load(sum_sq_addr(off), vmm_sq, tail);
+        } else {
+            uni_vsubps(vmm_src, vmm_src, vmm_a_);
+            // Elements past the tail must not contribute to the sums.
+            if (tail) zero_tail(vmm_src);
+        }
+
+        uni_vaddps(vmm_s, vmm_s, vmm_src);
+        uni_vfmadd231ps(vmm_sq, vmm_src, vmm_src);
+
+        if (is_nspc_) {
+            io_[f32]->store(vmm_s, b_addr(off), tail);
+            io_[f32]->store(vmm_sq, sum_sq_addr(off), tail);
+        }
+    }
+
+    // Reduces `unroll_` accumulators starting from `vmm` and adds the result
+    // to the value at `addr`.
+    void store_sum(const Address &addr, const Vmm &vmm) {
+        const Xmm xmm = Xmm(vmm.getIdx());
+        for (int i = 1; i < unroll_; i++)
+            uni_vaddps(vmm, vmm, Vmm(vmm.getIdx() + i));
+        reduce(vmm, vmm_tmp_);
+        uni_vaddss(xmm, xmm, addr);
+        uni_vmovss(addr, xmm);
+    }
+
+    void generate_stat() {
+        const int dt_size = types::data_type_size(src_dt_);
+
+        preamble();
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(stat_args_t, x)
+        mov(reg_src_, ptr[reg_param_ + PARAM_OFF(src)]);
+        mov(reg_a_, ptr[reg_param_ + PARAM_OFF(pivot)]);
+        mov(reg_b_, ptr[reg_param_ + PARAM_OFF(sum)]);
+        mov(reg_sum_sq_, ptr[reg_param_ + PARAM_OFF(sum_sq)]);
+        mov(reg_rows_, ptr[reg_param_ + PARAM_OFF(rows)]);
+#undef PARAM_OFF
+
+        if (!is_nspc_) {
+            for (int i = 0; i < unroll_; i++) {
+                uni_vpxor(vmm_sum(i), vmm_sum(i), vmm_sum(i));
+                uni_vpxor(vmm_sum_sq(i), vmm_sum_sq(i), vmm_sum_sq(i));
+            }
+            uni_vbroadcastss(vmm_a_, ptr[reg_a_]);
+        }
+
+        Label row_loop;
+        L(row_loop);
+        {
+            loop_over_row([&](int n_vecs, dim_t off, bool tail) {
+                for (int i = 0; i < n_vecs; i++)
+                    io_[src_dt_]->load(
+                            src_addr(off + i * simd_w_), vmm_x(i), tail);
+                for (int i = 0; i < n_vecs; i++)
+                    accumulate(i, off + i * simd_w_, tail);
+            });
+            add(reg_src_, len_ * dt_size);
+            dec(reg_rows_);
+            jnz(row_loop, T_NEAR);
+        }
+
+        if (!is_nspc_) {
+            store_sum(ptr[reg_b_], vmm_sum(0));
+            store_sum(ptr[reg_sum_sq_], vmm_sum_sq(0));
+        }
+
+        postamble();
+    }
+
+    void compute_dst(int n_vecs, dim_t off, bool tail) {
+        for (int i = 0; i < n_vecs; i++)
+            io_[src_dt_]->load(src_addr(off + i * simd_w_), vmm_x(i), tail);
+
+        for (int i = 0; i < n_vecs; i++) {
+            const Vmm vmm_dst = vmm_x(i);
+            if (is_nspc_) {
+                io_[f32]->load(mean_addr(off + i * simd_w_), vmm_mean_, tail);
+                io_[f32]->load(a_addr(off + i * simd_w_), vmm_a_, tail);
+                io_[f32]->load(b_addr(off + i * simd_w_), vmm_b_, tail);
+            }
+            uni_vsubps(vmm_dst, vmm_dst, vmm_mean_);
+            uni_vfmadd213ps(vmm_dst, vmm_a_, vmm_b_);
+        }
+
+        for (auto &injector : eltwise_injectors_)
+            injector->compute_vector_range(
+                    vmm_x(0).getIdx(), vmm_x(n_vecs).getIdx());
+
+        for (int i = 0; i < n_vecs; i++) {
+            const Vmm vmm_dst = vmm_x(i);
+            uni_vmulps(vmm_dst, vmm_dst, vmm_dst_scale_);
+            io_[dst_dt_]->store(vmm_dst, dst_addr(off + i * simd_w_), tail);
+        }
+    }
+
+    void generate_data() {
+        const int src_dt_size = types::data_type_size(src_dt_);
+        const int dst_dt_size = types::data_type_size(dst_dt_);
+
+        // Only eltwise post-ops are dispatched to this kernel.
+        const auto &post_ops = gen_pd_->attr()->post_ops_;
+        eltwise_injectors_.clear();
+        for (int i = 0; i < post_ops.len(); i++)
+            eltwise_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this,
+                            post_ops.entry_[i].eltwise, true, reg_table_,
+                            Opmask(injector_opmask_idx_)));
+
+        preamble();
+        io_.init_bf16();
+        if (tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(data_args_t, x)
+        mov(reg_src_, ptr[reg_param_ + PARAM_OFF(src)]);
+        mov(reg_dst_, ptr[reg_param_ + PARAM_OFF(dst)]);
+        mov(reg_mean_, ptr[reg_param_ + PARAM_OFF(mean)]);
+        mov(reg_a_, ptr[reg_param_ + PARAM_OFF(a)]);
+        mov(reg_b_, ptr[reg_param_ + PARAM_OFF(b)]);
+        mov(reg_rows_, ptr[reg_param_ + PARAM_OFF(rows)]);
+        mov(reg_tmp_, ptr[reg_param_ + PARAM_OFF(dst_scales)]);
+#undef PARAM_OFF
+
+        uni_vbroadcastss(vmm_dst_scale_, ptr[reg_tmp_]);
+        if (!is_nspc_) {
+            uni_vbroadcastss(vmm_mean_, ptr[reg_mean_]);
+            uni_vbroadcastss(vmm_a_, ptr[reg_a_]);
+            uni_vbroadcastss(vmm_b_, ptr[reg_b_]);
+        }
+
+        Label row_loop;
+        L(row_loop);
+        {
+            loop_over_row([&](int n_vecs, dim_t off, bool tail) {
+                compute_dst(n_vecs, off, tail);
+            });
+            add(reg_src_, len_ * src_dt_size);
+            add(reg_dst_, len_ * dst_dt_size);
+            dec(reg_rows_);
+            jnz(row_loop, T_NEAR);
+        }
+
+        postamble();
+
+        for (auto &injector : eltwise_injectors_)
+            injector->prepare_table();
+    }
+};
+
+template <cpu_isa_t isa>
+struct jit_gnorm_stat_kernel_t : public gnorm_stat_kernel_t,
+                                 public jit_gnorm_generator_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_gnorm_stat_kernel_t);
+
+    using generator_t = jit_gnorm_generator_t<isa>;
+
+    jit_gnorm_stat_kernel_t(const group_normalization_pd_t *pd)
+        : gnorm_stat_kernel_t(pd), generator_t(jit_name(), pd) {}
+
+    void operator()(const void *src, const float *pivot, float *sum,
+            float *sum_sq, size_t rows) const override {
+        typename generator_t::stat_args_t args;
+        args.src = src;
+        args.pivot = pivot;
+        args.sum = sum;
+        args.sum_sq = sum_sq;
+        args.rows = rows;
+        jit_generator::operator()(&args);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    void generate() override { this->generate_stat(); }
+};
+
+template <cpu_isa_t isa>
+struct jit_gnorm_data_kernel_t : public gnorm_data_kernel_t,
+                                 public jit_gnorm_generator_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_gnorm_data_kernel_t);
+
+    using generator_t = jit_gnorm_generator_t<isa>;
+
+    jit_gnorm_data_kernel_t(const group_normalization_pd_t *pd)
+        : gnorm_data_kernel_t(pd), generator_t(jit_name(), pd) {}
+
+    void operator()(const void *src, void *dst, const float *mean,
+            const float *a, const float *b, const float *dst_scales,
+            size_t rows) const override {
+        typename generator_t::data_args_t args;
+        args.src = src;
+        args.dst = dst;
+        args.mean = mean;
+        args.a = a;
+        args.b = b;
+        args.dst_scales = dst_scales;
+        args.rows = rows;
+        jit_generator::operator()(&args);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    void generate() override { this->generate_data(); }
+};
+
+gnorm_stat_kernel_t *gnorm_stat_kernel_t::create(
+        const group_normalization_pd_t *pd) {
+    if (get_gnorm_isa() == avx512_core)
+        return new jit_gnorm_stat_kernel_t<avx512_core>(pd);
+    return new jit_gnorm_stat_kernel_t<avx2>(pd);
+}
+
+gnorm_data_kernel_t *gnorm_data_kernel_t::create(
+        const group_normalization_pd_t *pd) {
+    if (get_gnorm_isa() == avx512_core)
+        return new jit_gnorm_data_kernel_t<avx512_core>(pd);
+    return new jit_gnorm_data_kernel_t<avx2>(pd);
+}
+
+status_t jit_uni_group_normalization_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const bool ok = is_fwd() && !has_zero_dim_memory() && mayiuse(avx2)
+            && utils::one_of(src_md()->data_type, f32, bf16, f16)
+            && utils::one_of(dst_md()->data_type, f32, bf16, f16)
+            && IMPLICATION(
+                    utils::one_of(bf16, src_md()->data_type,
+                            dst_md()->data_type),
+                    mayiuse(avx512_core) || mayiuse(avx2_vnni_2))
+            && IMPLICATION(
+                    utils::one_of(f16, src_md()->data_type,
+                            dst_md()->data_type),
+                    mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2))
+            && stat_md()->data_type == f32 && check_scale_shift_data_type()
+            && attr()->has_default_values(
+                    skip_mask_t::scales_runtime | skip_mask_t::post_ops)
+            && attr_scales_ok() && post_ops_ok()
+            && set_default_formats_common()
+            && attr_.set_default_formats(dst_md(0)) == status::success;
+    if (!ok) return status::unimplemented;
+
+    // The kernels work with dense plain or channels-last data only and the
+    // statistics are addressed as a dense {N, G} array.
+    const auto ncsp_tag = utils::pick(ndims() - 2, nc, ncw, nchw, ncdhw);
+    const auto nspc_tag = utils::pick(ndims() - 2, nc, nwc, nhwc, ndhwc);
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    is_nspc_ = is_nspc(this);
+    const auto tag = is_nspc_ ? nspc_tag : ncsp_tag;
+    if (!(src_d.matches_tag(tag) && dst_d.matches_tag(tag)))
+        return status::unimplemented;
+    if (!stats_are_tmp()
+            && !memory_desc_wrapper(stat_md()).matches_tag(format_tag::ab))
+        return status::unimplemented;
+
+    if (is_nspc_) {
+        const dim_t nthr = dnnl_get_max_threads();
+        const dim_t n_chunks = nstl::max<dim_t>(
+                1, nstl::min<dim_t>(SP(), utils::div_up(nthr, MB())));
+        sp_chunk_ = utils::div_up(SP(), n_chunks);
+        n_sp_chunks_ = utils::div_up(SP(), sp_chunk_);
+    } else {
+        sp_chunk_ = SP();
+        n_sp_chunks_ = 1;
+    }
+
+    init_scratchpad();
+    return status::success;
+}
+
+bool jit_uni_group_normalization_fwd_t::pd_t::post_ops_ok() const {
+    const auto &post_ops = attr()->post_ops_;
+    for (int i = 0; i < post_ops.len(); i++) {
+        const auto &e = post_ops.entry_[i];
+        if (!e.is_eltwise()
+                || !eltwise_injector::is_supported(
+                        get_gnorm_isa(), e.eltwise.alg))
+            return false;
+    }
+    return true;
+}
+
+void jit_uni_group_normalization_fwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    if (stats_are_tmp()) {
+        scratchpad.template book<float>(key_gnorm_tmp_mean, MB() * G());
+        scratchpad.template book<float>(key_gnorm_tmp_var, MB() * G());
+    }
+    if (!stats_are_src())
+        scratchpad.template book<float>(
+                key_gnorm_reduction, 2 * MB() * n_sp_chunks_ * C());
+    scratchpad.template book<float>(key_gnorm_tmp_scaleshift, 3 * MB() * C());
+}
+
+status_t jit_uni_group_normalization_fwd_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(stat_kernel_, gnorm_stat_kernel_t::create(pd())));
+    CHECK(safe_ptr_assign(data_kernel_, gnorm_data_kernel_t::create(pd())));
+    CHECK(stat_kernel_->create_kernel());
+    CHECK(data_kernel_->create_kernel());
+    return status::success;
+}
+
+status_t jit_uni_group_normalization_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+    auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
+
+    float *mean, *variance;
+    if (pd()->stats_are_tmp()) {
+        mean = scratchpad.template get<float>(key_gnorm_tmp_mean);
+        variance = scratchpad.template get<float>(key_gnorm_tmp_var);
+    } else {
+        mean = pd()->stats_are_src()
+                ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+                : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+        variance = pd()->stats_are_src()
+                ? const_cast<float *>(
+                        CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+                : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+    }
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t Cg = pd()->C_per_group();
+    const dim_t SP = pd()->SP();
+    const bool is_nspc = pd()->is_nspc_;
+    const dim_t sp_chunk = pd()->sp_chunk_;
+    const dim_t n_sp_chunks = pd()->n_sp_chunks_;
+    const size_t src_dt_size = types::data_type_size(pd()->src_md()->data_type);
+    const size_t dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
+    const float eps = pd()->desc()->group_norm_epsilon;
+
+    // Per-channel multipliers, addends and means applied by the data kernel.
+    // The multipliers also keep the per-channel pivots for the statistics
+    // kernel.
+    float *ss_a = scratchpad.template get<float>(key_gnorm_tmp_scaleshift);
+    float *ss_b = ss_a + N * C;
+    float *ss_m = ss_b + N * C;
+
+    if (!pd()->stats_are_src()) {
+        // The sums of the shifted values kept per channel and spatial chunk.
+        float *sum = scratchpad.template get<float>(key_gnorm_reduction);
+        float *sum_sq = sum + N * n_sp_chunks * C;
+        const data_type_t src_dt = pd()->src_md()->data_type;
+
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            const dim_t c0 = c / Cg * Cg;
+            const dim_t off = is_nspc ? n * SP * C + c0 : (n * C + c0) * SP;
+            ss_a[n * C + c] = cpu::io::load_float_value(src_dt, src, off);
+        });
+
+        if (is_nspc) {
+            parallel_nd(N, n_sp_chunks, [&](dim_t n, dim_t chunk) {
+                const dim_t sp_s = chunk * sp_chunk;
+                const dim_t sp_e = nstl::min(SP, sp_s + sp_chunk);
+                const dim_t acc_off = (n * n_sp_chunks + chunk) * C;
+                utils::array_set(&sum[acc_off], 0.f, C);
+                utils::array_set(&sum_sq[acc_off], 0.f, C);
+                (*stat_kernel_)(src + (n * SP + sp_s) * C * src_dt_size,
+                        &ss_a[n * C], &sum[acc_off], &sum_sq[acc_off],
+                        sp_e - sp_s);
+            });
+        } else {
+            parallel_nd(N, C, [&](dim_t n, dim_t c) {
+                const dim_t acc_off = n * C + c;
+                sum[acc_off] = 0.f;
+                sum_sq[acc_off] = 0.f;
+                (*stat_kernel_)(src + acc_off * SP * src_dt_size,
+                        &ss_a[acc_off], &sum[acc_off], &sum_sq[acc_off], 1);
+            });
+        }
+
+        const double group_size = static_cast<double>(Cg * SP);
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            double s = 0, s_sq = 0;
+            for_(dim_t chunk = 0; chunk < n_sp_chunks; chunk++)
+            for (dim_t c = g * Cg; c < (g + 1) * Cg; c++) {
+                s += sum[(n * n_sp_chunks + chunk) * C + c];
+                s_sq += sum_sq[(n * n_sp_chunks + chunk) * C + c];
+            }
+            const double shifted_mean = s / group_size;
+            const double var = s_sq / group_size - shifted_mean * shifted_mean;
+            mean[n * G + g] = static_cast<float>(
+                    ss_a[n * C + g * Cg] + shifted_mean);
+            variance[n * G + g] = static_cast<float>(nstl::max(var, 0.0));
+        });
+    }
+
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        const dim_t s_off = n * G + c / Cg;
+        const float sm
+                = (scale ? scale[c] : 1.f) / sqrtf(variance[s_off] + eps);
+        const float sv = shift ? shift[c] : 0.f;
+        ss_a[n * C + c] = sm * src_scales[0];
+        ss_b[n * C + c] = sv * src_scales[0];
+        ss_m[n * C + c] = mean[s_off];
+    });
+
+    if (is_nspc) {
+        parallel_nd(N, n_sp_chunks, [&](dim_t n, dim_t chunk) {
+            const dim_t sp_s = chunk * sp_chunk;
+            const dim_t sp_e = nstl::min(SP, sp_s + sp_chunk);
+            const dim_t off = (n * SP + sp_s) * C;
+            (*data_kernel_)(src + off * src_dt_size, dst + off * dst_dt_size,
+                    &ss_m[n * C], &ss_a[n * C], &ss_b[n * C], dst_scales,
+                    sp_e - sp_s);
+        });
+    } else {
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            const dim_t off = (n * C + c) * SP;
+            (*data_kernel_)(src + off * src_dt_size, dst + off * dst_dt_size,
+                    &ss_m[n * C + c], &ss_a[n * C + c], &ss_b[n * C + c],
+                    dst_scales, 1);
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+#define CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Accumulates sum(src - pivot) and sum((src - pivot)^2) in a single pass over
+// the data. With the plain (ncsp) layout a call processes a single channel and
+// adds the reduced values to `sum[0]` and `sum_sq[0]`; with the channels-last
+// (nspc) layout a call processes `rows` spatial points and accumulates per
+// channel values into `sum[0:C]` and `sum_sq[0:C]`.
+struct gnorm_stat_kernel_t {
+    static gnorm_stat_kernel_t *create(const group_normalization_pd_t *pd);
+    virtual ~gnorm_stat_kernel_t() = default;
+
+    virtual void operator()(const void *src, const float *pivot, float *sum,
+            float *sum_sq, size_t rows) const {};
+
+    virtual status_t create_kernel() { return status::success; }
+
+protected:
+    gnorm_stat_kernel_t(const group_normalization_pd_t *pd) : pd_(pd) {}
+
+    const group_normalization_pd_t *pd_;
+};
+
+// Computes dst = post_ops((src - mean) * a + b) * dst_scale, where `a` combines
+// the inverse standard deviation, the scale and the source scale and `b` is
+// the shift multiplied by the source scale. The mean is subtracted first as in
+// the layer normalization kernels, so no precision is lost when the mean is
+// large compared to the standard deviation. The layouts are handled in the
+// same way as in the statistics kernel.
+struct gnorm_data_kernel_t {
+    static gnorm_data_kernel_t *create(const group_normalization_pd_t *pd);
+    virtual ~gnorm_data_kernel_t() = default;
+
+    virtual void operator()(const void *src, void *dst, const float *mean,
+            const float *a, const float *b, const float *dst_scales,
+            size_t rows) const {};
+
+    virtual status_t create_kernel() { return status::success; }
+
+protected:
+    gnorm_data_kernel_t(const group_normalization_pd_t *pd) : pd_(pd) {}
+
+    const group_normalization_pd_t *pd_;
+};
+
+struct jit_uni_group_normalization_fwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        using cpu_group_normalization_fwd_pd_t::
+                cpu_group_normalization_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:uni", jit_uni_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Channels-last layout, the channel dimension is dense.
+        bool is_nspc_;
+        // The spatial dimension is split into chunks to get enough parallel
+        // work with the channels-last layout.
+        dim_t sp_chunk_;
+        dim_t n_sp_chunks_;
+
+    private:
+        bool post_ops_ok() const;
+        void init_scratchpad();
+    };
+
+    jit_uni_group_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<gnorm_stat_kernel_t> stat_kernel_;
+    std::unique_ptr<gnorm_data_kernel_t> data_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -89,6 +89,7 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , use_shift_(pd_->use_shift())
         , save_stats_(pd_->is_training())
         , calculate_stats_(!pd_->stats_are_src())
+        , use_rms_norm_(pd_->use_rms_norm())
         , eps_(pd_->desc()->layer_norm_epsilon)
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(src_d_.data_type(), data_type::f16,
@@ -142,6 +143,7 @@ protected:
     const bool use_shift_;
     const bool save_stats_;
     const bool calculate_stats_;
+    const bool use_rms_norm_;
     const float eps_;
     const bool has_ne_convert_src_xf16_;
 
@@ -363,13 +365,15 @@ protected:
         if (has_ne_convert_src_xf16_)
             compute_ne_convert_xf16(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!use_rms_norm_)
+                            uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         else
             compute(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!use_rms_norm_)
+                            uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         if (save_stats_)
@@ -390,7 +394,7 @@ protected:
             if (use_shift_)
                 io_[f32]->load(
                         shift_ptr(offt_elems + j * simd_w_), vmm_shift, tail);
-            uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+            if (!use_rms_norm_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
             uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
             if (use_scale_ && use_shift_)
                 uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -412,7 +416,7 @@ protected:
             io_[f32]->load(shift_ptr(offt_elems), vmm_shift, tail);
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
-        uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+        if (!use_rms_norm_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
         uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
         if (use_scale_ && use_shift_)
             uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -485,13 +489,15 @@ protected:
             jle(end, T_NEAR);
 
             if (calculate_stats_) {
-                // compute stats
-                compute_mean();
+                // compute stats, RMS normalization needs variance only
+                if (!use_rms_norm_) compute_mean();
                 compute_var();
             } else {
                 // read mean and var from input
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!use_rms_norm_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
                 uni_vmovss(xmm_tmp, dword[reg_var]);
                 uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
             }
@@ -514,7 +520,7 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_dst, c_dst_size);
-            add(reg_mean, float_size);
+            if (!use_rms_norm_) add(reg_mean, float_size);
             add(reg_var, float_size);
             jmp(unroll_loop);
         }
@@ -1100,6 +1106,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
                         CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
                 : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
     }
+    // The kernel neither reads nor writes the mean in RMS normalization.
+    if (pd()->use_rms_norm()) mean = nullptr;
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
@@ -1119,7 +1127,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
         const int block_size = N_end - N_start;
-        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, &mean[N_start],
+        float *const mean_ptr = mean ? &mean[N_start] : nullptr;
+        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, mean_ptr,
                 &variance[N_start], src_scales, dst_scales, block_size);
     });
     return status::success;
@@ -193,8 +193,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
 
         // reorder input stats
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->use_rms_norm())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -202,8 +203,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
         if (status != status::success) return status;
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, {&mean, true}, ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->use_rms_norm())
+                reorder_stat(ctx, engine, {&mean, true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {&variance, true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -231,6 +233,7 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
             const memory_desc_wrapper src_d(src_md());
 
             const bool ok = is_bwd() && !has_zero_dim_memory()
+                    && !use_rms_norm()
                     && mayiuse(avx2) // sse41 is not supported yet
                     && utils::one_of(src_md()->data_type, f32, bf16, f16)
                     && utils::one_of(diff_dst_md()->data_type, f32, bf16, f16)
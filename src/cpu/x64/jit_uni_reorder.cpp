@@ -164,9 +164,29 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         return true;
     }
 
+    // f8 inputs are supported only through the direct copy path which
+    // up-converts them to f32 with io_helper.
+    static bool f8_direct_copy_applicable(const prb_t &p) {
+        using namespace data_type;
+
+        return p.ndims == 1 && utils::everyone_is(1, p.is(0), p.os(0))
+                && utils::one_of(p.otype, f32, bf16, f16) && !p.is_tail_present
+                && !p.req_s8s8_comp && !p.req_asymmetric_comp
+                && !p.req_src_zp && !p.req_dst_zp
+                && p.src_scale_type == scale_type_t::NONE
+                && p.dst_scale_type == scale_type_t::NONE && p.beta == 0.f
+                && mayiuse(avx512_core);
+    }
+
     static bool applicable(const prb_t &p) {
         using namespace data_type;
 
+        if (utils::one_of(p.itype, f8_e5m2, f8_e4m3))
+            return utils::everyone_is(0, p.ioff, p.ooff)
+                    && f8_direct_copy_applicable(p)
+                    && simple_impl_desc_init(p, nullptr)
+                    && IMPLICATION(p.otype == f16, mayiuse(avx512_core_fp16));
+
         bool ok = true && p.ndims > 0
                 && utils::one_of(p.itype, f32, bf16, f16, s32, s8, u8)
                 && utils::one_of(p.otype, f32, bf16, f16, s32, s8, u8)
@@ -521,7 +541,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                 zero_idx, saturation_ubound_idx, reg_tmp_);
         io::jit_io_multi_dt_helper_t<Vmm> io(this, isa_,
                 {prb_.itype, prb_.otype}, io_conf, io_tail_conf, io_bf16_conf,
-                {{prb_.otype, io_saturation_conf}});
+                {{prb_.otype, io_saturation_conf}}, utils::nullopt,
+                io::io_f8_conf_t(saturation_ubound_idx + 1, reg_tmp_));
 
         io.init_saturate_f32({prb_.otype});
 
@@ -0,0 +1,360 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::cpu::matmul;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+namespace {
+constexpr dim_t M_blk = grouped_m_kernel_sizes[0];
+// The blocks of the weights layouts picked by brgemm matmul for 3D weights:
+// N_blk columns of a group are stored contiguously in chunks of K_blk rows.
+constexpr dim_t N_blk = 64;
+constexpr dim_t K_blk = 16;
+} // namespace
+
+template <cpu_isa_t isa>
+format_tag_t brgemm_grouped_matmul_t<isa>::pd_t::get_wei_tag() const {
+    return weights_md()->data_type == bf16 ? format_tag::aCB16b64c2b
+                                           : format_tag::aCB16b64c;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_grouped_matmul_t<isa>::pd_t::set_default_formats() {
+    // Weights in `any` format get the blocked layout of brgemm matmul, so
+    // that the kernels read them in place and the existing reorders pack
+    // them once.
+    if (weights_md_.format_kind == format_kind::any
+            && memory_desc_init_by_tag(weights_md_, get_wei_tag())
+                    != status::success)
+        return false;
+    if (dst_md_.format_kind == format_kind::any
+            && memory_desc_init_by_tag(dst_md_, format_tag::ab)
+                    != status::success)
+        return false;
+
+    const memory_desc_wrapper wei_d(weights_md_);
+    return wei_d.matches_one_of_tag(format_tag::abc, get_wei_tag())
+            != format_tag::undef
+            && memory_desc_wrapper(dst_md_).matches_one_of_tag(format_tag::ab)
+            != format_tag::undef;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const auto src_type = src_md()->data_type;
+    const auto wei_type = weights_md()->data_type;
+    const auto dst_type = dst_md()->data_type;
+
+    const bool is_f32 = isa == avx512_core
+            && everyone_is(f32, src_type, wei_type, dst_type);
+    const bool is_bf16 = one_of(isa, avx512_core_bf16, avx512_core_amx)
+            && everyone_is(bf16, src_type, wei_type)
+            && one_of(dst_type, f32, bf16);
+
+    const bool ok = mayiuse(isa) && src_d.is_grouped_desc()
+            && src_d.metadata_type(0) == s32 && (is_f32 || is_bf16)
+            && attr()->has_default_values() && set_default_formats();
+    if (!ok) return status::unimplemented;
+
+    const bool is_wei_plain = memory_desc_wrapper(weights_md())
+                                      .matches_one_of_tag(format_tag::abc)
+            != format_tag::undef;
+    pack_B_ = is_bf16 && is_wei_plain;
+    use_buffer_c_ = dst_type != f32;
+
+    if (pack_B_) {
+        const dim_t K = src_d.dims()[1];
+        const dim_t N = dst_md()->dims[1];
+        const dim_t dt_size = types::data_type_size(wei_type);
+
+        // The same configuration as for packing the weights of brgemm
+        // ukernels: a single plain K x N matrix with N_blk columns per block.
+        copy_B_conf_ = zero<brgemm_matmul_conf_t>();
+        copy_B_conf_.isa = avx512_core;
+        copy_B_conf_.src_dt = src_type;
+        copy_B_conf_.wei_dt = wei_type;
+        copy_B_conf_.orig_wei_dt = wei_type;
+        copy_B_conf_.wei_tag = format_tag::acbd;
+        copy_B_conf_.copy_B_wei_stride = N * dt_size;
+        copy_B_conf_.K = K;
+        copy_B_conf_.N = N;
+        copy_B_conf_.K_blk = K;
+        copy_B_conf_.N_blk = N_blk;
+        copy_B_conf_.N_tail = N % N_blk;
+        copy_B_conf_.wei_n_blk = N_blk;
+        copy_B_conf_.LDB = N_blk;
+        copy_B_conf_.b_dt_sz = dt_size;
+        copy_B_conf_.tr_b_dt_sz = dt_size;
+        copy_B_conf_.src_zp_type = brgemm_broadcast_t::none;
+        copy_B_conf_.wei_zp_type = brgemm_broadcast_t::none;
+    }
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init_brgemm_descs() {
+    const memory_desc_wrapper wei_d(weights_md());
+    const dim_t K = src_md()->dims[1];
+    const dim_t N = dst_md()->dims[1];
+    const auto src_type = src_md()->data_type;
+    const auto wei_type = weights_md()->data_type;
+
+    // Plain f32 weights are read in place, everything else is blocked.
+    const bool is_B_blocked = pack_B_
+            || wei_d.matches_one_of_tag(format_tag::abc) == format_tag::undef;
+    const dim_t LDB = is_B_blocked ? N_blk : N;
+    // The kernels either store to the destination directly or accumulate
+    // into a per-thread buffer of M_blk x N_blk elements.
+    const dim_t LDC = use_buffer_c_ ? N_blk : N;
+
+    for (int i = 0; i < num_grouped_m_kernels; i++)
+        for (bool is_N_tail : {false, true}) {
+            brgemm_t &brg = brg_descs_[i][is_N_tail];
+            brg = brgemm_t();
+            const dim_t M_ker = grouped_m_kernel_sizes[i];
+            const dim_t N_ker = is_N_tail ? N % N_blk : N_blk;
+            if (N_ker == 0 || (!is_N_tail && N < N_blk)) continue;
+
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, src_type, wei_type,
+                    false, false, brgemm_row_major, 1.f, 0.f, K, LDB, LDC,
+                    M_ker, N_ker, K));
+
+            if (use_buffer_c_) {
+                memory_desc_t dst_md;
+                const dims_t dims = {M_ker, N_ker};
+                const dims_t strides = {N, 1};
+                CHECK(memory_desc_init_by_strides(
+                        dst_md, 2, dims, dst_md_.data_type, strides));
+                CHECK(brgemm_desc_set_postops(&brg, attr(), &dst_md, (int)N));
+            }
+
+            brgemm_attr_t brgattr;
+            brgattr.max_bs = 1;
+            CHECK(brgemm_desc_set_attr(&brg, brgattr));
+            wsp_tile_per_thr_bytes_ = nstl::max(
+                    (size_t)brg.get_wsp_buffer_size(), wsp_tile_per_thr_bytes_);
+        }
+
+    nthr_ = dnnl_get_max_threads();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_matmul_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    if (pack_B_) {
+        const memory_desc_wrapper wei_d(weights_md());
+        const dim_t G = wei_d.dims()[0];
+        const dim_t K = wei_d.dims()[1];
+        const dim_t N = wei_d.dims()[2];
+        scratchpad.book(key_brgemm_primitive_buffer_b,
+                G * div_up(N, N_blk) * rnd_up(K, K_blk) * N_blk,
+                wei_d.data_type_size());
+    }
+    if (use_buffer_c_)
+        scratchpad.template book<float>(
+                key_brgemm_primitive_buffer, nthr_ * M_blk * N_blk);
+    if (is_superset(isa, avx512_core_amx))
+        scratchpad.book(key_conv_amx_tile_buffer,
+                static_cast<size_t>(nthr_) * wsp_tile_per_thr_bytes_,
+                sizeof(char));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::init(engine_t *engine) {
+    const bool is_amx = is_superset(isa, avx512_core_amx);
+    for (int i = 0; i < num_grouped_m_kernels; i++)
+        for (bool is_N_tail : {false, true}) {
+            const brgemm_t &brg = pd()->get_brg_desc(i, is_N_tail);
+            if (brg.bcast_dim == 0) continue;
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, brg));
+            CHECK(safe_ptr_assign(brg_kernels_[i][is_N_tail], ker));
+            if (is_amx) brgemm_palettes_.insert(2 * i + is_N_tail, brg);
+        }
+
+    if (pd()->pack_B_)
+        CHECK(create_brgemm_matmul_copy_b(
+                copy_B_kernel_, &pd()->copy_B_conf_));
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_matmul_t<isa>::pack_weights(
+        const char *wei, char *packed) const {
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const dim_t G = wei_d.dims()[0];
+    const dim_t K = wei_d.dims()[1];
+    const dim_t N = wei_d.dims()[2];
+    const dim_t NB = div_up(N, N_blk);
+    const dim_t dt_size = wei_d.data_type_size();
+    const dim_t packed_blk_size = rnd_up(K, K_blk) * N_blk;
+
+    parallel_nd(G, NB, [&](dim_t g, dim_t nb) {
+        auto ctx = jit_brgemm_matmul_copy_b_t::ctx_t();
+        ctx.src = wei + (g * K * N + nb * N_blk) * dt_size;
+        ctx.tr_src = packed + (g * NB + nb) * packed_blk_size * dt_size;
+        ctx.current_K_start = 0;
+        ctx.current_K_iters = K;
+        ctx.current_N_blk = nstl::min(N_blk, N - nb * N_blk);
+        (*copy_B_kernel_)(&ctx);
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
+    const auto *offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto *dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t M = dst_d.dims()[0];
+    const dim_t N = dst_d.dims()[1];
+    const dim_t K = src_d.dims()[1];
+    const dim_t G = src_d.ngroups();
+    const dim_t NB = div_up(N, N_blk);
+
+    if (!grouped_offsets_ok(offsets, G, M)) return status::invalid_arguments;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const char *packed_wei = nullptr;
+    if (pd()->pack_B_) {
+        char *packed = scratchpad.template get<char>(
+                key_brgemm_primitive_buffer_b);
+        pack_weights(wei, packed);
+        packed_wei = packed;
+    }
+    float *buffer_c = pd()->use_buffer_c_
+            ? scratchpad.template get<float>(key_brgemm_primitive_buffer)
+            : nullptr;
+    const bool is_amx = is_superset(isa, avx512_core_amx);
+    char *wsp_tile = is_amx
+            ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
+            : nullptr;
+
+    const dim_t src_dt_size = src_d.data_type_size();
+    const dim_t wei_dt_size = wei_d.data_type_size();
+    const dim_t dst_dt_size = dst_d.data_type_size();
+    const auto B_ptr = [&](dim_t g, dim_t nb) {
+        if (packed_wei) {
+            const dim_t packed_blk_size = rnd_up(K, K_blk) * N_blk;
+            return packed_wei + (g * NB + nb) * packed_blk_size * wei_dt_size;
+        }
+        return wei + wei_d.off(g, 0, nb * N_blk) * wei_dt_size;
+    };
+
+    // A work item is a block of M_blk rows and N_blk columns of a group. The
+    // items of a group are ordered by the N block first, so that a thread
+    // reuses a block of weights for consecutive items.
+    std::vector<dim_t> work_offsets(G + 1, 0);
+    for (dim_t g = 0; g < G; g++) {
+        const dim_t M_g = offsets[g + 1] - offsets[g];
+        work_offsets[g + 1] = work_offsets[g] + div_up(M_g, M_blk) * NB;
+    }
+    const dim_t work_amount = work_offsets[G];
+    if (work_amount == 0) return status::success;
+
+    const int nthr = (int)nstl::min<dim_t>(pd()->nthr_, work_amount);
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        dim_t g = std::upper_bound(work_offsets.begin(), work_offsets.end(),
+                          start)
+                - work_offsets.begin() - 1;
+        float *c_buf = buffer_c ? buffer_c + ithr * M_blk * N_blk : nullptr;
+        void *scratch = wsp_tile
+                ? wsp_tile + ithr * pd()->wsp_tile_per_thr_bytes_
+                : nullptr;
+        brgemm_batch_element_t batch;
+        const brgemm_post_ops_data_t post_ops_data;
+        int prev_ker_idx = -1;
+
+        for (dim_t w = start; w < end; w++) {
+            // Empty groups have no work items and are skipped.
+            while (w >= work_offsets[g + 1])
+                g++;
+            const dim_t M_g = offsets[g + 1] - offsets[g];
+            const dim_t MB_g = div_up(M_g, M_blk);
+            const dim_t nb = (w - work_offsets[g]) / MB_g;
+            const dim_t mb = (w - work_offsets[g]) % MB_g;
+            const bool is_N_tail = (nb + 1) * N_blk > N;
+
+            batch.ptr.B = B_ptr(g, nb);
+            dim_t m = offsets[g] + mb * M_blk;
+            dim_t m_left = nstl::min(M_blk, M_g - mb * M_blk);
+            for (int i = 0; i < num_grouped_m_kernels && m_left > 0; i++) {
+                if (grouped_m_kernel_sizes[i] > m_left) continue;
+                const auto *ker = brg_kernels_[i][is_N_tail].get();
+                brgemm_palettes_.maybe_tile_configure(
+                        is_amx, prev_ker_idx, 2 * i + is_N_tail);
+                batch.ptr.A = src + m * K * src_dt_size;
+                char *dst_ptr = dst + (m * N + nb * N_blk) * dst_dt_size;
+                if (c_buf)
+                    brgemm_kernel_execute_postops(ker, 1, &batch, c_buf,
+                            dst_ptr, post_ops_data, scratch);
+                else
+                    brgemm_kernel_execute(ker, 1, &batch, dst_ptr, scratch);
+                m += grouped_m_kernel_sizes[i];
+                m_left -= grouped_m_kernel_sizes[i];
+            }
+        }
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+template struct brgemm_grouped_matmul_t<avx512_core>;
+template struct brgemm_grouped_matmul_t<avx512_core_bf16>;
+template struct brgemm_grouped_matmul_t<avx512_core_amx>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
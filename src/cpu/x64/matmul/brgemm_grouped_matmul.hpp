@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
+#include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+namespace {
+// The M sizes of the grouped matmul kernels. The first one is the M block,
+// and any M tail is covered by a combination of the others.
+constexpr int grouped_m_kernel_sizes[] = {32, 16, 8, 4, 2, 1};
+constexpr int num_grouped_m_kernels = sizeof(grouped_m_kernel_sizes)
+        / sizeof(grouped_m_kernel_sizes[0]);
+} // namespace
+
+// Matmul with a source in grouped encoding: the rows of the source are split
+// into groups of sizes known at execution time only, and each group is
+// multiplied by its own weights matrix. This is the computation of the
+// experts of a Mixture-of-Experts layer, where a group holds the tokens
+// routed to an expert.
+//
+// All groups are computed in a single parallel region. The work is split into
+// blocks of M_blk rows by N_blk columns of a group, and the threads get equal
+// numbers of blocks, so small and large groups are balanced together.
+template <cpu_isa_t isa>
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_grouped:", isa, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        const brgemm_t &get_brg_desc(int m_ker_idx, bool is_N_tail) const {
+            return brg_descs_[m_ker_idx][is_N_tail];
+        }
+
+        int nthr_ = 0;
+        // The size of the buffer the AMX kernels store the tiles to before
+        // converting the result.
+        size_t wsp_tile_per_thr_bytes_ = 0;
+        // Plain bf16 weights are packed to the VNNI layout at every
+        // execution with the brgemm matmul copy routine.
+        bool pack_B_ = false;
+        // The destination is not f32, so the kernels accumulate into a
+        // buffer and convert the result while storing it.
+        bool use_buffer_c_ = false;
+        brgemm_matmul_conf_t copy_B_conf_;
+
+    private:
+        format_tag_t get_wei_tag() const;
+        bool set_default_formats();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_t brg_descs_[num_grouped_m_kernels][2];
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Packs the weights of all groups in the blocked layout into `packed`.
+    void pack_weights(const char *wei, char *packed) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[num_grouped_m_kernels][2];
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
+            2 * num_grouped_m_kernels};
+    std::unique_ptr<jit_brgemm_matmul_copy_b_t> copy_B_kernel_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -17,12 +17,16 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
+#include "common/reorder.hpp"
+#include "common/stream.hpp"
 #include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_engine.hpp"
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/prepacked_weights_registry.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -61,15 +65,23 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
     const bool is_f16
             = everyone_is(f16, src_dt, wei_dt) && one_of(dst_dt, f16, f32);
+    const bool is_wei_decomp = one_of(src_dt, f32, bf16)
+            && types::is_4bit(wei_dt) && one_of(dst_dt, src_dt, f32);
+    // The source is quantized to s8 at execution time, see
+    // dnnl_primitive_attr_set_src_dynamic_quantization().
+    const bool is_src_dyn_quant = attr()->src_dyn_quant_dt_ == s8;
+    const bool is_src_dyn_quant_dt_ok = one_of(src_dt, f32, bf16)
+            && wei_dt == s8 && one_of(dst_dt, f32, bf16);
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
         // The cause in IMPLICATION should be an expression to work around
         // ICE in GCC 7.4.
         const bool is_bia_dt_correct
-                = IMPLICATION(is_int8 == true,
+                = IMPLICATION(is_int8 == true || is_src_dyn_quant == true,
                           one_of(bia_dt, f32, s32, s8, u8, bf16))
-                && IMPLICATION(!is_int8, one_of(bia_dt, f32, src_dt));
+                && IMPLICATION(!is_int8 && !is_src_dyn_quant,
+                        one_of(bia_dt, f32, src_dt));
         return IMPLICATION(with_bias(), is_bia_dt_correct && is_bias_1xN());
     };
 
@@ -77,6 +89,18 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         const std::vector<int> supported_args
                 = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
         bool ok = attr_scales_ok(supported_args);
+        // Groups and non-f32 scales are supported for compressed weights
+        // only.
+        const auto &wei_scales = attr()->scales_.get(DNNL_ARG_WEIGHTS);
+        ok = ok
+                && IMPLICATION(!is_wei_decomp,
+                        wei_scales.has_default_groups()
+                                && wei_scales.has_default_data_type());
+        ok = ok
+                && attr()->scales_.get(DNNL_ARG_SRC).has_default_groups()
+                && attr()->scales_.get(DNNL_ARG_SRC).has_default_data_type()
+                && attr()->scales_.get(DNNL_ARG_DST).has_default_groups()
+                && attr()->scales_.get(DNNL_ARG_DST).has_default_data_type();
         if (!attr()->scales_.get(DNNL_ARG_SRC).has_default_values()
                 && !attr()->scales_.get(DNNL_ARG_WEIGHTS).has_default_values()
                 && attr()->scales_.get(DNNL_ARG_WEIGHTS).mask_ != 0) {
@@ -86,8 +110,16 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         return ok;
     };
 
-    auto check_attr_zero_points
-            = [&]() -> bool { return attr()->zero_points_.common(); };
+    auto check_attr_zero_points = [&]() -> bool {
+        const auto &zp = attr()->zero_points_;
+        // Compressed weights support grouped zero points for weights only,
+        // the configuration is checked in init_brgemm_matmul_conf().
+        if (is_wei_decomp)
+            return zp.has_default_values(DNNL_ARG_SRC)
+                    && zp.has_default_values(DNNL_ARG_DST);
+        return zp.common() && zp.has_default_groups()
+                && zp.has_default_data_type();
+    };
 
     // The current version supports runtime value for M dimension in the case
     // of 2d problems only and do not support any runtime strides for B and C
@@ -96,7 +128,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const bool no_dynamic_strides_for_B_and_C
             = !memory_desc_wrapper(weights_md_).has_runtime_strides()
             && !memory_desc_wrapper(dst_md_).has_runtime_strides();
-    const bool problem_dt_correct = is_int8 || is_bf16 || is_f32 || is_f16;
+    const bool problem_dt_correct = is_src_dyn_quant
+            ? is_src_dyn_quant_dt_ok
+            : is_int8 || is_bf16 || is_f32 || is_f16 || is_wei_decomp;
     VCHECK_MATMUL(is_dense_data(), VERBOSE_NONTRIVIAL_STRIDE);
     VCHECK_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
     VCHECK_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT);
@@ -106,19 +140,47 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VCHECK_MATMUL(
             attr()->has_default_values(
                     primitive_attr_t::skip_mask_t::scales_runtime
+                            | primitive_attr_t::skip_mask_t::
+                                    scales_runtime_groups
+                            | primitive_attr_t::skip_mask_t::
+                                    scales_runtime_data_type
                             | primitive_attr_t::skip_mask_t::zero_points_runtime
+                            | primitive_attr_t::skip_mask_t::
+                                    zero_points_runtime_groups
+                            | primitive_attr_t::skip_mask_t::
+                                    zero_points_runtime_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
-                            | primitive_attr_t::skip_mask_t::sum_dt,
+                            | primitive_attr_t::skip_mask_t::sum_dt
+                            | primitive_attr_t::skip_mask_t::
+                                    src_dynamic_quantization,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
-    VCHECK_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt, is_int8),
+    VCHECK_MATMUL(attr()->post_ops_.check_sum_consistency(
+                          dst_dt, is_int8 || is_src_dyn_quant),
             VERBOSE_UNSUPPORTED_DT);
     VCHECK_MATMUL(check_attr_scales(), VERBOSE_UNSUPPORTED_SCALES_CFG);
     VCHECK_MATMUL(check_attr_zero_points(), VERBOSE_UNSUPPORTED_ZP_CFG);
     VCHECK_MATMUL(check_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
 
-    CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
-            dst_md_, bias_md_, attr_));
+    // Plain weights that are declared constant per address are reordered to
+    // the blocked layout once instead of being copied on every execution.
+    // Fall back to the regular path if the blocked layout is not available.
+    const bool try_prepack_weights = attr()->shared_weights_ && !is_wei_decomp
+            && weights_md_.format_kind == format_kind::blocked
+            && !memory_desc_wrapper(weights_md_).has_runtime_dims_or_strides();
+    if (try_prepack_weights) {
+        packed_weights_md_ = weights_md_;
+        packed_weights_md_.format_kind = format_kind::any;
+        status_t status = init_brgemm_matmul_conf(isa, bgmmc_, *desc(),
+                src_md_, packed_weights_md_, dst_md_, bias_md_, attr_);
+        if (status == status::success && bgmmc_.blocked_B)
+            status = reorder_primitive_desc_create(weights_reorder_pd_, engine,
+                    &weights_md_, &packed_weights_md_);
+        if (status != status::success) weights_reorder_pd_.reset();
+    }
+    if (!prepack_weights())
+        CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_,
+                weights_md_, dst_md_, bias_md_, attr_));
 
     const float alpha = 1.0;
     const float beta = 1.0;
@@ -126,8 +188,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     const int max_m_ker_idx
             = bgmmc_.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
+    const int max_k_ker_idx
+            = bgmmc_.is_runtime_K ? max_num_dynamic_k_tails + 1 : 2;
     const bool is_amx = is_superset(isa, avx512_core_amx);
-    const bool is_s8s8 = src_dt == s8 && wei_dt == s8;
+    const bool is_s8s8 = bgmmc_.src_dt == s8 && wei_dt == s8;
     // In the case of dynamic M for amx the last tail kernel generate using
     // non-amx isa. s8s8 proplem type is exception to avoid compensations
     // processing for tail kernel
@@ -140,13 +204,15 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     for_(int i_init = 0; i_init < 2; i_init++)
     for_(int i_M = 0; i_M < max_m_ker_idx; i_M++)
     for_(int i_N = 0; i_N < 2; i_N++)
-    for (int i_K = 0; i_K < 2; i_K++) {
+    for (int i_K = 0; i_K < max_k_ker_idx; i_K++) {
         auto vbeta = (i_init) ? beta_init : beta;
         auto vM = (i_M) == 0 ? bgmmc_.M_blk
                              : (bgmmc_.is_runtime_M ? dynamic_m_tails[i_M - 1]
                                                     : bgmmc_.M_tail);
         auto vN = (i_N) ? bgmmc_.N_tail : bgmmc_.N_blk;
-        auto vK = (i_K) ? bgmmc_.K_tail : bgmmc_.K_blk;
+        auto vK = (i_K) == 0 ? bgmmc_.K_blk
+                             : (bgmmc_.is_runtime_K ? dynamic_k_tails[i_K - 1]
+                                                    : bgmmc_.K_tail);
 
         int bs = get_brg_batchsize(bgmmc_, i_bs, i_K);
         int idx = get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
@@ -168,8 +234,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         brgattr.generate_skip_accumulation
                 = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
         if (is_superset(kernel_isa, avx512_core_amx)) {
-            if (!brgattr.generate_skip_accumulation) {
+            if (!brgattr.generate_skip_accumulation
+                    && !bgmmc_.with_src_dyn_quant) {
                 // TODO: uker doesn't yet support generate_skip_accumulation
+                // and per-row scales of dynamically quantized A
                 brgattr.use_uker = true;
                 brgattr.use_interleave_stores = true;
             }
@@ -191,7 +259,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     auto scratchpad = scratchpad_registry().registrar();
     init_scratchpad(scratchpad, bgmmc_);
-    book_precomputed_scales(scratchpad, attr()->scales_, N());
+    if (prepack_weights())
+        scratchpad.book(key_nested, weights_reorder_pd_->scratchpad_registry());
+    if (!bgmmc_.with_wei_decompression)
+        book_precomputed_scales(scratchpad, attr()->scales_, N());
 
     return status::success;
 }
@@ -201,10 +272,12 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const int max_m_ker_idx
             = bgmmc.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
+    const int max_k_ker_idx
+            = bgmmc.is_runtime_K ? max_num_dynamic_k_tails + 1 : 2;
     for_(int i_bs = 0; i_bs < 2; i_bs++)
     for_(int i_M = 0; i_M < max_m_ker_idx; i_M++)
     for_(int i_N = 0; i_N < 2; i_N++)
-    for_(int i_K = 0; i_K < 2; i_K++)
+    for_(int i_K = 0; i_K < max_k_ker_idx; i_K++)
     for (int i_init = 0; i_init < 2; i_init++) {
         int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
@@ -216,6 +289,10 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
     }
 
+    if (pd()->prepack_weights())
+        CHECK(pd()->weights_reorder_pd_->create_primitive(
+                weights_reorder_, engine));
+
     if (bgmmc.use_buffer_b)
         CHECK(create_brgemm_matmul_copy_b(copy_B_kernel_, &bgmmc));
 
@@ -235,13 +312,59 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_packed_weights(const exec_ctx_t &ctx,
+        std::shared_ptr<const void> &packed_weights) const {
+    // The packed copy belongs to the memory object rather than to the
+    // address: a new object or data handle at the same address may hold new
+    // weights.
+    const uint64_t user_mem_id = ctx.args().at(DNNL_ARG_WEIGHTS).mem->id();
+
+    std::lock_guard<std::mutex> lock(packed_weights_mutex_);
+    if (packed_weights_ && packed_weights_user_mem_id_ == user_mem_id) {
+        packed_weights = packed_weights_;
+        return status::success;
+    }
+
+    auto pack = [&](void *packed_ptr) -> status_t {
+        engine_t *engine = ctx.stream()->engine();
+        memory_t packed_mem(engine, pd()->packed_weights_md(),
+                memory_flags_t::use_runtime_ptr, packed_ptr);
+
+        exec_args_t r_args;
+        r_args[DNNL_ARG_SRC] = ctx.args().at(DNNL_ARG_WEIGHTS);
+        r_args[DNNL_ARG_DST] = {&packed_mem, false};
+        exec_ctx_t r_ctx(ctx, std::move(r_args));
+
+        nested_scratchpad_t ns(ctx, key_nested, weights_reorder_);
+        r_ctx.set_scratchpad_grantor(ns.grantor());
+        return weights_reorder_->execute(r_ctx);
+    };
+
+    const prepacked_weights_registry_t::key_t key(user_mem_id,
+            *pd()->weights_md(), *pd()->packed_weights_md(),
+            get_numa_node(ctx.stream()->engine()));
+    CHECK(prepacked_weights_registry_t::get().get_or_pack(
+            packed_weights, key, pack));
+
+    packed_weights_user_mem_id_ = user_mem_id;
+    packed_weights_ = packed_weights;
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
-    DEFINE_ZERO_POINT_VALUE(wei_zero_point, DNNL_ARG_WEIGHTS);
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    // Scales and zero points of compressed weights are applied by the copy B
+    // kernel, see brg_matmul_exec_ctx_t.
+    const primitive_attr_t *wei_attr = bgmmc.with_wei_decompression
+            ? &default_attr()
+            : pd()->attr();
+    DEFINE_ZERO_POINT_VALUE_ATTR(wei_attr, wei_zero_point, DNNL_ARG_WEIGHTS);
     DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
-    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER_ATTR(wei_attr, wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
@@ -250,13 +373,20 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
     auto &scratchpad = ctx.get_scratchpad_grantor();
-    const float *oscales = precompute_scales(
-            scratchpad, src_scales, wei_scales, pd()->N(), pd()->attr());
+    const float *oscales = bgmmc.with_wei_decompression
+            ? src_scales
+            : precompute_scales(scratchpad, src_scales, wei_scales, pd()->N(),
+                    pd()->attr());
 
-    brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, src_zero_point,
-            wei_zero_point, dst_zero_point, dst_scales, helper);
+    std::shared_ptr<const void> packed_weights;
+    if (pd()->prepack_weights())
+        CHECK(get_packed_weights(ctx, packed_weights));
+
+    brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(),
+            static_cast<const char *>(packed_weights.get()), oscales,
+            src_zero_point, wei_zero_point, dst_zero_point, dst_scales,
+            helper);
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     const bool is_amx = is_superset(isa, avx512_core_amx);
@@ -265,45 +395,69 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     const int M_chunks = brgmm_ctx.get_M_chunks();
     const int M_chunk_size = brgmm_ctx.get_M_chunk_size();
     const int M_chunk_tail = brgmm_ctx.get_M_chunk_tail();
+    const int work_amount = brgmm_ctx.get_parallel_work_amount();
+    const int nthr_bmn = brgmm_ctx.get_num_threads_for_bmn();
+
+    // The partial results of the parallel reduction are combined by the
+    // thread that computed them, so the work can be stolen only when the
+    // reduction is not used.
+    std::unique_ptr<work_stealing_scheduler_t> scheduler;
+    if (nthr_bmn > 1 && !brgmm_ctx.parallel_reduction_is_used()
+            && get_scheduling() == dnnl_scheduling_work_stealing)
+        scheduler.reset(new work_stealing_scheduler_t(work_amount, nthr_bmn));
+
     parallel(num_threads, [&](const int ithr, const int nthr) {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
         if (ithr_bmn < 0 || ithr_k < 0) return;
-        int start {0}, end {0};
-        balance211(brgmm_ctx.get_parallel_work_amount(),
-                brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
-        int kc_start {0}, kc_end {bgmmc.K_chunks};
+        int kc_start {0}, kc_end {brgmm_ctx.get_K_chunks()};
         if (brgmm_ctx.parallel_reduction_is_used())
-            balance211((int)bgmmc.K_chunks, brgmm_ctx.get_num_threads_for_k(),
-                    ithr_k, kc_start, kc_end);
+            balance211(brgmm_ctx.get_K_chunks(),
+                    brgmm_ctx.get_num_threads_for_k(), ithr_k, kc_start,
+                    kc_end);
 
         int prev_ker_idx = -1;
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brgmm_ctx.get_base_brgemm_kernel_idx());
 
-        int b {0}, mc {0}, nc {0};
-        nd_iterator_init(
-                start, b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
-        while (start < end) {
-            auto m_start = mc * M_chunk_size;
-            const bool m_chunk_tail = mc == M_chunks - 1 && M_chunk_tail > 0;
-            auto m_end = m_start + (m_chunk_tail ? M_chunk_tail : M_chunk_size);
-            auto n_start = nc * bgmmc.N_chunk_size;
-            auto n_end = nstl::min(
-                    (nc + 1) * bgmmc.N_chunk_size, bgmmc.num_N_blocks);
-            for_(int kc = kc_start; kc < kc_end; kc++)
-            for (int nb = n_start; nb < n_end; nb++) {
-                if (bgmmc.use_buffer_b)
-                    copy_b_chunk_in_buffer(brgmm_ctx, ithr, b, nb, kc);
-                for (int mb = m_start; mb < m_end; mb++) {
-                    if (use_buffer_a && nb == n_start)
-                        copy_a_chunk_in_buffer(brgmm_ctx, ithr, b, mb, kc);
-                    compute_kernel(brgmm_ctx, ithr, b, mb, nb, kc,
-                            kc == kc_start, prev_ker_idx);
+        auto compute_range = [&](int start, int end) {
+            int b {0}, mc {0}, nc {0};
+            nd_iterator_init(
+                    start, b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
+            while (start < end) {
+                auto m_start = mc * M_chunk_size;
+                const bool m_chunk_tail
+                        = mc == M_chunks - 1 && M_chunk_tail > 0;
+                auto m_end = m_start
+                        + (m_chunk_tail ? M_chunk_tail : M_chunk_size);
+                auto n_start = nc * bgmmc.N_chunk_size;
+                auto n_end = nstl::min(
+                        (nc + 1) * bgmmc.N_chunk_size, bgmmc.num_N_blocks);
+                for_(int kc = kc_start; kc < kc_end; kc++)
+                for (int nb = n_start; nb < n_end; nb++) {
+                    if (bgmmc.use_buffer_b)
+                        copy_b_chunk_in_buffer(brgmm_ctx, ithr, b, nb, kc);
+                    for (int mb = m_start; mb < m_end; mb++) {
+                        if (use_buffer_a && nb == n_start)
+                            copy_a_chunk_in_buffer(brgmm_ctx, ithr, b, mb, kc);
+                        compute_kernel(brgmm_ctx, ithr, b, mb, nb, kc,
+                                kc == kc_start, prev_ker_idx);
+                    }
                 }
+                ++start;
+                nd_iterator_step(
+                        b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
             }
-            ++start;
-            nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
+        };
+
+        if (scheduler) {
+            dim_t start {0}, end {0};
+            while (scheduler->next(ithr_bmn, start, end))
+                compute_range((int)start, (int)end);
+        } else {
+            int start {0}, end {0};
+            balance211(work_amount, nthr_bmn, ithr_bmn, start, end);
+            compute_range(start, end);
         }
         if (is_amx) { amx_tile_release(); }
     });
@@ -329,18 +483,21 @@ void brgemm_matmul_t<isa>::compute_kernel(
     const int k_blk_idx = k_chunk_idx * bgmmc.brgemm_batch_size;
 
     const dim_t M = brgmm_ctx.get_M();
+    const dim_t K = brgmm_ctx.get_K();
     const int m_ker_idx = brgmm_ctx.get_M_kernel_idx(m_blk_idx);
     const bool is_N_tail = (bgmmc.N - n < bgmmc.N_blk);
     const bool is_last_K_chunk = brgmm_ctx.is_last_K_chunk(k_chunk_idx);
 
     const int remaining_k_blks
-            = (bgmmc.use_buffer_a ? utils::rnd_up(bgmmc.K, bgmmc.K_blk)
-                                  : bgmmc.K)
+            = (bgmmc.use_buffer_a ? utils::rnd_up(K, bgmmc.K_blk) : K)
             - k_chunk_idx * bgmmc.K_chunk_elems;
     const int gemm_batch = brgmm_ctx.get_brgemm_batch_size(k_chunk_idx);
     const bool is_K_tail
             = is_last_K_chunk && (gemm_batch * bgmmc.K_blk) != remaining_k_blks;
-    auto is_bs_tail = (gemm_batch != bgmmc.brgemm_batch_size);
+    // With runtime K the last chunk is processed by the main kernel with a
+    // smaller batch.
+    auto is_bs_tail = !bgmmc.is_runtime_K
+            && (gemm_batch != bgmmc.brgemm_batch_size);
     const int brg_ker_idx = pd()->get_brg_kernel_idx(
             is_bs_tail, do_init, m_ker_idx, is_N_tail, false);
     const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
@@ -358,7 +515,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
     const auto &post_ops_binary_rhs_arg_vec
             = brgmm_ctx.get_post_ops_binary_rhs_arg_vec();
     const bool post_ops_applicable = bgmmc.post_ops_applicable
-            && (brgmm_ctx.get_num_threads_for_k() <= 1 || bgmmc.K_chunks == 1);
+            && (brgmm_ctx.get_num_threads_for_k() <= 1
+                    || brgmm_ctx.get_K_chunks() == 1);
 
     if (need_copy_d && bgmmc.with_sum)
         brgmm_ctx.copy_dst_values_to_buffer(b_idx, m_blk_idx, n_blk_idx);
@@ -400,7 +558,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(),
+                    brgmm_ctx.get_src_dyn_quant_scales_ptr(ithr, m_blk_idx)};
 
             brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch);
@@ -409,13 +568,19 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     (void *)ptr_C, is_amx ? (void *)wsp_tile : nullptr);
         }
     }
-    if (is_K_tail) {
-        brgmm_ctx.init_brgemm_batch_elements_values(
-                ithr, gemm_batch, 1, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
-
-        const bool use_init_ker = (do_init && gemm_batch == 0);
-        const int brg_ker_idx = pd()->get_brg_kernel_idx(
-                false, use_init_ker, m_ker_idx, is_N_tail, true);
+    // The K tail is covered by a single kernel, or by a sequence of kernels
+    // accumulating into the same result for runtime K.
+    const int num_K_tail_kernels
+            = is_K_tail ? brgmm_ctx.get_num_K_tail_kernels() : 0;
+    for (int i_tail = 0; i_tail < num_K_tail_kernels; i_tail++) {
+        brgmm_ctx.init_brgemm_batch_elements_values(ithr, gemm_batch, 1, b_idx,
+                m_blk_idx, k_blk_idx, n_blk_idx,
+                brgmm_ctx.get_K_tail_kernel_offset(i_tail));
+
+        const bool use_init_ker = (do_init && gemm_batch == 0 && i_tail == 0);
+        const bool is_last_K_tail_kernel = i_tail == num_K_tail_kernels - 1;
+        const int brg_ker_idx = pd()->get_brg_kernel_idx(false, use_init_ker,
+                m_ker_idx, is_N_tail, brgmm_ctx.get_K_tail_kernel_idx(i_tail));
         assert(brg_ker_idx >= 0);
         const bool is_amx = is_superset(
                 pd()->get_brg_desc(brg_ker_idx).isa_impl, avx512_core_amx);
@@ -423,7 +588,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
                 is_amx, prev_ker_idx, brg_ker_idx);
         const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
 
-        if (post_ops_applicable) {
+        if (post_ops_applicable && is_last_K_tail_kernel) {
             void *scratch = is_amx
                     ? static_cast<void *>(wsp_tile)
                     : static_cast<void *>(brgmm_ctx.get_s8s8_comp_ptr(
@@ -449,7 +614,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(),
+                    brgmm_ctx.get_src_dyn_quant_scales_ptr(ithr, m_blk_idx)};
 
             brgemm_kernel_execute_postops(brg_kernel_k_tail, 1, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch);
@@ -477,7 +643,8 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
         if (ithr_bmn < 0 || ithr_k < 0) return;
 
-        const int num_reduction_buffers = nstl::min(nthr_k, bgmmc.K_chunks);
+        const int num_reduction_buffers
+                = nstl::min(nthr_k, brgmm_ctx.get_K_chunks());
 
         int bmn_start {0}, bmn_end {0};
         int start {0}, end {0};
@@ -579,7 +746,9 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 static_cast<const void *>(zp_comp_b),
                                 static_cast<const void *>(zp_c_val_ptr),
                                 skip_accumulation, 1, false, false,
-                                brgmm_ctx.get_dst_scales_ptr()};
+                                brgmm_ctx.get_dst_scales_ptr(),
+                                brgmm_ctx.get_src_dyn_quant_scales_ptr(
+                                        ithr, mb)};
 
                         brgemm_kernel_execute_postops(brg_kernel, 0, nullptr,
                                 (void *)ptr_C, (void *)ptr_D, post_ops_data,
@@ -618,6 +787,8 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     ctx.zp_b_neg_value_ptr = (void *)brgmm_ctx.get_zp_b_neg_val_ptr();
     ctx.zp_ab_comp_ptr = (void *)brgmm_ctx.get_zp_ab_mixed_comp_ptr();
     ctx.dynamic_src_ld = brgmm_ctx.get_src_stride();
+    ctx.src_dyn_quant_scales
+            = (void *)brgmm_ctx.get_src_dyn_quant_scales_ptr(ithr, m_blk_idx);
 
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
@@ -660,9 +831,33 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             ithr, b_idx, n_blk_idx);
     ctx.zp_a_neg_value_ptr = (void *)brgmm_ctx.get_zp_a_neg_val_ptr();
 
+    // Scales and zero points of compressed weights may change along K, so
+    // the kernel is called for each range of rows where they are constant.
+    auto copy_b_decompress = [&](int k, int k_iters, char *tr_src) {
+        for (int k_seg = k; k_seg < k + k_iters;) {
+            const int k_seg_end = nstl::min<int>(k + k_iters,
+                    rnd_dn(k_seg, bgmmc.wei_decomp_k_group)
+                            + bgmmc.wei_decomp_k_group);
+            ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k_seg, n);
+            ctx.tr_src = (void *)(tr_src
+                    + (k_seg - k) * bgmmc.LDB * bgmmc.tr_b_dt_sz);
+            ctx.scales_ptr = brgmm_ctx.get_wei_decomp_scales_ptr(k_seg, n);
+            ctx.zp_ptr = brgmm_ctx.get_wei_decomp_zp_ptr(k_seg, n);
+            ctx.current_K_start = k_seg;
+            ctx.current_K_iters = k_seg_end - k_seg;
+            (*copy_B_kernel_)(&ctx);
+            k_seg = k_seg_end;
+        }
+    };
+
     int gb = 0;
     for (; gb < gemm_batch; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
+        if (bgmmc.with_wei_decompression) {
+            copy_b_decompress(k, nstl::min(bgmmc.K_blk, bgmmc.K),
+                    brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx));
+            continue;
+        }
         ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
         ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
         ctx.compensation_ptr
@@ -677,7 +872,11 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         }
     }
 
-    if (is_K_tail) {
+    if (is_K_tail && bgmmc.with_wei_decompression) {
+        const int k = k_start + gb * bgmmc.K_blk;
+        copy_b_decompress(k, bgmmc.K % bgmmc.K_blk,
+                brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx));
+    } else if (is_K_tail) {
         const int k = k_start + gb * bgmmc.K_blk;
         ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
         ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
@@ -710,15 +909,22 @@ void brgemm_matmul_t<isa>::accumulate(
 template <cpu_isa_t isa>
 struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     brg_matmul_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd,
-            const float *oscales, int32_t src_zp, int32_t wei_zp,
-            int32_t dst_zp, const float *dst_scales, matmul_helper_t &helper)
+            const char *packed_B_ptr, const float *oscales, int32_t src_zp,
+            int32_t wei_zp, int32_t dst_zp, const float *dst_scales,
+            matmul_helper_t &helper)
         : bgmmc_(pd->get_brgemm_matmul_conf()) {
 
         data_A_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
-        data_B_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+        data_B_ptr_ = packed_B_ptr
+                ? packed_B_ptr
+                : CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
         data_C_ptr_ = CTX_OUT_MEM(char *, DNNL_ARG_DST);
 
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+        wei_decomp_scales_ptr_ = CTX_IN_MEM(
+                const char *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+        wei_decomp_zp_ptr_ = CTX_IN_MEM(
+                const char *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
         oscales_ptr_ = oscales;
         dst_scales_ptr_ = dst_scales;
         memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
@@ -751,7 +957,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                         key_conv_amx_tile_buffer)
                 : nullptr;
 
-        const memory_desc_wrapper weights_d(pd->weights_md(0));
+        const memory_desc_wrapper weights_d(pd->packed_weights_md());
         const dim_t comp_offset = bgmmc_.b_dt_sz
                 * (weights_d.size() - weights_d.additional_buffer_size());
         s8s8_compensation_ptr_ = (bgmmc.s8s8_compensation_required)
@@ -773,11 +979,16 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 ? scratchpad.template get<int32_t>(
                         key_brgemm_primitive_zp_comp_b)
                 : nullptr;
+        src_dyn_quant_scales_ptr_ = bgmmc.with_src_dyn_quant
+                ? scratchpad.template get<float>(
+                        key_matmul_src_dyn_quant_scales)
+                : nullptr;
 
         zero_point_a_negative_val_ = -src_zp;
         zero_point_b_negative_val_ = -wei_zp;
+        K_ = bgmmc.is_runtime_K ? helper.K() : bgmmc.K;
         zero_point_mixed_ab_compensation_component_
-                = bgmmc.K * zero_point_a_negative_val_;
+                = K_ * zero_point_a_negative_val_;
 
         zero_point_c_val_ = dst_zp;
 
@@ -807,11 +1018,33 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                                     + s8s8_buffer_sz]));
         }
 
-        // Set last_chunk_brgemm_batch_size_ to brgemm_batch_size
-        // when K_tail = 0 and brgemm_batch_tail_size = 0
-        last_chunk_brgemm_batch_size_ = bgmmc.brgemm_batch_tail_size;
-        if (bgmmc.K_tail == 0 && last_chunk_brgemm_batch_size_ == 0)
-            last_chunk_brgemm_batch_size_ = bgmmc.brgemm_batch_size;
+        if (bgmmc.is_runtime_K) {
+            K_chunks_ = div_up(K_, bgmmc.K_chunk_elems);
+            // The full K blocks of the last chunk, possibly none.
+            last_chunk_brgemm_batch_size_
+                    = (K_ - (K_chunks_ - 1) * bgmmc.K_chunk_elems)
+                    / bgmmc.K_blk;
+            // Cover the K tail with the largest tail kernels that fit, so
+            // that no element beyond K is read.
+            int tail = K_ % bgmmc.K_blk;
+            int k_offset = 0;
+            for (int tail_idx = 0; tail_idx < max_num_dynamic_k_tails;
+                    tail_idx++) {
+                const int tail_ker_size = dynamic_k_tails[tail_idx];
+                while (tail >= tail_ker_size) {
+                    k_tail_processing_.push_back({k_offset, tail_idx + 1});
+                    k_offset += tail_ker_size;
+                    tail -= tail_ker_size;
+                }
+            }
+        } else {
+            K_chunks_ = bgmmc.K_chunks;
+            // Set last_chunk_brgemm_batch_size_ to brgemm_batch_size
+            // when K_tail = 0 and brgemm_batch_tail_size = 0
+            last_chunk_brgemm_batch_size_ = bgmmc.brgemm_batch_tail_size;
+            if (bgmmc.K_tail == 0 && last_chunk_brgemm_batch_size_ == 0)
+                last_chunk_brgemm_batch_size_ = bgmmc.brgemm_batch_size;
+        }
 
         copy_A_src_stride_ = bgmmc.copy_A_src_stride;
         if (bgmmc.is_runtime_M) {
@@ -947,9 +1180,30 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const char *get_data_B_ptr(int b, int k, int n) const {
         int cur_b = get_bb_idx(b, bgmmc_.bcast_B_desc);
+        // Offsets of 4-bit weights are in elements, two per byte.
+        if (bgmmc_.with_wei_decompression)
+            return data_B_ptr_ + get_data_B_off(cur_b, k, n) / 2;
         return data_B_ptr_ + get_data_B_off(cur_b, k, n);
     }
 
+    const void *get_wei_decomp_scales_ptr(int k, int n) const {
+        if (!bgmmc_.with_wei_decomp_scales) return nullptr;
+        const dim_t off = k / bgmmc_.wei_decomp_scales_k_group
+                        * bgmmc_.wei_decomp_scales_k_stride
+                + n * bgmmc_.wei_decomp_scales_n_stride;
+        return wei_decomp_scales_ptr_
+                + off * types::data_type_size(bgmmc_.wei_decomp_scales_dt);
+    }
+
+    const void *get_wei_decomp_zp_ptr(int k, int n) const {
+        if (!bgmmc_.with_wei_decomp_zero_points) return nullptr;
+        const dim_t off = k / bgmmc_.wei_decomp_zp_k_group
+                        * bgmmc_.wei_decomp_zp_k_stride
+                + n * bgmmc_.wei_decomp_zp_n_stride;
+        return wei_decomp_zp_ptr_
+                + off * types::data_type_size(bgmmc_.wei_decomp_zp_dt);
+    }
+
     char *get_data_C_ptr(int b, int m, int n) const {
         return data_C_ptr_ + get_data_C_off(b, m, n);
     }
@@ -981,9 +1235,11 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 + ithr * bgmmc_.brgemm_batch_element_per_thr_sz;
     }
 
+    // k_offset is a shift along K within a block used by the runtime K tail
+    // kernels.
     void init_brgemm_batch_elements_values(int ithr, int brg_batch_start,
             int brg_batch_iters, int b_idx, int m_blk_idx, int k_blk_idx,
-            int n_blk_idx) const {
+            int n_blk_idx, int k_offset = 0) const {
         auto addr_batch = get_batch_elem_ptr(ithr);
 
         const dim_t m = get_M_idx(m_blk_idx, true);
@@ -991,7 +1247,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         for (int b_iter = 0; b_iter < brg_batch_iters; b_iter++) {
             const int brg_batch_idx = brg_batch_start + b_iter;
-            const int k = (k_blk_idx + brg_batch_idx) * bgmmc_.K_blk;
+            const int k
+                    = (k_blk_idx + brg_batch_idx) * bgmmc_.K_blk + k_offset;
             addr_batch[b_iter].ptr.A = bgmmc_.use_buffer_a
                     ? get_buf_A_ptr(ithr, m_blk_idx, brg_batch_idx)
                     : get_data_A_ptr(b_idx, m, k);
@@ -1258,6 +1515,22 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 + m_blk_local * bgmmc_.zp_b_comp_buffer_shift_m;
     }
 
+    float *get_src_dyn_quant_scales_ptr(int ithr, int m_blk_idx) const {
+        if (!bgmmc_.with_src_dyn_quant) return nullptr;
+
+        float *scales_ptr = src_dyn_quant_scales_ptr_
+                + ithr * bgmmc_.src_dyn_quant_scales_elems_per_thr;
+        if (is_runtime_M_tail_chunk(m_blk_idx)) {
+            const dim_t curr_m_buf_shift
+                    = m_tail_processing_[get_M_tail_block_idx(m_blk_idx)]
+                              .buf_dim_idx;
+            return scales_ptr + curr_m_buf_shift;
+        }
+
+        const int m_blk_local = m_blk_idx % M_chunk_size_;
+        return scales_ptr + m_blk_local * bgmmc_.M_blk;
+    }
+
     char *get_tile_workspace(int ithr) const {
         return is_amx_ ? wsp_tile_ptr_ + ithr * bgmmc_.wsp_tile_per_thr_bytes
                        : nullptr;
@@ -1270,7 +1543,19 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     int get_base_brgemm_kernel_idx() const { return base_brg_ker_idx_; }
 
     bool is_last_K_chunk(int k_chunk_idx) const {
-        return k_chunk_idx == bgmmc_.K_chunks - 1;
+        return k_chunk_idx == K_chunks_ - 1;
+    }
+
+    int get_num_K_tail_kernels() const {
+        return bgmmc_.is_runtime_K ? (int)k_tail_processing_.size() : 1;
+    }
+
+    int get_K_tail_kernel_idx(int i_tail) const {
+        return bgmmc_.is_runtime_K ? k_tail_processing_[i_tail].kernel_idx : 1;
+    }
+
+    int get_K_tail_kernel_offset(int i_tail) const {
+        return bgmmc_.is_runtime_K ? k_tail_processing_[i_tail].offset : 0;
     }
 
     int get_brgemm_batch_size(int k_chunk_idx) const {
@@ -1281,14 +1566,14 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     int get_parallel_work_amount() const { return parallel_work_amount_; }
     int get_num_threads_for_k() const { return nthr_k_; }
     bool parallel_reduction_is_used() const {
-        return nthr_k_ > 1 && bgmmc_.K_chunks > 1;
+        return nthr_k_ > 1 && K_chunks_ > 1;
     }
     int get_num_threads_for_bmn() const { return nthr_bmn_; }
     // ithr = ithr_k * nthr_bmn + ithr_bmn
     int get_thread_idx_for_k(int ithr) const {
         if (ithr >= num_threads_used_) return -1;
         const int ithr_k = ithr / nthr_bmn_;
-        return ithr_k < bgmmc_.K_chunks ? ithr_k : -1;
+        return ithr_k < K_chunks_ ? ithr_k : -1;
     }
     int get_thread_idx_for_bmn(int ithr) const {
         if (ithr >= num_threads_used_) return -1;
@@ -1297,6 +1582,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     }
     int get_num_threads_for_parallelization() const { return nthr_; }
     dim_t get_M() const { return M_; }
+    dim_t get_K() const { return K_; }
+    int get_K_chunks() const { return K_chunks_; }
     int get_M_chunks() const { return M_chunks_; }
     int get_num_M_blocks() const { return num_M_blocks_; }
     int get_M_chunk_size() const { return M_chunk_size_; }
@@ -1420,6 +1707,13 @@ private:
         dim_t buf_dim_idx;
     };
 
+    struct k_tail_processing_t {
+        // shift along K within the last K block
+        int offset;
+        // index of tail processing kernel, 0 is reserved for main block
+        int kernel_idx;
+    };
+
     bool is_amx_;
     const brgemm_matmul_conf_t &bgmmc_;
     const char *data_A_ptr_;
@@ -1434,6 +1728,8 @@ private:
 
     char *wsp_tile_ptr_;
     const char *bias_ptr_;
+    const char *wei_decomp_scales_ptr_;
+    const char *wei_decomp_zp_ptr_;
     const float *oscales_ptr_;
     const float *dst_scales_ptr_;
     int32_t *s8s8_compensation_ptr_;
@@ -1441,6 +1737,7 @@ private:
     int32_t *zero_point_a_compensations_ptr_;
     int32_t *zero_point_b_compensations_ptr_;
     int32_t *reorder_zp_a_comp_ptr_;
+    float *src_dyn_quant_scales_ptr_;
 
     int32_t zero_point_a_negative_val_;
     int32_t zero_point_b_negative_val_;
@@ -1466,6 +1763,9 @@ private:
     dim_t A_ptr_shift_b_;
     dim_t copy_A_src_stride_;
     std::vector<tail_processing_t> m_tail_processing_;
+    dim_t K_;
+    int K_chunks_;
+    std::vector<k_tail_processing_t> k_tail_processing_;
 };
 
 template struct brgemm_matmul_t<avx512_core_amx_fp16>;
@@ -17,6 +17,9 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <memory>
+#include <mutex>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
@@ -40,37 +43,53 @@ namespace {
 constexpr int dynamic_m_tails[] = {32, 16, 8, 1};
 constexpr int max_num_dynamic_m_tails
         = sizeof(dynamic_m_tails) / sizeof(dynamic_m_tails[0]);
+// Any K tail smaller than the K block of 16 is covered by a combination of
+// these kernels, see brg_matmul_exec_ctx_t.
+constexpr int dynamic_k_tails[] = {8, 4, 2, 1};
+constexpr int max_num_dynamic_k_tails
+        = sizeof(dynamic_k_tails) / sizeof(dynamic_k_tails[0]);
+// Runtime M and runtime K are not supported together, so the kernels for
+// the tails of either dimension fit into the same set.
 constexpr int max_num_brg_kernels_matmul
         = 2 * 2 * 2 * 2 * (max_num_dynamic_m_tails + 1 /* main kernel size */);
+static_assert(max_num_brg_kernels_matmul
+                >= 2 * 2 * 2 * 2 * (max_num_dynamic_k_tails + 1),
+        "not enough space for runtime K kernels");
 
 inline int get_brg_kernel_index(const brgemm_matmul_conf_t &bgmmc,
         bool is_bs_tail, bool do_initialization, int m_ker_idx, bool is_N_tail,
-        bool is_K_tail, int bs) {
+        int k_ker_idx, int bs) {
     const int max_m_ker_idx
             = bgmmc.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
-    if (m_ker_idx >= max_m_ker_idx) return -1;
+    const int max_k_ker_idx
+            = bgmmc.is_runtime_K ? max_num_dynamic_k_tails + 1 : 2;
+    if (m_ker_idx >= max_m_ker_idx || k_ker_idx >= max_k_ker_idx) return -1;
 
     auto vM = m_ker_idx > 0
             ? (bgmmc.is_runtime_M ? dynamic_m_tails[m_ker_idx - 1]
                                   : bgmmc.M_tail)
             : bgmmc.M_blk;
     auto vN = (is_N_tail) ? bgmmc.N_tail : bgmmc.N_blk;
-    auto vK = (is_K_tail) ? bgmmc.K_tail : bgmmc.K_blk;
+    auto vK = k_ker_idx > 0
+            ? (bgmmc.is_runtime_K ? dynamic_k_tails[k_ker_idx - 1]
+                                  : bgmmc.K_tail)
+            : bgmmc.K_blk;
     if (vM == 0 || vN == 0 || vK == 0 || bs == 0 || bgmmc.LDA < vK
             || bgmmc.LDB < vN || bgmmc.LDC < vN)
         return -1;
 
-    int idx = 16 * m_ker_idx + 8 * (int)is_bs_tail + 4 * (int)do_initialization
-            + 2 * (int)is_N_tail + (int)is_K_tail;
+    const int idx_wo_k = 8 * m_ker_idx + 4 * (int)is_bs_tail
+            + 2 * (int)do_initialization + (int)is_N_tail;
+    int idx = idx_wo_k * max_k_ker_idx + k_ker_idx;
     assert(idx < max_num_brg_kernels_matmul);
     return idx;
 }
 
 inline int get_brg_batchsize(
-        const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail, bool is_K_tail) {
-    auto bs = is_K_tail  ? 1
-            : is_bs_tail ? bgmmc.brgemm_batch_tail_size
-                         : bgmmc.brgemm_batch_size;
+        const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail, int k_ker_idx) {
+    auto bs = k_ker_idx > 0 ? 1
+            : is_bs_tail    ? bgmmc.brgemm_batch_tail_size
+                            : bgmmc.brgemm_batch_size;
     return bs;
 }
 } // namespace
@@ -85,19 +104,31 @@ struct brgemm_matmul_t : public primitive_t {
 
         status_t init(engine_t *engine);
         int get_brg_kernel_idx(bool is_bs_tail, bool do_initialization,
-                int m_ker_idx, bool is_N_tail, bool is_K_tail) const {
-            int bs = get_brg_batchsize(bgmmc_, is_bs_tail, is_K_tail);
+                int m_ker_idx, bool is_N_tail, int k_ker_idx) const {
+            int bs = get_brg_batchsize(bgmmc_, is_bs_tail, k_ker_idx);
             return get_brg_kernel_index(bgmmc_, is_bs_tail, do_initialization,
-                    m_ker_idx, is_N_tail, is_K_tail, bs);
+                    m_ker_idx, is_N_tail, k_ker_idx, bs);
         }
         const brgemm_t &get_brg_desc(int idx) const { return brg_descs_[idx]; }
         const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
             return bgmmc_;
         }
 
+        // With the shared weights attribute, plain weights are reordered to
+        // the blocked layout once per weights memory object and the result
+        // is shared via prepacked_weights_registry_t.
+        bool prepack_weights() const { return bool(weights_reorder_pd_); }
+        // Returns the weights memory descriptor the kernels work with.
+        const memory_desc_t *packed_weights_md() const {
+            return prepack_weights() ? &packed_weights_md_ : weights_md(0);
+        }
+
+        std::shared_ptr<primitive_desc_t> weights_reorder_pd_;
+
     private:
         brgemm_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
+        memory_desc_t packed_weights_md_;
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
@@ -114,6 +145,8 @@ private:
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_body(const exec_ctx_t &ctx) const;
+    status_t get_packed_weights(const exec_ctx_t &ctx,
+            std::shared_ptr<const void> &packed_weights) const;
     void compute_kernel(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
             int b_idx, int m_blk_idx, int n_blk_idx, int k_blk_idx,
             bool do_init, int &prev_ker_idx) const;
@@ -134,6 +167,12 @@ private:
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
+
+    std::shared_ptr<primitive_t> weights_reorder_;
+    // Packed weights for the most recently used weights memory object.
+    mutable std::mutex packed_weights_mutex_;
+    mutable uint64_t packed_weights_user_mem_id_ = 0;
+    mutable std::shared_ptr<const void> packed_weights_;
 };
 
 } // namespace matmul
@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <float.h>
+
 #include "common/c_types_map.hpp"
+#include "common/int4.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -1173,6 +1176,259 @@ void jit_brgemm_matmul_copy_a_transposed_impl_t::generate() {
     postamble();
 }
 
+// Quantizes rows of f32 or bf16 A to s8 while copying them to the A buffer.
+// The scale of a row is computed from the maximum absolute value of the whole
+// row when the first K block of the row is copied, and is reused for the
+// other K blocks of the row.
+struct jit_brgemm_matmul_copy_a_dyn_quant_t : public jit_brgemm_matmul_copy_a_t,
+                                              public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_dyn_quant_t)
+
+    jit_brgemm_matmul_copy_a_dyn_quant_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_a_t(conf)
+        , jit_generator(jit_name())
+        , is_bf16_src_(conf->orig_src_dt == data_type::bf16)
+        , typesize_(conf->a_dt_sz)
+        , src_stride_(conf->copy_A_src_stride)
+        , tr_src_stride_(conf->LDA * conf->tr_a_dt_sz) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using opmask_t = const Xbyak::Opmask;
+    using zmm = const Xbyak::Zmm;
+
+    enum {
+        k_step = 16,
+        unroll = 4,
+        // s8 values are stored in groups of 4 along K
+        vnni_granularity = 4,
+    };
+    const bool is_bf16_src_;
+    const dim_t typesize_;
+    const dim_t src_stride_, tr_src_stride_;
+
+    opmask_t kTailRow = k7;
+    opmask_t kTailLoad = k6;
+    opmask_t kTailStore = k5;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_scales = r8;
+    reg64_t reg_M_blk = r9;
+    reg64_t reg_K_blk = r10;
+    reg64_t reg_K_start = r11;
+    reg64_t reg_aux_src = r12;
+    reg64_t reg_aux_tr_src = r13;
+    reg64_t reg_loop = r14;
+    reg64_t reg_tmp = r15;
+
+    zmm zmm_abs_mask = zmm31;
+    zmm zmm_inv_scale = zmm30;
+    zmm zmm_acc(int i) const {
+        assert(i < unroll);
+        return zmm(i);
+    }
+    zmm zmm_data(int i) const {
+        assert(i < unroll);
+        return zmm(unroll + i);
+    }
+
+    void kmovw(Opmask k, unsigned w) {
+        mov(reg_tmp.cvt32(), w);
+        jit_generator::kmovw(k, reg_tmp.cvt32());
+    }
+    void load_src(zmm z, dim_t k, bool is_tail, Opmask k_tail);
+    void compute_row_scale();
+    void quantize_row(int ncolumns);
+    void copy_M_loop(int ncolumns, bool compute_scales);
+    void generate() override;
+};
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::load_src(
+        zmm z, dim_t k, bool is_tail, Opmask k_tail) {
+    const auto addr = ptr[reg_aux_src + k * typesize_];
+    const auto z_m = is_tail ? z | k_tail | T_z : z;
+    if (is_bf16_src_) {
+        vpmovzxwd(z_m, addr);
+        vpslld(z, z, 16);
+    } else {
+        vmovups(z_m, addr);
+    }
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::compute_row_scale() {
+    // The maximum is taken over the whole row, which starts at reg_src for
+    // the first K block.
+    const dim_t K = conf_->K;
+    const dim_t group = unroll * k_step;
+    const dim_t num_groups = K / group;
+    const dim_t K_rem = K % group;
+
+    auto max_abs = [&](int i, dim_t k, bool is_tail) {
+        load_src(zmm_data(i), k, is_tail, kTailRow);
+        vpandd(zmm_data(i), zmm_data(i), zmm_abs_mask);
+        vmaxps(zmm_acc(i), zmm_acc(i), zmm_data(i));
+    };
+
+    for (int i = 0; i < unroll; i++)
+        vpxord(zmm_acc(i), zmm_acc(i), zmm_acc(i));
+    mov(reg_aux_src, reg_src);
+    if (num_groups > 0) {
+        Label group_loop;
+        mov(reg_loop, num_groups);
+        L(group_loop);
+        for (int i = 0; i < unroll; i++)
+            max_abs(i, i * k_step, false);
+        add(reg_aux_src, group * typesize_);
+        dec(reg_loop);
+        jnz(group_loop, T_NEAR);
+    }
+    for (dim_t k = 0; k < K_rem; k += k_step)
+        max_abs(k / k_step, k, K_rem - k < k_step);
+
+    vmaxps(zmm_acc(0), zmm_acc(0), zmm_acc(1));
+    vmaxps(zmm_acc(2), zmm_acc(2), zmm_acc(3));
+    vmaxps(zmm_acc(0), zmm_acc(0), zmm_acc(2));
+    const Ymm ymm_max = Ymm(zmm_acc(0).getIdx());
+    const Ymm ymm_tmp = Ymm(zmm_acc(1).getIdx());
+    const Xmm xmm_max = Xmm(zmm_acc(0).getIdx());
+    const Xmm xmm_tmp = Xmm(zmm_acc(1).getIdx());
+    vextractf64x4(ymm_tmp, zmm_acc(0), 1);
+    vmaxps(ymm_max, ymm_max, ymm_tmp);
+    vextractf128(xmm_tmp, ymm_max, 1);
+    vmaxps(xmm_max, xmm_max, xmm_tmp);
+    vpermilps(xmm_tmp, xmm_max, 0x4e);
+    vmaxps(xmm_max, xmm_max, xmm_tmp);
+    vpermilps(xmm_tmp, xmm_max, 0xb1);
+    vmaxss(xmm_max, xmm_max, xmm_tmp);
+
+    // scale = max(absmax / 127, FLT_MIN), so that zero rows stay finite
+    mov(reg_tmp.cvt32(), float2int(127.f));
+    vmovd(xmm_tmp, reg_tmp.cvt32());
+    vdivss(xmm_max, xmm_max, xmm_tmp);
+    mov(reg_tmp.cvt32(), float2int(FLT_MIN));
+    vmovd(xmm_tmp, reg_tmp.cvt32());
+    vmaxss(xmm_max, xmm_max, xmm_tmp);
+    vmovss(ptr[reg_scales], xmm_max);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::quantize_row(int ncolumns) {
+    const Xmm xmm_scale = Xmm(zmm_acc(0).getIdx());
+    const Xmm xmm_inv_scale = Xmm(zmm_inv_scale.getIdx());
+    mov(reg_tmp.cvt32(), float2int(1.f));
+    vmovd(xmm_inv_scale, reg_tmp.cvt32());
+    vmovss(xmm_scale, ptr[reg_scales]);
+    vdivss(xmm_inv_scale, xmm_inv_scale, xmm_scale);
+    vbroadcastss(zmm_inv_scale, xmm_inv_scale);
+
+    const int group = unroll * k_step;
+    const int num_groups = ncolumns / group;
+    const int columns_rem = ncolumns % group;
+
+    auto quantize = [&](int i, int k, bool is_tail) {
+        const auto z = zmm_data(i);
+        load_src(z, k, is_tail, kTailLoad);
+        vmulps(z, z, zmm_inv_scale);
+        vcvtps2dq(z, z);
+        // Columns beyond K are zero-padded up to the VNNI granularity.
+        const auto addr = ptr[reg_aux_tr_src + k];
+        if (is_tail)
+            vpmovsdb(addr | kTailStore, z);
+        else
+            vpmovsdb(addr, z);
+    };
+
+    mov(reg_aux_src, reg_src);
+    mov(reg_aux_tr_src, reg_tr_src);
+    if (num_groups > 0) {
+        Label group_loop;
+        mov(reg_loop, num_groups);
+        L(group_loop);
+        for (int i = 0; i < unroll; i++)
+            quantize(i, i * k_step, false);
+        add(reg_aux_src, group * typesize_);
+        add(reg_aux_tr_src, group);
+        dec(reg_loop);
+        jnz(group_loop, T_NEAR);
+    }
+    for (int k = 0; k < columns_rem; k += k_step)
+        quantize(k / k_step, k, columns_rem - k < k_step);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::copy_M_loop(
+        int ncolumns, bool compute_scales) {
+    const int columns_tail = ncolumns % k_step;
+    if (columns_tail > 0) {
+        kmovw(kTailLoad, (1 << columns_tail) - 1);
+        const int store_tail = nstl::min(
+                (int)k_step, utils::rnd_up(columns_tail, vnni_granularity));
+        kmovw(kTailStore, (1 << store_tail) - 1);
+    }
+
+    Label loop_M;
+    L(loop_M);
+
+    if (compute_scales) compute_row_scale();
+    quantize_row(ncolumns);
+
+    add(reg_src, src_stride_);
+    add(reg_tr_src, tr_src_stride_);
+    add(reg_scales, sizeof(float));
+
+    dec(reg_M_blk);
+    jnz(loop_M, T_NEAR);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::generate() {
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(src_dyn_quant_scales)]);
+    mov(reg_K_blk, ptr[param1 + GET_OFF(current_K_blk)]);
+    mov(reg_M_blk, ptr[param1 + GET_OFF(current_M_blk)]);
+    mov(reg_K_start, ptr[param1 + GET_OFF(current_K_start)]);
+
+    mov(reg_tmp.cvt32(), 0x7fffffff);
+    vpbroadcastd(zmm_abs_mask, reg_tmp.cvt32());
+    const int row_tail = conf_->K % k_step;
+    if (row_tail > 0) kmovw(kTailRow, (1 << row_tail) - 1);
+
+    auto copy_body = [this](bool compute_scales) {
+        Label copy_body_done;
+        // might be different from conf_->K_tail
+        const dim_t K_blk_tail
+                = conf_->K_tail > 0 ? conf_->K % conf_->K_blk : 0;
+        if (K_blk_tail > 0) {
+            Label not_K_tail;
+            cmp(reg_K_blk, K_blk_tail);
+            jne(not_K_tail, T_NEAR);
+            copy_M_loop(K_blk_tail, compute_scales);
+            jmp(copy_body_done, T_NEAR);
+
+            L(not_K_tail);
+        }
+
+        copy_M_loop(nstl::min(conf_->K, conf_->K_blk), compute_scales);
+        L(copy_body_done);
+    };
+
+    Label not_first_K_blk, done;
+    cmp(reg_K_start, 0);
+    jne(not_first_K_blk, T_NEAR);
+    copy_body(true);
+    jmp(done, T_NEAR);
+
+    L(not_first_K_blk);
+    copy_body(false);
+    L(done);
+
+    postamble();
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_b_int8_t : public jit_brgemm_matmul_copy_b_t,
                                          public jit_generator {
@@ -2232,6 +2488,279 @@ void jit_brgemm_matmul_copy_b_f32_t::generate() {
     postamble();
 }
 
+// Decompresses packed 4-bit weights to f32 or to bf16 in VNNI format. Each
+// call processes rows of B that share the same scales and zero points:
+//     tr_src[k][n] = (w[k][n] - zp[n]) * scale[n]
+struct jit_brgemm_matmul_copy_b_decompress_t : public jit_brgemm_matmul_copy_b_t,
+                                               public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_b_decompress_t)
+
+    jit_brgemm_matmul_copy_b_decompress_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_b_t(conf)
+        , jit_generator(jit_name())
+        , is_bf16_out_(conf->wei_dt == data_type::bf16)
+        , k_blk_step_(is_bf16_out_ ? 2 : 1)
+        , src_stride_(conf->N / 2)
+        , tr_src_stride_(conf->LDB * k_blk_step_ * conf->tr_b_dt_sz) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using reg32_t = const Xbyak::Reg32;
+    using opmask_t = const Xbyak::Opmask;
+    using zmm = const Xbyak::Zmm;
+
+    enum {
+        n_blk_step = 16,
+        max_n_blks = 4,
+        // Each row (or pair of rows for bf16) uses two data registers and
+        // a temporary one.
+        regs_per_blk = 3,
+        max_unroll = 7,
+    };
+    const bool is_bf16_out_;
+    const int k_blk_step_;
+    const dim_t src_stride_, tr_src_stride_;
+
+    opmask_t kTail = k7;
+    opmask_t kTailBytes = k5;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_K_iters = r8;
+    reg64_t reg_N_blk = r9;
+    reg64_t reg_scales = r10;
+    reg64_t reg_zp = r11;
+    reg32_t regw_tmp = r14d;
+    reg64_t reg_tmp = r15;
+
+    zmm zmm_zero = zmm31;
+    zmm zmm_permw = zmm30;
+    zmm zmm_lut = zmm29;
+    zmm zmm_scales(int n_blk) const { return zmm(28 - n_blk); }
+    zmm zmm_zp(int n_blk) const { return zmm(24 - n_blk); }
+    zmm zmm_data(int blk, int idx) const {
+        assert(blk < max_unroll && idx < regs_per_blk);
+        return zmm(blk * regs_per_blk + idx);
+    }
+
+    void kmovw(Opmask k, unsigned w) {
+        mov(regw_tmp, w);
+        jit_generator::kmovw(k, regw_tmp);
+    }
+    void load_params(zmm z, reg64_t base, data_type_t dt, dim_t n_stride,
+            int n, bool is_tail);
+    void decompress_row(zmm z, zmm z_tmp, int k, int n, bool is_tail);
+    void copy_block(int nrows, int ncolumns);
+    void compute_k_loop(int ncolumns);
+    void generate() override;
+};
+
+void jit_brgemm_matmul_copy_b_decompress_t::load_params(zmm z, reg64_t base,
+        data_type_t dt, dim_t n_stride, int n, bool is_tail) {
+    using namespace data_type;
+    if (n_stride == 0) {
+        const auto addr = ptr[base];
+        switch (dt) {
+            case f32: vbroadcastss(z, addr); break;
+            case bf16:
+                vpbroadcastw(z, addr);
+                vpslld(z, z, 16);
+                break;
+            case f16:
+                vpbroadcastw(z, addr);
+                vcvtph2ps(z, Ymm(z.getIdx()));
+                break;
+            case s32: vpbroadcastd(z, addr); break;
+            case s8:
+                movsx(regw_tmp, byte[base]);
+                vpbroadcastd(z, regw_tmp);
+                break;
+            case u8:
+                movzx(regw_tmp, byte[base]);
+                vpbroadcastd(z, regw_tmp);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    } else {
+        const auto addr = ptr[base + n * types::data_type_size(dt)];
+        const auto z_m = is_tail ? z | kTail | T_z : z;
+        switch (dt) {
+            case f32: vmovups(z_m, addr); break;
+            case bf16:
+                vpmovzxwd(z_m, addr);
+                vpslld(z, z, 16);
+                break;
+            case f16: vcvtph2ps(z_m, addr); break;
+            case s32: vmovdqu32(z_m, addr); break;
+            case s8: vpmovsxbd(z_m, addr); break;
+            case u8: vpmovzxbd(z_m, addr); break;
+            default: assert(!"unsupported data type");
+        }
+    }
+    if (utils::one_of(dt, s32, s8, u8)) vcvtdq2ps(z, z);
+}
+
+void jit_brgemm_matmul_copy_b_decompress_t::decompress_row(
+        zmm z, zmm z_tmp, int k, int n, bool is_tail) {
+    // Spread 8 bytes to the low bytes of 8 qwords, then move the high half
+    // of each byte to the upper dword of the qword. Shifting the dwords left
+    // and back right leaves a single 4-bit value in each of 16 dwords.
+    const auto addr = ptr[reg_src + k * src_stride_ + n / 2];
+    vpmovzxbq(is_tail ? z | kTailBytes | T_z : z, addr);
+    vpsllq(z_tmp, z, 28);
+    vpord(z, z, z_tmp);
+    vpslld(z, z, 28);
+    if (conf_->orig_wei_dt == data_type::s4)
+        vpsrad(z, z, 28);
+    else
+        vpsrld(z, z, 28);
+
+    if (conf_->orig_wei_dt == data_type::nf4)
+        vpermps(z, z, zmm_lut);
+    else
+        vcvtdq2ps(z, z);
+
+    const int n_blk = n / n_blk_step;
+    if (conf_->with_wei_decomp_zero_points) vsubps(z, z, zmm_zp(n_blk));
+    if (conf_->with_wei_decomp_scales) vmulps(z, z, zmm_scales(n_blk));
+    // Columns beyond N are zero-padded in the buffer.
+    if (is_tail) vmovups(z | kTail | T_z, z);
+}
+
+void jit_brgemm_matmul_copy_b_decompress_t::copy_block(
+        int nrows, int ncolumns) {
+    const dim_t tr_typesize = conf_->tr_b_dt_sz;
+    int iter = 0;
+    for_(int k = 0; k < nrows; k += k_blk_step_)
+    for (int n = 0; n < conf_->wei_n_blk; n += n_blk_step) {
+        const dim_t tr_src_off = (k / k_blk_step_) * tr_src_stride_
+                + n * k_blk_step_ * tr_typesize;
+        const auto store_addr = EVEX_compress_addr(reg_tr_src, tr_src_off);
+
+        const int columns_left = ncolumns - n;
+        if (columns_left <= 0) {
+            vmovups(store_addr, zmm_zero);
+            continue;
+        }
+
+        const bool is_tail = columns_left < n_blk_step;
+        const int blk = iter++ % max_unroll;
+        const auto z0 = zmm_data(blk, 0);
+        const auto z1 = zmm_data(blk, 1);
+        const auto z_tmp = zmm_data(blk, 2);
+
+        decompress_row(z0, z_tmp, k, n, is_tail);
+        if (!is_bf16_out_) {
+            vmovups(store_addr, z0);
+            continue;
+        }
+
+        if (nrows - k >= 2) {
+            decompress_row(z1, z_tmp, k + 1, n, is_tail);
+            vcvtne2ps2bf16(z0, z1, z0);
+        } else {
+            vcvtneps2bf16(Ymm(z0.getIdx()), z0);
+        }
+        vpermw(z0, zmm_permw, z0);
+        vmovups(store_addr, z0);
+    }
+}
+
+void jit_brgemm_matmul_copy_b_decompress_t::compute_k_loop(int ncolumns) {
+    const int columns_tail = ncolumns % n_blk_step;
+    if (columns_tail > 0) {
+        kmovw(kTail, (1 << columns_tail) - 1);
+        kmovw(kTailBytes, (1 << utils::div_up(columns_tail, 2)) - 1);
+    }
+
+    for (int n = 0; n < ncolumns; n += n_blk_step) {
+        const bool is_tail = ncolumns - n < n_blk_step;
+        const int n_blk = n / n_blk_step;
+        if (conf_->with_wei_decomp_scales)
+            load_params(zmm_scales(n_blk), reg_scales,
+                    conf_->wei_decomp_scales_dt,
+                    conf_->wei_decomp_scales_n_stride, n, is_tail);
+        if (conf_->with_wei_decomp_zero_points)
+            load_params(zmm_zp(n_blk), reg_zp, conf_->wei_decomp_zp_dt,
+                    conf_->wei_decomp_zp_n_stride, n, is_tail);
+    }
+
+    auto compute_uni_k_loop = [&](int unroll) {
+        Label K_start_label, K_end_label;
+
+        L(K_start_label);
+        cmp(reg_K_iters, unroll * k_blk_step_);
+        jl(K_end_label, T_NEAR);
+
+        copy_block(unroll * k_blk_step_, ncolumns);
+        add(reg_src, unroll * k_blk_step_ * src_stride_);
+        add(reg_tr_src, unroll * tr_src_stride_);
+
+        sub(reg_K_iters, unroll * k_blk_step_);
+        jmp(K_start_label, T_NEAR);
+
+        L(K_end_label);
+    };
+
+    constexpr int k_unroll = 8;
+    compute_uni_k_loop(k_unroll);
+    compute_uni_k_loop(1);
+
+    if (is_bf16_out_) {
+        // The last odd row is paired with zeros.
+        Label K_loop_done;
+        cmp(reg_K_iters, 0);
+        jle(K_loop_done, T_NEAR);
+        copy_block(1, ncolumns);
+        L(K_loop_done);
+    }
+}
+
+void jit_brgemm_matmul_copy_b_decompress_t::generate() {
+    assert(conf_->wei_n_blk <= max_n_blks * n_blk_step);
+    alignas(64) static constexpr const int16_t bf16_vnni_permute[32]
+            = {0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23, 8, 24, 9,
+                    25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31};
+
+    preamble();
+    vpxord(zmm_zero, zmm_zero, zmm_zero);
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_K_iters, ptr[param1 + GET_OFF(current_K_iters)]);
+    mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(scales_ptr)]);
+    mov(reg_zp, ptr[param1 + GET_OFF(zp_ptr)]);
+
+    if (is_bf16_out_) {
+        mov(reg_tmp, reinterpret_cast<size_t>(bf16_vnni_permute));
+        vmovdqa64(zmm_permw, ptr[reg_tmp]);
+    }
+    if (conf_->orig_wei_dt == data_type::nf4) {
+        mov(reg_tmp, reinterpret_cast<size_t>(nf4_t::lut));
+        vmovups(zmm_lut, ptr[reg_tmp]);
+    }
+
+    Label done;
+    if (conf_->N_tail > 0) {
+        Label not_N_tail;
+        cmp(reg_N_blk, conf_->N_tail);
+        jne(not_N_tail, T_NEAR);
+        compute_k_loop(conf_->N_tail);
+        jmp(done, T_NEAR);
+
+        L(not_N_tail);
+    }
+
+    compute_k_loop(conf_->N_blk);
+    L(done);
+
+    postamble();
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_b_transposed_t
     : public jit_brgemm_matmul_copy_b_t,
@@ -2874,7 +3403,10 @@ status_t create_brgemm_matmul_copy_b(
     // to imply upconverting. So, the assumption is `is_f1`6 below evaluates to
     // `false` on avx512_core_fp16.
     const bool is_f16 = everyone_is(data_type::f16, conf->src_dt, conf->wei_dt);
-    if (is_B_transposed) {
+    if (conf->with_wei_decompression) {
+        CHECK(safe_ptr_assign(
+                copy_ker, new jit_brgemm_matmul_copy_b_decompress_t(conf)));
+    } else if (is_B_transposed) {
         if (is_superset(conf->isa, avx512_core))
             CHECK(safe_ptr_assign(copy_ker,
                     new jit_brgemm_matmul_copy_b_transposed_t<Zmm>(conf)));
@@ -2915,7 +3447,11 @@ status_t create_brgemm_matmul_copy_b(
 status_t create_brgemm_matmul_copy_a(
         std::unique_ptr<jit_brgemm_matmul_copy_a_t> &copy_ker,
         const brgemm_matmul_conf_t *conf) {
-    if (conf->transposed_A) {
+    if (conf->with_src_dyn_quant) {
+        assert(!conf->transposed_A && is_superset(conf->isa, avx512_core));
+        CHECK(safe_ptr_assign(
+                copy_ker, new jit_brgemm_matmul_copy_a_dyn_quant_t(conf)));
+    } else if (conf->transposed_A) {
         CHECK(safe_ptr_assign(copy_ker,
                 new jit_brgemm_matmul_copy_a_transposed_impl_t(conf)));
     } else {
@@ -32,6 +32,10 @@ struct jit_brgemm_matmul_copy_b_t {
         const void *compensation_ptr;
         const void *zp_a_compensation_ptr;
         const void *zp_a_neg_value_ptr;
+        // Scales and zero points of compressed weights for the first row of
+        // the block.
+        const void *scales_ptr;
+        const void *zp_ptr;
 
         dim_t current_K_start;
         dim_t current_K_iters;
@@ -56,6 +60,9 @@ struct jit_brgemm_matmul_copy_a_t {
         const void *zp_a_compensation_result_ptr;
         const void *zp_b_neg_value_ptr;
         const void *zp_ab_comp_ptr;
+        // Per-row scales of dynamically quantized A for the first row of the
+        // block.
+        const void *src_dyn_quant_scales;
 
         dim_t current_K_start;
         dim_t current_K_blk;
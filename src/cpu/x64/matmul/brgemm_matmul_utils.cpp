@@ -80,13 +80,15 @@ int get_default_n_block(format_tag_t matrix_b_tag) {
         case aCB16b32c4b:
         case BA16a32b:
         case BA16a32b2a:
-        case BA16a32b4a: return 32;
+        case BA16a32b4a:
+        case AB16a32b: return 32;
         case aCB16b16c:
         case aCB16b16c2b:
         case aCB16b16c4b:
         case BA16a16b:
         case BA16a16b2a:
-        case BA16a16b4a: return 16;
+        case BA16a16b4a:
+        case AB16a16b: return 16;
         default: return 64;
     }
 }
@@ -265,6 +267,14 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_tags(memory_desc_t &A_md,
                         transposed_tensor_layout_tag, acbd, adbc)
                 : memory_desc_matches_one_of_tag(
                         A_md, plain_tensor_layout_tag, acbd);
+        if (bgmmc.src_tag == format_tag::undef && bgmmc.is_runtime_K) {
+            // With runtime K, A is taken from a buffer preallocated for the
+            // largest K, so its rows may be longer than K.
+            const dims_t any_row_stride = {-1};
+            if (memory_desc_matches_tag(
+                        A_md, plain_tensor_layout_tag, any_row_stride))
+                bgmmc.src_tag = plain_tensor_layout_tag;
+        }
     }
 
     if (C_any_layout) {
@@ -315,6 +325,21 @@ format_tag_t brgemm_matmul_conf_utils_t::pick_blocked_B_layout(
         int n_blk) const {
 
     if (bgmmc.ndims > 3) return format_tag::undef;
+    // Decompression is implemented for plain weights only.
+    if (bgmmc.with_wei_decompression) return format_tag::undef;
+    // With runtime K the blocks along K are outermost, so the strides of
+    // weights do not depend on K and appending rows writes new blocks only.
+    // Such layouts are available for 16 and 32 N blocks.
+    if (bgmmc.is_runtime_K) {
+        if (bgmmc.ndims != 2 || !this->is_f32()) return format_tag::undef;
+        switch (n_blk) {
+            case 64:
+            case 48:
+            case 32: return AB16a32b;
+            case 16: return AB16a16b;
+            default: return format_tag::undef;
+        }
+    }
     if (this->is_int8()) switch (n_blk) {
             case 64: return bgmmc.ndims == 3 ? aCB16b64c4b : BA16a64b4a;
             case 48: return bgmmc.ndims == 3 ? aCB16b48c4b : BA16a48b4a;
@@ -789,6 +814,33 @@ float compute_blocking_heuristic_avx2(brgemm_matmul_conf_t &bgmmc,
     return best_imbalance;
 }
 
+// For runtime M the actual size is unknown at primitive creation time, so
+// there is nothing to search over. Use a fixed M block which matches the set of
+// pre-generated M tail kernels (see dynamic_m_tails) and distribute the work
+// over M blocks and N blocks only. This keeps a single primitive (and a single
+// primitive cache entry) valid for any M.
+void compute_blocking_heuristic_runtime_M(const brgemm_matmul_conf_t &bgmmc,
+        const matmul_avx512_blocking_params_t::matmul_params_t &matmul,
+        int default_k_blk, matmul_avx512_blocking_params_t &best_blocking) {
+    assert(bgmmc.is_runtime_M);
+    const int m_blk = 64;
+    const int k_blk = nstl::min(matmul.K, default_k_blk);
+    best_blocking.update_params(1, m_blk, 1, bgmmc.N_blk, 1, k_blk, 1);
+}
+
+// For runtime K the reduction size is unknown at primitive creation time.
+// Use K blocks of the size of the blocks of weights along K, which keeps each
+// batch element within a single block of K-outer blocked weights, and pick
+// the other parameters as if the problem was not split along K.
+void compute_blocking_heuristic_runtime_K(const brgemm_matmul_conf_t &bgmmc,
+        matmul_avx512_blocking_params_t &best_blocking) {
+    assert(bgmmc.is_runtime_K);
+    const int m_blk = nstl::min(bgmmc.M, static_cast<dim_t>(64));
+    const int batch_size = 32;
+    best_blocking.update_params(
+            1, m_blk, 1, bgmmc.N_blk, batch_size, bgmmc.wei_k_blk, 1);
+}
+
 status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils) {
 
@@ -882,28 +934,47 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
         // - unused.
 
         const matmul_avx512_blocking_params_t::matmul_params_t matmul(
-                bgmmc.M, bgmmc.N, bgmmc.K, bgmmc.batch);
+                bgmmc.is_runtime_M ? 0 : bgmmc.M, bgmmc.N,
+                bgmmc.is_runtime_K ? 0 : bgmmc.K, bgmmc.batch);
 
         matmul_avx512_blocking_params_t best_blocking(matmul, bgmmc.nthr);
 
-        const float best_imbalance = compute_blocking_heuristic_avx512(
-                bgmmc, bm_conf_utils, matmul, best_blocking);
+        if (bgmmc.is_runtime_K) {
+            compute_blocking_heuristic_runtime_K(bgmmc, best_blocking);
+        } else if (bgmmc.is_runtime_M) {
+            const bool use_extended_k_blk = matmul.K > 1024
+                    && (!bm_conf_utils.check_is_transposed(bgmmc.src_tag));
+            compute_blocking_heuristic_runtime_M(bgmmc, matmul,
+                    use_extended_k_blk ? 1024 : 512, best_blocking);
+        } else {
+            const float best_imbalance = compute_blocking_heuristic_avx512(
+                    bgmmc, bm_conf_utils, matmul, best_blocking);
 
-        if (best_imbalance == 1.f) return status::unimplemented;
+            if (best_imbalance == 1.f) return status::unimplemented;
+        }
 
         best_blocking.update_configuration(bgmmc);
+        // The partial results along K are accumulated in the destination
+        // unless the sum post-op needs its original values.
+        if (bgmmc.is_runtime_K) bgmmc.use_buffer_c = bgmmc.with_sum;
     } else {
         assert(one_of(bm_conf_utils.get_isa(), avx2_vnni, avx2_vnni_2));
 
         const matmul_avx512_blocking_params_t::matmul_params_t matmul(
-                bgmmc.M, bgmmc.N, bgmmc.K, bgmmc.batch);
+                bgmmc.is_runtime_M ? 0 : bgmmc.M, bgmmc.N, bgmmc.K,
+                bgmmc.batch);
 
         matmul_avx512_blocking_params_t best_blocking(matmul, bgmmc.nthr);
 
-        const float best_imbalance = compute_blocking_heuristic_avx2(
-                bgmmc, bm_conf_utils, matmul, best_blocking);
+        if (bgmmc.is_runtime_M) {
+            compute_blocking_heuristic_runtime_M(
+                    bgmmc, matmul, 1024, best_blocking);
+        } else {
+            const float best_imbalance = compute_blocking_heuristic_avx2(
+                    bgmmc, bm_conf_utils, matmul, best_blocking);
 
-        if (best_imbalance == 1.f) return status::unimplemented;
+            if (best_imbalance == 1.f) return status::unimplemented;
+        }
 
         best_blocking.update_configuration(bgmmc);
     }
@@ -911,6 +982,73 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
     return status::success;
 }
 
+// Describes how scales and zero points of compressed weights are laid out.
+// Both may be common, per N, or per group of rows along K and per N.
+static status_t init_wei_decompression_conf(
+        brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr) {
+    const int n_mask = 1 << (bgmmc.ndims - 1);
+    const int k_mask = 1 << (bgmmc.ndims - 2);
+
+    // Returns the group size along K, or 0 if the groups are not supported.
+    auto get_k_group = [&](int mask, int groups_ndims,
+                               const dims_t groups) -> dim_t {
+        if (mask & ~(n_mask | k_mask)) return 0;
+        if (!(mask & k_mask)) return groups_ndims == 0 ? bgmmc.K : 0;
+        if (groups_ndims == 0) return 1;
+        // Groups along N are not supported.
+        if (groups_ndims != 2 || groups[1] != 1) return 0;
+        return bgmmc.K % groups[0] == 0 ? groups[0] : 0;
+    };
+
+    const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
+    bgmmc.with_wei_decomp_scales = !wei_scales.has_default_values();
+    bgmmc.wei_decomp_scales_k_group = bgmmc.K;
+    if (bgmmc.with_wei_decomp_scales) {
+        const int mask = wei_scales.mask_;
+        bgmmc.wei_decomp_scales_dt = wei_scales.data_type_;
+        bgmmc.wei_decomp_scales_n_stride = (mask & n_mask) ? 1 : 0;
+        bgmmc.wei_decomp_scales_k_stride
+                = (mask & k_mask) ? ((mask & n_mask) ? bgmmc.N : 1) : 0;
+        bgmmc.wei_decomp_scales_k_group = get_k_group(
+                mask, wei_scales.ndims_, wei_scales.group_dims_);
+        VCONDCHECK_BG(bgmmc.wei_decomp_scales_k_group > 0
+                        && one_of(bgmmc.wei_decomp_scales_dt, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    const auto &zp = attr.zero_points_;
+    bgmmc.with_wei_decomp_zero_points
+            = !zp.has_default_values(DNNL_ARG_WEIGHTS);
+    bgmmc.wei_decomp_zp_k_group = bgmmc.K;
+    if (bgmmc.with_wei_decomp_zero_points) {
+        const int mask = zp.get(DNNL_ARG_WEIGHTS);
+        bgmmc.wei_decomp_zp_dt = zp.get_data_type(DNNL_ARG_WEIGHTS);
+        bgmmc.wei_decomp_zp_n_stride = (mask & n_mask) ? 1 : 0;
+        bgmmc.wei_decomp_zp_k_stride
+                = (mask & k_mask) ? ((mask & n_mask) ? bgmmc.N : 1) : 0;
+        bgmmc.wei_decomp_zp_k_group = get_k_group(mask,
+                zp.get_groups_ndims(DNNL_ARG_WEIGHTS),
+                zp.get_groups(DNNL_ARG_WEIGHTS));
+        VCONDCHECK_BG(bgmmc.wei_decomp_zp_k_group > 0
+                        && one_of(bgmmc.wei_decomp_zp_dt, s32, s8, u8),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
+    bgmmc.wei_decomp_k_group = math::gcd((int)bgmmc.wei_decomp_scales_k_group,
+            (int)bgmmc.wei_decomp_zp_k_group);
+
+    // Two elements share a byte, so a row must start at a byte boundary.
+    VCONDCHECK_BG(bgmmc.N % 2 == 0, VERBOSE_BAD_DIM, "N", 1);
+    // bf16 values are copied as pairs of rows along K, so scales and zero
+    // points must not change in the middle of a pair.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.src_dt == bf16,
+                          bgmmc.wei_decomp_k_group % 2 == 0
+                                  || bgmmc.wei_decomp_k_group == bgmmc.K),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    return status::success;
+}
+
 status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         const matmul_desc_t &mmd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -928,10 +1066,39 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.dst_dt = dst_d.data_type();
     bgmmc.wei_dt = weights_d.data_type();
 
+    bgmmc.orig_wei_dt = bgmmc.wei_dt;
+    bgmmc.with_wei_decompression = types::is_4bit(bgmmc.orig_wei_dt);
+    if (bgmmc.with_wei_decompression) {
+        // The weights are decompressed to the source data type while being
+        // copied to the B buffer, so the rest is a regular f32 or bf16
+        // problem.
+        VCONDCHECK_BG(is_superset(isa, avx512_core)
+                        && one_of(bgmmc.src_dt, f32, bf16),
+                VERBOSE_UNSUPPORTED_DT_CFG);
+        bgmmc.wei_dt = bgmmc.src_dt;
+    }
+
+    bgmmc.orig_src_dt = bgmmc.src_dt;
+    bgmmc.with_src_dyn_quant = attr.src_dyn_quant_dt_ == s8;
+    if (bgmmc.with_src_dyn_quant) {
+        // A is quantized to s8 while being copied to the A buffer, so the
+        // rest is a regular int8 problem. Full range s8 data saturates the
+        // int16 pair sums of vpmaddubsw, so VNNI is required.
+        VCONDCHECK_BG(is_superset(isa, avx512_core_vnni)
+                        && one_of(bgmmc.src_dt, f32, bf16)
+                        && bgmmc.wei_dt == s8
+                        && one_of(bgmmc.dst_dt, f32, bf16),
+                VERBOSE_UNSUPPORTED_DT_CFG);
+        bgmmc.src_dt = s8;
+    }
+
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
     bgmmc.s8s8_compensation_required = bgmmc.src_dt == s8 && !isa_has_s8s8(isa);
     bgmmc.ndims = dst_d.ndims();
+    // The layout of weights depends on whether K is known, see
+    // pick_blocked_B_layout().
+    bgmmc.is_runtime_K = is_runtime_value(weights_d.dims()[bgmmc.ndims - 2]);
 
     brgemm_matmul_conf_utils_t bm_conf_utils(bgmmc, isa, attr,
             src_d.format_kind() == format_kind::any,
@@ -945,8 +1112,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_amx = is_superset(isa, avx512_core_amx);
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    if (bgmmc.with_wei_decompression) bgmmc.b_dt_sz = 1;
+    if (bgmmc.with_src_dyn_quant)
+        bgmmc.a_dt_sz = types::data_type_size(bgmmc.orig_src_dt);
 
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_wei_decompression, !bgmmc.is_bf32),
+            VERBOSE_UNSUPPORTED_FPMATH_MODE);
 
     // Make BRGeMM compute MatMul as if it were in bfloat16, while down-convert
     // happens during copy-buffer computations
@@ -971,9 +1143,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
+    // Weights scales are applied during decompression.
     bgmmc.with_scales = !src_scales.has_default_values()
-            || !wei_scales.has_default_values();
-    if (bgmmc.with_scales) {
+            || (!wei_scales.has_default_values()
+                    && !bgmmc.with_wei_decompression);
+    if (bgmmc.with_scales && bgmmc.with_wei_decompression) {
+        bgmmc.is_oscale_per_n = false;
+    } else if (bgmmc.with_scales) {
         bgmmc.is_oscale_per_n = wei_scales.mask_ == 1 << (bgmmc.ndims - 1);
 
         // only common and per-oc-channel scales are supported
@@ -981,6 +1157,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
     }
 
+    // The scales of dynamically quantized A are computed by the library.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dyn_quant,
+                          src_scales.has_default_values()),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
     const auto &dst_scales = attr.scales_.get(DNNL_ARG_DST);
     bgmmc.with_dst_scales = !dst_scales.has_default_values();
     // only common scales are supported
@@ -997,7 +1178,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     VCONDCHECK_BG(post_ops_ok(bgmmc, attr, dst_d), VERBOSE_UNSUPPORTED_POSTOP);
 
     bgmmc.src_zp_type = get_zp_type(attr, DNNL_ARG_SRC);
-    bgmmc.wei_zp_type = get_zp_type(attr, DNNL_ARG_WEIGHTS);
+    bgmmc.wei_zp_type = bgmmc.with_wei_decompression
+            ? brgemm_broadcast_t::none
+            : get_zp_type(attr, DNNL_ARG_WEIGHTS);
     bgmmc.dst_zp_type = get_zp_type(attr, DNNL_ARG_DST);
 
     VCONDCHECK_BG(
@@ -1005,6 +1188,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                     everyone_is(brgemm_broadcast_t::none, bgmmc.src_zp_type,
                             bgmmc.wei_zp_type, bgmmc.dst_zp_type)),
             VERBOSE_UNSUPPORTED_ZP_CFG);
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dyn_quant,
+                          bgmmc.src_zp_type == brgemm_broadcast_t::none),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
 
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
@@ -1015,20 +1201,39 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.batch = helper.batch();
     bgmmc.is_runtime_M = is_runtime_value(bgmmc.M);
     bgmmc.is_runtime_N = is_runtime_value(bgmmc.N);
-    bgmmc.is_runtime_K = is_runtime_value(bgmmc.K);
 
-    // runtime value for M dimension is only supported
-    if (is_runtime_value(bgmmc.batch) || bgmmc.is_runtime_N
-            || bgmmc.is_runtime_K)
+    // runtime value for M and K dimensions is only supported
+    if (is_runtime_value(bgmmc.batch) || bgmmc.is_runtime_N)
         return status::unimplemented;
 
-    // Runtime value for M dimension is supported for 2d AMX int8/bfloat16
-    // problems only.
-    const bool runtime_M_supported = bgmmc.is_amx && bgmmc.ndims == 2
-            && one_of(true, bm_conf_utils.is_int8(), bm_conf_utils.is_bf16());
+    // Runtime value for M dimension is supported for 2d problems only. M tail
+    // kernels for a fixed set of sizes are generated at creation time and
+    // combined at execution time to cover any M. On AMX only int8/bfloat16
+    // problems are supported.
+    const bool runtime_M_supported = bgmmc.ndims == 2
+            && IMPLICATION(bgmmc.is_amx,
+                    one_of(true, bm_conf_utils.is_int8(),
+                            bm_conf_utils.is_bf16()));
     if (bgmmc.is_runtime_M && !runtime_M_supported)
         return status::unimplemented;
 
+    // Runtime value for K dimension is supported for 2d f32 problems with
+    // known M. K tail kernels for a fixed set of sizes are generated at
+    // creation time and combined at execution time to cover any K. A and B
+    // are read in place, so their strides must not depend on K: A is taken
+    // from a buffer preallocated for the largest K, and B is either plain or
+    // blocked with the blocks along K outermost.
+    const bool runtime_K_supported = bgmmc.ndims == 2 && !bgmmc.is_runtime_M
+            && bm_conf_utils.is_f32() && !bgmmc.is_bf32
+            && !bgmmc.with_wei_decompression;
+    if (bgmmc.is_runtime_K && !runtime_K_supported)
+        return status::unimplemented;
+
+    if (bgmmc.with_wei_decompression) {
+        VCONDCHECK_BG(!bgmmc.is_runtime_M, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        CHECK(init_wei_decompression_conf(bgmmc, attr));
+    }
+
     bgmmc.batch_without_first_dim
             = bgmmc.batch_ndims > 1 ? helper.batch() / dst_d.dims()[0] : 0;
 
@@ -1066,6 +1271,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             VERBOSE_UNSUPPORTED_TAG);
     VCHECK_BG(bm_conf_utils.set_or_check_B_tag(weights_md),
             VERBOSE_UNSUPPORTED_TAG);
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_wei_decompression,
+                          bm_conf_utils.check_is_plain(bgmmc.wei_tag)),
+            VERBOSE_UNSUPPORTED_TAG);
 
     bgmmc.req_wei_vnni_downconvert = bm_conf_utils.wei_down_convert_to_vnni();
 
@@ -1078,6 +1286,14 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.transposed_A = (bm_conf_utils.check_is_transposed(bgmmc.src_tag)
             || bgmmc.src_tag == adbc);
+    // Rows of A are quantized in place of the regular copy, so they must be
+    // contiguous along K.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dyn_quant,
+                          !bgmmc.transposed_A && bgmmc.src_tag != acbd),
+            VERBOSE_UNSUPPORTED_TAG);
+    // The row scales are computed over K known at creation time.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dyn_quant, !bgmmc.is_runtime_K),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     // runtime A stride wrt M dimension is not acceptable
     if (is_runtime_value(helper.get_a_stride(bgmmc.ndims - 2)))
@@ -1109,8 +1325,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                               || bm_conf_utils.is_bf32()))
             || (bm_conf_utils.is_f16() && isa == avx512_core_fp16)
             || bgmmc.wei_zp_type != brgemm_broadcast_t::none
-            || bgmmc.transposed_A || lda_is_big_2pow;
+            || bgmmc.transposed_A || lda_is_big_2pow
+            || bgmmc.with_src_dyn_quant;
     bgmmc.use_buffer_a = is_copy_a_required;
+    VCONDCHECK_BG(IMPLICATION(bgmmc.is_runtime_K, !bgmmc.use_buffer_a),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
@@ -1142,6 +1361,14 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // - nthr_K
     VCHECK_BG(compute_blocking_heuristic(bgmmc, bm_conf_utils),
             VERBOSE_BLOCKING_FAIL);
+    // The scale of a row is computed when its first K block is copied, so
+    // all the K blocks of a row have to be processed by the same thread.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dyn_quant, bgmmc.nthr_k == 1),
+            VERBOSE_BLOCKING_FAIL);
+
+    // A is read in place with runtime K, so its leading dimension is the row
+    // stride of the preallocated buffer rather than K.
+    if (bgmmc.is_runtime_K) bgmmc.LDA = bgmmc.A_strides[1] / bgmmc.a_dt_sz;
 
     if (bgmmc.wei_n_blk > bgmmc.N_blk
             && IMPLICATION(
@@ -1159,7 +1386,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.M_tail = bgmmc.is_runtime_M ? 0 : bgmmc.M % bgmmc.M_blk;
     bgmmc.N_tail = bgmmc.N % bgmmc.N_blk;
-    bgmmc.K_tail = bgmmc.K > bgmmc.K_blk
+    bgmmc.K_tail = !bgmmc.is_runtime_K && bgmmc.K > bgmmc.K_blk
             ? rnd_up(bgmmc.K % bgmmc.K_blk, bgmmc.required_k_granularity)
             : 0;
 
@@ -1183,15 +1410,22 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.K_chunk_elems = bgmmc.K_blk * bgmmc.brgemm_batch_size;
     bgmmc.M_chunks = div_up(bgmmc.M, bgmmc.M_chunk_elems);
     bgmmc.N_chunks = div_up(bgmmc.N, bgmmc.N_chunk_elems);
-    bgmmc.K_chunks = div_up(bgmmc.K, bgmmc.K_chunk_elems);
     bgmmc.num_M_blocks = div_up(bgmmc.M, bgmmc.M_blk);
     bgmmc.num_N_blocks = div_up(bgmmc.N, bgmmc.N_blk);
-    const int last_chunck_batch_size
-            = (nstl::max(bgmmc.K, bgmmc.K_blk)
-                      - (bgmmc.K_chunks - 1) * bgmmc.K_chunk_elems)
-            / bgmmc.K_blk;
-    bgmmc.brgemm_batch_tail_size
-            = last_chunck_batch_size % bgmmc.brgemm_batch_size;
+    if (bgmmc.is_runtime_K) {
+        // The number of K chunks is known at execution time only, and the
+        // last one is processed by the main kernel with a smaller batch.
+        bgmmc.K_chunks = 0;
+        bgmmc.brgemm_batch_tail_size = 0;
+    } else {
+        bgmmc.K_chunks = div_up(bgmmc.K, bgmmc.K_chunk_elems);
+        const int last_chunck_batch_size
+                = (nstl::max(bgmmc.K, bgmmc.K_blk)
+                          - (bgmmc.K_chunks - 1) * bgmmc.K_chunk_elems)
+                / bgmmc.K_blk;
+        bgmmc.brgemm_batch_tail_size
+                = last_chunck_batch_size % bgmmc.brgemm_batch_size;
+    }
 
     bgmmc.buffer_c_chunk_sz = bgmmc.acc_dt_sz * bgmmc.LDC
             * (bgmmc.nthr_k > 1 ? bgmmc.M : bgmmc.M_blk);
@@ -1277,6 +1511,9 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.zp_b_comp_elems_per_thr = bgmmc.M_chunk_size
             * (bgmmc.zp_b_comp_result_shift_m + bgmmc.zp_b_comp_buffer_shift_m);
 
+    bgmmc.src_dyn_quant_scales_elems_per_thr
+            = bgmmc.with_src_dyn_quant ? bgmmc.M_chunk_size * bgmmc.M_blk : 0;
+
     bgmmc.brgemm_batch_element_per_thr_sz = 16 * bgmmc.brgemm_batch_size;
 }
 
@@ -1318,6 +1555,11 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
                 bgmmc.nthr * bgmmc.zp_b_comp_elems_per_thr,
                 types::data_type_size(s32));
 
+    if (bgmmc.with_src_dyn_quant)
+        scratchpad.book(key_matmul_src_dyn_quant_scales,
+                bgmmc.nthr * bgmmc.src_dyn_quant_scales_elems_per_thr,
+                types::data_type_size(f32));
+
     if (is_superset(bgmmc.isa, avx512_core_amx))
         scratchpad.book(key_conv_amx_tile_buffer,
                 static_cast<size_t>(bgmmc.nthr) * bgmmc.wsp_tile_per_thr_bytes,
@@ -180,6 +180,33 @@ struct brgemm_matmul_conf_t {
     bool is_runtime_M = false;
     bool is_runtime_N = false;
     bool is_runtime_K = false;
+
+    // Packed 4-bit weights are decompressed to `wei_dt` (which equals
+    // `src_dt` in this case) while being copied to the B buffer. For such
+    // weights `b_dt_sz` is 1 and `B_strides` are counted in elements.
+    bool with_wei_decompression = false;
+    data_type_t orig_wei_dt = data_type::undef;
+    // f32 or bf16 A is quantized to s8 (`src_dt`) row by row while being
+    // copied to the A buffer. For such A `a_dt_sz` is the size of
+    // `orig_src_dt`. The scales of the rows of an M chunk are stored per
+    // thread.
+    bool with_src_dyn_quant = false;
+    data_type_t orig_src_dt = data_type::undef;
+    dim_t src_dyn_quant_scales_elems_per_thr = 0;
+    bool with_wei_decomp_scales = false;
+    bool with_wei_decomp_zero_points = false;
+    data_type_t wei_decomp_scales_dt = data_type::undef;
+    data_type_t wei_decomp_zp_dt = data_type::undef;
+    // Strides of the scales and zero points in elements. The K stride
+    // applies per group of `k_group` rows; a zero stride means broadcast.
+    dim_t wei_decomp_scales_k_stride = 0, wei_decomp_scales_n_stride = 0;
+    dim_t wei_decomp_scales_k_group = 0;
+    dim_t wei_decomp_zp_k_stride = 0, wei_decomp_zp_n_stride = 0;
+    dim_t wei_decomp_zp_k_group = 0;
+    // Number of rows of B for which both scales and zero points stay the
+    // same. The copy B kernel is called for each such range separately.
+    dim_t wei_decomp_k_group = 0;
+
     inline bool lda_big_pow2() const {
         const dim_t big_K_threshold = 4096;
         return !transposed_A && math::is_pow2(K) && K >= big_K_threshold;
@@ -205,6 +232,12 @@ struct brgemm_matmul_conf_utils_t {
     }
 
     inline bool use_buffer_b(bool use_heuristic = true) const {
+        // Decompression happens in the copy routine only.
+        if (bgmmc.with_wei_decompression) return true;
+        // With runtime K the weights are read in place, see
+        // pick_blocked_B_layout().
+        if (bgmmc.is_runtime_K) return false;
+
         if (bgmmc.is_amx)
             // use b_buffer for AMX when:
             // - not bf32 && using non-blocked weights
@@ -324,7 +324,75 @@ void jit_uni_sparse_matmul_kernel_t<avx2>::prepare_tail_mask() {
     vmovups(tail_vmask, ptr[reg_tmp]);
 }
 
+namespace {
+// Number of columns of the bf16 weights in a block of the VNNI layout.
+constexpr dim_t bsr_bf16_n_block = 64;
+} // namespace
+
+status_t jit_uni_sparse_matmul_t::pd_t::init_bsr_brgemm() {
+    const memory_desc_wrapper src_d(src_md());
+    const dim_t R = src_d.sparse_desc().block_dims[0];
+    const dim_t C = src_d.sparse_desc().block_dims[1];
+    const dim_t K = src_d.dims()[1];
+    const dim_t N = dst_md()->dims[1];
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = K / C;
+
+    if (is_bsr_bf16_) {
+        // dst[R x Nb] = sum_p values_p[R x C] * wei[C x Nb] for each block of
+        // Nb columns of the VNNI-packed weights.
+        const dim_t n_tail = N % bsr_bf16_n_block;
+        if (N >= bsr_bf16_n_block) {
+            CHECK(brgemm_desc_init(&brg_desc_, avx512_core_bf16, brgemm_addr,
+                    bf16, bf16, false, false, brgemm_row_major, 1.f, 0.f, C,
+                    bsr_bf16_n_block, N, R, bsr_bf16_n_block, C));
+            CHECK(brgemm_desc_set_attr(&brg_desc_, brgattr));
+        }
+        if (n_tail > 0) {
+            CHECK(brgemm_desc_init(&brg_desc_n_tail_, avx512_core_bf16,
+                    brgemm_addr, bf16, bf16, false, false, brgemm_row_major,
+                    1.f, 0.f, C, bsr_bf16_n_block, N, R, n_tail, C));
+            CHECK(brgemm_desc_set_attr(&brg_desc_n_tail_, brgattr));
+        }
+    } else {
+        // dst[R x N] = sum_p values_p[R x C] * wei[C x N] over the non-zero
+        // blocks `p` of a row of blocks.
+        const cpu_isa_t isa = mayiuse(avx512_core) ? avx512_core : avx2;
+        CHECK(brgemm_desc_init(&brg_desc_, isa, brgemm_addr, f32, f32, false,
+                false, brgemm_row_major, 1.f, 0.f, C, N, N, R, N, C));
+        CHECK(brgemm_desc_set_attr(&brg_desc_, brgattr));
+    }
+
+    nthr_ = dnnl_get_max_threads();
+    return status::success;
+}
+
+void jit_uni_sparse_matmul_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    const memory_desc_wrapper src_d(src_md());
+    const dim_t C = src_d.sparse_desc().block_dims[1];
+    const dim_t K = src_d.dims()[1];
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, nthr_ * (K / C));
+}
+
 status_t jit_uni_sparse_matmul_t::init(engine_t *engine) {
+    if (pd()->is_bsr_) {
+        const auto create_brg_kernel
+                = [](std::unique_ptr<brgemm_kernel_t> &kernel,
+                          const brgemm_t &desc) {
+                      if (desc.bcast_dim == 0) return status::success;
+                      brgemm_kernel_t *ker = nullptr;
+                      CHECK(brgemm_kernel_create(&ker, desc));
+                      return safe_ptr_assign(kernel, ker);
+                  };
+        CHECK(create_brg_kernel(brg_kernel_, pd()->brg_desc_));
+        return create_brg_kernel(brg_kernel_n_tail_, pd()->brg_desc_n_tail_);
+    }
+
     if (mayiuse(avx512_core)) {
         using kernel_t = jit_uni_sparse_matmul_kernel_t<avx512_core>;
         kernel_ = std::unique_ptr<kernel_t> {new kernel_t(pd())};
@@ -343,6 +411,8 @@ jit_uni_sparse_matmul_t::jit_uni_sparse_matmul_t(const pd_t *apd)
 jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
 
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->is_bsr_) return execute_bsr(ctx);
+
     const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
     const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
     const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
@@ -378,6 +448,97 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+status_t jit_uni_sparse_matmul_t::execute_bsr(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto *weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto *src_values = CTX_IN_MEM(const void *, DNNL_ARG_SRC, 0);
+    const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t M = dst_d.dims()[0];
+    const dim_t N = dst_d.dims()[1];
+    const dim_t K = src_d.dims()[1];
+    const dim_t R = src_d.sparse_desc().block_dims[0];
+    const dim_t C = src_d.sparse_desc().block_dims[1];
+    const dim_t MB = M / R;
+    const dim_t block_size = R * C;
+
+    const size_t dt_size = types::data_type_size(src_d.data_type());
+    const auto *values = static_cast<const char *>(src_values);
+    const auto *wei = static_cast<const char *>(weights);
+    // The bf16 weights consist of VNNI-packed K x Nb blocks, the rows of the
+    // padded K follow each other within a block.
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const dim_t n_block = pd()->is_bsr_bf16_ ? bsr_bf16_n_block : N;
+    const dim_t wei_n_block_size = wei_d.padded_dims()[0] * n_block;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto *batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    // Rows of blocks are distributed so that the threads get similar
+    // amounts of work: a row costs its number of non-zero blocks plus one for
+    // writing the destination. The cost of the rows preceding `mb` is
+    // `src_pointers[mb] + mb`, which grows monotonically.
+    const dim_t total_cost = src_pointers[MB] + MB;
+    const auto first_row = [&](int ithr, int nthr) {
+        if (ithr == nthr) return MB;
+        const dim_t target = total_cost * ithr / nthr;
+        dim_t lo = 0, hi = MB;
+        while (lo < hi) {
+            const dim_t mid = (lo + hi) / 2;
+            if (src_pointers[mid] + mid < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    };
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        const dim_t start = first_row(ithr, nthr);
+        const dim_t end = first_row(ithr + 1, nthr);
+        brgemm_batch_element_t *batch = batch_base + ithr * (K / C);
+
+        for (dim_t mb = start; mb < end; mb++) {
+            const dim_t row_begin = src_pointers[mb];
+            const int bs = static_cast<int>(src_pointers[mb + 1] - row_begin);
+            float *dst_rows = dst + mb * R * N;
+            if (bs == 0) {
+                std::memset(dst_rows, 0, R * N * sizeof(float));
+                continue;
+            }
+
+            // Only the non-zero blocks make it to the batch.
+            for (dim_t n0 = 0; n0 < N; n0 += n_block) {
+                for (int i = 0; i < bs; i++) {
+                    const dim_t p = row_begin + i;
+                    // A block of weights rows starts at an even row, so the
+                    // offset in the VNNI layout matches the plain one.
+                    const dim_t wei_off = n0 / n_block * wei_n_block_size
+                            + src_indices[p] * C * n_block;
+                    batch[i].ptr.A = values + p * block_size * dt_size;
+                    batch[i].ptr.B = wei + wei_off * dt_size;
+                }
+                const bool is_n_tail = N - n0 < n_block;
+                brgemm_kernel_execute(is_n_tail ? brg_kernel_n_tail_.get()
+                                                : brg_kernel_.get(),
+                        bs, batch, dst_rows + n0);
+            }
+        }
+    });
+
+    return status::success;
+}
+
 } // namespace matmul
 } // namespace x64
 } // namespace cpu
@@ -27,6 +27,8 @@
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
 
+#include "cpu/x64/brgemm/brgemm.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -50,24 +52,71 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             memory_desc_wrapper src_d(src_md());
             memory_desc_wrapper wei_d(weights_md(0));
 
-            const bool ok
-                    = utils::everyone_is(f32, src_type, wei_type, dst_type)
-                    && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
-                    && utils::everyone_is(
+            if (!src_d.is_sparse_desc() || wei_d.is_sparse_desc()
+                    || src_d.is_grouped_desc())
+                return status::unimplemented;
+            is_bsr_ = src_d.encoding() == sparse_encoding::bsr;
+            is_bsr_bf16_ = is_bsr_ && src_type == bf16;
+
+            const bool dt_ok = is_bsr_
+                    ? utils::one_of(src_type, f32, bf16) && wei_type == src_type
+                            && dst_type == f32
+                    : utils::everyone_is(f32, src_type, wei_type, dst_type);
+            if (!dt_ok) return status::unimplemented;
+
+            // bf16 values are used by brgemm as is, while the weights have
+            // to be in the VNNI layout, which the user gets with a reorder
+            // by passing `any`. Blocks must hold pairs of columns for that.
+            if (is_bsr_bf16_) {
+                if (!mayiuse(avx512_core_bf16)
+                        || src_d.sparse_desc().block_dims[1] % 2 != 0)
+                    return status::unimplemented;
+                if (weights_md_.format_kind == format_kind::any)
+                    CHECK(memory_desc_init_by_tag(weights_md_, wei_tag()));
+            }
+
+            const bool ok = utils::everyone_is(
                             s32, src_d.metadata_type(0), src_d.metadata_type(1))
                     && !with_bias() && attr()->has_default_values()
                     && mayiuse(avx2) && set_default_formats() && formats_ok();
-            return ok ? status::success : status::unimplemented;
+            if (!ok) return status::unimplemented;
+
+            if (is_bsr_) {
+                CHECK(init_bsr_brgemm());
+                init_scratchpad();
+            }
+            return status::success;
         }
 
         bool formats_ok() const {
             const bool is_dst_ab
                     = memory_desc_wrapper(dst_md()).matches_one_of_tag(
                             format_tag::ab);
-            const bool is_wei_ab = memory_desc_wrapper(weights_md())
-                                           .matches_one_of_tag(format_tag::ab);
-            return is_dst_ab && is_wei_ab;
+            const bool is_wei_ok = memory_desc_wrapper(weights_md())
+                                           .matches_one_of_tag(wei_tag());
+            return is_dst_ab && is_wei_ok;
+        }
+
+        // For bf16 the weights are split into blocks of 64 columns and each
+        // block holds pairs of rows interleaved, so a block is a VNNI-packed
+        // K x 64 matrix.
+        format_tag_t wei_tag() const {
+            return is_bsr_bf16_ ? format_tag::BA16a64b2a : format_tag::ab;
         }
+
+        bool is_bsr_ = false;
+        bool is_bsr_bf16_ = false;
+        int nthr_ = 0;
+        // A row of blocks of the source is multiplied by the weights with a
+        // single brgemm call which batches over the non-zero blocks only.
+        // bf16 uses a call per block of columns of the weights, the second
+        // descriptor handles the last incomplete block.
+        brgemm_t brg_desc_;
+        brgemm_t brg_desc_n_tail_;
+
+    private:
+        status_t init_bsr_brgemm();
+        void init_scratchpad();
     };
 
     jit_uni_sparse_matmul_t(const pd_t *apd);
@@ -78,7 +127,11 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_bsr(const exec_ctx_t &ctx) const;
+
     std::unique_ptr<sparse_matmul_kernel_t> kernel_;
+    std::unique_ptr<brgemm_kernel_t> brg_kernel_;
+    std::unique_ptr<brgemm_kernel_t> brg_kernel_n_tail_;
 };
 
 } // namespace matmul
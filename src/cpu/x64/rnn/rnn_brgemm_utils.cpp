@@ -500,9 +500,11 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
     const bool mlc_m_dim_adjustment_not_required
             = IMPLICATION(rnn.skip_dst_iter_copy(),
                     rnn.skip_src_layer_copy() && rnn.n_layer == 1);
+    // With variable sequence lengths the layer part is computed only for the
+    // rows active at each time step.
     const bool merged_layer_compute_applicable = rnn.src_layer_is_trivial_stride
             && mlc_cell_type_ok && mlc_problem_shape_ok
-            && mlc_m_dim_adjustment_not_required;
+            && mlc_m_dim_adjustment_not_required && !rnn.is_var_seq_len;
     if (merged_layer_compute_applicable) {
         rnn.merge_gemm_layer = true;
 
@@ -82,13 +82,17 @@ io_gather_conf_t::io_gather_conf_t(const std::size_t simd_w,
     , reg_tmp1_(reg_tmp1)
     , vmm_tmp_idx_(vmm_tmp_idx) {}
 
+io_f8_conf_t::io_f8_conf_t(const int vmm_aux_idx, const Xbyak::Reg64 &reg_tmp)
+    : vmm_aux_idx_(vmm_aux_idx), reg_tmp_(reg_tmp) {}
+
 template <typename Vmm>
 jit_io_helper_t<Vmm>::jit_io_helper_t(jit_generator *host, const cpu_isa_t &isa,
         const data_type_t &data_type, const io_conf_t &io_conf,
         const utils::optional_t<io_tail_conf_t> &tail_conf,
         const utils::optional_t<io_emu_bf16_conf_t> &bf16_conf,
         const utils::optional_t<io_saturation_conf_t> &saturation_conf,
-        const utils::optional_t<io_gather_conf_t> &gather_conf)
+        const utils::optional_t<io_gather_conf_t> &gather_conf,
+        const utils::optional_t<io_f8_conf_t> &f8_conf)
     : host_(host)
     , isa_(isa)
     , data_type_(data_type)
@@ -99,7 +103,8 @@ jit_io_helper_t<Vmm>::jit_io_helper_t(jit_generator *host, const cpu_isa_t &isa,
     , tail_conf_(tail_conf)
     , bf16_conf_(bf16_conf)
     , saturation_conf_(saturation_conf)
-    , gather_conf_(gather_conf) {
+    , gather_conf_(gather_conf)
+    , f8_conf_(f8_conf) {
 
     if (data_type_ == data_type::bf16
             && !(is_superset(isa_, avx512_core_bf16)
@@ -113,9 +118,13 @@ jit_io_helper_t<Vmm>::jit_io_helper_t(jit_generator *host, const cpu_isa_t &isa,
     }
 
     assert(utils::one_of(data_type_, data_type::f16, data_type::bf16,
-                   data_type::f32, data_type::s8, data_type::u8, data_type::s32)
+                   data_type::f32, data_type::s8, data_type::u8, data_type::s32,
+                   data_type::f8_e5m2, data_type::f8_e4m3)
             && is_data_type_supported(data_type_)
-            && "Supported data types f16, bf16, f32, s8, u8, s32");
+            && "Supported data types f16, bf16, f32, s8, u8, s32, f8_e5m2, "
+               "f8_e4m3");
+    assert(IMPLICATION(data_type_ == data_type::f8_e4m3, f8_conf.has_value())
+            && "Config for f8 conversion is not set.");
 
     /*
      * vpmovsxbd, vpmovzxbd for AVX are defined only for XMM. Since AVX2
@@ -151,6 +160,9 @@ bool jit_io_helper_t<Vmm>::is_data_type_supported(const data_type_t dt) {
             return is_superset(isa_, avx512_core) || isa_ == avx2_vnni_2;
         case data_type::f16:
             return is_superset(isa_, avx512_core_fp16) || isa_ == avx2_vnni_2;
+        // Only loads with up-conversion to f32 are supported.
+        case data_type::f8_e5m2:
+        case data_type::f8_e4m3: return is_superset(isa_, avx512_core);
         default: assert(!"Unsupported data type");
     }
     return false;
@@ -546,6 +558,10 @@ void jit_io_helper_t<Vmm>::load(const Xbyak::Address &src_addr,
             case data_type::s32: load_s32(src_addr, dst_vmm, tail); break;
             case data_type::bf16: load_bf16(src_addr, dst_vmm); break;
             case data_type::f16: load_f16(src_addr, dst_vmm); break;
+            case data_type::f8_e5m2:
+            case data_type::f8_e4m3:
+                load_f8(src_addr, dst_raw_vmm, tail);
+                break;
             case data_type::s8:
             case data_type::u8: load_i8(src_addr, dst_vmm); break;
             default: assert(!"Unsupported data type.");
@@ -607,6 +623,62 @@ void jit_io_helper_t<Vmm>::load_f16(
     host_->uni_vcvtph2psx(dst_vmm, src_addr);
 }
 
+template <typename Vmm>
+void jit_io_helper_t<Vmm>::load_f8(
+        const Xbyak::Address &src_addr, const Vmm &dst_vmm, const bool tail) {
+    using Vmm_lower_t = typename vreg_traits<Vmm>::Vmm_lower_t;
+    const Vmm_lower_t dst_lower(dst_vmm.getIdx());
+
+    // Zero-extends f8 values to words. The conversion goes through f16 with
+    // the words holding the f16 bit patterns.
+    const auto load_words = [&](const Vmm_lower_t &vmm) {
+        if (tail)
+            host_->vpmovzxbw(
+                    vmm | tail_conf_->tail_opmask_ | host_->T_z, src_addr);
+        else
+            host_->vpmovzxbw(vmm, src_addr);
+    };
+
+    load_words(dst_lower);
+
+    if (data_type_ == data_type::f8_e5m2) {
+        // f8_e5m2 is exactly the upper byte of f16, including denormals,
+        // infinities and NaNs.
+        host_->vpsllw(dst_lower, dst_lower, 8);
+        host_->vcvtph2ps(dst_vmm, dst_lower);
+        return;
+    }
+
+    assert(f8_conf_.has_value() && "Config for f8 conversion is not set.");
+    const Vmm vmm_aux(f8_conf_->vmm_aux_idx_);
+    const Vmm_lower_t aux_lower(f8_conf_->vmm_aux_idx_);
+    const Xbyak::Reg64 &reg_tmp = f8_conf_->reg_tmp_;
+
+    // Put the exponent and mantissa bits of f8_e4m3 into the corresponding
+    // f16 fields. As the exponent biases differ by 8, the f16 value is 2^-8 of
+    // the f8_e4m3 value, which holds for denormals too.
+    host_->vpsllw(dst_lower, dst_lower, 9);
+    host_->vpsrlw(dst_lower, dst_lower, 2);
+    // The NaN magnitude 0x7f is the only one that maps above 0x3f7f. The
+    // saturating addition sets the sign bit for it only, then the arithmetic
+    // shift turns the word into an all-ones f16 NaN.
+    host_->mov(reg_tmp.cvt32(), 0x4080);
+    host_->vpbroadcastw(aux_lower, reg_tmp.cvt16());
+    host_->vpaddusw(aux_lower, aux_lower, dst_lower);
+    host_->vpsraw(aux_lower, aux_lower, 15);
+    host_->vpord(dst_lower, dst_lower, aux_lower);
+    // Restore the sign.
+    load_words(aux_lower);
+    host_->vpsrlw(aux_lower, aux_lower, 7);
+    host_->vpsllw(aux_lower, aux_lower, 15);
+    host_->vpord(dst_lower, dst_lower, aux_lower);
+
+    host_->vcvtph2ps(dst_vmm, dst_lower);
+    host_->mov(reg_tmp.cvt32(), float2int(256.f));
+    host_->vpbroadcastd(vmm_aux, reg_tmp.cvt32());
+    host_->vmulps(dst_vmm, dst_vmm, vmm_aux);
+}
+
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::load_i8(
         const Xbyak::Address &src_addr, const Vmm &dst_vmm) {
@@ -892,7 +964,8 @@ jit_io_multi_dt_helper_t<Vmm>::jit_io_multi_dt_helper_t(jit_generator *host,
         const utils::optional_t<io_tail_conf_t> &tail_conf,
         const utils::optional_t<io_emu_bf16_conf_t> &bf16_conf,
         const std::map<data_type_t, io_saturation_conf_t> &saturation_confs,
-        const utils::optional_t<io_gather_conf_t> &gather_conf) {
+        const utils::optional_t<io_gather_conf_t> &gather_conf,
+        const utils::optional_t<io_f8_conf_t> &f8_conf) {
     assert(!data_types.empty());
     for (const auto &dt : data_types) {
         // can be replaced by try_emplace from C++17
@@ -910,7 +983,9 @@ jit_io_multi_dt_helper_t<Vmm>::jit_io_multi_dt_helper_t(jit_generator *host,
                                     io_saturation_conf_t> {saturation_conf
                                                                    ->second}
                                                     : utils::nullopt,
-                            gather_conf));
+                            gather_conf,
+                            dt == data_type::f8_e4m3 ? f8_conf
+                                                     : utils::nullopt));
         }
     }
 }
@@ -120,6 +120,17 @@ public:
     utils::optional_t<int> vmm_tmp_idx_ = utils::nullopt;
 };
 
+class io_f8_conf_t {
+public:
+    io_f8_conf_t(const int vmm_aux_idx, const Xbyak::Reg64 &reg_tmp);
+    io_f8_conf_t(const io_f8_conf_t &other) = default;
+
+    io_f8_conf_t &operator=(const io_f8_conf_t &other) = default;
+
+    int vmm_aux_idx_ = 0;
+    Xbyak::Reg64 reg_tmp_ = Xbyak::Reg64();
+};
+
 template <typename Vmm>
 class jit_io_multi_dt_helper_t;
 
@@ -137,7 +148,8 @@ public:
             const utils::optional_t<io_saturation_conf_t> &saturation_conf
             = utils::nullopt,
             const utils::optional_t<io_gather_conf_t> &gather_conf
-            = utils::nullopt);
+            = utils::nullopt,
+            const utils::optional_t<io_f8_conf_t> &f8_conf = utils::nullopt);
     jit_io_helper_t(jit_io_helper_t &&) = default;
     jit_io_helper_t &operator=(jit_io_helper_t &&) = default;
 
@@ -190,6 +202,8 @@ private:
             const bool tail);
     void load_bf16(const Xbyak::Address &src_addr, const Vmm &dst_vmm);
     void load_f16(const Xbyak::Address &src_addr, const Vmm &dst_vmm);
+    void load_f8(const Xbyak::Address &src_addr, const Vmm &dst_vmm,
+            const bool tail);
     void load_i8(const Xbyak::Address &src_addr, const Vmm &dst_vmm);
     void saturate(const Vmm &vmm);
     void store_byte_by_byte(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
@@ -213,6 +227,7 @@ private:
     const utils::optional_t<io_emu_bf16_conf_t> bf16_conf_;
     const utils::optional_t<io_saturation_conf_t> saturation_conf_;
     const utils::optional_t<io_gather_conf_t> gather_conf_;
+    const utils::optional_t<io_f8_conf_t> f8_conf_;
 };
 
 template <typename Vmm>
@@ -229,7 +244,8 @@ public:
             = utils::nullopt,
             const saturation_map_t &saturation_confs = saturation_map_t {},
             const utils::optional_t<io_gather_conf_t> &gather_conf
-            = utils::nullopt);
+            = utils::nullopt,
+            const utils::optional_t<io_f8_conf_t> &f8_conf = utils::nullopt);
     ~jit_io_multi_dt_helper_t();
     void prepare_tail_mask();
     void prepare_full_mask();
@@ -47,6 +47,11 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(shuffle);
             CASE(softmax);
             CASE(zero_pad);
+            // There are no GPU implementations of SDPA, group
+            // normalization and embedding bag yet.
+            case primitive_kind::sdpa:
+            case primitive_kind::group_normalization:
+            case primitive_kind::embedding_bag: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -33,10 +33,21 @@ static size_t get_timestamp() {
     return std::chrono::steady_clock::now().time_since_epoch().count();
 }
 
+// The buffer of an entry is available only after the kernel that added the
+// entry has computed the constants. Entries that are not ready yet cannot be
+// evicted, so the cache never waits on them while holding the lock.
+static bool is_ready(const value_t &value) {
+    return value.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+}
+
 status_t constant_cache_t::set_capacity(size_t capacity) {
     lock_write();
     capacity_ = static_cast<size_t>(capacity);
-    if (get_size() > capacity_) {
+    if (capacity_ == 0) {
+        evictions_ += constant_map().size();
+        constant_map().clear();
+    } else if (get_size() > capacity_) {
         // Evict excess buffers
         size_t excess_size = get_size() - capacity_;
         evict(excess_size);
@@ -50,7 +61,8 @@ size_t constant_cache_t::get_capacity() {
     return capacity_;
 }
 
-value_t constant_cache_t::get_or_add(const key_t &key, const value_t &value) {
+value_t constant_cache_t::get_or_add(
+        const key_t &key, const value_t &value, size_t size) {
     // 1. Section with shared access (read lock)
     lock_read();
     // Check if the cache is enabled.
@@ -62,6 +74,7 @@ value_t constant_cache_t::get_or_add(const key_t &key, const value_t &value) {
     auto e = get(key);
     if (e.valid()) {
         unlock_read();
+        hits_++;
         return e;
     }
 
@@ -84,7 +97,10 @@ value_t constant_cache_t::get_or_add(const key_t &key, const value_t &value) {
     e = get(key);
     if (!e.valid()) {
         // If the entry is missing in the cache then add it (cache_miss)
-        add(key, value);
+        add(key, value, size);
+        misses_++;
+    } else {
+        hits_++;
     }
     unlock_write();
     return e;
@@ -92,6 +108,8 @@ value_t constant_cache_t::get_or_add(const key_t &key, const value_t &value) {
 
 void constant_cache_t::remove_if_exist(const key_t &key) {
     lock_write();
+    // The key may be reused by a new kernel, so the pin is dropped as well.
+    pinned_keys_.erase(key);
     if (constant_map().count(key) == 0) {
         unlock_write();
     } else {
@@ -100,29 +118,51 @@ void constant_cache_t::remove_if_exist(const key_t &key) {
     }
 }
 
-// Get the total size of all cached buffers
+void constant_cache_t::set_pinned(const key_t &key, bool pinned) {
+    impl::utils::lock_write_t lock_w(rw_mutex_);
+    if (pinned)
+        pinned_keys_.insert(key);
+    else
+        pinned_keys_.erase(key);
+}
+
+void constant_cache_t::get_stats(
+        dnnl_graph_constant_tensor_cache_stats_t *stats) {
+    impl::utils::lock_read_t lock_r(rw_mutex_);
+    stats->hits = hits_.load(std::memory_order_relaxed);
+    stats->misses = misses_.load(std::memory_order_relaxed);
+    stats->evictions = evictions_.load(std::memory_order_relaxed);
+    stats->bytes_resident = get_size();
+    stats->num_entries = constant_map().size();
+    stats->num_pinned_entries = 0;
+    for (const auto &pair : constant_map())
+        stats->num_pinned_entries += pinned_keys_.count(pair.first);
+}
+
+// Get the total size of all cached buffers, including the ones that are
+// still being computed
 size_t constant_cache_t::get_size() const {
     size_t total_size = 0;
-    for (const auto &pair : constant_map()) {
-        total_size += pair.second.value_.get()->size();
-    }
+    for (const auto &pair : constant_map())
+        total_size += pair.second.size_;
     return total_size;
 }
 
-void constant_cache_t::add(const key_t &key, const value_t &constant) {
+void constant_cache_t::add(
+        const key_t &key, const value_t &constant, size_t size) {
+    if (size > capacity_) return;
     size_t current_size = get_size();
-    if (current_size >= capacity_) {
-        // FIXME(qun) because we can't know the concrete size of the constant,
-        // so we could only guarantee that the total size before adding  not
-        // beyond capacity here.
-        evict(current_size - capacity_);
+    if (current_size > capacity_ - size) {
+        evict(current_size - (capacity_ - size));
+        // Pinned entries and entries being computed occupy the budget.
+        if (get_size() > capacity_ - size) return;
     }
 
     size_t timestamp = get_timestamp();
 
     auto res = constant_map().emplace(std::piecewise_construct,
             std::forward_as_tuple(key),
-            std::forward_as_tuple(constant, timestamp));
+            std::forward_as_tuple(constant, size, timestamp));
     UNUSED(res);
     assert(res.second);
 }
@@ -137,19 +177,22 @@ value_t constant_cache_t::get(const key_t &key) {
     return it->second.value_;
 }
 
-// Evict n size of cached buffers
+// Evict n size of cached buffers in the least recently used order. Pinned
+// entries and entries which are not computed yet are skipped, so less than n
+// bytes may be evicted.
 void constant_cache_t::evict(size_t n) {
     using v_t = std::unordered_map<key_t, timed_entry_t>::value_type;
-    if (n == get_size()) {
-        constant_map().clear();
-        return;
-    }
+    const auto is_evictable = [&](const v_t &v) {
+        return pinned_keys_.count(v.first) == 0 && is_ready(v.second.value_);
+    };
 
     size_t evicted_size = 0;
     while (evicted_size < n) {
-        // Find the smallest timestamp
+        // Find the smallest timestamp among the evictable entries
         auto it = std::min_element(constant_map().begin(), constant_map().end(),
                 [&](const v_t &left, const v_t &right) {
+                    if (is_evictable(left) != is_evictable(right))
+                        return is_evictable(left);
                     // By default, load() and operator T use sequentially
                     // consistent memory ordering, which enforces writing the
                     // timestamps into registers in the same exact order they
@@ -162,20 +205,54 @@ void constant_cache_t::evict(size_t n) {
                             < right.second.timestamp_.load(
                                     std::memory_order_relaxed);
                 });
-        evicted_size += it->second.value_.get()->size();
+        if (it == constant_map().end() || !is_evictable(*it)) break;
+        evicted_size += it->second.size_;
         auto res = constant_map().erase(it->first);
         UNUSED(res);
         assert(res);
+        evictions_++;
     }
 }
 
-static constant_cache_t global_cache;
+// The caches are constructed when the library is loaded, so they outlive the
+// compiled partitions kept in other static objects, e.g. the compiled
+// partition cache, whose kernels remove their entries on destruction.
+static constant_cache_t cpu_cache;
+static constant_cache_t gpu_cache;
 
-constant_cache_t &get_global_constant_cache() {
-    return global_cache;
+constant_cache_t &get_constant_cache(engine_kind_t kind) {
+    return kind == engine_kind::gpu ? gpu_cache : cpu_cache;
 }
 
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
+
+using namespace dnnl::impl::graph;
+
+status_t DNNL_API dnnl_graph_set_constant_tensor_cache_capacity(
+        engine_kind_t eng_kind, size_t size) {
+    if (!utils::one_of(eng_kind, engine_kind::cpu, engine_kind::gpu))
+        return status::invalid_arguments;
+    return dnnl_impl::get_constant_cache(eng_kind).set_capacity(size);
+}
+
+status_t DNNL_API dnnl_graph_get_constant_tensor_cache_capacity(
+        engine_kind_t eng_kind, size_t *size) {
+    if (size == nullptr
+            || !utils::one_of(eng_kind, engine_kind::cpu, engine_kind::gpu))
+        return status::invalid_arguments;
+    *size = dnnl_impl::get_constant_cache(eng_kind).get_capacity();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_get_constant_tensor_cache_stats(
+        engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_stats_t *stats) {
+    if (stats == nullptr
+            || !utils::one_of(eng_kind, engine_kind::cpu, engine_kind::gpu))
+        return status::invalid_arguments;
+    dnnl_impl::get_constant_cache(eng_kind).get_stats(stats);
+    return status::success;
+}
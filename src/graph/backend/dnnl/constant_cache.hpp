@@ -24,6 +24,7 @@
 #include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "common/rw_mutex.hpp"
 #include "common/utils.hpp"
@@ -31,6 +32,7 @@
 #include "graph/backend/dnnl/common.hpp"
 
 #include "oneapi/dnnl/dnnl.hpp"
+#include "oneapi/dnnl/dnnl_graph_types.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -149,15 +151,29 @@ struct constant_cache_t {
 #endif
     }
 
+    // The capacity is a budget in bytes for the buffers resident in the
+    // cache. Setting it to 0 clears the cache, including pinned entries, and
+    // disables it.
     status_t set_capacity(size_t capacity);
     size_t get_capacity();
-    value_t get_or_add(const key_t &key, const value_t &value);
+    // The `size` is the size in bytes of the buffer that `value` will hold.
+    // It is accounted from the moment the entry is added, so the budget
+    // holds while the buffer is still being computed. An entry that does not
+    // fit the budget, even after evicting everything evictable, is not added.
+    value_t get_or_add(const key_t &key, const value_t &value, size_t size);
     void remove_if_exist(const key_t &key);
 
+    // A pinned entry is never evicted to fit the budget. The mark is kept for
+    // the key even when the entry is not in the cache yet, so a kernel can be
+    // pinned before its first execution.
+    void set_pinned(const key_t &key, bool pinned);
+
+    void get_stats(dnnl_graph_constant_tensor_cache_stats_t *stats);
+
 private:
     void evict(size_t n);
     value_t get(const key_t &key);
-    void add(const key_t &key, const value_t &constant);
+    void add(const key_t &key, const value_t &constant, size_t size);
     size_t get_size() const;
 
     void lock_read() { rw_mutex_.lock_read(); }
@@ -169,9 +185,10 @@ private:
 
     struct timed_entry_t {
         value_t value_;
+        size_t size_;
         std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        timed_entry_t(const value_t &value, size_t size, size_t timestamp)
+            : value_(value), size_(size), timestamp_(timestamp) {}
     };
 
     std::unordered_map<key_t, timed_entry_t> &constant_map() {
@@ -187,11 +204,19 @@ private:
     // an element*, since it invokes the copy constructor of std::atomic, which
     // is deleted.
     std::unique_ptr<std::unordered_map<key_t, timed_entry_t>> constant_map_;
+    std::unordered_set<key_t> pinned_keys_;
     impl::utils::rw_mutex_t rw_mutex_;
     size_t capacity_ = std::numeric_limits<size_t>::max();
+
+    // Hits are counted under the read lock, hence the counters are atomic.
+    std::atomic<size_t> hits_ {0};
+    std::atomic<size_t> misses_ {0};
+    std::atomic<size_t> evictions_ {0};
 };
 
-constant_cache_t &get_global_constant_cache();
+// Each engine kind has its own cache, so the budget of the device memory is
+// independent of the budget of the host memory.
+constant_cache_t &get_constant_cache(engine_kind_t kind);
 
 } // namespace dnnl_impl
 } // namespace graph
@@ -62,6 +62,7 @@ bool dnnl_backend::register_passes() {
     DNNL_BACKEND_REGISTER_PATTERN_CALL(reorder_fusion, pass_registry_);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(shuffle_fusion, pass_registry_);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(reduction_fusion, pass_registry_);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(embedding_bag_fusion, pass_registry_);
     pass_registry_.sort_passes();
 
 #undef DNNL_BACKEND_REGISTER_PATTERN_CALL
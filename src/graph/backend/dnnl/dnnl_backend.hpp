@@ -34,6 +34,7 @@
 #include "graph/utils/utils.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/constant_cache.hpp"
 #include "graph/backend/dnnl/internal_ops.hpp"
 #include "graph/backend/dnnl/layout_id_mgr.hpp"
 #include "graph/backend/dnnl/utils.hpp"
@@ -115,8 +116,18 @@ struct kernel_base_t {
         return enabled;
     }
 
+    constant_cache_t &constant_cache() const {
+        const auto kind = p_engine_
+                ? static_cast<engine_kind_t>(p_engine_.get_kind())
+                : engine_kind::cpu;
+        return get_constant_cache(kind);
+    }
+
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
+    // FIXME(qun) improve the cache key
+    constant_cache_t::key_t constant_key_
+            = reinterpret_cast<constant_cache_t::key_t>(this);
 };
 
 using kernel_ptr = std::shared_ptr<kernel_base_t>;
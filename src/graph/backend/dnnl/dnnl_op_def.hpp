@@ -1004,6 +1004,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                 .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
                         (int64_t)-1)
                 // New added attributes
+                .set_attr(op_attr::use_rms_norm, false, attribute_kind::b,
+                        false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(infer_norm_output_shape)
@@ -1012,6 +1014,61 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                         executable_creator<layernorm_executable_t>)
                 .SET_ARG_INDICES_GETTER(layernorm_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_groupnorm, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_inputs(std::set<size_t>({1, 32}))
+                .set_outputs_option(op_schema_t::param_num_option::optional)
+                .set_num_outputs(std::set<size_t>({2, 4}))
+                .set_input(0, "input")
+                .set_input(1, "gamma")
+                .set_input(2, "beta")
+                .set_output(0, "output")
+                .set_output(1, "mean")
+                .set_output(2, "variance")
+                .set_output(3, "scratchpad")
+                // Attributes inherited from GroupNorm
+                .set_attr(op_attr::groups, true, attribute_kind::i)
+                .set_attr(op_attr::keep_stats, false, attribute_kind::b, true)
+                .set_attr(op_attr::use_affine, false, attribute_kind::b, true)
+                .set_attr(op_attr::epsilon, false, attribute_kind::f, 1e-5f)
+                .set_attr(op_attr::data_format, false, attribute_kind::s, "NXC",
+                        {"NXC", "NCX"})
+                // New added attributes
+                .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
+                        (int64_t)-1)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_groupnorm_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_groupnorm)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<groupnorm_executable_t>)
+                .SET_ARG_INDICES_GETTER(groupnorm_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_embedding_bag, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_inputs(std::set<size_t>({2, 32}))
+                .set_num_outputs(2)
+                .set_input(0, "src")
+                .set_input(1, "indices")
+                .set_input(2, "offsets")
+                .set_output(0, "dst")
+                .set_output(1, "scratchpad")
+                // Attributes inherited from EmbeddingBag
+                .set_attr(op_attr::mode, false, attribute_kind::s, "sum",
+                        {"sum", "mean", "gather"})
+                // New added attributes
+                .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
+                        (int64_t)-1)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_embedding_bag_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_embedding_bag)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<embedding_bag_executable_t>)
+                .SET_ARG_INDICES_GETTER(embedding_bag_executable_t))
+
 DNNL_GRAPH_OP_SCHEMA(dnnl_reorder, 1,
         op_schema_t()
                 .set_inputs_option(op_schema_t::param_num_option::variadic)
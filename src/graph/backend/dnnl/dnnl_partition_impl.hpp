@@ -87,6 +87,11 @@ public:
     }
 #endif
 
+    status_t set_constant_cache_pinned(bool pinned) override {
+        kernel_->constant_cache().set_pinned(kernel_->constant_key_, pinned);
+        return status::success;
+    }
+
 private:
     kernel_ptr kernel_;
 };
@@ -45,6 +45,7 @@ const op_attr_t with_runtime_dst_zps = 0x1000c;
 const op_attr_t is_bias_add = 0x1000d;
 const op_attr_t with_sum = 0x1000e;
 const op_attr_t keep_dst_layout = 0x1000f;
+const op_attr_t use_rms_norm = 0x10010;
 
 // int64_t
 const op_attr_t alg_kind = 0x10100;
@@ -82,6 +83,7 @@ static inline std::string internal_attr2str(op_attr_t attr) {
         CASE(is_bias_add);
         CASE(with_sum);
         CASE(keep_dst_layout);
+        CASE(use_rms_norm);
         CASE(alg_kind);
         CASE(fusion_info_key);
         CASE(dw_type);
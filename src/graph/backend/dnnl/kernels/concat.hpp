@@ -133,6 +133,8 @@ public:
             mem_offkey.first.set_data_handle(
                     var_grantor.get(mem_offkey.second));
         }
+
+        res->set_sub_mems_data_handle();
     }
 
     status_t execute_impl(const stream_t *g_stream,
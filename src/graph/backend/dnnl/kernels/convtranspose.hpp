@@ -57,17 +57,13 @@ protected:
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    // FIXME(qun) improve the cache key
-    constant_cache_t::key_t constant_key_
-            = reinterpret_cast<constant_cache_t::key_t>(this);
-
 public:
     ~convtranspose_base_t() override {
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
 
         if (enabled_constant_cache()) {
-            get_global_constant_cache().remove_if_exist(constant_key_);
+            constant_cache().remove_if_exist(constant_key_);
         }
     }
 
@@ -115,8 +111,9 @@ public:
         if (enabled_constant_cache()) {
             std::promise<constant_cache_t::cached_t> c_promise;
             constant_cache_t::value_t cached_value
-                    = get_global_constant_cache().get_or_add(
-                            constant_key_, c_promise.get_future());
+                    = constant_cache().get_or_add(
+                            constant_key_, c_promise.get_future(),
+                            memory_planner_.total_internal_persistent_size());
             bool is_from_cache = cached_value.valid();
             if (is_from_cache) {
                 const constant_cache_t::cached_t &c_buffer = cached_value.get();
@@ -188,8 +185,9 @@ public:
         if (enabled_constant_cache()) {
             std::promise<constant_cache_t::cached_t> c_promise;
             constant_cache_t::value_t cached_value
-                    = get_global_constant_cache().get_or_add(
-                            constant_key_, c_promise.get_future());
+                    = constant_cache().get_or_add(
+                            constant_key_, c_promise.get_future(),
+                            memory_planner_.total_internal_persistent_size());
             bool is_from_cache = cached_value.valid();
             if (is_from_cache) {
                 const constant_cache_t::cached_t &c_buffer = cached_value.get();
@@ -60,10 +60,6 @@ protected:
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    // FIXME(qun) improve the cache key
-    constant_cache_t::key_t constant_key_
-            = reinterpret_cast<constant_cache_t::key_t>(this);
-
     std::once_flag once_flag_;
     subgraph_visualizer_t vis_;
     pass_pipeline_t pipeline_;
@@ -74,7 +70,7 @@ public:
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
 
         if (enabled_constant_cache()) {
-            get_global_constant_cache().remove_if_exist(constant_key_);
+            constant_cache().remove_if_exist(constant_key_);
         }
     }
 
@@ -273,6 +269,8 @@ public:
             mem_offkey.first.set_data_handle(
                     var_grantor.get(mem_offkey.second));
         }
+
+        res->set_sub_mems_data_handle();
     }
 
     status_t execute_impl(const stream_t *g_stream,
@@ -296,8 +294,9 @@ public:
         if (enabled_constant_cache()) {
             std::promise<constant_cache_t::cached_t> c_promise;
             constant_cache_t::value_t cached_value
-                    = get_global_constant_cache().get_or_add(
-                            constant_key_, c_promise.get_future());
+                    = constant_cache().get_or_add(
+                            constant_key_, c_promise.get_future(),
+                            memory_planner_.total_internal_persistent_size());
             bool is_from_cache = cached_value.valid();
             if (is_from_cache) {
                 const constant_cache_t::cached_t &c_buffer = cached_value.get();
@@ -368,8 +367,9 @@ public:
         if (enabled_constant_cache()) {
             std::promise<constant_cache_t::cached_t> c_promise;
             constant_cache_t::value_t cached_value
-                    = get_global_constant_cache().get_or_add(
-                            constant_key_, c_promise.get_future());
+                    = constant_cache().get_or_add(
+                            constant_key_, c_promise.get_future(),
+                            memory_planner_.total_internal_persistent_size());
             bool is_from_cache = cached_value.valid();
             if (is_from_cache) {
                 const constant_cache_t::cached_t &c_buffer = cached_value.get();
@@ -747,6 +747,57 @@ status_t layout_propagator_for_layernorm(op_ptr &op,
     return status;
 }
 
+status_t layout_propagator_for_groupnorm(op_ptr &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    status_t status = status::success;
+    const auto &pd
+            = groupnorm_executable_t::create_desc(op, p_engine, mgr, pd_cache);
+
+    insert_reorder_after(
+            op, 0, pd.dst_desc(), p_engine, mgr, pd_cache, rewriter);
+    value_ptr dst = op->get_output_value(0);
+    status = fill_layout_info(dst, pd.dst_desc());
+    if (status != status::success) return status;
+
+    if (op->num_outputs() > 2) {
+        // keep_stats is true
+        value_ptr mean = op->get_output_value(1);
+        value_ptr variance = op->get_output_value(2);
+        status = fill_layout_info(mean, pd.mean_desc());
+        if (status != status::success) return status;
+        status = fill_layout_info(variance, pd.variance_desc());
+        if (status != status::success) return status;
+    }
+
+    // scratchpad is groupnorm's last output
+    value_ptr scratchpad_val = op->get_output_values().back();
+    status = fill_layout_info(scratchpad_val, pd.scratchpad_desc());
+    return status;
+}
+
+status_t layout_propagator_for_embedding_bag(op_ptr &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    status_t status = status::success;
+    value_ptr src = op->get_input_value(0);
+    assertm(!ltw(src->get_logical_tensor()).is_any(),
+            "embedding_bag's src can't be any layout now");
+
+    const auto &pd = embedding_bag_executable_t::create_desc(
+            op, p_engine, mgr, pd_cache);
+
+    insert_reorder_after(
+            op, 0, pd.dst_desc(), p_engine, mgr, pd_cache, rewriter);
+    value_ptr dst = op->get_output_value(0);
+    status = fill_layout_info(dst, pd.dst_desc());
+    if (status != status::success) return status;
+
+    value_ptr scratchpad_val = op->get_output_value(1);
+    status = fill_layout_info(scratchpad_val, pd.scratchpad_desc());
+    return status;
+}
+
 status_t layout_propagator_for_layernorm_bwd(op_ptr &op,
         const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
         pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
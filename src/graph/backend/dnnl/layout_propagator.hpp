@@ -69,6 +69,8 @@ DECLARE_LAYOUT_PROPAGATOR(prelu);
 DECLARE_LAYOUT_PROPAGATOR(prelu_bwd);
 DECLARE_LAYOUT_PROPAGATOR(layernorm);
 DECLARE_LAYOUT_PROPAGATOR(layernorm_bwd);
+DECLARE_LAYOUT_PROPAGATOR(groupnorm);
+DECLARE_LAYOUT_PROPAGATOR(embedding_bag);
 DECLARE_LAYOUT_PROPAGATOR(permute);
 DECLARE_LAYOUT_PROPAGATOR(to_group);
 DECLARE_LAYOUT_PROPAGATOR(from_group);
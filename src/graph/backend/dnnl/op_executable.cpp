@@ -717,11 +717,18 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     bool use_affine = true;
     if (op->has_attr(op_attr::use_affine))
         use_affine = op->get_attr<bool>(op_attr::use_affine);
+    const bool use_rms_norm = op->has_attr(op_attr::use_rms_norm)
+            && op->get_attr<bool>(op_attr::use_rms_norm);
 
     auto flags = dnnl::normalization_flags::none;
-    if (use_affine)
+    if (use_rms_norm) {
+        // RMS normalization has no shift.
+        flags |= dnnl::normalization_flags::rms_norm;
+        if (use_affine) flags |= dnnl::normalization_flags::use_scale;
+    } else if (use_affine) {
         flags |= (dnnl::normalization_flags::use_scale
                 | dnnl::normalization_flags::use_shift);
+    }
 
     prop_kind pkind = keep_stats ? prop_kind::forward_training
                                  : prop_kind::forward_inference;
@@ -738,6 +745,103 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     return {pd, false};
 }
 
+groupnorm_executable_t::desc_t groupnorm_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<
+                dnnl::group_normalization_forward::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
+        prm_attr = make_dnnl_primitive_attr(op, mgr.get_info(key));
+    }
+
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const int64_t groups = op->get_attr<int64_t>(op_attr::groups);
+    float epsilon = 1e-5;
+    if (op->has_attr(op_attr::epsilon))
+        epsilon = op->get_attr<float>(op_attr::epsilon);
+    bool keep_stats = true;
+    if (op->has_attr(op_attr::keep_stats))
+        keep_stats = op->get_attr<bool>(op_attr::keep_stats);
+    bool use_affine = true;
+    if (op->has_attr(op_attr::use_affine))
+        use_affine = op->get_attr<bool>(op_attr::use_affine);
+
+    auto flags = dnnl::normalization_flags::none;
+    if (use_affine)
+        flags |= (dnnl::normalization_flags::use_scale
+                | dnnl::normalization_flags::use_shift);
+
+    prop_kind pkind = keep_stats ? prop_kind::forward_training
+                                 : prop_kind::forward_inference;
+
+    auto src = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+
+    dnnl::group_normalization_forward::primitive_desc pd(
+            p_engine, pkind, src, dst, groups, epsilon, flags, prm_attr);
+
+    pd_cache.insert({op.get(), pd});
+    return {pd, false};
+}
+
+embedding_bag_executable_t::desc_t embedding_bag_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<dnnl::embedding_bag::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
+        prm_attr = make_dnnl_primitive_attr(op, mgr.get_info(key));
+    }
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    const std::string mode = op->has_attr(op_attr::mode)
+            ? op->get_attr<std::string>(op_attr::mode)
+            : "sum";
+
+    auto src = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto indices = make_dnnl_memory_desc(
+            op->get_input_value(1)->get_logical_tensor());
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+
+    dnnl::embedding_bag::primitive_desc pd;
+    if (mode == "gather") {
+        pd = dnnl::embedding_bag::primitive_desc(
+                p_engine, src, indices, dst, prm_attr);
+    } else {
+        auto offsets = make_dnnl_memory_desc(
+                op->get_input_value(2)->get_logical_tensor());
+        const dnnl::algorithm algo = mode == "mean"
+                ? dnnl::algorithm::embedding_bag_mean
+                : dnnl::algorithm::embedding_bag_sum;
+        pd = dnnl::embedding_bag::primitive_desc(
+                p_engine, algo, src, indices, offsets, dst, prm_attr);
+    }
+
+    pd_cache.insert({op.get(), pd});
+    return {pd, false};
+}
+
 layernorm_bwd_executable_t::desc_t layernorm_bwd_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -2043,6 +2147,50 @@ arg_indices_t layernorm_executable_t::get_arg_indices(
     UNUSED(mgr);
     arg_indices_t arg_indices;
 
+    size_t in_index = 0;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, in_index++}});
+    if (!op->has_attr(op_attr::use_affine)
+            || op->get_attr<bool>(op_attr::use_affine)) {
+        arg_indices.insert({DNNL_ARG_SCALE, indices_t {input, in_index++}});
+        // RMS normalization has no shift.
+        if (!op->has_attr(op_attr::use_rms_norm)
+                || !op->get_attr<bool>(op_attr::use_rms_norm))
+            arg_indices.insert(
+                    {DNNL_ARG_SHIFT, indices_t {input, in_index++}});
+    }
+
+    const fusion_info_t &fusion_info
+            = (op->has_attr(op_attr::fusion_info_key)
+                      && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            ? mgr.get_info(op->get_attr<int64_t>(op_attr::fusion_info_key))
+            : fusion_info_t();
+
+    if (fusion_info.with_runtime_scales(false, 0)) {
+        arg_indices.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST,
+                indices_t {input, in_index++}});
+    }
+
+    size_t out_index = 0;
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, out_index++}});
+    if (!op->has_attr(op_attr::keep_stats)
+            || op->get_attr<bool>(op_attr::keep_stats)) {
+        arg_indices.insert({DNNL_ARG_MEAN, indices_t {output, out_index++}});
+        arg_indices.insert(
+                {DNNL_ARG_VARIANCE, indices_t {output, out_index++}});
+    }
+
+    if (op->num_outputs() > out_index) {
+        arg_indices.insert(
+                {DNNL_ARG_SCRATCHPAD, indices_t {output, out_index++}});
+    }
+
+    return arg_indices;
+}
+
+arg_indices_t groupnorm_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    arg_indices_t arg_indices;
+
     size_t in_index = 0;
     arg_indices.insert({DNNL_ARG_SRC, indices_t {input, in_index++}});
     if (!op->has_attr(op_attr::use_affine)
@@ -2062,6 +2210,8 @@ arg_indices_t layernorm_executable_t::get_arg_indices(
                 indices_t {input, in_index++}});
     }
 
+    get_arg_indices_for_post_ops(op, mgr, arg_indices, in_index);
+
     size_t out_index = 0;
     arg_indices.insert({DNNL_ARG_DST, indices_t {output, out_index++}});
     if (!op->has_attr(op_attr::keep_stats)
@@ -2079,6 +2229,33 @@ arg_indices_t layernorm_executable_t::get_arg_indices(
     return arg_indices;
 }
 
+arg_indices_t embedding_bag_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    arg_indices_t arg_indices;
+
+    size_t in_index = 0;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, in_index++}});
+    arg_indices.insert({DNNL_ARG_INDICES, indices_t {input, in_index++}});
+    if (!op->has_attr(op_attr::mode)
+            || op->get_attr<std::string>(op_attr::mode) != "gather")
+        arg_indices.insert({DNNL_ARG_OFFSETS, indices_t {input, in_index++}});
+
+    const fusion_info_t &fusion_info
+            = (op->has_attr(op_attr::fusion_info_key)
+                      && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            ? mgr.get_info(op->get_attr<int64_t>(op_attr::fusion_info_key))
+            : fusion_info_t();
+
+    if (fusion_info.with_runtime_scales(true, 0)) {
+        arg_indices.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC,
+                indices_t {input, in_index++}});
+    }
+
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+    return arg_indices;
+}
+
 arg_indices_t layernorm_bwd_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     arg_indices_t arg_indices;
@@ -150,6 +150,7 @@ using io_indices_t = std::vector<size_t>;
 std::unordered_map<op_kind_t, std::pair<io_indices_t, io_indices_t>>
         io_idx_to_permute = {
                 {op_kind::dnnl_batchnorm, {{0}, {0}}},
+                {op_kind::dnnl_groupnorm, {{0}, {0}}},
                 {op_kind::dnnl_prelu, {{0, 1}, {0}}},
                 {op_kind::dnnl_prelu_bwd, {{0, 1, 2}, {0, 1}}},
                 {op_kind::dnnl_resampling, {{0}, {0}}},
@@ -155,6 +155,20 @@ static status_t softplus_handler(
     return status::success;
 }
 
+static status_t rms_norm_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    // RMS normalization is a flavor of the layer normalization primitive
+    // which never exposes statistics.
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_layernorm);
+    new_op->merge_attributes(op->get_attributes());
+    new_op->set_attr<bool>(op_attr::use_rms_norm, true);
+    new_op->set_attr<bool>(op_attr::keep_stats, false);
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 static status_t batchnorm_fwd_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     auto new_op = std::make_shared<op_t>(op_kind::dnnl_batchnorm);
@@ -655,6 +669,11 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // layernorm
         ITEM(LayerNorm, common_handler<op_kind::kDnnl_layernorm>),
         ITEM(LayerNormBackward, common_handler<op_kind::kDnnl_layernorm_bwd>),
+        ITEM(RMSNorm, rms_norm_handler),
+        // groupnorm
+        ITEM(GroupNorm, common_handler<op_kind::kDnnl_groupnorm>),
+        // embedding bag
+        ITEM(EmbeddingBag, common_handler<op_kind::kDnnl_embedding_bag>),
         // quantization
         ITEM(Quantize, static_quant_handler),
         ITEM(Dequantize, static_dequant_handler),
@@ -21,6 +21,9 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "common/concat_pd.hpp"
+#include "common/primitive_desc_iface.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
@@ -204,6 +207,14 @@ std::shared_ptr<execution_args_set_t> execution_args_set_t::clone() const {
                 mem_offkey.second);
     }
 
+    ret->sub_mems_.reserve(sub_mems_.size());
+    for (const auto &sub_mem : sub_mems_) {
+        ret->sub_mems_.push_back(
+                {ret->value_mem_map_.at(find_val(sub_mem.mem_)),
+                        ret->value_mem_map_.at(find_val(sub_mem.parent_)),
+                        sub_mem.offset_});
+    }
+
     ret->topo_ordered_exec_args_.reserve(topo_ordered_exec_args_.size());
     for (const auto &args : topo_ordered_exec_args_) {
         std::unordered_map<int, memory> new_args;
@@ -223,6 +234,7 @@ void execution_args_set_t::clear() {
     mems_use_external_outputs_.clear();
     mems_use_internal_temporary_.clear();
     mems_use_internal_persistent_.clear();
+    sub_mems_.clear();
     value_mem_map_.clear();
     topo_ordered_exec_args_.clear();
 }
@@ -380,6 +392,10 @@ status_t memory_planner_t::assign_external_outputs_buffer(
                         q.push(alias);
                     }
 
+                    // push the inplace concat inputs to queue for next visit
+                    for (const value_t *in : get_inplace_concat_inputs(cur_val))
+                        q.push(in);
+
                     // push the inplaced input to queue for next visit
                     auto &producer = cur_val->get_producer();
                     auto op_inplace_pairs = get_op_inplace_pairs(producer, mgr);
@@ -504,6 +520,29 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             // already assigned buffer, skip it
             if (buffer_assignments_.count(out.get())) continue;
 
+            // the output is an inplace concat input, place it in the concat
+            // output buffer, which is allocated on the first such input so
+            // that it stays alive until the concat consumers are computed
+            if (inplace_concat_inputs_.count(out.get())) {
+                auto dst = const_cast<value_t *>(
+                        inplace_concat_inputs_.at(out.get()).first);
+                if (!buffer_assignments_.count(dst)) {
+                    size_t idx = temporary_buffer_assigner_.request(
+                            make_dnnl_memory_desc(dst->get_logical_tensor())
+                                    .get_size());
+                    buffer_assignments_.insert(std::make_pair(
+                            dst, assign_info_t(internal_temporary, idx)));
+                    temporary_buffer_ref_count[idx] = edge_ref_count.at(dst);
+                }
+                assign_info_t info = buffer_assignments_.at(dst);
+                buffer_assignments_.insert(std::make_pair(out.get(), info));
+                if (info.kind_ == internal_temporary) {
+                    temporary_buffer_ref_count[info.index_]
+                            += edge_ref_count.at(out.get());
+                }
+                continue;
+            }
+
             // this output need a new buffer, record it
             auto lt = out->get_logical_tensor();
             size_t idx = temporary_buffer_assigner_.request(
@@ -555,6 +594,8 @@ status_t memory_planner_t::prepare_subgraph_inplace_pairs(
         for (auto &out_val : out_vals) {
             auto out_buf = buffer_assignments_.at(out_val.get());
             if (out_buf.kind_ != external_output) continue;
+            // inplace concat inputs only occupy a part of the output buffer
+            if (inplace_concat_inputs_.count(out_val.get())) continue;
             logical_tensor_t out_lt = sg->outs_[out_buf.index_];
             logical_tensor_t in_lt = zero_logical_tensor();
 
@@ -643,6 +684,79 @@ status_t memory_planner_t::prepare_subgraph_inplace_pairs(
     return ret;
 }
 
+// Find the concat ops whose inputs can be written by their producers directly
+// into the concat output. The concat primitive detects that the inputs are
+// already in place and skips the copy, so a whole pass over the data is saved.
+// An input qualifies if:
+// - the concat primitive reports that its image in the output is a dense
+//   chunk with the input layout (see concat_pd_t::src_inplace_offset())
+// - it's produced inside the subgraph and consumed only by the concat, so no
+//   one else observes its buffer
+// - it's not constant, since constant values are cached in their own buffers
+// - it doesn't share buffer with other values via alias or inplace
+// A concat is handled only if all its inputs qualify, otherwise the primitive
+// would copy the data anyway. Only CPU engines are supported as the inputs
+// are addressed by raw pointers into the output buffer.
+status_t memory_planner_t::prepare_inplace_concat_inputs(
+        std::shared_ptr<subgraph_t> &sg, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr) {
+    if (p_engine.get_kind() != dnnl::engine::kind::cpu)
+        return status::success;
+
+    const auto sg_outs = sg->get_output_values();
+    for (op_ptr cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_concat) continue;
+        if (cur_op->has_attr(op_attr::is_constant)
+                && cur_op->get_attr<bool>(op_attr::is_constant))
+            continue;
+
+        const auto pd = concat_executable_t::create_desc(
+                cur_op, p_engine, mgr, sg->pd_cache_);
+        const auto concat_pd = static_cast<const concat_pd_t *>(
+                pd.get()->impl().get());
+        if (!concat_pd->is_inplace()) continue;
+
+        const value_t *dst = cur_op->get_output_value(0).get();
+        std::vector<std::pair<const value_t *, size_t>> inputs;
+        for (size_t i = 0; i < cur_op->num_inputs(); i++) {
+            const value_t *in = cur_op->get_input_value(i).get();
+            const int idx = static_cast<int>(i);
+            bool ok = in->has_producer() && in->get_consumers().size() == 1
+                    && std::find(sg_outs.begin(), sg_outs.end(), in)
+                            == sg_outs.end()
+                    && !ltw(in->get_logical_tensor()).is_constant()
+                    && alias_analyzer_.get_all_aliases(in).empty()
+                    && make_dnnl_memory_desc(in->get_logical_tensor())
+                            == pd.src_desc(idx);
+            if (!ok) break;
+
+            auto &producer = in->get_producer();
+            for (const auto &pair : get_op_inplace_pairs(producer, mgr)) {
+                if (pair.out_idx_ == in->get_offset()) ok = false;
+            }
+            if (!ok) break;
+
+            const dim_t offset = concat_pd->src_inplace_offset(idx);
+            inputs.emplace_back(in, static_cast<size_t>(offset));
+        }
+        if (inputs.size() != cur_op->num_inputs()) continue;
+
+        for (const auto &in_off : inputs) {
+            inplace_concat_inputs_.insert({in_off.first, {dst, in_off.second}});
+        }
+    }
+    return status::success;
+}
+
+std::vector<const value_t *> memory_planner_t::get_inplace_concat_inputs(
+        const value_t *concat_dst) const {
+    std::vector<const value_t *> ret;
+    for (const auto &in_dst : inplace_concat_inputs_) {
+        if (in_dst.second.first == concat_dst) ret.emplace_back(in_dst.first);
+    }
+    return ret;
+}
+
 status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
     // collect all values into the set.
     std::unordered_set<value_t *> to_be_booked;
@@ -686,6 +800,8 @@ status_t memory_planner_t::prepare_execution_args_set(
     status_t ret;
 
     auto classify_mem = [&, this](const dnnl::memory &mem, const value_t *val) {
+        // inplace concat inputs get their handles from the concat output
+        if (inplace_concat_inputs_.count(val)) return;
         const assign_info_t &info = buffer_assignments_.at(val);
         switch (info.kind_) {
             case external_input:
@@ -730,6 +846,16 @@ status_t memory_planner_t::prepare_execution_args_set(
     });
     if (ret != status::success) return ret;
 
+    for (const auto &in_dst : inplace_concat_inputs_) {
+        dnnl::memory mem, parent;
+        if (!exec_args_set_.find_value_mem_map(
+                    const_cast<value_t *>(in_dst.first), mem)
+                || !exec_args_set_.find_value_mem_map(
+                        const_cast<value_t *>(in_dst.second.first), parent))
+            return status::invalid_arguments;
+        exec_args_set_.add_sub_mem({mem, parent, in_dst.second.second});
+    }
+
     // construct the dnnl execution args for each op
     ret = topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
         const op_schema_t *opm
@@ -782,6 +908,7 @@ status_t memory_planner_t::prepare_execution_args_set(
 // - Count the reference count of each edges. the reference count will be used
 //   during assign temporary buffer to determine which edge's buffer can be
 //   reused since it ref count reduce to zero.
+// - Find the concat inputs which can share the buffer of the concat output.
 // - Assign external user given inputs/outputs buffer to corresponding edges
 // - Assign internal allocated temporary buffer to corresponding edges.
 // - Assign internal allocated persistent buffer to corresponding edges.
@@ -823,6 +950,10 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // Find the concat inputs which can be placed in the concat output
+    ret = prepare_inplace_concat_inputs(sg, p_engine, mgr);
+    if (ret != status::success) return ret;
+
     // Assign external_input buffers to subgraph's inputs and their alias
     ret = assign_external_inputs_buffer(sg, inputs);
     if (ret != status::success) return ret;
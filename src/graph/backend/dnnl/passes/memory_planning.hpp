@@ -43,6 +43,15 @@ namespace dnnl_impl {
 // are used when executing a compiled subgraph in a thread. This class should
 // only be generated by the memory_planner_t class. When executing subgraph in
 // multi-threads, each thread should have a replica.
+// A memory which lives at a byte offset inside the buffer of another (parent)
+// memory. For example, a concat input written by its producer directly into
+// the concat output.
+struct sub_memory_t {
+    dnnl::memory mem_;
+    dnnl::memory parent_;
+    size_t offset_;
+};
+
 class execution_args_set_t {
 public:
     execution_args_set_t() = default;
@@ -86,6 +95,10 @@ public:
         return mems_use_internal_persistent_;
     }
 
+    const std::vector<sub_memory_t> &get_sub_mems() const {
+        return sub_mems_;
+    }
+
     // adders
     void add_exec_args(const exec_args &args) {
         topo_ordered_exec_args_.emplace_back(args);
@@ -115,6 +128,19 @@ public:
         mems_use_internal_persistent_.emplace_back(mem_offkey);
     }
 
+    void add_sub_mem(const sub_memory_t &sub_mem) {
+        sub_mems_.emplace_back(sub_mem);
+    }
+
+    // Points the sub-memories to their place in the parent buffers. Should be
+    // called after all the other memories got their data handles.
+    void set_sub_mems_data_handle() const {
+        for (const auto &sub_mem : sub_mems_) {
+            char *base = static_cast<char *>(sub_mem.parent_.get_data_handle());
+            sub_mem.mem_.set_data_handle(base + sub_mem.offset_);
+        }
+    }
+
     // finders
     bool find_value_mem_map(value_t *key, memory &mem) const {
         auto pos = value_mem_map_.find(key);
@@ -136,6 +162,8 @@ private:
     // memory <-> offset key of used underlying buffer in the internal
     // persistent registry
     std::vector<std::pair<dnnl::memory, size_t>> mems_use_internal_persistent_;
+    // memories which live inside the buffers of other memories
+    std::vector<sub_memory_t> sub_mems_;
     // value pointer -> memory
     std::unordered_map<value_t *, memory> value_mem_map_;
     // execution args for each op in the subgraph
@@ -277,6 +305,9 @@ private:
 // The supported memory sharing policy:
 // - Inplace sharing. Use same buffer for input and output values of ops that
 //   support inplace computation.
+// - Inplace concat. Place the inputs of a concat at their offsets in the
+//   concat output buffer, so that the producers write there directly and the
+//   concat has nothing to copy.
 // - Standard sharing. Use same buffer for values that have disjoint live range.
 //   Take this subgraph 't1 -> op1 -> t2 -> op2 -> t3 -> op3 -> t4-> op4 -> t5'
 //   as an example: when writing data to t4, t2 is not used any more, so they
@@ -385,6 +416,7 @@ private:
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
         inplace_pairs_.clear();
+        inplace_concat_inputs_.clear();
     }
 
     status_t assign_external_inputs_buffer(std::shared_ptr<subgraph_t> &sg,
@@ -404,6 +436,12 @@ private:
     status_t prepare_subgraph_inplace_pairs(
             std::shared_ptr<subgraph_t> &sg, bool enable_standard_sharing);
 
+    status_t prepare_inplace_concat_inputs(std::shared_ptr<subgraph_t> &sg,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr);
+
+    std::vector<const value_t *> get_inplace_concat_inputs(
+            const value_t *concat_dst) const;
+
     status_t book_buffers(std::shared_ptr<subgraph_t> &sg);
 
     status_t prepare_execution_args_set(std::shared_ptr<subgraph_t> &sg,
@@ -422,6 +460,10 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    // concat input -> {concat output, offset in bytes of the input in the
+    // output}. The input shares the buffer of the output.
+    std::unordered_map<const value_t *, std::pair<const value_t *, size_t>>
+            inplace_concat_inputs_;
 };
 
 } // namespace dnnl_impl
@@ -143,7 +143,8 @@ status_t replace_quant_data_with_binary_post_op(
     for (const auto &cur_op : sg->get_ops()) {
         if ((is_output_scales_supported(cur_op->get_kind())
                     && cur_op->get_kind() != op_kind::dnnl_softmax
-                    && cur_op->get_kind() != op_kind::dnnl_layernorm)
+                    && cur_op->get_kind() != op_kind::dnnl_layernorm
+                    && cur_op->get_kind() != op_kind::dnnl_groupnorm)
                 || visited.count(cur_op.get()))
             continue;
 
@@ -257,7 +258,8 @@ status_t convert_to_runtime_src_scales(std::shared_ptr<subgraph_t> &sg) {
         if (consumers.empty()) continue;
         if (!impl::utils::one_of(consumers[0].get_op().get_kind(),
                     op_kind::dnnl_matmul, op_kind::dnnl_convolution,
-                    op_kind::dnnl_convtranspose, op_kind::dnnl_reorder))
+                    op_kind::dnnl_convtranspose, op_kind::dnnl_reorder,
+                    op_kind::dnnl_embedding_bag))
             continue;
 
         // make scales as a constant input
@@ -1089,7 +1091,8 @@ status_t fuse_src_scales(std::shared_ptr<subgraph_t> &sg) {
         if (consumers.empty()) continue;
         if (!impl::utils::one_of(consumers[0].get_op().get_kind(),
                     op_kind::dnnl_matmul, op_kind::dnnl_convolution,
-                    op_kind::dnnl_convtranspose, op_kind::dnnl_reorder))
+                    op_kind::dnnl_convtranspose, op_kind::dnnl_reorder,
+                    op_kind::dnnl_embedding_bag))
             continue;
 
         auto &next_op = consumers[0].get_op();
@@ -1140,6 +1143,7 @@ status_t fuse_dst_scales(std::shared_ptr<subgraph_t> &sg) {
                     && cur_op->get_kind() != op_kind::dnnl_convtranspose
                     && cur_op->get_kind() != op_kind::dnnl_softmax
                     && cur_op->get_kind() != op_kind::dnnl_layernorm
+                    && cur_op->get_kind() != op_kind::dnnl_groupnorm
                     && cur_op->get_kind() != op_kind::dnnl_reorder)
                 || visited.count(cur_op.get()) != 0)
             continue;
@@ -1185,8 +1189,9 @@ status_t convert_to_runtime_dst_scales(std::shared_ptr<subgraph_t> &sg) {
                 || !cur_op->get_input_value(0)->has_producer()
                 || !impl::utils::one_of(cur_op->get_input_op(0)->get_kind(),
                         op_kind::dnnl_softmax, op_kind::dnnl_layernorm,
-                        op_kind::dnnl_convolution, op_kind::dnnl_matmul,
-                        op_kind::dnnl_convtranspose, op_kind::dnnl_reorder)
+                        op_kind::dnnl_groupnorm, op_kind::dnnl_convolution,
+                        op_kind::dnnl_matmul, op_kind::dnnl_convtranspose,
+                        op_kind::dnnl_reorder)
                 || visited.count(cur_op.get()))
             continue;
 
@@ -1933,7 +1938,8 @@ status_t fuse_post_typecast_to_softmax_or_layernorm(
     std::vector<std::vector<op_t *>> fusion_groups;
     for (const auto &cur_op : sg->get_ops()) {
         if (cur_op->get_kind() != op_kind::dnnl_softmax
-                && cur_op->get_kind() != op_kind::dnnl_layernorm)
+                && cur_op->get_kind() != op_kind::dnnl_layernorm
+                && cur_op->get_kind() != op_kind::dnnl_groupnorm)
             continue;
         auto out = cur_op->get_output_value(0);
         if (out->get_consumers().size() != 1) continue;
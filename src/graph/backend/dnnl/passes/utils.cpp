@@ -470,6 +470,7 @@ get_post_ops_fusible_map() {
                     {dnnl_resampling, {dnnl_eltwise, dnnl_binary}},
                     {dnnl_reorder, {dnnl_binary}},
                     {dnnl_softmax, {dnnl_eltwise, dnnl_binary}},
+                    {dnnl_groupnorm, {dnnl_eltwise, dnnl_binary}},
             };
     return fusible_map;
 }
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+/*!
+ * \brief This provides embedding bag-related fusion
+ *        The process includes follow steps:
+ *          1. look for fusion pattern on the graph
+ *          2. If found, verify if this transformation is safe / correct
+ *          3. replace the pattern with a fused op, update the graph
+ *
+ * \brief These patterns can match the target graph as shown below:
+ *
+ *      [dequantize]*                   [dequantize]*
+ *           |                               |
+ *      embeddingbag          ...       embeddingbag*    ...
+ *                             \             |           /
+ *                                       concat
+ *
+ * where the dequantize of an int8 table becomes the source scales of the
+ * embedding bag primitive and `*` marks optional ops. The concat inputs
+ * which are not produced by an embedding bag are partition inputs.
+ */
+namespace {
+// The primitive applies a common scale or a scale per table row and does not
+// support zero points.
+bool check_table_dequant(op_t *op) {
+    if (!check_zps_values<0>(op)) return false;
+    const auto &qtype = op->get_attr<std::string>(op_attr::qtype);
+    return qtype == "per_tensor" || op->get_attr<int64_t>(op_attr::axis) == 0;
+}
+
+// Keeps the concat pattern from taking over concats which have nothing to do
+// with embedding lookups.
+bool check_embedding_bag_input(op_t *op) {
+    for (size_t i = 0; i < op->num_inputs(); ++i) {
+        auto in_val = op->get_input_value(i);
+        if (in_val->has_producer()
+                && in_val->get_producer().get_kind()
+                        == graph::op_kind::EmbeddingBag)
+            return true;
+    }
+    return false;
+}
+
+pm::pb_op_t *optional_dequant_embedding_bag(
+        const std::shared_ptr<pb_graph_t> &pgraph) {
+    auto dequant_graph = std::make_shared<pb_graph_t>();
+    pm::pb_op_t *dequant
+            = dequant_graph->append_op(graph::op_kind::Dequantize);
+    dequant->append_decision_function(check_table_dequant);
+    dequant_graph->create_input_port(0, dequant, 0);
+    dequant_graph->create_output_port(0, dequant, 0);
+    auto popt_dequant = pgraph->append_optional(dequant_graph);
+
+    return pgraph->append_op(graph::op_kind::EmbeddingBag,
+            in_edges_t {in_edge(0, popt_dequant, 0)});
+}
+} // namespace
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(embedding_bag_fusion)
+
+// Embedding bag is not supported on gpu.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, embedding_bag_fusion)
+        .set_priority(8.2f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    optional_dequant_embedding_bag(pgraph);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, embedding_bag_concat_fusion)
+        .set_priority(8.3f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    in_edges_t input_edges;
+                    for (size_t i = 0; i < VARIADIC_INPUT_NUM; ++i) {
+                        auto eb_graph = std::make_shared<pb_graph_t>();
+                        pm::pb_op_t *eb
+                                = optional_dequant_embedding_bag(eb_graph);
+                        eb_graph->create_output_port(0, eb, 0);
+                        auto popt_eb = pgraph->append_optional(eb_graph);
+                        input_edges.emplace_back(in_edge(i, popt_eb, 0));
+                    }
+                    pm::pb_op_t *concat = pgraph->append_op(
+                            graph::op_kind::Concat, input_edges);
+                    concat->append_decision_function(
+                            check_embedding_bag_input);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -48,7 +48,29 @@ using FCreatePattern = graph::pass::FCreatePattern;
  *        quantize          |              |
  *           |
  *  
+ * where layernorm is either LayerNorm or RMSNorm. GroupNorm additionally
+ * takes a chain of unary and binary post-ops before the optional typecast and
+ * quantize.
  */
+namespace {
+void make_groupnorm_post_ops_pattern(
+        const std::shared_ptr<pb_graph_t> &pgraph) {
+    pm::pb_op_t *groupnorm_base = pgraph->append_op(graph::op_kind::GroupNorm);
+
+    // repetition(alternation(unary | binary))
+    auto alt_unary_binary = std::make_shared<pb_graph_t>();
+    auto palt = alt_unary_binary->append_alternation(get_unary_binary_ops());
+    palt->allow_internal_inputs();
+    alt_unary_binary->create_input_port(0, palt, 0);
+    alt_unary_binary->create_output_port(0, palt, 0);
+    auto prep = pgraph->append_repetition(alt_unary_binary, {0, 0}, 0,
+            MAX_REPETITION, in_edges_t {in_edge(0, groupnorm_base, 0)});
+
+    auto alt_tc_q = make_typecast_quantize_alt();
+    pgraph->append_optional(alt_tc_q, in_edges_t {in_edge(0, prep, 0)});
+}
+} // namespace
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(layernorm_fusion)
 
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
@@ -57,8 +79,9 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
         .set_engine_kind(engine_kind::cpu)
         .set_attr<FCreatePattern>("FCreatePattern",
                 [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
-                    pm::pb_op_t *layernorm_base
-                            = pgraph->append_op(graph::op_kind::LayerNorm);
+                    pm::pb_op_t *layernorm_base = pgraph->append_alternation(
+                            {graph::op_kind::LayerNorm,
+                                    graph::op_kind::RMSNorm});
                     layernorm_base->append_decision_function(
                             check_input_dtype_from_offset<impl::data_type::f32,
                                     1>);
@@ -110,6 +133,17 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
             return std::make_shared<layernorm_fwd_t>();
         });
 
+// currently, group normalization is not supported on gpu.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, groupnorm_post_ops_fusion_cpu)
+        .set_priority(8.2f)
+        .set_kind(graph::partition_kind_t::misc_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>(
+                "FCreatePattern", make_groupnorm_post_ops_pattern)
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<layernorm_fwd_t>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
@@ -57,6 +57,8 @@ const data_type_t s32 = dnnl_s32;
 const data_type_t s8 = dnnl_s8;
 const data_type_t u8 = dnnl_u8;
 const data_type_t boolean = dnnl_boolean;
+const data_type_t f8_e5m2 = dnnl_f8_e5m2;
+const data_type_t f8_e4m3 = dnnl_f8_e4m3;
 } // namespace data_type
 
 using partition_policy_t = dnnl_graph_partition_policy_t;
@@ -141,10 +143,12 @@ const op_kind_t DynamicDequantize = dnnl_graph_op_dynamic_dequantize;
 const op_kind_t DynamicQuantize = dnnl_graph_op_dynamic_quantize;
 const op_kind_t Elu = dnnl_graph_op_elu;
 const op_kind_t EluBackward = dnnl_graph_op_elu_backward;
+const op_kind_t EmbeddingBag = dnnl_graph_op_embedding_bag;
 const op_kind_t End = dnnl_graph_op_end;
 const op_kind_t Exp = dnnl_graph_op_exp;
 const op_kind_t GELU = dnnl_graph_op_gelu;
 const op_kind_t GELUBackward = dnnl_graph_op_gelu_backward;
+const op_kind_t GroupNorm = dnnl_graph_op_group_norm;
 const op_kind_t HardSigmoid = dnnl_graph_op_hard_sigmoid;
 const op_kind_t HardSigmoidBackward = dnnl_graph_op_hard_sigmoid_backward;
 const op_kind_t HardSwish = dnnl_graph_op_hard_swish;
@@ -180,6 +184,7 @@ const op_kind_t ReduceSum = dnnl_graph_op_reduce_sum;
 const op_kind_t ReLU = dnnl_graph_op_relu;
 const op_kind_t ReLUBackward = dnnl_graph_op_relu_backward;
 const op_kind_t Reorder = dnnl_graph_op_reorder;
+const op_kind_t RMSNorm = dnnl_graph_op_rms_norm;
 const op_kind_t Round = dnnl_graph_op_round;
 const op_kind_t Select = dnnl_graph_op_select;
 const op_kind_t Sigmoid = dnnl_graph_op_sigmoid;
@@ -369,10 +369,12 @@ public:
             CASE(DynamicQuantize);
             CASE(Elu);
             CASE(EluBackward);
+            CASE(EmbeddingBag);
             CASE(End);
             CASE(Exp);
             CASE(GELU);
             CASE(GELUBackward);
+            CASE(GroupNorm);
             CASE(HardSigmoid);
             CASE(HardSigmoidBackward);
             CASE(HardSwish);
@@ -408,6 +410,7 @@ public:
             CASE(ReLU);
             CASE(ReLUBackward);
             CASE(Reorder);
+            CASE(RMSNorm);
             CASE(Round);
             CASE(Select);
             CASE(Sigmoid);
@@ -120,7 +120,7 @@ bool check_interpolate_sizes_scales(const op_t *n) {
     return true;
 }
 
-// check function for output number of LayerNorm forward.
+// check function for output number of LayerNorm and GroupNorm forward.
 // if keep_stats == true, outputs should include mean and variance.
 bool check_ln_fwd_outputs_num(const op_t *n) {
     const size_t actual_num = n->num_outputs();
@@ -142,6 +142,26 @@ bool check_ln_bwd_use_affine(const op_t *n) {
     return true;
 }
 
+// check function for input number of GroupNorm and RMSNorm forward.
+// gamma (and beta) should be provided if and only if use_affine == true.
+bool check_norm_fwd_inputs_num(const op_t *n) {
+    const size_t actual_num = n->num_inputs();
+    const bool use_affine = n->has_attr(op_attr::use_affine)
+            ? n->get_attr<bool>(op_attr::use_affine)
+            : true;
+    return use_affine ? actual_num > 1 : actual_num == 1;
+}
+
+// check function for input number of EmbeddingBag.
+// offsets should be provided if and only if mode != "gather".
+bool check_embedding_bag_inputs_num(const op_t *n) {
+    const size_t actual_num = n->num_inputs();
+    const std::string mode = n->has_attr(op_attr::mode)
+            ? n->get_attr<std::string>(op_attr::mode)
+            : "sum";
+    return mode == "gather" ? actual_num == 2 : actual_num == 3;
+}
+
 // check function foraxes of Reduce.
 // including Reduce: L1/L2/Max/Mean/Min/Prod/Sum.
 // attribute_axes and input_axes is incompatible.
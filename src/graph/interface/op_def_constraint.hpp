@@ -41,6 +41,10 @@ bool check_ln_fwd_outputs_num(const op_t *n);
 
 bool check_ln_bwd_use_affine(const op_t *n);
 
+bool check_norm_fwd_inputs_num(const op_t *n);
+
+bool check_embedding_bag_inputs_num(const op_t *n);
+
 bool check_reduce_axes(const op_t *n);
 
 bool check_quant_dequant_scales_zps(const op_t *n);
@@ -25,6 +25,7 @@
 #include "oneapi/dnnl/dnnl_graph_sycl.h"
 
 #include "common/stream.hpp"
+#include "common/trace.hpp"
 #include "common/verbose.hpp"
 
 #include "graph/interface/allocator.hpp"
@@ -448,6 +449,14 @@ status_t DNNL_API dnnl_graph_compiled_partition_query_logical_tensor(
     return compiled_partition->query_logical_tensor(tid, lt);
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_set_constant_tensor_cache_pinned(
+        compiled_partition_t *compiled_partition, int pinned) {
+    if (compiled_partition == nullptr || pinned < 0)
+        return status::invalid_arguments;
+    if (!compiled_partition->is_initialized()) return status::invalid_arguments;
+    return compiled_partition->set_constant_cache_pinned(pinned > 0);
+}
+
 status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
         const compiled_partition_t *compiled_partition,
         size_t *num_inplace_pairs, const inplace_pair_t **inplace_pairs) {
@@ -726,6 +735,9 @@ status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
     pre_process(processed_inputs, inputs, backend);
     pre_process(processed_outputs, outputs, backend);
 
+    dnnl::impl::trace::scoped_event_t trace_event("partition",
+            dnnl::impl::trace::is_enabled() ? info() : nullptr, -1, -1,
+            /* is_current = */ true);
     return pimpl_->execute(astream, processed_inputs, processed_outputs);
 }
 
@@ -751,6 +763,9 @@ status_t dnnl_graph_compiled_partition::execute_sycl(const stream_t *astream,
     pre_process(processed_inputs, inputs, backend);
     pre_process(processed_outputs, outputs, backend);
 
+    dnnl::impl::trace::scoped_event_t trace_event("partition",
+            dnnl::impl::trace::is_enabled() ? info() : nullptr, -1, -1,
+            /* is_current = */ true);
     ret = pimpl_->execute_sycl(astream, processed_inputs, processed_outputs,
             sycl_deps, sycl_event);
 
@@ -203,6 +203,10 @@ public:
         return pimpl_->get_outputs();
     }
 
+    graph::status_t set_constant_cache_pinned(bool pinned) {
+        return pimpl_->set_constant_cache_pinned(pinned);
+    }
+
     const char *info() const {
         auto eng = pimpl_->get_engine();
         if (!info_.is_initialized()) info_.init(eng, this);
@@ -352,6 +352,16 @@ public:
             = 0;
 #endif
 
+    /// Pin or unpin the constant tensors of the compiled partition in the
+    /// constant tensor cache of the backend
+    /// @param pinned Whether the constant tensors are pinned
+    /// @return The status code. Will be unimplemented if the backend doesn't
+    ///     cache constant tensors
+    virtual status_t set_constant_cache_pinned(bool pinned) {
+        UNUSED(pinned);
+        return status::unimplemented;
+    }
+
 protected:
     /// The engine which this compiled_partition_impl_t is specialized
     /// for. Should directly store the engine that is given when calling
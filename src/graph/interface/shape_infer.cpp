@@ -1047,6 +1047,60 @@ status_t infer_norm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_groupnorm_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto status = infer_identity_output_shape(n, inputs, outputs);
+    if (status != status::success) return status;
+
+    const bool keep_stats = n->has_attr(op_attr::keep_stats)
+            ? n->get_attr<bool>(op_attr::keep_stats)
+            // Keep default value as which in op_schema
+            : true;
+    if (!keep_stats) return status::success;
+
+    // mean and variance are computed per sample and group.
+    const dims input0_dims = logical_tensor_wrapper_t(inputs[0]).vdims();
+    const dim_t groups = n->get_attr<int64_t>(op_attr::groups);
+    const dims output_dims {input0_dims[0], groups};
+    for (size_t i = 1; i < 3; i++) {
+        if (logical_tensor_wrapper_t(outputs[i]).is_shape_unknown())
+            set_shape_and_strides(*outputs[i], output_dims);
+    }
+    return status::success;
+}
+
+status_t infer_embedding_bag_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    auto in1 = logical_tensor_wrapper_t(inputs[1]);
+    if (in0.ndims() != 2 || in1.ndims() != 1) return status::invalid_shape;
+
+    // gather produces a row per index, pooling produces a row per bag.
+    const std::string mode = n->has_attr(op_attr::mode)
+            ? n->get_attr<std::string>(op_attr::mode)
+            : "sum";
+    dim_t rows = in1.vdims()[0];
+    if (mode != "gather") {
+        auto in2 = logical_tensor_wrapper_t(inputs[2]);
+        if (in2.ndims() != 1) return status::invalid_shape;
+        rows = in2.vdims()[0];
+    }
+    const dims output_dims {rows, in0.vdims()[1]};
+
+    // check if partial set shape aligns with inferred shape
+    if (out0.ndims() != -1) {
+        if (!validate(output_dims, out0.vdims())) {
+            return status::invalid_shape;
+        }
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
 status_t infer_norm_bprop_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
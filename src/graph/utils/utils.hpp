@@ -64,7 +64,9 @@ inline static size_t size_of(data_type_t dtype) {
         case data_type::f32:
         case data_type::s32: return 4U;
         case data_type::s8:
-        case data_type::u8: return 1U;
+        case data_type::u8:
+        case data_type::f8_e5m2:
+        case data_type::f8_e4m3: return 1U;
         case data_type::f16:
         case data_type::bf16: return 2U;
         default: return 0;
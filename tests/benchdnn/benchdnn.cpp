@@ -68,6 +68,9 @@ int fix_times_per_prb {default_fix_times_per_prb};
 int default_fix_times_per_prb {0};
 int repeats_per_prb {default_repeats_per_prb};
 int default_repeats_per_prb {1};
+int perf_instances {default_perf_instances};
+int default_perf_instances {1};
+bool perf_counters {false};
 
 bool fast_ref_gpu {DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE};
 
@@ -117,6 +117,9 @@ extern int fix_times_per_prb; // if non-zero run prb that many times
 extern int default_fix_times_per_prb; // 0, rely on time criterion
 extern int repeats_per_prb; // test repeats per prb
 extern int default_repeats_per_prb; // default test repeats per prb
+extern int perf_instances; // number of concurrent instances in perf mode
+extern int default_perf_instances; // 1, a single instance
+extern bool perf_counters; // collect hardware counters in timers
 
 extern bool fast_ref_gpu;
 extern bool allow_enum_tags_only;
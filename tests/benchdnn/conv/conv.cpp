@@ -368,7 +368,14 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
 
     float trh = 0.f;
     if (prb->alg & WINO) {
-        trh = prb->dt[1] == dnnl_f16 ? 7e-3f : 2e-5f;
+        // The transformed source and weights are rounded to the data type of
+        // the computations. The CPU implementation uses F(2x2, 3x3) for bf16,
+        // whose transforms do not amplify the rounding error, so the error is
+        // dominated by the bf16 rounding of the operands and the destination,
+        // which is within a few units of 2^-9 in the L2 norm.
+        trh = prb->dt[1] == dnnl_f16   ? 7e-3f
+                : prb->dt[1] == dnnl_bf16 ? 1e-2f
+                                          : 2e-5f;
         if (prb->dir & FLAG_WEI) {
             // This is an empirical equation derived by observing growth error
             // with increasing 'k' dimension in gemm of winograd
@@ -129,7 +129,8 @@ struct prb_t : public desc_t {
         : prb_t(s.desc, s.dir[0], s.dt[0], s.stag[0], s.wtag[0], s.dtag[0],
                 s.alg[0],
                 settings_t::get_attr(s.scales[0], s.zero_points[0],
-                        s.post_ops[0], s.scratchpad_mode[0], s.fpmath_mode[0]),
+                        s.post_ops[0], s.scratchpad_mode[0], s.fpmath_mode[0],
+                        s.scheduling[0]),
                 s.ctx_init[0], s.ctx_exe[0], s.mb[0]) {
         SAFE_V(s.has_single_setup() ? OK : FAIL);
     }
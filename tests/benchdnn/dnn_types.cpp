@@ -589,6 +589,7 @@ int attr_t::post_ops_t::from_str(const std::string &s) {
 bool attr_t::is_def(bool skip_fpmath) const {
     return scales.is_def() && zero_points.is_def() && post_ops.is_def()
             && scratchpad_mode == get_default_scratchpad_mode()
+            && scheduling == dnnl_scheduling_balanced
             && IMPLICATION(
                     !skip_fpmath, fpmath_mode == dnnl_fpmath_mode_strict);
 }
@@ -742,6 +743,11 @@ std::ostream &operator<<(std::ostream &s, dnnl_scratchpad_mode_t sm) {
     return s;
 }
 
+std::ostream &operator<<(std::ostream &s, dnnl_scheduling_t sch) {
+    s << (sch == dnnl_scheduling_work_stealing ? "work_stealing" : "balanced");
+    return s;
+}
+
 std::ostream &operator<<(std::ostream &s, dnnl_fpmath_mode_t fm) {
     s << fpmath_mode2str(fm);
     return s;
@@ -758,6 +764,8 @@ std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
             s << "--attr-scratchpad=" << attr.scratchpad_mode << " ";
         if (attr.fpmath_mode != dnnl_fpmath_mode_strict)
             s << "--attr-fpmath=" << attr.fpmath_mode << " ";
+        if (attr.scheduling != dnnl_scheduling_balanced)
+            s << "--attr-scheduling=" << attr.scheduling << " ";
     }
     return s;
 }
@@ -803,6 +811,16 @@ std::ostream &operator<<(std::ostream &s, memory_kind_ext_t memory_kind) {
     return s;
 }
 
+std::ostream &operator<<(std::ostream &s, cold_cache_t cold_cache) {
+    switch (cold_cache) {
+        case cold_cache_t::none: s << "none"; break;
+        case cold_cache_t::wei: s << "wei"; break;
+        case cold_cache_t::all: s << "all"; break;
+        default: assert(!"unexpected"); break;
+    }
+    return s;
+}
+
 std::ostream &dump_global_params(std::ostream &s) {
     // Need to dump mode and modifiers in front of the driver name to make all
     // updated default values take effect before parsing a state of a problem.
@@ -820,6 +838,12 @@ std::ostream &dump_global_params(std::ostream &s) {
         s << "--max-ms-per-prb=" << max_ms_per_prb << " ";
     if (canonical || fix_times_per_prb != default_fix_times_per_prb)
         s << "--fix-times-per-prb=" << fix_times_per_prb << " ";
+    if (canonical || cold_cache != default_cold_cache)
+        s << "--cold-cache=" << cold_cache << " ";
+    if (canonical || perf_instances != default_perf_instances)
+        s << "--perf-instances=" << perf_instances << " ";
+    if (canonical || perf_counters != false)
+        s << "--perf-counters=" << bool2str(perf_counters) << " ";
 
     s << "--" << driver_name << " ";
     if (canonical) s << "--canonical=" << bool2str(canonical) << " ";
@@ -871,6 +895,19 @@ dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str) {
     return attr_t::get_default_scratchpad_mode();
 }
 
+dnnl_scheduling_t str2scheduling(const char *str) {
+    const char *param = "balanced";
+    if (!strncasecmp(param, str, strlen(param)))
+        return dnnl_scheduling_balanced;
+
+    param = "work_stealing";
+    if (!strncasecmp(param, str, strlen(param)))
+        return dnnl_scheduling_work_stealing;
+
+    assert(!"not expected");
+    return dnnl_scheduling_balanced;
+}
+
 dnnl_fpmath_mode_t str2fpmath_mode(const char *str) {
     if (std::strcmp(str, "") == 0) {
         dnnl_fpmath_mode_t ret;
@@ -1063,6 +1100,8 @@ dnnl_primitive_attr_t create_dnnl_attr(
     DNN_SAFE_V(
             dnnl_primitive_attr_set_fpmath_mode(dnnl_attr, attr.fpmath_mode));
 
+    DNN_SAFE_V(dnnl_primitive_attr_set_scheduling(dnnl_attr, attr.scheduling));
+
     return dnnl_attr;
 }
 
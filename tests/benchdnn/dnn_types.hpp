@@ -364,7 +364,8 @@ struct attr_t {
 
     attr_t()
         : scratchpad_mode(get_default_scratchpad_mode())
-        , fpmath_mode(dnnl_fpmath_mode_strict) {}
+        , fpmath_mode(dnnl_fpmath_mode_strict)
+        , scheduling(dnnl_scheduling_balanced) {}
 
     template <typename First, typename... Rest>
     void insert(const First &first, const Rest &...rest) {
@@ -377,6 +378,7 @@ struct attr_t {
     void insert(const post_ops_t &po) { this->post_ops = po; }
     void insert(dnnl_scratchpad_mode_t sm) { this->scratchpad_mode = sm; }
     void insert(dnnl_fpmath_mode_t fpm) { this->fpmath_mode = fpm; }
+    void insert(dnnl_scheduling_t sch) { this->scheduling = sch; }
 
     // When parallel creation modifier is enabled, the library scratchpad mode
     // can't be used unless "-DDNNL_ENABLE_CONCURRENT_EXEC=ON" is enabled at the
@@ -394,6 +396,7 @@ struct attr_t {
     post_ops_t post_ops;
     dnnl_scratchpad_mode_t scratchpad_mode;
     dnnl_fpmath_mode_t fpmath_mode;
+    dnnl_scheduling_t scheduling;
 
     bool is_def(bool skip_fpmath = false) const;
 };
@@ -507,6 +510,7 @@ std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t::kind_t &k);
 std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t &post_ops);
 std::ostream &operator<<(std::ostream &s, dnnl_scratchpad_mode_t sm);
 std::ostream &operator<<(std::ostream &s, dnnl_fpmath_mode_t fm);
+std::ostream &operator<<(std::ostream &s, dnnl_scheduling_t sch);
 std::ostream &operator<<(std::ostream &s, const attr_t &attr);
 
 // A container for additional data and info, not available from user's input at
@@ -581,6 +585,7 @@ dnnl_primitive_attr_t create_dnnl_attr(
 dnnl_engine_kind_t str2engine_kind(const char *str);
 dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str);
 dnnl_fpmath_mode_t str2fpmath_mode(const char *str);
+dnnl_scheduling_t str2scheduling(const char *str);
 
 void maybe_scale(const attr_t &attr, float &d, const float *scales, int64_t c,
         int arg, bool opposite_scale = false);
@@ -15,13 +15,20 @@
 *******************************************************************************/
 
 #include <algorithm> // for std::reverse and std::copy
+#include <cstring> // for std::memcpy
 #include <functional> // for std::bind and std::placeholders
 #include <list>
 #include <string> // for std::string
+#include <thread> // for std::thread
+#include <unordered_map>
+#include <unordered_set>
 #include <utility> // for std::pair
 #include <vector> // for std::vector
 
 #include <assert.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 #include "oneapi/dnnl/dnnl.hpp"
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
@@ -44,6 +51,7 @@
 
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
+#include "utils/parallel.hpp"
 
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL \
         || DNNL_GPU_RUNTIME == DNNL_RUNTIME_SYCL
@@ -256,6 +264,7 @@ size_t engine_index = 0;
 isa_hints_t hints {isa_hints_t::none};
 
 memory_kind_ext_t memory_kind {default_memory_kind};
+cold_cache_t cold_cache {default_cold_cache};
 
 void init_isa_settings() {
     if (hints.get() == isa_hints_t::no_hints)
@@ -423,10 +432,13 @@ void finalize() {
     finalize_tbb();
 }
 
+using exec_args_sets_t = std::vector<std::vector<dnnl_exec_arg_t>>;
+
 inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, exec_args_sets_t &dnnl_args_sets) {
     t.reset();
     while (true) {
+        auto &dnnl_args = dnnl_args_sets[t.times() % dnnl_args_sets.size()];
         DNN_SAFE(perf_func(stream, dnnl_args), WARN);
         t.stamp();
         if (should_stop(t)) break;
@@ -435,7 +447,7 @@ inline int measure_perf_individual(timer::timer_t &t, dnnl_stream_t stream,
 }
 
 inline int measure_perf_aggregate(timer::timer_t &t, dnnl_stream_t stream,
-        perf_function_t &perf_func, std::vector<dnnl_exec_arg_t> &dnnl_args) {
+        perf_function_t &perf_func, exec_args_sets_t &dnnl_args_sets) {
     // There seems to be some limit to how many kernels can be queued in OCL
     // builds and 4096 seems to be a nice number under that limit.
     // Otherwise, hangs in perf validation are observed due to many kernels
@@ -444,11 +456,12 @@ inline int measure_perf_aggregate(timer::timer_t &t, dnnl_stream_t stream,
 
     // Warm-up run, this is not measured due to possibility the associated
     // kernel has not been built and skews the results.
-    DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+    DNN_SAFE(perf_func(stream, dnnl_args_sets[0]), WARN);
     DNN_SAFE(dnnl_stream_wait(stream), WARN);
 
     int cur_batch_times
             = fix_times_per_prb ? fix_times_per_prb : min_times_per_prb;
+    size_t args_set_idx = 0;
 
     t.reset();
     reset_gpu_profiling();
@@ -458,7 +471,8 @@ inline int measure_perf_aggregate(timer::timer_t &t, dnnl_stream_t stream,
     bool is_first_loop = true;
     while (true) {
         for (int i = 0; i < cur_batch_times; i++) {
-            DNN_SAFE(perf_func(stream, dnnl_args), WARN);
+            DNN_SAFE(perf_func(stream, dnnl_args_sets[args_set_idx]), WARN);
+            args_set_idx = (args_set_idx + 1) % dnnl_args_sets.size();
         }
         DNN_SAFE(dnnl_stream_wait(stream), WARN);
 
@@ -497,6 +511,232 @@ inline int measure_perf_aggregate(timer::timer_t &t, dnnl_stream_t stream,
     return OK;
 }
 
+// Makes `cloned` refer to copies of the memories from `args` for which
+// `need_copy` returns true, and to the original memories otherwise. A memory
+// passed as several arguments, e.g. for in-place execution, is copied once.
+static int clone_args(const args_t &args,
+        const std::function<bool(int)> &need_copy,
+        std::list<dnn_mem_t> &mem_storage, args_t &cloned) {
+    std::unordered_map<const dnn_mem_t *, const dnn_mem_t *> copies;
+    cloned.clear();
+    for (int i = 0; i < args.size(); ++i) {
+        const int arg = args.arg(i);
+        const dnn_mem_t &mem = args.dnn_mem(i);
+        if (!need_copy(arg) || mem.size() == 0) {
+            cloned.set(arg, mem);
+            continue;
+        }
+
+        auto it = copies.find(&mem);
+        if (it == copies.end()) {
+            mem_storage.emplace_back(mem.md_, mem.engine());
+            const auto &copy = mem_storage.back();
+            if (!copy) return FAIL;
+            // Without host memory both memories are filled with the same
+            // value on creation, so there is nothing to copy.
+            if (mem.is_mapped())
+                std::memcpy(copy.get_mapped_pointer<void>(),
+                        mem.get_mapped_pointer<void>(), mem.size());
+            it = copies.emplace(&mem, &copy).first;
+        }
+        cloned.set(arg, *it->second);
+    }
+    return OK;
+}
+
+static bool is_cold_cache_arg(int arg) {
+    switch (cold_cache) {
+        case cold_cache_t::none: return false;
+        case cold_cache_t::wei:
+            return (arg >= DNNL_ARG_WEIGHTS_0 && arg <= DNNL_ARG_WEIGHTS_3)
+                    || arg == DNNL_ARG_BIAS;
+        case cold_cache_t::all: return arg != DNNL_ARG_SCRATCHPAD;
+    }
+    return false;
+}
+
+// Returns the sets of arguments for the performance loop to cycle through.
+// The first set is `args`, the others refer to copies of the arguments
+// selected by `--cold-cache`. There are enough sets for the copies to occupy
+// twice the size of the last level cache, so every run starts with the
+// replicated data evicted.
+static int init_cold_cache_args(const args_t &args,
+        std::list<dnn_mem_t> &mem_storage, std::vector<args_t> &args_sets) {
+    // Limits the memory footprint for tiny problems.
+    static constexpr size_t max_args_sets = 1024;
+
+    args_sets.assign(1, args);
+    if (cold_cache == cold_cache_t::none) return OK;
+
+    if (!is_cpu()) {
+        static bool warned = false;
+        if (!warned) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "WARNING: `--cold-cache` is supported for CPU only and "
+                    "will be ignored.");
+            warned = true;
+        }
+        return OK;
+    }
+
+    size_t cache_size = 0;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    using namespace dnnl::impl::cpu::platform;
+    cache_size = (size_t)get_per_core_cache_size(3) * get_num_cores();
+#endif
+
+    std::unordered_set<const dnn_mem_t *> replicated;
+    size_t replicated_size = 0;
+    for (int i = 0; i < args.size(); ++i) {
+        const dnn_mem_t &mem = args.dnn_mem(i);
+        if (!is_cold_cache_arg(args.arg(i))) continue;
+        if (replicated.insert(&mem).second) replicated_size += mem.size();
+    }
+    if (replicated_size == 0) return OK;
+
+    const size_t n_sets = MIN2(max_args_sets,
+            MAX2((size_t)1,
+                    (size_t)div_up(2 * cache_size, replicated_size)));
+    args_sets.resize(n_sets);
+    for (size_t i = 1; i < n_sets; i++)
+        SAFE(clone_args(args, is_cold_cache_arg, mem_storage, args_sets[i]),
+                WARN);
+    return OK;
+}
+
+// Returns the CPUs the process is allowed to run on, or an empty list if
+// the affinity can't be queried.
+static std::vector<int> get_process_cpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &mask)) cpus.push_back(cpu);
+    }
+#endif
+    return cpus;
+}
+
+int get_n_process_cpus() {
+    const auto cpus = get_process_cpus();
+    return cpus.empty() ? benchdnn_get_max_threads() : (int)cpus.size();
+}
+
+// Binds the calling thread, and thus the threads it spawns, to `cpus`.
+static void bind_thread_to_cpus(const std::vector<int> &cpus) {
+#ifdef __linux__
+    if (cpus.empty()) return;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (int cpu : cpus)
+        CPU_SET(cpu, &mask);
+    if (sched_setaffinity(0, sizeof(mask), &mask) != 0)
+        BENCHDNN_PRINT(2, "%s\n", "WARNING: failed to bind an instance.");
+#else
+    (void)cpus;
+#endif
+}
+
+// Runs `perf_instances` instances concurrently. Every instance has a private
+// copy of all arguments and runs on its own subset of the process CPUs.
+// The measurements are merged into `t`, so its throughput is the aggregate
+// one.
+static int measure_perf_instances(const thr_ctx_t &ctx, timer::timer_t &t,
+        perf_function_t &perf_func, const args_t &args,
+        std::list<dnn_mem_t> &mem_storage,
+        std::vector<args_t> &all_args_sets) {
+    const int n_instances = perf_instances;
+    const auto cpus = get_process_cpus();
+    // The parser guarantees at least one CPU per instance, so the CPU sets
+    // of the instances don't overlap.
+    const int n_cpus_per_instance = get_n_process_cpus() / n_instances;
+    assert(n_cpus_per_instance > 0);
+
+    std::vector<exec_args_sets_t> dnnl_args_sets(n_instances);
+    for (int i = 0; i < n_instances; i++) {
+        args_t instance_args;
+        if (i == 0)
+            instance_args = args;
+        else
+            SAFE(clone_args(
+                         args, [](int) { return true; }, mem_storage,
+                         instance_args),
+                    WARN);
+
+        std::vector<args_t> args_sets;
+        SAFE(init_cold_cache_args(instance_args, mem_storage, args_sets), WARN);
+        for (const auto &args_set : args_sets) {
+            dnnl_args_sets[i].emplace_back();
+            execute_unmap_args(args_set, dnnl_args_sets[i].back());
+            all_args_sets.push_back(args_set);
+        }
+    }
+
+    std::vector<timer::timer_t> timers(n_instances);
+    std::vector<int> statuses(n_instances, OK);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n_instances; i++) {
+        threads.emplace_back([&, i]() {
+            std::vector<int> instance_cpus;
+            for (int j = 0; j < n_cpus_per_instance && !cpus.empty(); j++)
+                instance_cpus.push_back(cpus[i * n_cpus_per_instance + j]);
+            bind_thread_to_cpus(instance_cpus);
+
+            thr_ctx_t instance_ctx = ctx;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_TBB_THREADING_WITH_CONSTRAINTS
+            instance_ctx.max_concurrency = n_cpus_per_instance;
+#endif
+            stream_t stream(get_test_engine(), instance_ctx.get_interop_obj());
+            statuses[i] = execute_in_thr_ctx(instance_ctx,
+                    measure_perf_individual, timers[i], stream, perf_func,
+                    dnnl_args_sets[i]);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    t.reset();
+    for (int i = 0; i < n_instances; i++) {
+        SAFE(statuses[i], WARN);
+        t.merge(timers[i]);
+    }
+    return OK;
+}
+
+// Runs a single instance in the thread context `ctx`.
+static int measure_perf_single(const thr_ctx_t &ctx, timer::timer_t &t,
+        perf_function_t &perf_func, const args_t &args,
+        std::list<dnn_mem_t> &mem_storage,
+        std::vector<args_t> &all_args_sets) {
+    SAFE(init_cold_cache_args(args, mem_storage, all_args_sets), WARN);
+    exec_args_sets_t dnnl_args_sets(all_args_sets.size());
+    for (size_t i = 0; i < all_args_sets.size(); i++)
+        execute_unmap_args(all_args_sets[i], dnnl_args_sets[i]);
+
+    const auto &engine = get_test_engine();
+    stream_t stream(engine, ctx.get_interop_obj());
+    // For non-DPCPP CPU: measure individual iterations.
+    // For DPCPP CPU and GPU: measure iterations in batches to hide driver
+    // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
+    if (is_cpu() && !is_sycl_engine(engine))
+        return execute_in_thr_ctx(ctx, measure_perf_individual, t, stream,
+                perf_func, dnnl_args_sets);
+    return execute_in_thr_ctx(ctx, measure_perf_aggregate, t, stream,
+            perf_func, dnnl_args_sets);
+}
+
+static bool is_perf_instances_supported() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // The testing threadpool can't be shared by concurrent instances.
+    return false;
+#else
+    return is_cpu() && !is_sycl_engine();
+#endif
+}
+
 int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
         args_t &args) {
     if (!has_bench_mode_bit(mode_bit_t::perf)) return OK;
@@ -504,27 +744,38 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
     // GPU profiling need enabled before stream constructions, as the command
     // queue needs profiling enabled.
     if (is_gpu()) enable_gpu_profiling();
-    const auto &engine = get_test_engine();
-    stream_t stream(engine, ctx.get_interop_obj());
-    std::vector<dnnl_exec_arg_t> dnnl_args;
-    execute_unmap_args(args, dnnl_args);
+
+    // Copies of the arguments for `--cold-cache` and `--perf-instances`.
+    // Every args set is mapped back after the measurement since memories
+    // expect to be mapped on destruction.
+    std::list<dnn_mem_t> mem_storage;
+    std::vector<args_t> all_args_sets;
 
     auto &t = res->timer_map.perf_timer();
-    // For non-DPCPP CPU: measure individual iterations.
-    // For DPCPP CPU and GPU: measure iterations in batches to hide driver
-    // overhead. DPCPP CPU follows the model of GPU, thus, handled similar.
     int ret = OK;
-    if (is_cpu() && !is_sycl_engine(engine)) {
-        ret = execute_in_thr_ctx(
-                ctx, measure_perf_individual, t, stream, perf_func, dnnl_args);
+    if (perf_instances > 1 && !is_perf_instances_supported()) {
+        static bool warned = false;
+        if (!warned) {
+            BENCHDNN_PRINT(0, "%s\n",
+                    "WARNING: `--perf-instances` is supported for CPU only "
+                    "with non-threadpool runtimes and will be ignored.");
+            warned = true;
+        }
+    }
+
+    if (perf_instances > 1 && is_perf_instances_supported()) {
+        ret = measure_perf_instances(
+                ctx, t, perf_func, args, mem_storage, all_args_sets);
     } else {
-        ret = execute_in_thr_ctx(
-                ctx, measure_perf_aggregate, t, stream, perf_func, dnnl_args);
+        ret = measure_perf_single(
+                ctx, t, perf_func, args, mem_storage, all_args_sets);
     }
 
     if (is_gpu()) disable_gpu_profiling();
     if (ret != OK) res->state = FAILED;
     execute_map_args(args);
+    for (const auto &args_set : all_args_sets)
+        execute_map_args(args_set);
 
     return ret;
 }
@@ -1160,6 +1411,20 @@ memory_kind_ext_t str2memory_kind(const char *str) {
     return memory_kind_ext_t::usm;
 }
 
+cold_cache_t str2cold_cache(const char *str) {
+#define CASE(param) \
+    if (!strcasecmp(#param, str)) return cold_cache_t::param
+
+    CASE(none);
+    CASE(wei);
+    CASE(all);
+
+#undef CASE
+
+    assert(!"not expected");
+    return cold_cache_t::none;
+}
+
 static void maybe_print_cpu_engine_error_message() {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
     fprintf(stderr,
@@ -279,6 +279,18 @@ const memory_kind_ext_t default_memory_kind = memory_kind_ext_t::usm;
 
 extern memory_kind_ext_t memory_kind;
 
+// Specifies which execution arguments are replicated in performance mode to
+// measure the execution with the data evicted from the last level cache.
+enum class cold_cache_t {
+    none, // All runs use the same memories.
+    wei, // Weights and bias are replicated.
+    all, // All arguments but scratchpad are replicated.
+};
+
+const cold_cache_t default_cold_cache = cold_cache_t::none;
+
+extern cold_cache_t cold_cache;
+
 void init_isa_settings();
 
 struct args_t {
@@ -685,6 +697,9 @@ int measure_perf(const thr_ctx_t &ctx, res_t *res, perf_function_t &perf_func,
 int measure_perf(
         const thr_ctx_t &ctx, res_t *res, dnnl_primitive_t prim, args_t &args);
 
+// Returns the number of CPUs the process is allowed to run on.
+int get_n_process_cpus();
+
 std::vector<float> prepare_po_vals(const dnn_mem_t &dst_m, const args_t &args,
         const std::vector<std::pair<int, int>> &v_po_masks,
         const size_t dst_off);
@@ -693,6 +708,7 @@ bool check_md_consistency_with_tag(
         const_dnnl_memory_desc_t md, const std::string &tag);
 
 memory_kind_ext_t str2memory_kind(const char *str);
+cold_cache_t str2cold_cache(const char *str);
 
 float reorder_rescale_factor();
 dims_t md2dims(const_dnnl_memory_desc_t md);
@@ -43,6 +43,11 @@ dnnl_data_type_t str2dt(const char *str) {
     CASE(u8);
     CASE(f64);
     CASE(boolean);
+    CASE(f8_e5m2);
+    CASE(f8_e4m3);
+    CASE(s4);
+    CASE(u4);
+    CASE(nf4);
     CASE(data_type_max);
 #undef CASE
     if (!strcmp("undef", str) || !strcmp("dnnl_data_type_undef", str))
@@ -60,6 +65,8 @@ dnnl_sparse_encoding_t str2sparse_encoding(const char *str) {
         return CONCAT2(dnnl_, _case); \
 } while (0)
     CASE(csr);
+    CASE(bsr);
+    CASE(grouped);
 #undef CASE
     if (!strcmp("undef", str) || !strcmp("dnnl_sparse_encoding_undef", str))
         return dnnl_sparse_encoding_undef;
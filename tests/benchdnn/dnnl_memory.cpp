@@ -437,6 +437,15 @@ benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> dnn_mem_t::init_csr_md(int ndims,
             &md, ndims, dims, data_type, nnz, indices_dt, pointers_dt));
     return md;
 }
+
+benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> dnn_mem_t::init_grouped_md(
+        int ndims, const dnnl_dims_t dims, dnnl_data_type_t data_type,
+        dnnl_dim_t ngroups, dnnl_data_type_t offsets_dt) {
+    dnnl_memory_desc_t md {};
+    DNN_SAFE_V(dnnl_memory_desc_create_with_grouped_encoding(
+            &md, ndims, dims, data_type, ngroups, offsets_dt));
+    return md;
+}
 #endif
 
 int dnn_mem_t::initialize_memory_create_sycl(const handle_info_t &handle_info) {
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <float.h>
 #include <math.h>
 #include <random>
@@ -64,6 +65,10 @@ benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> create_md(const prb_t *prb,
                     return dnn_mem_t::init_csr_md(prb->ndims,
                             src_rt_dims.data(), dt, nnz, dnnl_s32, dnnl_s32);
                     break;
+                case dnnl_grouped:
+                    return dnn_mem_t::init_grouped_md(prb->ndims,
+                            src_rt_dims.data(), dt, prb->ngroups(), dnnl_s32);
+                    break;
                 default: assert(!"unsupported encoding"); return nullptr;
             }
         } else
@@ -80,6 +85,12 @@ benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> create_md(const prb_t *prb,
         auto wei_encoding = prb->sparse_options.get_encoding(DNNL_ARG_WEIGHTS);
         auto wei_sparsity = prb->sparse_options.get_sparsity(DNNL_ARG_WEIGHTS);
 
+        // A grouped source takes a weights matrix per group.
+        if (prb->ngroups() > 0) {
+            const dims_t wei_dims = {prb->ngroups(), prb->k, prb->n};
+            return dnn_mem_t::init_md(3, wei_dims.data(), dt, prb->wtag);
+        }
+
         if (wei_encoding != dnnl_sparse_encoding_undef) {
             const dnnl_dim_t nnz
                     = std::max(prb->k * prb->n * (1.0f - wei_sparsity), 1.0f);
@@ -305,6 +316,54 @@ int fill_csr_data(data_kind_t kind, const prb_t *prb, dnn_mem_t &mem_dt,
 
     return OK;
 }
+
+// The rows are split into groups at random points, so some groups are empty.
+// All the rows belong to a group.
+int fill_grouped_data(const prb_t *prb, const cfg_t &cfg, dnn_mem_t &mem_dt,
+        dnn_mem_t &mem_fp, res_t *res) {
+    if (query_md_num_handles(mem_dt.md_) != 2) return FAIL;
+
+    const int64_t G = prb->ngroups();
+    const int64_t M = prb->m;
+    const int values_idx = 0;
+    const int offsets_idx = 1;
+
+    std::vector<int64_t> offsets(G + 1, M);
+    offsets[0] = 0;
+    std::uniform_int_distribution<int64_t> offsets_gen(0, M);
+    std::minstd_rand offsets_seed(G);
+    for (int64_t g = 1; g < G; g++)
+        offsets[g] = offsets_gen(offsets_seed);
+    std::sort(offsets.begin() + 1, offsets.end() - 1);
+    for (int64_t g = 0; g <= G; g++) {
+        mem_fp.set_elem(g, offsets[g], offsets_idx);
+        mem_dt.set_elem(g, offsets[g], offsets_idx);
+    }
+
+    /* Do fixed partitioning to have same filling for any number of threads */
+    const int64_t nelems = M * prb->k;
+    const int64_t n_chunks = 16;
+    const int64_t chunk_size = div_up(nelems, n_chunks);
+
+    benchdnn_parallel_nd(n_chunks, [&](int64_t idx_chunk) {
+        int64_t idx_start = idx_chunk * chunk_size;
+        int64_t idx_end = MIN2(idx_start + chunk_size, nelems);
+
+        std::uniform_int_distribution<> values_gen(
+                cfg.get_range_min(SRC), cfg.get_range_max(SRC));
+        std::minstd_rand values_seed(nelems + idx_start + 1);
+        values_seed.discard(1);
+
+        for (int64_t i = idx_start; i < idx_end; i++) {
+            const float val = round_to_nearest_representable(
+                    cfg.get_dt(SRC), values_gen(values_seed));
+            mem_fp.set_elem(i, val, values_idx);
+            mem_dt.set_elem(i, val, values_idx);
+        }
+    });
+
+    return OK;
+}
 #endif
 
 int fill_data(data_kind_t kind, const prb_t *prb, const cfg_t &cfg,
@@ -320,6 +379,8 @@ int fill_data(data_kind_t kind, const prb_t *prb, const cfg_t &cfg,
     if ((kind == SRC && src_encoding == dnnl_csr)
             || (kind == WEI && wei_encoding == dnnl_csr))
         return fill_csr_data(kind, prb, mem_dt, mem_fp, res);
+    if (kind == SRC && src_encoding == dnnl_grouped)
+        return fill_grouped_data(prb, cfg, mem_dt, mem_fp, res);
 #endif
 
     cfg_t::density_args_t density_args;
@@ -381,6 +442,22 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_sum_po(
             prb->attr, res, dnnl_matmul, prb->src_dt(), prb->dst_dt());
 
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    // A grouped source supports neither batch dimensions, nor runtime
+    // dimensions, nor bias, nor attributes. The weights tensor is 3D, so only
+    // the generic tags apply to it.
+    if (prb->ngroups() > 0) {
+        const bool ok = prb->ndims == 2 && prb->src_runtime_dim_mask().none()
+                && prb->weights_runtime_dim_mask().none()
+                && prb->bia_dt == dnnl_data_type_undef && prb->attr.is_def()
+                && (prb->wtag == tag::any || prb->wtag == tag::abx);
+        if (!ok) {
+            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+            return;
+        }
+    }
+#endif
+
     if (is_gpu()) {
 #ifdef DNNL_EXPERIMENTAL_SPARSE
         if (!prb->sparse_options.is_def()) {
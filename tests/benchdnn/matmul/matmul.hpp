@@ -80,7 +80,8 @@ struct prb_t : public prb_vdims_t {
                 s.sparse_options[0],
 #endif
                 settings_t::get_attr(s.scales[0], s.zero_points[0],
-                        s.post_ops[0], s.scratchpad_mode[0], s.fpmath_mode[0]),
+                        s.post_ops[0], s.scratchpad_mode[0], s.fpmath_mode[0],
+                        s.scheduling[0]),
                 s.ctx_init[0], s.ctx_exe[0]) {
         SAFE_V(s.has_single_setup() ? OK : FAIL);
     }
@@ -155,6 +156,15 @@ struct prb_t : public prb_vdims_t {
 
     const dims_t &src_dims() const { return vdims[0]; }
     const dims_t &weights_dims() const { return vdims[1]; }
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    // Returns the number of groups of a source in grouped encoding, or 0. The
+    // number of groups takes the place of the sparsity in the encoding option.
+    int64_t ngroups() const {
+        if (sparse_options.get_encoding(DNNL_ARG_SRC) != dnnl_grouped) return 0;
+        if (sparse_options.is_sparsity_def(DNNL_ARG_SRC)) return 4;
+        return (int64_t)sparse_options.get_sparsity(DNNL_ARG_SRC);
+    }
+#endif
     dims_t bia_dims() const {
         dims_t dims(ndims, 1);
         for (int d = 0; d < ndims; ++d)
@@ -179,6 +179,30 @@ void compute_ref_matmul_csr(const prb_t *prb, const args_t &args) {
         });
     }
 }
+
+void compute_ref_matmul_grouped(const prb_t *prb, const args_t &args) {
+    const dnn_mem_t &src_m = args.find(DNNL_ARG_SRC);
+    const dnn_mem_t &wei_m = args.find(DNNL_ARG_WEIGHTS);
+    const dnn_mem_t &dst_m = args.find(DNNL_ARG_DST);
+    const int64_t G = prb->ngroups();
+    const int64_t N = prb->n;
+    const int64_t K = prb->k;
+
+    const float *src_values = src_m.get_mapped_pointer<float>(0);
+    const int32_t *src_offsets = src_m.get_mapped_pointer<int32_t>(1);
+    const float *weights = wei_m.get_mapped_pointer<float>();
+    float *dst = dst_m.get_mapped_pointer<float>();
+
+    // Rows of the destination that belong to no group are not written.
+    benchdnn_parallel_nd(G, N, [&](int64_t g, int64_t n) {
+        for (int64_t m = src_offsets[g]; m < src_offsets[g + 1]; m++) {
+            float acc = 0.0f;
+            for (int64_t k = 0; k < K; k++)
+                acc += src_values[m * K + k] * weights[(g * K + k) * N + n];
+            dst[dst_off_f(prb, 0, m, n)] = acc;
+        }
+    });
+}
 #endif
 
 void compute_ref(
@@ -195,6 +219,8 @@ void compute_ref(
 
     if (src_encoding == dnnl_csr || wei_encoding == dnnl_csr) {
         compute_ref_matmul_csr(prb, args);
+    } else if (src_encoding == dnnl_grouped) {
+        compute_ref_matmul_grouped(prb, args);
     } else {
         compute_ref_matmul(prb, args);
     }
@@ -185,6 +185,13 @@ void copy_res_fwd(const prb_t &prb, const args_t &args,
             auto from = &ws_src_layer(prb.n_layer, dir_val, it + 1, nb, 0);
             auto to = &dst_layer(
                     it, nb, action == action_concat ? prb.dlc(CELL) : 0);
+            // dst_layer is zero past the sequence length.
+            if (it >= prb.seq_len(nb)) {
+                if (action != action_sum)
+                    for (int64_t c = 0; c < prb.dlc(CELL); c++)
+                        to[c] = 0;
+                continue;
+            }
             copy(1, prb.dlc(CELL), prb.wc, prb.dlc(PRIMITIVE), from, to, action,
                     prb.is_int8());
 
@@ -361,6 +368,19 @@ void rnn_linear_fwd(const prb_t &prb, const args_t &args,
                         &ws_src_iter_c(lay, dir_val, prev_iter, 0, 0),
                         cell_scratchpad_);
 #undef SAFE_PTR
+                // The sequences that have finished keep their states, so
+                // right-to-left starts from the last valid time step.
+                for (int64_t b = 0; b < prb.mb; b++) {
+                    if (iter - 1 < prb.seq_len(b)) continue;
+                    for (int64_t c = 0; c < prb.wc; c++) {
+                        ws_src_iter(lay, dir_val, iter, b, c)
+                                = ws_src_iter(lay, dir_val, prev_iter, b, c);
+                        if (prb.alg == VANILLA_LSTM)
+                            ws_src_iter_c(lay, dir_val, iter, b, c)
+                                    = ws_src_iter_c(
+                                            lay, dir_val, prev_iter, b, c);
+                    }
+                }
             }
         }
 
@@ -513,6 +513,13 @@ int fill_bias(const prb_t &prb, rnn_data_kind_t kind, dnn_mem_t &mem_dt,
     return OK;
 }
 
+int fill_seq_lengths(const prb_t &prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    for (int64_t b = 0; b < mem_fp.nelems(); b++)
+        mem_fp.set_elem(b, prb.seq_len(b));
+    mem_dt.reorder(mem_fp);
+    return OK;
+}
+
 void compute_ref(
         const prb_t *prb, const args_t &args, dnnl_primitive_t prim_ref) {
     const prb_t &prb_ = *prb;
@@ -781,6 +788,14 @@ void skip_unimplemented_prb(const prb_t *prb_, res_t *res) {
         return;
     }
 
+    // Variable sequence lengths are supported for the forward floating-point
+    // configurations only.
+    if (prb.with_seq_lengths()
+            && (prb.prop == dnnl_backward || prb.is_int8() || prb.is_augru())) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     // GPU limitations for RNN
     if (is_gpu()) {
         bool is_AUGRU = prb.alg == VANILLA_AUGRU || prb.alg == LBR_AUGRU;
@@ -928,6 +943,7 @@ std::vector<int> supported_exec_args(dir_t dir) {
             DNNL_ARG_DST_ITER,
             DNNL_ARG_DST_ITER_C,
             DNNL_ARG_WORKSPACE,
+            DNNL_ARG_SEQ_LENGTHS,
     };
     static const std::vector<int> exec_bwd_args = {
             DNNL_ARG_SRC_LAYER,
@@ -1063,6 +1079,9 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
                 if (dir & FLAG_FWD)
                     SAFE(fill_memory(prb, DST_ITER_C, mem, ref_mem), WARN);
                 break;
+            case DNNL_ARG_SEQ_LENGTHS:
+                SAFE(fill_seq_lengths(prb, mem, ref_mem), WARN);
+                break;
             case DNNL_ARG_SCRATCHPAD: break;
             case DNNL_ARG_WORKSPACE: break;
             case DNNL_ARG_DIFF_SRC_LAYER:
@@ -98,6 +98,8 @@ using flags_t = unsigned;
 // XXX: UNDEF is used in activation_t
 const flags_t NONE = dnnl_rnn_flags_undef;
 const flags_t DIFF_WEIGHTS_OVERWRITE = dnnl_rnn_flags_diff_weights_overwrite;
+const flags_t VARIABLE_SEQUENCE_LENGTH
+        = dnnl_rnn_flags_variable_sequence_length;
 flags_t str2flags(const char *str);
 std::string flags2str(flags_t flags);
 
@@ -429,6 +431,13 @@ struct prb_t : public desc_t {
     bool is_lstm_peephole() const { return with_peephole; }
     bool is_lstm_projection() const { return with_projection; }
     bool is_augru() const { return alg == VANILLA_AUGRU || alg == LBR_AUGRU; }
+    bool with_seq_lengths() const {
+        return flags & VARIABLE_SEQUENCE_LENGTH;
+    }
+    // The first sequence takes all the time steps, the rest are shorter.
+    int64_t seq_len(int64_t b) const {
+        return with_seq_lengths() ? n_iter - (b * 3) % n_iter : n_iter;
+    }
 
     // Used to construct memory desc when dimensions are runtime since such mds
     // can't be used directly from query and memory objects can't be constructed.
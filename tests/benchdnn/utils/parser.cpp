@@ -223,6 +223,18 @@ bool parse_attr_fpmath_mode(std::vector<dnnl_fpmath_mode_t> &fpmath_mode,
             str, option_name, help);
 }
 
+bool parse_attr_scheduling(std::vector<dnnl_scheduling_t> &scheduling,
+        const std::vector<dnnl_scheduling_t> &def_scheduling, const char *str,
+        const std::string &option_name /* = "attr-scheduling"*/) {
+    static const std::string help
+            = "MODE    (Default: `balanced`)\n    Specifies scheduling "
+              "attribute. `MODE` values can be `balanced` or "
+              "`work_stealing`.\n    More details at "
+            + doc_url + "knobs_attr.md\n";
+    return parse_vector_option(scheduling, def_scheduling, str2scheduling, str,
+            option_name, help);
+}
+
 bool parse_axis(std::vector<int> &axis, const std::vector<int> &def_axis,
         const char *str, const std::string &option_name /* = "axis"*/) {
     static const std::string help
@@ -604,6 +616,62 @@ static bool parse_max_ms_per_prb(
     return parsed;
 }
 
+static bool parse_cold_cache(
+        const char *str, const std::string &option_name = "cold-cache") {
+    static const std::string help
+            = "MODE    (Default: `none`)\n    Specifies which arguments are "
+              "replicated in performance mode to measure the execution with "
+              "the data evicted from the last level cache.\n    `MODE` "
+              "values are `none`, `wei` (weights and bias) or `all` (all "
+              "arguments but scratchpad).\n";
+    return parse_single_value_option(cold_cache, default_cold_cache,
+            str2cold_cache, str, option_name, help);
+}
+
+static bool parse_perf_counters(
+        const char *str, const std::string &option_name = "perf-counters") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to collect "
+              "hardware counters in performance mode, when set to `true`.\n"
+              "    Should be specified before the driver name to count all "
+              "threads.\n";
+    bool parsed = parse_single_value_option(
+            perf_counters, false, str2bool, str, option_name, help);
+    // Counters must be opened before any thread is spawned to count it.
+    if (parsed && perf_counters
+            && !dnnl::impl::perf_counters_t::get().is_open()) {
+        BENCHDNN_PRINT(0, "%s\n",
+                "WARNING: hardware counters are unavailable, "
+                "`--perf-counters` will be ignored.");
+        perf_counters = false;
+    }
+    return parsed;
+}
+
+static bool parse_perf_instances(
+        const char *str, const std::string &option_name = "perf-instances") {
+    static const std::string help
+            = "N    (Default: `1`)\n    Specifies the number of independent "
+              "instances executed concurrently in performance mode.\n    Each "
+              "instance is bound to its own subset of cores.\n    `N` "
+              "can't exceed the number of CPUs available to the process.\n";
+    bool parsed = parse_single_value_option(perf_instances,
+            default_perf_instances, atoi, str, option_name, help);
+    if (parsed) {
+        perf_instances = MAX2(1, perf_instances);
+        const int n_cpus = get_n_process_cpus();
+        if (perf_instances > n_cpus) {
+            BENCHDNN_PRINT(0,
+                    "Error: `--perf-instances=%d` exceeds the number of CPUs "
+                    "available to the process (%d), the instances would share "
+                    "CPUs.\n",
+                    perf_instances, n_cpus);
+            exit(2);
+        }
+    }
+    return parsed;
+}
+
 static bool parse_repeats_per_prb(
         const char *str, const std::string &option_name = "repeats-per-prb") {
     static const std::string help
@@ -825,12 +893,14 @@ bool parse_bench_settings(const char *str) {
 
     bool parsed = parse_allow_enum_tags_only(str)
             || parse_attr_same_pd_check(str) || parse_canonical(str)
-            || parse_cpu_isa_hints(str) || parse_engine(str)
-            || parse_fast_ref_gpu(str) || parse_fix_times_per_prb(str)
-            || parse_max_ms_per_prb(str) || parse_repeats_per_prb(str)
-            || parse_mem_check(str) || parse_memory_kind(str) || parse_mode(str)
-            || parse_mode_modifier(str) || parse_skip_impl(str)
-            || parse_start(str) || parse_verbose(str);
+            || parse_cold_cache(str) || parse_cpu_isa_hints(str)
+            || parse_engine(str) || parse_fast_ref_gpu(str)
+            || parse_fix_times_per_prb(str) || parse_max_ms_per_prb(str)
+            || parse_repeats_per_prb(str) || parse_mem_check(str)
+            || parse_memory_kind(str) || parse_mode(str)
+            || parse_mode_modifier(str) || parse_perf_counters(str)
+            || parse_perf_instances(str)
+            || parse_skip_impl(str) || parse_start(str) || parse_verbose(str);
 
     // Last condition makes this help message to be triggered once driver_name
     // is already known.
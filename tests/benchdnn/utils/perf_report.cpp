@@ -74,6 +74,20 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return t.ticks(mode) / t.sec(mode) / unit;
     };
 
+    // Every last level cache miss is assumed to transfer a cache line from
+    // memory.
+    static constexpr double cache_line_size = 64;
+    using pc_t = dnnl::impl::perf_counters_t;
+    const auto &perf_timer = res->timer_map.perf_timer();
+    auto get_ratio = [&](double num, double den) -> double {
+        if (!den) return 0;
+        return num / den / unit;
+    };
+    const double cycles = perf_timer.counter(pc_t::cycles);
+    const double insts = perf_timer.counter(pc_t::instructions);
+    const double llc_misses = perf_timer.counter(pc_t::llc_misses);
+    const double mem_bytes = cache_line_size * llc_misses;
+
     // Please update doc/knobs_perf_report.md in case of any new options!
 
 #define HANDLE(opt, ...) \
@@ -119,6 +133,17 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("freq", s << get_freq(res->timer_map.perf_timer()));
     HANDLE("ops", s << ops() / unit);
     HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
+    HANDLE("p50", s << res->timer_map.perf_timer().ms_percentile(50) / unit);
+    HANDLE("p99", s << res->timer_map.perf_timer().ms_percentile(99) / unit);
+    HANDLE("thr", s << res->timer_map.perf_timer().throughput() / unit);
+    HANDLE("cycles", s << cycles / unit);
+    HANDLE("insts", s << insts / unit);
+    HANDLE("llcmiss", s << llc_misses / unit);
+    HANDLE("ipc", s << get_ratio(insts, cycles));
+    HANDLE("fpc", s << get_ratio(ops(), cycles));
+    HANDLE("bpf", s << get_ratio(mem_bytes, ops()));
+    HANDLE("mbw",
+            s << get_ratio(mem_bytes, perf_timer.sec(timer::timer_t::avg)));
     HANDLE("impl", s << res->impl_name);
     HANDLE("ibytes", s << res->ibytes / unit);
     HANDLE("obytes", s << res->obytes / unit);
@@ -51,11 +51,24 @@ void timer_t::reset() {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = 0;
     ms_start_ = 0;
+    samples_.clear();
+    wall_ms_ = 0;
+    for (int i = 0; i < n_counters; ++i)
+        counters_[i] = 0;
 
     start();
 }
 
+static void counters_now(uint64_t *values) {
+    // The counters are not touched unless requested with `--perf-counters`.
+    if (!perf_counters || !dnnl::impl::perf_counters_t::get().read(values)) {
+        for (int i = 0; i < timer_t::n_counters; ++i)
+            values[i] = 0;
+    }
+}
+
 void timer_t::start() {
+    counters_now(counters_start_);
     ticks_start_ = ticks_now();
     ms_start_ = ms_now();
 }
@@ -73,9 +86,11 @@ void timer_t::stop(int add_times, int64_t add_ticks, double add_ms) {
     ms_[mode_t::sum] += d_ms;
     ticks_[mode_t::avg] += d_ticks;
     ticks_[mode_t::sum] += d_ticks;
+    wall_ms_ += d_ms;
 
     d_ticks /= add_times;
     d_ms /= add_times;
+    samples_.push_back(d_ms);
 
     ms_[mode_t::min] = times_ ? std::min(ms_[mode_t::min], d_ms) : d_ms;
     ms_[mode_t::max] = times_ ? std::max(ms_[mode_t::max], d_ms) : d_ms;
@@ -89,7 +104,58 @@ void timer_t::stop(int add_times, int64_t add_ticks, double add_ms) {
 }
 
 void timer_t::stamp(int add_times) {
-    stop(add_times, ticks_now() - ticks_start_, ms_now() - ms_start_);
+    const double d_ms = ms_now() - ms_start_;
+    const uint64_t d_ticks = ticks_now() - ticks_start_;
+    if (perf_counters && add_times != 0) {
+        uint64_t counters_end[n_counters];
+        counters_now(counters_end);
+        for (int i = 0; i < n_counters; ++i) {
+            counters_[i] += counters_end[i] - counters_start_[i];
+            counters_start_[i] = counters_end[i];
+        }
+    }
+    stop(add_times, d_ticks, d_ms);
+}
+
+double timer_t::ms_percentile(double percent) const {
+    if (samples_.empty()) return 0; // nothing to report
+    std::vector<double> sorted(samples_);
+    const size_t idx = std::min(sorted.size() - 1,
+            (size_t)(percent / 100. * (sorted.size() - 1) + 0.5));
+    std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
+    return sorted[idx];
+}
+
+double timer_t::throughput() const {
+    if (wall_ms_ == 0) return 0; // nothing to report
+    return times() / (wall_ms_ / 1e3);
+}
+
+void timer_t::merge(const timer_t &rhs) {
+    if (rhs.times_ == 0) return;
+
+    ms_[mode_t::avg] += rhs.ms_[mode_t::avg];
+    ms_[mode_t::sum] += rhs.ms_[mode_t::sum];
+    ticks_[mode_t::avg] += rhs.ticks_[mode_t::avg];
+    ticks_[mode_t::sum] += rhs.ticks_[mode_t::sum];
+
+    ms_[mode_t::min] = times_ ? std::min(ms_[mode_t::min], rhs.ms_[mode_t::min])
+                              : rhs.ms_[mode_t::min];
+    ms_[mode_t::max] = times_ ? std::max(ms_[mode_t::max], rhs.ms_[mode_t::max])
+                              : rhs.ms_[mode_t::max];
+    ticks_[mode_t::min] = times_
+            ? std::min(ticks_[mode_t::min], rhs.ticks_[mode_t::min])
+            : rhs.ticks_[mode_t::min];
+    ticks_[mode_t::max] = times_
+            ? std::max(ticks_[mode_t::max], rhs.ticks_[mode_t::max])
+            : rhs.ticks_[mode_t::max];
+
+    samples_.insert(samples_.end(), rhs.samples_.begin(), rhs.samples_.end());
+    // Timers ran concurrently, so the wall time is the longest of them.
+    wall_ms_ = std::max(wall_ms_, rhs.wall_ms_);
+    for (int i = 0; i < n_counters; ++i)
+        counters_[i] = std::max(counters_[i], rhs.counters_[i]);
+    times_ += rhs.times_;
 }
 
 timer_t &timer_t::operator=(const timer_t &rhs) {
@@ -101,6 +167,12 @@ timer_t &timer_t::operator=(const timer_t &rhs) {
     for (int i = 0; i < n_modes; ++i)
         ms_[i] = rhs.ms_[i];
     ms_start_ = rhs.ms_start_;
+    samples_ = rhs.samples_;
+    wall_ms_ = rhs.wall_ms_;
+    for (int i = 0; i < n_counters; ++i) {
+        counters_[i] = rhs.counters_[i];
+        counters_start_[i] = rhs.counters_start_[i];
+    }
     return *this;
 }
 
@@ -19,6 +19,9 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+#include "src/common/perf_counters.hpp"
 
 #define TIME_FUNC(func, res, name) \
     do { \
@@ -33,8 +36,11 @@
 
 namespace timer {
 
+using counter_t = dnnl::impl::perf_counters_t::counter_t;
+
 struct timer_t {
     enum mode_t { min = 0, avg = 1, max = 2, sum = 3, n_modes };
+    static constexpr int n_counters = dnnl::impl::perf_counters_t::n_counters;
 
     timer_t() { reset(); }
 
@@ -68,11 +74,36 @@ struct timer_t {
         return ticks_[mode] / (mode == avg ? times() : 1);
     }
 
+    // Returns the time of a single run in ms which is not exceeded by
+    // `percent` percent of the measurements.
+    double ms_percentile(double percent) const;
+
+    // Returns the number of runs per second of wall time.
+    double throughput() const;
+
+    // Returns the average value of a hardware counter per run. Counters are
+    // collected by `stamp` when `--perf-counters` is enabled.
+    double counter(counter_t counter) const {
+        if (!times()) return 0; // nothing to report
+        return (double)counters_[counter] / times();
+    }
+
+    // Adds the measurements of a timer that was running concurrently.
+    void merge(const timer_t &rhs);
+
     timer_t &operator=(const timer_t &rhs);
 
     int times_;
     uint64_t ticks_[n_modes], ticks_start_;
     double ms_[n_modes], ms_start_;
+    // Time of a single run for every `stop` call.
+    std::vector<double> samples_;
+    // Time elapsed while measuring. Unlike `ms_[sum]`, it is not accumulated
+    // over concurrent timers.
+    double wall_ms_;
+    // Hardware counters are process-wide, so like `wall_ms_` they are not
+    // accumulated over concurrent timers.
+    uint64_t counters_[n_counters], counters_start_[n_counters];
 };
 
 namespace names {
@@ -14,8 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string>
 #include <thread>
 
+#if defined(__linux__) && defined(__GLIBC__)
+#include <sched.h>
+#endif
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -73,6 +78,153 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(engine_test_t, TestMultithreading) {
     exe.join();
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_P(engine_test_t, TestNumaNode) {
+    engine::kind eng_kind = GetParam();
+    SKIP_IF(engine::get_count(eng_kind) == 0, "Engine is not found.");
+
+    engine eng {eng_kind, 0};
+    ASSERT_EQ(eng.get_numa_node(), -1);
+
+    const int nnodes = (int)engine::get_numa_node_count(eng_kind);
+    if (nnodes == 0) {
+        EXPECT_ANY_THROW(engine(eng_kind, 0, 0));
+        return;
+    }
+    EXPECT_ANY_THROW(engine(eng_kind, 0, nnodes));
+
+    const memory::dim nelems = 1000;
+    memory::desc mem_d({nelems}, memory::data_type::f32, memory::format_tag::x);
+    for (int node = 0; node < nnodes; node++) {
+        engine numa_eng {eng_kind, 0, node};
+        ASSERT_EQ(numa_eng.get_numa_node(), node);
+
+        auto mem = test::make_memory(mem_d, numa_eng);
+        {
+            auto ptr = map_memory<float>(mem);
+            for (memory::dim i = 0; i < nelems; i++)
+                ptr[i] = float(i) * (i % 2 == 0 ? 1 : -1);
+        }
+
+        auto eltwise_pd = eltwise_forward::primitive_desc(numa_eng,
+                prop_kind::forward, algorithm::eltwise_relu, mem_d, mem_d,
+                0.0f);
+        eltwise_forward eltwise(eltwise_pd);
+
+        // The threads are bound to the node for the time of the execution
+        // only.
+#if defined(__linux__) && defined(__GLIBC__)
+        cpu_set_t mask_before, mask_after;
+        ASSERT_EQ(sched_getaffinity(0, sizeof(mask_before), &mask_before), 0);
+#endif
+        stream s(numa_eng);
+        eltwise.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+        s.wait();
+#if defined(__linux__) && defined(__GLIBC__)
+        ASSERT_EQ(sched_getaffinity(0, sizeof(mask_after), &mask_after), 0);
+        ASSERT_TRUE(CPU_EQUAL(&mask_before, &mask_after));
+#endif
+
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i = 0; i < nelems; i++)
+            ASSERT_EQ(ptr[i], i % 2 == 0 ? float(i) : 0.f);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(engine_test_t, TestNumaNodePrimitiveCache) {
+    engine::kind eng_kind = GetParam();
+    SKIP_IF(engine::get_count(eng_kind) == 0, "Engine is not found.");
+    SKIP_IF(engine::get_numa_node_count(eng_kind) == 0,
+            "Engine does not support NUMA binding.");
+
+    bool verbose_enabled = true;
+    try {
+        set_verbose(2);
+    } catch (error &) { verbose_enabled = false; }
+    SKIP_IF(!verbose_enabled, "Verbose mode is not available.");
+
+    // Primitives keep memory on the node of their engine, so the engines
+    // bound to a node get their own primitives from the cache.
+    memory::desc mem_d({1237}, memory::data_type::f32, memory::format_tag::x);
+    auto create = [&](const engine &eng) {
+        auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward,
+                algorithm::eltwise_relu, mem_d, mem_d, 0.37f);
+        eltwise_forward p(pd);
+    };
+    testing::internal::CaptureStdout();
+    create(engine(eng_kind, 0));
+    create(engine(eng_kind, 0, 0));
+    create(engine(eng_kind, 0, 0));
+    const std::string out = testing::internal::GetCapturedStdout();
+    set_verbose(0);
+
+    std::vector<std::string> statuses;
+    for (size_t pos = out.find("create:cache_"); pos != std::string::npos;
+            pos = out.find("create:cache_", pos + 1))
+        statuses.push_back(out.substr(pos + 13, 4));
+    ASSERT_EQ(statuses, std::vector<std::string>({"miss", "miss", "hit,"}))
+            << out;
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(engine_test_t, TestScratchpadPool) {
+    engine::kind eng_kind = GetParam();
+    SKIP_IF(engine::get_count(eng_kind) == 0, "Engine is not found.");
+
+    engine eng {eng_kind, 0};
+    if (eng_kind != engine::kind::cpu) {
+        EXPECT_ANY_THROW(eng.get_scratchpad_pool_stats());
+        return;
+    }
+
+    memory::desc src_md({1, 64, 14, 14}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    memory::desc wei_md({64, 64, 3, 3}, memory::data_type::f32,
+            memory::format_tag::oihw);
+    memory::desc dst_md({1, 64, 14, 14}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto make_pd = [&](scratchpad_mode mode) {
+        primitive_attr attr;
+        attr.set_scratchpad_mode(mode);
+        return convolution_forward::primitive_desc(eng, prop_kind::forward,
+                algorithm::convolution_direct, src_md, wei_md, dst_md,
+                {1, 1}, {1, 1}, {1, 1}, attr);
+    };
+    SKIP_IF(make_pd(scratchpad_mode::user).scratchpad_desc().get_size() == 0,
+            "Primitive does not use a scratchpad.");
+
+    const size_t capacity = size_t(1) << 30;
+    eng.set_scratchpad_pool_capacity(capacity);
+    ASSERT_EQ(eng.get_scratchpad_pool_capacity(), capacity);
+
+    auto pd = make_pd(scratchpad_mode::library);
+    { convolution_forward conv(pd); }
+    auto stats = eng.get_scratchpad_pool_stats();
+    if (stats.allocations == 0) return; // The global scratchpad is used.
+    ASSERT_EQ(stats.allocations, 1u);
+    ASSERT_EQ(stats.bytes_in_use, 0u);
+    ASSERT_GT(stats.bytes_cached, 0u);
+    ASSERT_EQ(stats.peak_bytes, stats.bytes_cached);
+
+    // The buffer is reused by the next primitive, so the pool does not grow.
+    for (int i = 0; i < 3; i++) {
+        convolution_forward conv(pd);
+        auto cur = eng.get_scratchpad_pool_stats();
+        ASSERT_EQ(cur.allocations, 1u);
+        ASSERT_EQ(cur.reuses, size_t(i + 1));
+        ASSERT_EQ(cur.bytes_in_use, stats.bytes_cached);
+        ASSERT_EQ(cur.bytes_cached, 0u);
+    }
+    ASSERT_EQ(eng.get_scratchpad_pool_stats().peak_bytes, stats.peak_bytes);
+
+    // Shrinking the capacity frees the idle buffers.
+    eng.set_scratchpad_pool_capacity(0);
+    stats = eng.get_scratchpad_pool_stats();
+    ASSERT_EQ(stats.bytes_cached, 0u);
+    ASSERT_EQ(stats.evictions, 1u);
+    { convolution_forward conv(pd); }
+    ASSERT_EQ(eng.get_scratchpad_pool_stats().allocations, 2u);
+    ASSERT_EQ(eng.get_scratchpad_pool_stats().evictions, 2u);
+}
+
 INSTANTIATE_TEST_SUITE_P(AllEngineKinds, engine_test_t,
         ::testing::Values(engine::kind::cpu, engine::kind::gpu));
 
@@ -30,3 +30,36 @@ TEST(CAPI, ConstantTensorCache) {
             dnnl_invalid_arguments);
     ASSERT_EQ(dnnl_graph_set_constant_tensor_cache(-1), dnnl_invalid_arguments);
 }
+
+TEST(CAPI, ConstantTensorCacheCapacity) {
+    size_t capacity = 0;
+    ASSERT_EQ(
+            dnnl_graph_get_constant_tensor_cache_capacity(dnnl_cpu, &capacity),
+            dnnl_success);
+    const size_t default_capacity = capacity;
+
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(dnnl_cpu, 1024),
+            dnnl_success);
+    ASSERT_EQ(
+            dnnl_graph_get_constant_tensor_cache_capacity(dnnl_cpu, &capacity),
+            dnnl_success);
+    ASSERT_EQ(capacity, 1024U);
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(
+                      dnnl_cpu, default_capacity),
+            dnnl_success);
+
+    dnnl_graph_constant_tensor_cache_stats_t stats;
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_stats(dnnl_cpu, &stats),
+            dnnl_success);
+
+    // negative test
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_capacity(dnnl_cpu, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_capacity(dnnl_any_engine, 1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_stats(dnnl_cpu, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_compiled_partition_set_constant_tensor_cache_pinned(
+                      nullptr, 1),
+            dnnl_invalid_arguments);
+}
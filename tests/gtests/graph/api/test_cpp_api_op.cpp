@@ -113,6 +113,9 @@ TEST(APIOp, CreateAllOps) {
             op::kind::HardSigmoidBackward,
             op::kind::Select,
             op::kind::Pow,
+            op::kind::GroupNorm,
+            op::kind::RMSNorm,
+            op::kind::EmbeddingBag,
     };
     // clang-format on
 
@@ -417,3 +417,68 @@ TEST(Execute, ConcatEmptyInput) {
             graph::status::success);
     strm->wait();
 }
+
+TEST(Execute, ConcatInplaceInputs) {
+    // The inputs are reordered to the dst layout before the concat, so the
+    // reorders write directly into the dst slices and the concat is skipped.
+    graph::op_t concat_op(graph::op_kind::Concat);
+    concat_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+    graph::engine_t *eng = get_engine();
+
+    const std::vector<graph::dim_t> src_dims {2, 3, 4};
+    const std::vector<graph::dim_t> src_strides {1, 2, 6};
+    graph::logical_tensor_t src0 = utils::logical_tensor_init(
+            0, src_dims, src_strides, graph::data_type::f32);
+    graph::logical_tensor_t src1 = utils::logical_tensor_init(
+            1, src_dims, src_strides, graph::data_type::f32);
+    graph::logical_tensor_t dst = utils::logical_tensor_init(2, {4, 3, 4},
+            graph::data_type::f32, graph::layout_type::strided);
+
+    concat_op.add_input(src0);
+    concat_op.add_input(src1);
+    concat_op.add_output(dst);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&concat_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("concat_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src0, &src1};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    test::vector<float> src0_data(24), src1_data(24), dst_data(48, 0.f);
+    for (size_t i = 0; i < src0_data.size(); ++i) {
+        src0_data[i] = static_cast<float>(i);
+        src1_data[i] = static_cast<float>(100 + i);
+    }
+
+    graph::tensor_t src0_ts(src0, eng, src0_data.data());
+    graph::tensor_t src1_ts(src1, eng, src1_data.data());
+    graph::tensor_t dst_ts(dst, eng, dst_data.data());
+
+    graph::stream_t *strm = get_stream();
+    ASSERT_EQ(cp.execute(strm, {src0_ts, src1_ts}, {dst_ts}),
+            graph::status::success);
+    strm->wait();
+
+    for (graph::dim_t a = 0; a < 4; ++a)
+        for (graph::dim_t b = 0; b < 3; ++b)
+            for (graph::dim_t c = 0; c < 4; ++c) {
+                const auto &src_data = a < 2 ? src0_data : src1_data;
+                const graph::dim_t src_off = (a % 2) * src_strides[0]
+                        + b * src_strides[1] + c * src_strides[2];
+                ASSERT_EQ(dst_data[(a * 3 + b) * 4 + c], src_data[src_off]);
+            }
+}
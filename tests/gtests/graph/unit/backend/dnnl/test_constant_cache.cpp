@@ -39,7 +39,7 @@ TEST(ConstantCache, GetOrAddEmpty) {
 
     graph::dnnl_impl::constant_cache_t cache;
     ASSERT_EQ(cache.set_capacity(0), graph::status::success);
-    ASSERT_FALSE(cache.get_or_add(key_t(), value_t()).valid());
+    ASSERT_FALSE(cache.get_or_add(key_t(), value_t(), 0).valid());
 }
 
 TEST(ConstantCache, Evict) {
@@ -57,22 +57,162 @@ TEST(ConstantCache, Evict) {
             = std::make_shared<dnnl_impl::constant_buffer_t>(
                     1, p_engine_, g_alloc_);
     c_promise1.set_value(c_buffer1);
-    ASSERT_NO_THROW(cache.get_or_add(1, c_promise1.get_future()));
+    ASSERT_NO_THROW(cache.get_or_add(1, c_promise1.get_future(), 1));
 
     std::promise<dnnl_impl::constant_cache_t::cached_t> c_promise2;
     dnnl_impl::constant_cache_t::cached_t c_buffer2
             = std::make_shared<dnnl_impl::constant_buffer_t>(
                     2, p_engine_, g_alloc_);
     c_promise2.set_value(c_buffer2);
-    ASSERT_NO_THROW(cache.get_or_add(2, c_promise2.get_future()));
+    ASSERT_NO_THROW(cache.get_or_add(2, c_promise2.get_future(), 2));
 
     std::promise<dnnl_impl::constant_cache_t::cached_t> c_promise3;
     dnnl_impl::constant_cache_t::cached_t c_buffer3
             = std::make_shared<dnnl_impl::constant_buffer_t>(
                     3, p_engine_, g_alloc_);
     c_promise3.set_value(c_buffer3);
-    ASSERT_NO_THROW(cache.get_or_add(3, c_promise3.get_future()));
+    ASSERT_NO_THROW(cache.get_or_add(3, c_promise3.get_future(), 3));
 
     ASSERT_EQ(cache.set_capacity(3), graph::status::success);
     ASSERT_EQ(cache.set_capacity(0), graph::status::success);
 }
+
+namespace {
+dnnl_impl::constant_cache_t::value_t make_ready_value(size_t size,
+        const dnnl::engine &p_engine, const graph::allocator_t *alc) {
+    std::promise<dnnl_impl::constant_cache_t::cached_t> c_promise;
+    c_promise.set_value(std::make_shared<dnnl_impl::constant_buffer_t>(
+            size, p_engine, alc));
+    return c_promise.get_future().share();
+}
+} // namespace
+
+TEST(ConstantCache, EvictLeastRecentlyUsedAndKeepPinned) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_
+            = static_cast<const graph::allocator_t *>(engine.get_allocator());
+
+    graph::dnnl_impl::constant_cache_t cache;
+    ASSERT_EQ(cache.set_capacity(6), graph::status::success);
+    cache.set_pinned(1, true);
+
+    ASSERT_FALSE(
+            cache.get_or_add(1, make_ready_value(2, p_engine_, g_alloc_), 2)
+                    .valid());
+    ASSERT_FALSE(
+            cache.get_or_add(2, make_ready_value(2, p_engine_, g_alloc_), 2)
+                    .valid());
+    ASSERT_FALSE(
+            cache.get_or_add(3, make_ready_value(2, p_engine_, g_alloc_), 2)
+                    .valid());
+    // Touch the entry 2, so the entry 3 becomes the least recently used one
+    // which is not pinned.
+    ASSERT_TRUE(cache.get_or_add(2, make_ready_value(2, p_engine_, g_alloc_), 2)
+                        .valid());
+
+    dnnl_graph_constant_tensor_cache_stats_t stats;
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.hits, 1U);
+    ASSERT_EQ(stats.misses, 3U);
+    ASSERT_EQ(stats.bytes_resident, 6U);
+    ASSERT_EQ(stats.num_entries, 3U);
+    ASSERT_EQ(stats.num_pinned_entries, 1U);
+
+    // The cache is full, so adding a new entry evicts the entry 3 while the
+    // pinned entry 1 survives although it is the least recently used one.
+    ASSERT_FALSE(
+            cache.get_or_add(4, make_ready_value(2, p_engine_, g_alloc_), 2)
+                    .valid());
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.evictions, 1U);
+    ASSERT_EQ(stats.num_entries, 3U);
+    ASSERT_EQ(stats.bytes_resident, 6U);
+    for (size_t key : {1, 2, 4}) {
+        auto value = make_ready_value(2, p_engine_, g_alloc_);
+        ASSERT_TRUE(cache.get_or_add(key, value, 2).valid()) << "key: " << key;
+    }
+
+    // Shrinking the budget evicts everything except the pinned entry.
+    ASSERT_EQ(cache.set_capacity(1), graph::status::success);
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.evictions, 3U);
+    ASSERT_EQ(stats.num_entries, 1U);
+    ASSERT_EQ(stats.bytes_resident, 2U);
+    ASSERT_TRUE(cache.get_or_add(1, make_ready_value(2, p_engine_, g_alloc_), 2)
+                        .valid());
+
+    // Unpinned entries are evicted as usual.
+    cache.set_pinned(1, false);
+    ASSERT_EQ(cache.set_capacity(1), graph::status::success);
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.num_entries, 0U);
+    ASSERT_EQ(stats.bytes_resident, 0U);
+}
+
+TEST(ConstantCache, NotReadyEntryIsAccountedButNotEvicted) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_
+            = static_cast<const graph::allocator_t *>(engine.get_allocator());
+
+    graph::dnnl_impl::constant_cache_t cache;
+    ASSERT_EQ(cache.set_capacity(3), graph::status::success);
+
+    std::promise<dnnl_impl::constant_cache_t::cached_t> c_promise;
+    ASSERT_FALSE(cache.get_or_add(1, c_promise.get_future(), 2).valid());
+
+    // The entry takes its part of the budget before its buffer is computed.
+    dnnl_graph_constant_tensor_cache_stats_t stats;
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.num_entries, 1U);
+    ASSERT_EQ(stats.bytes_resident, 2U);
+
+    // The entry cannot be evicted, so a new entry that does not fit the rest
+    // of the budget is not added.
+    ASSERT_FALSE(
+            cache.get_or_add(2, make_ready_value(2, p_engine_, g_alloc_), 2)
+                    .valid());
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.num_entries, 1U);
+    ASSERT_EQ(stats.evictions, 0U);
+    ASSERT_EQ(cache.set_capacity(1), graph::status::success);
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.num_entries, 1U);
+
+    c_promise.set_value(make_ready_value(2, p_engine_, g_alloc_).get());
+    cache.remove_if_exist(1);
+}
+
+TEST(ConstantCache, EntryOverBudgetIsNotAdded) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine_ = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc_
+            = static_cast<const graph::allocator_t *>(engine.get_allocator());
+
+    graph::dnnl_impl::constant_cache_t cache;
+    ASSERT_EQ(cache.set_capacity(4), graph::status::success);
+    ASSERT_FALSE(
+            cache.get_or_add(1, make_ready_value(2, p_engine_, g_alloc_), 2)
+                    .valid());
+
+    // An entry larger than the budget neither gets in nor evicts anything.
+    for (int i = 0; i < 2; i++)
+        ASSERT_FALSE(
+                cache.get_or_add(2, make_ready_value(5, p_engine_, g_alloc_), 5)
+                        .valid());
+    dnnl_graph_constant_tensor_cache_stats_t stats;
+    cache.get_stats(&stats);
+    ASSERT_EQ(stats.num_entries, 1U);
+    ASSERT_EQ(stats.bytes_resident, 2U);
+    ASSERT_EQ(stats.evictions, 0U);
+    ASSERT_EQ(stats.misses, 3U);
+
+    // The budget holds after adding entries which need eviction.
+    for (size_t key = 3; key < 6; key++) {
+        auto value = make_ready_value(3, p_engine_, g_alloc_);
+        ASSERT_FALSE(cache.get_or_add(key, value, 3).valid());
+        cache.get_stats(&stats);
+        ASSERT_LE(stats.bytes_resident, 4U);
+    }
+}
@@ -0,0 +1,249 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+// Pools the rows of `table` selected by every bag of `indices`. Bag `b` spans
+// [offsets[b], offsets[b + 1]) and the last one ends at the last index. Empty
+// offsets mean a bag per index (gather).
+std::vector<float> ref_embedding_bag(const std::vector<float> &table,
+        size_t D, const std::vector<int32_t> &indices,
+        const std::vector<int32_t> &offsets, bool mean) {
+    const bool gather = offsets.empty();
+    const size_t n_bags = gather ? indices.size() : offsets.size();
+    std::vector<float> dst(n_bags * D, 0.f);
+    for (size_t b = 0; b < n_bags; ++b) {
+        const size_t begin = gather ? b : offsets[b];
+        const size_t end = gather ? b + 1
+                                  : (b + 1 < n_bags ? offsets[b + 1]
+                                                    : indices.size());
+        for (size_t i = begin; i < end; ++i)
+            for (size_t d = 0; d < D; ++d)
+                dst[b * D + d] += table[indices[i] * D + d];
+        if (mean && end > begin)
+            for (size_t d = 0; d < D; ++d)
+                dst[b * D + d] /= static_cast<float>(end - begin);
+    }
+    return dst;
+}
+} // namespace
+
+TEST(ExecuteSubgraphInt8, DequantizeEmbeddingBag) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t R = 5, D = 20;
+    test::vector<int8_t> table(R * D);
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = static_cast<int8_t>(static_cast<int>((i * 13) % 255) - 127);
+    test::vector<int32_t> indices {0, 3, 4, 3, 1, 2};
+    // The second bag is empty.
+    test::vector<int32_t> offsets {0, 2, 2};
+    const std::vector<float> scales {0.5f, 0.25f, 1.f, 2.f, 0.125f};
+    const std::vector<int64_t> zps(R, 0);
+
+    std::vector<float> table_f32(table.size());
+    for (size_t i = 0; i < table.size(); ++i)
+        table_f32[i] = scales[i / D] * table[i];
+    const std::vector<int32_t> indices_v(indices.begin(), indices.end());
+    const std::vector<int32_t> offsets_v(offsets.begin(), offsets.end());
+    const auto ref_dst
+            = ref_embedding_bag(table_f32, D, indices_v, offsets_v, false);
+    test::vector<float> dst(ref_dst.size(), 0.f);
+
+    graph::op_t dq_op(0, graph::op_kind::Dequantize, "dq");
+    dq_op.set_attr<std::string>(graph::op_attr::qtype, "per_channel");
+    dq_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+    dq_op.set_attr<std::vector<float>>(graph::op_attr::scales, scales);
+    dq_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, zps);
+    graph::op_t eb_op(1, graph::op_kind::EmbeddingBag, "eb");
+    eb_op.set_attr<std::string>(graph::op_attr::mode, "sum");
+
+    auto table_lt = utils::logical_tensor_init(0, {R, D}, graph::data_type::s8);
+    auto table_f32_lt
+            = utils::logical_tensor_init(1, {R, D}, graph::data_type::f32);
+    auto indices_lt = utils::logical_tensor_init(
+            2, {(int64_t)indices.size()}, graph::data_type::s32);
+    auto offsets_lt = utils::logical_tensor_init(
+            3, {(int64_t)offsets.size()}, graph::data_type::s32);
+    auto dst_lt = utils::logical_tensor_init(
+            4, {(int64_t)offsets.size(), D}, graph::data_type::f32);
+
+    dq_op.add_input(table_lt);
+    dq_op.add_output(table_f32_lt);
+    eb_op.add_input(table_f32_lt);
+    eb_op.add_input(indices_lt);
+    eb_op.add_input(offsets_lt);
+    eb_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&dq_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&eb_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("embedding_bag_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &table_lt, &indices_lt, &offsets_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    graph::tensor_t table_ts(table_lt, eng, table.data());
+    graph::tensor_t indices_ts(indices_lt, eng, indices.data());
+    graph::tensor_t offsets_ts(offsets_lt, eng, offsets.data());
+    graph::tensor_t dst_ts(dst_lt, eng, dst.data());
+
+    graph::stream_t *strm = get_stream();
+    ASSERT_EQ(cp.execute(strm, {table_ts, indices_ts, offsets_ts}, {dst_ts}),
+            graph::status::success);
+    strm->wait();
+
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+}
+
+TEST(ExecuteSubgraphFp32, EmbeddingBagConcat) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    // The dense features come from outside of the partition, the embeddings
+    // are looked up inside of it.
+    const int64_t B = 3, DD = 2, R = 6, D = 16;
+    test::vector<float> dense(B * DD);
+    for (size_t i = 0; i < dense.size(); ++i)
+        dense[i] = static_cast<float>(i) - 2.f;
+    test::vector<float> table(R * D);
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = static_cast<float>((i * 7) % 17) - 8.f;
+    test::vector<int32_t> bag_indices {5, 0, 2, 2, 1, 4, 3};
+    test::vector<int32_t> bag_offsets {0, 3, 4};
+    test::vector<int32_t> gather_indices {4, 0, 4};
+
+    const std::vector<float> table_v(table.begin(), table.end());
+    const auto ref_bag = ref_embedding_bag(table_v, D,
+            std::vector<int32_t>(bag_indices.begin(), bag_indices.end()),
+            std::vector<int32_t>(bag_offsets.begin(), bag_offsets.end()),
+            true);
+    const auto ref_gather = ref_embedding_bag(table_v, D,
+            std::vector<int32_t>(gather_indices.begin(), gather_indices.end()),
+            {}, false);
+    const int64_t C = DD + 2 * D;
+    std::vector<float> ref_dst(B * C);
+    for (int64_t b = 0; b < B; ++b)
+        for (int64_t c = 0; c < C; ++c)
+            ref_dst[b * C + c] = c < DD
+                    ? dense[b * DD + c]
+                    : (c < DD + D ? ref_bag[b * D + c - DD]
+                                  : ref_gather[b * D + c - DD - D]);
+    test::vector<float> dst(ref_dst.size(), 0.f);
+
+    graph::op_t bag_op(0, graph::op_kind::EmbeddingBag, "bag");
+    bag_op.set_attr<std::string>(graph::op_attr::mode, "mean");
+    graph::op_t gather_op(1, graph::op_kind::EmbeddingBag, "gather");
+    gather_op.set_attr<std::string>(graph::op_attr::mode, "gather");
+    graph::op_t concat_op(2, graph::op_kind::Concat, "concat");
+    concat_op.set_attr<int64_t>(graph::op_attr::axis, 1);
+
+    auto dense_lt
+            = utils::logical_tensor_init(0, {B, DD}, graph::data_type::f32);
+    auto table_lt
+            = utils::logical_tensor_init(1, {R, D}, graph::data_type::f32);
+    auto bag_indices_lt = utils::logical_tensor_init(
+            2, {(int64_t)bag_indices.size()}, graph::data_type::s32);
+    auto bag_offsets_lt
+            = utils::logical_tensor_init(3, {B}, graph::data_type::s32);
+    auto gather_indices_lt
+            = utils::logical_tensor_init(4, {B}, graph::data_type::s32);
+    auto bag_dst_lt
+            = utils::logical_tensor_init(5, {B, D}, graph::data_type::f32);
+    auto gather_dst_lt
+            = utils::logical_tensor_init(6, {B, D}, graph::data_type::f32);
+    auto dst_lt = utils::logical_tensor_init(7, {B, C}, graph::data_type::f32);
+
+    bag_op.add_input(table_lt);
+    bag_op.add_input(bag_indices_lt);
+    bag_op.add_input(bag_offsets_lt);
+    bag_op.add_output(bag_dst_lt);
+    gather_op.add_input(table_lt);
+    gather_op.add_input(gather_indices_lt);
+    gather_op.add_output(gather_dst_lt);
+    concat_op.add_input(dense_lt);
+    concat_op.add_input(bag_dst_lt);
+    concat_op.add_input(gather_dst_lt);
+    concat_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&bag_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&gather_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&concat_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("embedding_bag_concat_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 3U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&table_lt,
+            &bag_indices_lt, &bag_offsets_lt, &gather_indices_lt, &dense_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    graph::tensor_t dense_ts(dense_lt, eng, dense.data());
+    graph::tensor_t table_ts(table_lt, eng, table.data());
+    graph::tensor_t bag_indices_ts(bag_indices_lt, eng, bag_indices.data());
+    graph::tensor_t bag_offsets_ts(bag_offsets_lt, eng, bag_offsets.data());
+    graph::tensor_t gather_indices_ts(
+            gather_indices_lt, eng, gather_indices.data());
+    graph::tensor_t dst_ts(dst_lt, eng, dst.data());
+
+    graph::stream_t *strm = get_stream();
+    ASSERT_EQ(cp.execute(strm,
+                      {table_ts, bag_indices_ts, bag_offsets_ts,
+                              gather_indices_ts, dense_ts},
+                      {dst_ts}),
+            graph::status::success);
+    strm->wait();
+
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+}
@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <random>
+#include <string>
 #include "gtest/gtest.h"
 
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
@@ -472,3 +475,157 @@ TEST(ExecuteSubgraphInt8, LayernormTypecastQuant) {
         ASSERT_FLOAT_EQ(ref_data[i], dst_data[i]);
     }
 }
+
+TEST(Execute, RMSNormInference) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    test::vector<float> src {3.0, 4.0, 1.0, -1.0, 0.5, 2.0};
+    test::vector<float> scale {1.0, 2.0};
+    test::vector<float> ref_dst(src.size(), 0.0);
+    test::vector<float> dst(src.size(), 0.0);
+    for (size_t row = 0; row < 3; ++row) {
+        const float x0 = src[2 * row], x1 = src[2 * row + 1];
+        const float ms = (x0 * x0 + x1 * x1) / 2;
+        for (size_t c = 0; c < 2; ++c)
+            ref_dst[2 * row + c] = scale[c] * src[2 * row + c] / std::sqrt(ms);
+    }
+
+    graph::op_t rms_norm_op(graph::op_kind::RMSNorm);
+    rms_norm_op.set_attr<float>(graph::op_attr::epsilon, 0);
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {1, 3, 2}, graph::data_type::f32);
+    graph::logical_tensor_t scale_lt
+            = utils::logical_tensor_init(1, {2}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, {1, 3, 2}, graph::data_type::f32);
+
+    rms_norm_op.add_input(src_lt);
+    rms_norm_op.add_input(scale_lt);
+    rms_norm_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&rms_norm_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("rms_norm_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &scale_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    graph::tensor_t src_ts(src_lt, eng, src.data());
+    graph::tensor_t scale_ts(scale_lt, eng, scale.data());
+    graph::tensor_t dst_ts(dst_lt, eng, dst.data());
+
+    graph::stream_t *strm = get_stream();
+    cp.execute(strm, {src_ts, scale_ts}, {dst_ts});
+    strm->wait();
+
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+}
+
+TEST(ExecuteSubgraphFp32, GroupNormRelu) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    // N = 2, C = 4, W = 3 with 2 groups of 2 channels in the NXC format.
+    const size_t N = 2, C = 4, W = 3, G = 2, Cg = C / G;
+    test::vector<float> src(N * W * C);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<float>((i * 7) % 11) - 5.f;
+    test::vector<float> scale {1.0, 0.5, 2.0, -1.0};
+    test::vector<float> shift {0.0, 1.0, -1.0, 0.5};
+    test::vector<float> ref_dst(src.size(), 0.0);
+    test::vector<float> dst(src.size(), 0.0);
+    for (size_t n = 0; n < N; ++n)
+        for (size_t g = 0; g < G; ++g) {
+            float mean = 0, var = 0;
+            for (size_t w = 0; w < W; ++w)
+                for (size_t c = g * Cg; c < (g + 1) * Cg; ++c)
+                    mean += src[(n * W + w) * C + c];
+            mean /= W * Cg;
+            for (size_t w = 0; w < W; ++w)
+                for (size_t c = g * Cg; c < (g + 1) * Cg; ++c) {
+                    const float d = src[(n * W + w) * C + c] - mean;
+                    var += d * d;
+                }
+            var /= W * Cg;
+            for (size_t w = 0; w < W; ++w)
+                for (size_t c = g * Cg; c < (g + 1) * Cg; ++c) {
+                    const size_t off = (n * W + w) * C + c;
+                    const float inv_std = 1.f / std::sqrt(var + 1e-5f);
+                    const float val
+                            = scale[c] * (src[off] - mean) * inv_std + shift[c];
+                    ref_dst[off] = std::max(val, 0.f);
+                }
+        }
+
+    graph::op_t gnorm_op(0, graph::op_kind::GroupNorm, "gnorm");
+    gnorm_op.set_attr<int64_t>(graph::op_attr::groups, G);
+    gnorm_op.set_attr<bool>(graph::op_attr::keep_stats, false);
+    gnorm_op.set_attr<std::string>(graph::op_attr::data_format, "NXC");
+    graph::op_t relu_op(1, graph::op_kind::ReLU, "relu");
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {N, W, C}, graph::data_type::f32);
+    graph::logical_tensor_t scale_lt
+            = utils::logical_tensor_init(1, {C}, graph::data_type::f32);
+    graph::logical_tensor_t shift_lt
+            = utils::logical_tensor_init(2, {C}, graph::data_type::f32);
+    graph::logical_tensor_t gnorm_dst_lt
+            = utils::logical_tensor_init(3, {N, W, C}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(4, {N, W, C}, graph::data_type::f32);
+
+    gnorm_op.add_input(src_lt);
+    gnorm_op.add_input(scale_lt);
+    gnorm_op.add_input(shift_lt);
+    gnorm_op.add_output(gnorm_dst_lt);
+    relu_op.add_input(gnorm_dst_lt);
+    relu_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    ASSERT_EQ(g.add_op(&gnorm_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&relu_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("groupnorm_post_ops_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &scale_lt, &shift_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    graph::tensor_t src_ts(src_lt, eng, src.data());
+    graph::tensor_t scale_ts(scale_lt, eng, scale.data());
+    graph::tensor_t shift_ts(shift_lt, eng, shift.data());
+    graph::tensor_t dst_ts(dst_lt, eng, dst.data());
+
+    graph::stream_t *strm = get_stream();
+    cp.execute(strm, {src_ts, scale_ts, shift_ts}, {dst_ts});
+    strm->wait();
+
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+}
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <vector>
 
 #include "dnnl_test_common.hpp"
@@ -151,6 +152,48 @@ TEST_P(test_parallel_nd_t, Test) {
     CheckID();
 }
 
+TEST_P(test_parallel_nd_t, TestWorkStealing) {
+    const auto prev_scheduling = impl::get_scheduling();
+    impl::set_scheduling(dnnl_scheduling_work_stealing);
+    emit_parallel_nd();
+    impl::set_scheduling(prev_scheduling);
+    CheckID();
+}
+
+TEST(test_work_stealing_scheduler, TestCoverage) {
+    // A single thread must complete the work of all the others.
+    for (ptrdiff_t work_amount : {0, 1, 7, 100}) {
+        for (int nthr : {1, 3, 16}) {
+            impl::work_stealing_scheduler_t scheduler(work_amount, nthr);
+            std::vector<int> visits((size_t)work_amount, 0);
+            ptrdiff_t start {0}, end {0};
+            while (scheduler.next(nthr - 1, start, end)) {
+                ASSERT_LT(start, end);
+                for (ptrdiff_t i = start; i < end; ++i)
+                    visits[i]++;
+            }
+            for (ptrdiff_t i = 0; i < work_amount; ++i)
+                ASSERT_EQ(visits[i], 1) << "item: " << i;
+        }
+    }
+
+    // Threads together visit every item exactly once.
+    const ptrdiff_t work_amount = 1000;
+    std::vector<std::atomic<int>> visits((size_t)work_amount);
+    for (auto &v : visits)
+        v = 0;
+    impl::work_stealing_scheduler_t scheduler(
+            work_amount, dnnl_get_max_threads());
+    impl::parallel(dnnl_get_max_threads(), [&](int ithr, int nthr) {
+        ptrdiff_t start {0}, end {0};
+        while (scheduler.next(ithr, start, end))
+            for (ptrdiff_t i = start; i < end; ++i)
+                visits[i]++;
+    });
+    for (ptrdiff_t i = 0; i < work_amount; ++i)
+        ASSERT_EQ(visits[i], 1) << "item: " << i;
+}
+
 CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
         ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{100}}, np_t {{0, 0}},
                 np_t {{1, 2}}, np_t {{10, 10}}, np_t {{0, 1, 0}},
@@ -16,15 +16,31 @@
 
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <unistd.h>
 #endif
 
 #include "stdlib.h"
 
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include "src/common/dnnl_thread.hpp"
+#include "src/common/perf_counters.hpp"
+#include "src/common/trace.hpp"
+
 // Note: use one non-default value to validate functionality. Rest values, if
 // check in loop will not take effect.
 
@@ -40,10 +56,317 @@ void custom_setenv(const char *name, const char *value, int overwrite) {
 #endif
 }
 
+std::vector<std::string> split(const std::string &s, char delim) {
+    std::vector<std::string> res;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, delim))
+        res.push_back(item);
+    return res;
+}
+
+// Returns the line of `out` that starts with `prefix`.
+std::string find_line(const std::string &out, const std::string &prefix) {
+    for (const auto &line : split(out, '\n'))
+        if (line.compare(0, prefix.size(), prefix) == 0) return line;
+    return std::string();
+}
+
+// Creates a temporary directory and returns its path, empty on failure.
+std::string make_temp_dir() {
+#ifdef _WIN32
+    char dir[MAX_PATH], path[MAX_PATH];
+    if (!GetTempPathA(MAX_PATH, dir) || !GetTempFileNameA(dir, "dnn", 0, path))
+        return std::string();
+    DeleteFileA(path);
+    return CreateDirectoryA(path, nullptr) ? path : std::string();
+#else
+    const char *tmpdir = ::getenv("TMPDIR");
+    std::string tmpl = std::string(tmpdir ? tmpdir : "/tmp")
+            + "/onednn_trace_XXXXXX";
+    std::vector<char> path(tmpl.begin(), tmpl.end());
+    path.push_back('\0');
+    return ::mkdtemp(path.data()) ? path.data() : std::string();
+#endif
+}
+
+void remove_dir(const std::string &path) {
+#ifdef _WIN32
+    RemoveDirectoryA(path.c_str());
+#else
+    ::rmdir(path.c_str());
+#endif
+}
+
+// A minimal JSON parser, enough to validate the structure of the trace.
+struct json_t {
+    enum kind_t { null, boolean, number, string, array, object };
+    kind_t kind = null;
+    double num = 0;
+    std::string str;
+    std::vector<json_t> items;
+    std::vector<std::string> keys;
+
+    // Returns the member `key` of an object or nullptr if there is none.
+    const json_t *get(const std::string &key) const {
+        for (size_t i = 0; i < keys.size(); i++)
+            if (keys[i] == key) return &items[i];
+        return nullptr;
+    }
+
+    // Parses the whole `s`, returns false if it is not valid JSON.
+    static bool parse(const std::string &s, json_t &res) {
+        size_t pos = 0;
+        return parse_value(s, pos, res) && (skip_ws(s, pos), pos == s.size());
+    }
+
+private:
+    static void skip_ws(const std::string &s, size_t &pos) {
+        while (pos < s.size() && std::isspace((unsigned char)s[pos]))
+            pos++;
+    }
+
+    // Escaped characters are kept as is, which is enough for the checks.
+    static bool parse_string(
+            const std::string &s, size_t &pos, std::string &res) {
+        if (pos == s.size() || s[pos++] != '"') return false;
+        const std::string escapes = "\"\\/bfnrt";
+        while (pos < s.size() && s[pos] != '"') {
+            if ((unsigned char)s[pos] < 0x20) return false;
+            if (s[pos] == '\\' && ++pos < s.size()
+                    && escapes.find(s[pos]) == std::string::npos)
+                return false;
+            if (pos < s.size()) res += s[pos++];
+        }
+        return pos++ < s.size();
+    }
+
+    static bool parse_value(const std::string &s, size_t &pos, json_t &res) {
+        skip_ws(s, pos);
+        if (pos == s.size()) return false;
+        const char c = s[pos];
+        if (c == '"') {
+            res.kind = string;
+            return parse_string(s, pos, res.str);
+        }
+        if (c == '{' || c == '[') {
+            const bool is_obj = c == '{';
+            res.kind = is_obj ? object : array;
+            const char end = is_obj ? '}' : ']';
+            skip_ws(s, ++pos);
+            if (pos < s.size() && s[pos] == end) return ++pos, true;
+            while (true) {
+                if (is_obj) {
+                    skip_ws(s, pos);
+                    res.keys.emplace_back();
+                    if (!parse_string(s, pos, res.keys.back())) return false;
+                    skip_ws(s, pos);
+                    if (pos == s.size() || s[pos++] != ':') return false;
+                }
+                res.items.emplace_back();
+                if (!parse_value(s, pos, res.items.back())) return false;
+                skip_ws(s, pos);
+                if (pos == s.size()) return false;
+                if (s[pos] == end) return ++pos, true;
+                if (s[pos++] != ',') return false;
+            }
+        }
+        for (const char *lit : {"true", "false", "null"}) {
+            if (s.compare(pos, strlen(lit), lit) != 0) continue;
+            res.kind = lit[0] == 'n' ? null : boolean;
+            res.num = lit[0] == 't';
+            pos += strlen(lit);
+            return true;
+        }
+        const char *begin = s.c_str() + pos;
+        char *num_end = nullptr;
+        res.kind = number;
+        res.num = std::strtod(begin, &num_end);
+        if (num_end == begin) return false;
+        pos += num_end - begin;
+        return true;
+    }
+};
+
 } // namespace
 
 namespace dnnl {
 
+// The variable is read on the first use of the tracing, so the test goes
+// first. It does not create primitives, as that would read the verbose
+// variables before the tests below set them.
+TEST(onednn_trace_env_var_test, TestEnvVars) {
+    // The file is written again at the process exit, which fails silently
+    // once the directory is removed.
+    const std::string dir = make_temp_dir();
+    ASSERT_FALSE(dir.empty());
+    const std::string path = dir + "/trace.json";
+    custom_setenv("ONEDNN_TRACE", path.c_str(), 1);
+    ASSERT_TRUE(impl::trace::is_enabled());
+
+    EXPECT_STREQ(impl::trace::get_current_name(), "parallel");
+    {
+        impl::trace::scoped_event_t outer("primitive", "outer", -1, -1, true);
+        EXPECT_STREQ(impl::trace::get_current_name(), "outer");
+        {
+            impl::trace::scoped_event_t inner(
+                    "primitive", "inner", -1, -1, true);
+            EXPECT_STREQ(impl::trace::get_current_name(), "inner");
+        }
+        EXPECT_STREQ(impl::trace::get_current_name(), "outer");
+    }
+    EXPECT_STREQ(impl::trace::get_current_name(), "parallel");
+
+    // Chunks of parallel sections are named after the current event.
+    const std::string prim_name = "test \"primitive\"";
+    {
+        impl::trace::scoped_event_t prim(
+                "primitive", prim_name.c_str(), -1, -1, true);
+        impl::parallel(0, [](int, int) {});
+    }
+
+    // A thread keeps a limited number of events.
+    const int n_extra = 10;
+    std::thread([&]() {
+        for (int i = 0; i < impl::trace::max_events_per_thread + n_extra; i++)
+            impl::trace::record("primitive", "flood", 0);
+    }).join();
+
+    impl::trace::dump();
+    std::string contents;
+    {
+        std::ifstream f(path);
+        ASSERT_TRUE(f.good());
+        std::stringstream ss;
+        ss << f.rdbuf();
+        contents = ss.str();
+    }
+    std::remove(path.c_str());
+    remove_dir(dir);
+
+    json_t trace;
+    ASSERT_TRUE(json_t::parse(contents, trace));
+    ASSERT_EQ(trace.kind, json_t::object);
+    const json_t *events = trace.get("traceEvents");
+    ASSERT_NE(events, nullptr);
+    ASSERT_EQ(events->kind, json_t::array);
+
+    int n_outer = 0, n_inner = 0, n_prim = 0, n_chunks = 0, n_flood = 0;
+    double n_dropped = 0;
+    for (const auto &e : events->items) {
+        ASSERT_EQ(e.kind, json_t::object);
+        const json_t *name = e.get("name"), *ph = e.get("ph"),
+                     *pid = e.get("pid"), *tid = e.get("tid");
+        ASSERT_TRUE(name && name->kind == json_t::string);
+        ASSERT_TRUE(ph && ph->kind == json_t::string);
+        ASSERT_TRUE(pid && pid->kind == json_t::number);
+        ASSERT_TRUE(tid && tid->kind == json_t::number);
+        const json_t *args = e.get("args");
+        if (ph->str == "M") {
+            ASSERT_EQ(name->str, "thread_name");
+            ASSERT_TRUE(args && args->get("name"));
+            const json_t *dropped = args->get("dropped_events");
+            if (dropped) n_dropped += dropped->num;
+            continue;
+        }
+        ASSERT_EQ(ph->str, "X");
+        const json_t *cat = e.get("cat"), *ts = e.get("ts"),
+                     *dur = e.get("dur");
+        ASSERT_TRUE(cat && cat->kind == json_t::string);
+        ASSERT_TRUE(ts && ts->kind == json_t::number);
+        ASSERT_TRUE(dur && dur->kind == json_t::number && dur->num >= 0);
+        if (cat->str == "parallel") {
+            ASSERT_TRUE(args && args->get("ithr") && args->get("nthr"));
+            ASSERT_LT(args->get("ithr")->num, args->get("nthr")->num);
+            ASSERT_EQ(name->str, prim_name);
+            n_chunks++;
+        } else if (name->str == "flood") {
+            n_flood++;
+        } else {
+            ASSERT_EQ(cat->str, "primitive");
+            n_outer += name->str == "outer";
+            n_inner += name->str == "inner";
+            n_prim += name->str == prim_name;
+        }
+    }
+    EXPECT_EQ(n_outer, 1);
+    EXPECT_EQ(n_inner, 1);
+    EXPECT_EQ(n_prim, 1);
+    EXPECT_GE(n_chunks, 1);
+    EXPECT_EQ(n_flood, impl::trace::max_events_per_thread);
+    EXPECT_EQ(n_dropped, n_extra);
+}
+
+// The variable is read on the first verbose check, which happens on the first
+// primitive creation in this binary.
+TEST(onednn_verbose_env_var_test, TestProfileCounters) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Hardware counters are reported for CPU only.");
+    custom_setenv("ONEDNN_VERBOSE", "profile_counters", 1);
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+    memory::desc md({16, 16}, memory::data_type::f32, memory::format_tag::ab);
+    memory src(md, eng), dst(md, eng);
+
+    const auto run = [&]() {
+        testing::internal::CaptureStdout();
+        eltwise_forward::primitive_desc pd(eng, prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, md, 0.f);
+        eltwise_forward(pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+        return testing::internal::GetCapturedStdout();
+    };
+
+    const std::string out = run();
+    const bool is_open = impl::perf_counters_t::get().is_open();
+    EXPECT_NE(out.find(is_open ? "hardware counters are enabled"
+                               : "hardware counters are unavailable"),
+            std::string::npos)
+            << out;
+
+    // The execution line has the columns of the template, which ends with
+    // the counters if they are available.
+    const std::string tmpl_prefix = "onednn_verbose,info,prim_template:";
+    const std::string tmpl = find_line(out, tmpl_prefix);
+    ASSERT_FALSE(tmpl.empty()) << out;
+    const auto columns = split(tmpl.substr(tmpl_prefix.size()), ',');
+    const std::string exec_prefix = "onednn_verbose,exec,cpu,eltwise,";
+    const std::string exec = find_line(out, exec_prefix);
+    ASSERT_FALSE(exec.empty()) << out;
+    const auto fields = split(exec.substr(exec_prefix.size()), ',');
+    ASSERT_EQ(fields.size() + 3, columns.size()) << tmpl << "\n" << exec;
+
+    const size_t n = fields.size();
+    if (is_open) {
+        ASSERT_EQ(columns.back(), "llc_misses");
+        ASSERT_EQ(columns[columns.size() - 4], "exec_time");
+        // The counters are integers, the primitive takes some cycles and
+        // instructions.
+        for (size_t i = n - 3; i < n; i++)
+            ASSERT_EQ(fields[i].find_first_not_of("0123456789"),
+                    std::string::npos)
+                    << exec;
+        EXPECT_GT(std::stoull(fields[n - 3]), 0U) << exec;
+        EXPECT_GT(std::stoull(fields[n - 2]), 0U) << exec;
+    } else {
+        ASSERT_EQ(columns.back(), "exec_time");
+    }
+
+    // set_verbose() resets the flags, so the counters are not reported.
+    set_verbose(1);
+    const std::string out_no_counters = run();
+    set_verbose(0);
+    const std::string exec_no_counters
+            = find_line(out_no_counters, exec_prefix);
+    ASSERT_FALSE(exec_no_counters.empty()) << out_no_counters;
+    const auto fields_no_counters
+            = split(exec_no_counters.substr(exec_prefix.size()), ',');
+    EXPECT_EQ(fields_no_counters.size() + (is_open ? 3 : 0), n)
+            << exec_no_counters;
+}
+
 #if DNNL_X64
 TEST(onednn_max_cpu_isa_env_var_test, TestEnvVars) {
     custom_setenv("ONEDNN_MAX_CPU_ISA", "SSE41", 1);
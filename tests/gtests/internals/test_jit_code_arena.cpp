@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "cpu/x64/jit_code_arena.hpp"
+
+namespace dnnl {
+
+using namespace impl::cpu::x64;
+
+namespace {
+
+// Places a function returning `value` (mov eax, imm32; ret) in the arena.
+uint8_t *create_return_value(int value) {
+    uint8_t code[] = {0xb8, 0, 0, 0, 0, 0xc3};
+    std::memcpy(code + 1, &value, sizeof(value));
+    uint8_t *buf = jit_code_arena::alloc(sizeof(code));
+    if (buf) std::memcpy(buf, code, sizeof(code));
+    return buf;
+}
+
+int call(const uint8_t *code) {
+    return reinterpret_cast<int (*)()>(const_cast<uint8_t *>(code))();
+}
+
+// Returns the address the arena gives to the next small kernel.
+uint8_t *next_alloc() {
+    uint8_t *code = jit_code_arena::alloc(1);
+    jit_code_arena::free(code);
+    return code;
+}
+
+} // namespace
+
+TEST(test_jit_code_arena, TestAllocFree) {
+    uint8_t *a = jit_code_arena::alloc(100);
+    if (a == nullptr) return; // The arena is disabled or not supported.
+    uint8_t *b = jit_code_arena::alloc(1);
+    ASSERT_NE(b, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(a) % 64, 0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0u);
+    ASSERT_NE(a, b);
+    jit_code_arena::free(a);
+    jit_code_arena::free(b);
+
+    // Too large kernels are not placed in the arena.
+    ASSERT_EQ(jit_code_arena::alloc(64 * 1024 * 1024), nullptr);
+}
+
+TEST(test_jit_code_arena, TestKernels) {
+    std::vector<uint8_t *> kernels;
+    for (int i = 0; i < 64; i++) {
+        kernels.push_back(create_return_value(i));
+        if (kernels.back() == nullptr) return; // The arena is disabled.
+    }
+    for (int i = 0; i < 64; i++)
+        ASSERT_EQ(call(kernels[i]), i);
+
+    // Kernels are released in an arbitrary order and new kernels reuse the
+    // released space.
+    std::vector<uint8_t *> released;
+    for (int i = 0; i < 64; i += 2) {
+        released.push_back(kernels[i]);
+        jit_code_arena::free(kernels[i]);
+    }
+    for (int i = 0; i < 64; i += 2) {
+        kernels[i] = create_return_value(-i);
+        ASSERT_EQ(kernels[i], released[i / 2]);
+    }
+    for (int i = 0; i < 64; i++)
+        ASSERT_EQ(call(kernels[i]), i % 2 ? i : -i);
+    for (auto *k : kernels)
+        jit_code_arena::free(k);
+}
+
+TEST(test_jit_code_arena, TestPrimitiveCacheEviction) {
+    uint8_t *start = next_alloc();
+    if (start == nullptr) return; // The arena is disabled.
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+    const memory::dim nelems = 16 * 1024;
+    memory::desc md({nelems}, memory::data_type::f32, memory::format_tag::a);
+    memory src(md, eng), dst(md, eng);
+    float *src_ptr = static_cast<float *>(src.get_data_handle());
+    const float *dst_ptr = static_cast<float *>(dst.get_data_handle());
+    for (memory::dim i = 0; i < nelems; i++)
+        src_ptr[i] = static_cast<float>(i % 5) - 2.f;
+
+    const int capacity = get_primitive_cache_capacity();
+    for (int iter = 0; iter < 2; iter++) {
+        set_primitive_cache_capacity(capacity > 0 ? capacity : 1);
+        {
+            // The jit implementation of exp loads its constants through the
+            // absolute address of a table, which is resolved only after its
+            // code is moved to the arena.
+            eltwise_forward::primitive_desc pd(eng,
+                    prop_kind::forward_inference, algorithm::eltwise_exp, md,
+                    md, 0.f, 0.f);
+            if (std::string(pd.impl_info_str()).find("jit") != 0) {
+                set_primitive_cache_capacity(capacity);
+                return;
+            }
+            eltwise_forward(pd).execute(
+                    strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+            strm.wait();
+            for (memory::dim i = 0; i < nelems; i++)
+                ASSERT_NEAR(dst_ptr[i], std::exp(src_ptr[i]),
+                        1e-6f * dst_ptr[i]);
+        }
+        // The primitive is kept alive by the primitive cache only.
+        ASSERT_NE(next_alloc(), start);
+
+        // Evicting the primitive destroys its kernels, and new kernels,
+        // including the ones of the recreated primitive, are placed in the
+        // released space.
+        set_primitive_cache_capacity(0);
+        ASSERT_EQ(next_alloc(), start);
+    }
+    set_primitive_cache_capacity(capacity);
+}
+
+} // namespace dnnl
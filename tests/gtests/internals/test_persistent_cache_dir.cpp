@@ -0,0 +1,257 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+namespace {
+
+// The directory is read once on the first primitive descriptor creation, so
+// it is set up before main().
+struct cache_dir_t {
+    cache_dir_t() {
+        char tmpl[] = "/tmp/onednn_persistent_cache_XXXXXX";
+        if (!mkdtemp(tmpl)) return;
+        path = tmpl;
+        ::setenv("ONEDNN_PERSISTENT_CACHE_DIR", path.c_str(), 1);
+    }
+    ~cache_dir_t() {
+        if (path.empty()) return;
+        clear();
+        ::rmdir(path.c_str());
+    }
+
+    std::vector<std::string> entries() const {
+        std::vector<std::string> res;
+        DIR *dir = ::opendir(path.c_str());
+        if (!dir) return res;
+        while (const dirent *e = ::readdir(dir)) {
+            const std::string name = e->d_name;
+            if (name.size() > 5 && name.substr(name.size() - 5) == ".blob")
+                res.push_back(path + "/" + name);
+        }
+        ::closedir(dir);
+        return res;
+    }
+
+    void clear() const {
+        for (const auto &e : entries())
+            std::remove(e.c_str());
+    }
+
+    std::string path;
+};
+
+cache_dir_t cache_dir;
+
+// The entry layout on disk is:
+//     | magic | version size | version | id size | id | blob size | blob |
+// A dispatching entry stores the position of the implementation in the list
+// and its name as the blob.
+struct entry_t {
+    uint64_t magic = 0;
+    std::vector<uint8_t> version, id, blob;
+
+    bool read(const std::string &path) {
+        std::vector<uint8_t> data;
+        FILE *f = fopen(path.c_str(), "rb");
+        if (!f) return false;
+        uint8_t buf[4096];
+        size_t n = 0;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            data.insert(data.end(), buf, buf + n);
+        fclose(f);
+
+        size_t pos = 0;
+        auto read_u64 = [&](uint64_t &v) {
+            if (data.size() - pos < sizeof(v)) return false;
+            std::memcpy(&v, data.data() + pos, sizeof(v));
+            pos += sizeof(v);
+            return true;
+        };
+        auto read_bytes = [&](std::vector<uint8_t> &v) {
+            uint64_t size = 0;
+            if (!read_u64(size) || data.size() - pos < size) return false;
+            v.assign(data.begin() + pos, data.begin() + pos + size);
+            pos += size;
+            return true;
+        };
+        return read_u64(magic) && read_bytes(version) && read_bytes(id)
+                && read_bytes(blob) && pos == data.size();
+    }
+
+    void write(const std::string &path) const {
+        FILE *f = fopen(path.c_str(), "wb");
+        ASSERT_NE(f, nullptr);
+        auto write_bytes = [&](const std::vector<uint8_t> &v) {
+            const uint64_t size = v.size();
+            fwrite(&size, sizeof(size), 1, f);
+            if (size) fwrite(v.data(), size, 1, f);
+        };
+        fwrite(&magic, sizeof(magic), 1, f);
+        write_bytes(version);
+        write_bytes(id);
+        write_bytes(blob);
+        fclose(f);
+    }
+
+    std::string impl_name() const {
+        if (blob.size() <= sizeof(int32_t)) return std::string();
+        return std::string(blob.begin() + sizeof(int32_t), blob.end());
+    }
+
+    void set_impl(int32_t idx, const std::string &name) {
+        blob.resize(sizeof(idx));
+        std::memcpy(blob.data(), &idx, sizeof(idx));
+        blob.insert(blob.end(), name.begin(), name.end());
+    }
+};
+
+} // namespace
+
+class persistent_cache_dir_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(cache_dir.path.empty(), "Cannot create a cache directory.");
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "The test is run for the CPU engine.");
+        // The primitive cache would serve the primitive descriptors without
+        // consulting the persistent cache.
+        set_primitive_cache_capacity(0);
+        cache_dir.clear();
+    }
+
+    void TearDown() override { cache_dir.clear(); }
+
+    static std::string create_impl() {
+        engine eng(engine::kind::cpu, 0);
+        memory::desc src_md({16, 32}, memory::data_type::f32,
+                memory::format_tag::ab);
+        memory::desc wei_md({32, 24}, memory::data_type::f32,
+                memory::format_tag::ab);
+        memory::desc dst_md({16, 24}, memory::data_type::f32,
+                memory::format_tag::ab);
+        return matmul::primitive_desc(eng, src_md, wei_md, dst_md)
+                .impl_info_str();
+    }
+
+    static std::string only_entry() {
+        const auto entries = cache_dir.entries();
+        EXPECT_EQ(entries.size(), 1U);
+        return entries.empty() ? std::string() : entries[0];
+    }
+
+    // Points the stored entry to the reference implementation and returns
+    // true if the primitive descriptor creation takes it from the entry.
+    static bool redirect_to_ref(const std::string &path, entry_t entry) {
+        for (int32_t idx = 0; idx < 128; ++idx) {
+            entry.set_impl(idx, "ref:any");
+            entry.write(path);
+            if (create_impl() == "ref:any") return true;
+        }
+        return false;
+    }
+};
+
+TEST_F(persistent_cache_dir_test_t, TestStoreThenLoad) {
+    const std::string impl = create_impl();
+
+    const std::string path = only_entry();
+    entry_t entry;
+    ASSERT_TRUE(entry.read(path));
+    ASSERT_EQ(entry.impl_name(), impl);
+
+    // The stored entry is used as is.
+    ASSERT_EQ(create_impl(), impl);
+    ASSERT_EQ(only_entry(), path);
+
+    // The stored implementation is taken without trying the ones in front of
+    // it, which is observable when the entry points to a slower one.
+    if (impl == "ref:any") return;
+    ASSERT_TRUE(redirect_to_ref(path, entry));
+    entry_t redirected;
+    ASSERT_TRUE(redirected.read(path));
+    ASSERT_EQ(redirected.impl_name(), "ref:any");
+}
+
+TEST_F(persistent_cache_dir_test_t, TestCorruptedEntry) {
+    const std::string impl = create_impl();
+    const std::string path = only_entry();
+    entry_t entry;
+    ASSERT_TRUE(entry.read(path));
+
+    // A truncated entry is ignored and replaced.
+    {
+        FILE *f = fopen(path.c_str(), "wb");
+        ASSERT_NE(f, nullptr);
+        fwrite(&entry.magic, sizeof(entry.magic), 1, f);
+        const uint64_t huge_size = uint64_t(1) << 60;
+        fwrite(&huge_size, sizeof(huge_size), 1, f);
+        fclose(f);
+    }
+    ASSERT_EQ(create_impl(), impl);
+    entry_t replaced;
+    ASSERT_TRUE(replaced.read(path));
+    ASSERT_EQ(replaced.impl_name(), impl);
+
+    // An entry that points outside of the implementation list or to an
+    // implementation with another name is ignored and replaced.
+    for (int32_t idx : {-5, 0, 100000}) {
+        entry_t bad = entry;
+        bad.set_impl(idx, "no_such_impl");
+        bad.write(path);
+        ASSERT_EQ(create_impl(), impl);
+        ASSERT_TRUE(replaced.read(path));
+        ASSERT_EQ(replaced.impl_name(), impl);
+    }
+}
+
+TEST_F(persistent_cache_dir_test_t, TestVersionMismatch) {
+    const std::string impl = create_impl();
+    SKIP_IF(impl == "ref:any", "The reference implementation is the default.");
+    const std::string path = only_entry();
+    entry_t entry;
+    ASSERT_TRUE(entry.read(path));
+
+    // Make sure the entry would be used with the current version.
+    ASSERT_TRUE(redirect_to_ref(path, entry));
+    entry_t redirected;
+    ASSERT_TRUE(redirected.read(path));
+
+    // The same entry written by another version is ignored and replaced.
+    redirected.version.push_back('x');
+    redirected.write(path);
+    ASSERT_EQ(create_impl(), impl);
+    entry_t replaced;
+    ASSERT_TRUE(replaced.read(path));
+    ASSERT_EQ(replaced.version, entry.version);
+    ASSERT_EQ(replaced.impl_name(), impl);
+}
+
+} // namespace dnnl
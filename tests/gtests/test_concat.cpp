@@ -14,6 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -435,4 +442,110 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+class concat_inplace_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Only the CPU implementations skip in-place sources.");
+    }
+};
+
+TEST_F(concat_inplace_test_t, TestInplaceOffsetQuery) {
+    using tag = memory::format_tag;
+    const auto f32 = memory::data_type::f32;
+    engine eng = get_test_engine();
+
+    // Sources concatenated along the outermost dimension are dense chunks of
+    // the destination.
+    const std::vector<memory::desc> srcs_outer {
+            {{2, 3, 4}, f32, tag::abc}, {{3, 3, 4}, f32, tag::abc}};
+    concat::primitive_desc outer_pd(eng, 0, srcs_outer);
+    ASSERT_EQ(outer_pd.get_src_inplace_offset(0), 0);
+    ASSERT_EQ(outer_pd.get_src_inplace_offset(1),
+            (memory::dim)srcs_outer[0].get_size());
+    ASSERT_EQ(outer_pd.get_src_inplace_offset(2), -1);
+
+    // Sources concatenated along an inner dimension are not.
+    const std::vector<memory::desc> srcs_inner {
+            {{2, 3, 4}, f32, tag::abc}, {{2, 5, 4}, f32, tag::abc}};
+    concat::primitive_desc inner_pd(eng, 1, srcs_inner);
+    ASSERT_EQ(inner_pd.get_src_inplace_offset(0), -1);
+    ASSERT_EQ(inner_pd.get_src_inplace_offset(1), -1);
+}
+
+TEST_F(concat_inplace_test_t, TestInplaceSourcesAreNotCopied) {
+    using tag = memory::format_tag;
+    const auto f32 = memory::data_type::f32;
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const std::vector<memory::desc> src_mds {
+            {{2, 3, 4}, f32, tag::abc}, {{3, 3, 4}, f32, tag::abc}};
+    concat::primitive_desc pd(eng, 0, src_mds);
+    const memory::desc dst_md = pd.dst_desc();
+    const size_t dst_size = dst_md.get_size();
+    const size_t nelems = dst_size / sizeof(float);
+
+#if defined(__linux__)
+    // The destination is placed on its own pages, so it can be made read
+    // only. Any write into it by the primitive would fault.
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t buf_size = (dst_size + page - 1) / page * page;
+    void *buf = mmap(nullptr, buf_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(buf, MAP_FAILED);
+#else
+    std::vector<float> storage(nelems);
+    void *buf = storage.data();
+#endif
+
+    // The producers write their outputs directly into the destination.
+    auto dst_ptr = static_cast<float *>(buf);
+    for (size_t i = 0; i < nelems; ++i)
+        dst_ptr[i] = static_cast<float>(i);
+
+    memory dst(dst_md, eng, buf);
+    std::unordered_map<int, memory> args {{DNNL_ARG_DST, dst}};
+    for (int i = 0; i < (int)src_mds.size(); ++i) {
+        const memory::dim offset = pd.get_src_inplace_offset(i);
+        ASSERT_GE(offset, 0);
+        args.insert({DNNL_ARG_MULTIPLE_SRC + i,
+                memory(src_mds[i], eng,
+                        static_cast<char *>(buf) + offset)});
+    }
+
+#if defined(__linux__)
+    ASSERT_EQ(mprotect(buf, buf_size, PROT_READ), 0);
+#endif
+    concat(pd).execute(strm, args);
+    strm.wait();
+#if defined(__linux__)
+    ASSERT_EQ(mprotect(buf, buf_size, PROT_READ | PROT_WRITE), 0);
+#endif
+
+    for (size_t i = 0; i < nelems; ++i)
+        ASSERT_EQ(dst_ptr[i], static_cast<float>(i)) << "index: " << i;
+
+    // Sources that are not in place are still copied.
+    memory src0(src_mds[0], eng), src1(src_mds[1], eng);
+    fill_data<float>(src_mds[0].get_size() / sizeof(float), src0);
+    fill_data<float>(src_mds[1].get_size() / sizeof(float), src1);
+    concat(pd).execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, src0}, {DNNL_ARG_MULTIPLE_SRC + 1, src1},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+    {
+        auto src0_ptr = map_memory<float>(src0);
+        auto src1_ptr = map_memory<float>(src1);
+        const size_t n0 = src_mds[0].get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; ++i)
+            ASSERT_EQ(dst_ptr[i], i < n0 ? src0_ptr[i] : src1_ptr[i - n0])
+                    << "index: " << i;
+    }
+
+#if defined(__linux__)
+    munmap(buf, buf_size);
+#endif
+}
+
 } // namespace dnnl
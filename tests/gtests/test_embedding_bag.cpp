@@ -0,0 +1,229 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+enum class eb_scales_kind_t { none, common, per_row };
+
+struct embedding_bag_test_params_t {
+    algorithm alg;
+    dt table_dt;
+    dt dst_dt;
+    memory::dim rows, D;
+    memory::dim n_indices;
+    // The number of bags, ignored for gather.
+    memory::dim n_bags;
+    eb_scales_kind_t scales_kind;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_test_params_t> {
+private:
+    embedding_bag_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<embedding_bag_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Embedding bag is supported on CPU only.");
+        SKIP_IF(unsupported_data_type(p.table_dt)
+                        || unsupported_data_type(p.dst_dt),
+                "Engine does not support this data type.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // The values are exactly representable in all the table data types.
+    float table_value(memory::dim i) const {
+        const float v = static_cast<float>((i * 7) % 11);
+        if (p.table_dt == dt::u8) return v;
+        if (p.table_dt == dt::s8) return v - 5.f;
+        return (v - 5.f) / 4.f;
+    }
+
+    static float scale_value(memory::dim row) {
+        return 0.5f * static_cast<float>(1 + row % 3);
+    }
+
+    void Test() {
+        const bool is_gather = p.alg == algorithm::embedding_bag_gather;
+        const memory::dim n_bags = is_gather ? p.n_indices : p.n_bags;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::desc table_md({p.rows, p.D}, p.table_dt, tag::ab);
+        memory::desc idx_md({p.n_indices}, dt::s32, tag::a);
+        memory::desc off_md({n_bags}, dt::s32, tag::a);
+        memory::desc dst_md({n_bags, p.D}, p.dst_dt, tag::ab);
+
+        primitive_attr attr;
+        if (p.scales_kind != eb_scales_kind_t::none)
+            attr.set_scales_mask(DNNL_ARG_SRC,
+                    p.scales_kind == eb_scales_kind_t::per_row ? 1 << 0 : 0);
+
+        auto pd = is_gather ? embedding_bag::primitive_desc(
+                          eng, table_md, idx_md, dst_md, attr)
+                            : embedding_bag::primitive_desc(eng, p.alg,
+                                    table_md, idx_md, off_md, dst_md, attr);
+        ASSERT_EQ(pd.src_desc(), table_md);
+        ASSERT_EQ(pd.indices_desc(), idx_md);
+        ASSERT_EQ(pd.dst_desc(), dst_md);
+        ASSERT_EQ(pd.get_algorithm(), p.alg);
+        if (is_gather) ASSERT_EQ(pd.offsets_desc(), memory::desc());
+
+        // The table is filled in f32 and converted to its data type.
+        memory table_f32({{p.rows, p.D}, dt::f32, tag::ab}, eng);
+        {
+            auto ptr = map_memory<float>(table_f32);
+            for (memory::dim i = 0; i < p.rows * p.D; i++)
+                ptr[i] = table_value(i);
+        }
+        memory table(table_md, eng);
+        reorder(table_f32, table).execute(strm, table_f32, table);
+
+        // Random-like lookups with repeated rows; bags get from zero to five
+        // indices.
+        std::vector<int32_t> indices(p.n_indices), offsets(n_bags, 0);
+        for (memory::dim i = 0; i < p.n_indices; i++)
+            indices[i] = static_cast<int32_t>((i * 37 + 11) % p.rows);
+        if (!is_gather) {
+            memory::dim off = 0;
+            for (memory::dim b = 0; b < n_bags; b++) {
+                offsets[b] = static_cast<int32_t>(off);
+                off = std::min(off + (b * 5) % 6, p.n_indices);
+            }
+        }
+
+        std::vector<float> scales(
+                p.scales_kind == eb_scales_kind_t::per_row ? p.rows : 1);
+        for (size_t r = 0; r < scales.size(); r++)
+            scales[r] = scale_value(static_cast<memory::dim>(r));
+
+        memory idx(idx_md, eng), off(off_md, eng), dst(dst_md, eng);
+        memory scales_mem({{static_cast<memory::dim>(scales.size())}, dt::f32,
+                                  tag::a},
+                eng);
+        {
+            auto ptr = map_memory<int32_t>(idx);
+            for (memory::dim i = 0; i < p.n_indices; i++)
+                ptr[i] = indices[i];
+        }
+        if (!is_gather) {
+            auto ptr = map_memory<int32_t>(off);
+            for (memory::dim b = 0; b < n_bags; b++)
+                ptr[b] = offsets[b];
+        }
+        {
+            auto ptr = map_memory<float>(scales_mem);
+            for (size_t r = 0; r < scales.size(); r++)
+                ptr[r] = scales[r];
+        }
+
+        std::unordered_map<int, memory> args {{DNNL_ARG_SRC, table},
+                {DNNL_ARG_INDICES, idx}, {DNNL_ARG_DST, dst}};
+        if (!is_gather) args.insert({DNNL_ARG_OFFSETS, off});
+        if (p.scales_kind != eb_scales_kind_t::none)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales_mem});
+        embedding_bag(pd).execute(strm, args);
+        strm.wait();
+
+        memory dst_f32({{n_bags, p.D}, dt::f32, tag::ab}, eng);
+        reorder(dst, dst_f32).execute(strm, dst, dst_f32);
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst_f32);
+        const float eps = p.dst_dt == dt::f32 ? 1e-5f : 1e-2f;
+        for (memory::dim b = 0; b < n_bags; b++) {
+            const memory::dim beg = is_gather ? b : offsets[b];
+            const memory::dim end = is_gather
+                    ? b + 1
+                    : (b + 1 < n_bags ? offsets[b + 1] : p.n_indices);
+            for (memory::dim d = 0; d < p.D; d++) {
+                float ref = 0.f;
+                for (memory::dim i = beg; i < end; i++) {
+                    const memory::dim row = indices[i];
+                    const float s = p.scales_kind == eb_scales_kind_t::none
+                            ? 1.f
+                            : scales[p.scales_kind == eb_scales_kind_t::per_row
+                                            ? row
+                                            : 0];
+                    ref += s * table_value(row * p.D + d);
+                }
+                if (p.alg == algorithm::embedding_bag_mean && end > beg)
+                    ref /= static_cast<float>(end - beg);
+                ASSERT_NEAR(ref, dst_ptr[b * p.D + d],
+                        eps * (1.f + std::fabs(ref)))
+                        << "bag: " << b << ", d: " << d;
+            }
+        }
+    }
+};
+
+TEST_P(embedding_bag_test_t, TestsEmbeddingBag) {}
+
+using scales = eb_scales_kind_t;
+static const auto gather = algorithm::embedding_bag_gather;
+static const auto sum = algorithm::embedding_bag_sum;
+static const auto mean = algorithm::embedding_bag_mean;
+
+INSTANTIATE_TEST_SUITE_P(TestEmbeddingBag, embedding_bag_test_t,
+        ::testing::Values(
+                embedding_bag_test_params_t {gather, dt::f32, dt::f32, 50, 64,
+                        40, 0, scales::none, false, dnnl_success},
+                embedding_bag_test_params_t {sum, dt::f32, dt::f32, 100, 37,
+                        200, 60, scales::none, false, dnnl_success},
+                embedding_bag_test_params_t {mean, dt::f32, dt::f32, 1000, 300,
+                        150, 48, scales::common, false, dnnl_success},
+                embedding_bag_test_params_t {sum, dt::s8, dt::f32, 300, 128,
+                        90, 33, scales::per_row, false, dnnl_success},
+                embedding_bag_test_params_t {mean, dt::u8, dt::f32, 20, 16,
+                        64, 20, scales::per_row, false, dnnl_success},
+                embedding_bag_test_params_t {gather, dt::s8, dt::f32, 64, 20,
+                        31, 0, scales::per_row, false, dnnl_success},
+                embedding_bag_test_params_t {sum, dt::bf16, dt::f32, 70, 512,
+                        100, 25, scales::none, false, dnnl_success},
+                embedding_bag_test_params_t {sum, dt::f16, dt::f32, 70, 24,
+                        100, 25, scales::per_row, false, dnnl_success},
+                embedding_bag_test_params_t {mean, dt::f32, dt::bf16, 40, 48,
+                        80, 16, scales::none, false, dnnl_success},
+                // No indices at all: every bag is empty.
+                embedding_bag_test_params_t {sum, dt::f32, dt::f32, 10, 8, 0,
+                        4, scales::none, false, dnnl_success}));
+
+INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagEF, embedding_bag_test_t,
+        ::testing::Values(
+                // Not an embedding bag algorithm.
+                embedding_bag_test_params_t {algorithm::eltwise_relu, dt::f32,
+                        dt::f32, 10, 8, 4, 2, scales::none, true,
+                        dnnl_invalid_arguments}));
+
+} // namespace dnnl
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class float8_test_t : public ::testing::TestWithParam<dt> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "f8 data types are supported on CPU only.");
+    }
+
+    // Converts f32 values to f8 with a reorder and returns the raw bits.
+    static std::vector<uint8_t> to_f8(dt f8_dt, const std::vector<float> &v) {
+        const memory::dims dims {static_cast<memory::dim>(v.size())};
+        engine eng = get_test_engine();
+        stream strm(eng);
+        memory src({dims, dt::f32, tag::a}, eng);
+        memory dst({dims, f8_dt, tag::a}, eng);
+        {
+            auto ptr = map_memory<float>(src);
+            for (size_t i = 0; i < v.size(); ++i)
+                ptr[i] = v[i];
+        }
+        reorder(src, dst).execute(strm, src, dst);
+        strm.wait();
+
+        auto ptr = map_memory<uint8_t>(dst);
+        return std::vector<uint8_t>(ptr, ptr + v.size());
+    }
+
+    // Converts raw f8 values to f32 with a reorder.
+    static std::vector<float> to_f32(dt f8_dt, const std::vector<uint8_t> &v) {
+        const memory::dims dims {static_cast<memory::dim>(v.size())};
+        engine eng = get_test_engine();
+        stream strm(eng);
+        memory src({dims, f8_dt, tag::a}, eng);
+        memory dst({dims, dt::f32, tag::a}, eng);
+        {
+            auto ptr = map_memory<uint8_t>(src);
+            for (size_t i = 0; i < v.size(); ++i)
+                ptr[i] = v[i];
+        }
+        reorder(src, dst).execute(strm, src, dst);
+        strm.wait();
+
+        auto ptr = map_memory<float>(dst);
+        return std::vector<float>(ptr, ptr + v.size());
+    }
+};
+
+TEST_P(float8_test_t, TestRoundTripAllValues) {
+    const dt f8_dt = GetParam();
+    std::vector<uint8_t> raw(256);
+    for (int i = 0; i < 256; ++i)
+        raw[i] = static_cast<uint8_t>(i);
+
+    const auto f = to_f32(f8_dt, raw);
+    const auto back = to_f8(f8_dt, f);
+    for (int i = 0; i < 256; ++i) {
+        if (std::isnan(f[i])) continue;
+        ASSERT_EQ(raw[i], back[i]) << "raw: " << i;
+    }
+}
+
+TEST_P(float8_test_t, TestRoundTripTensor) {
+    const dt f8_dt = GetParam();
+    const memory::dims dims {2, 67};
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    memory src({dims, dt::f32, tag::ab}, eng);
+    memory f8({dims, f8_dt, tag::ab}, eng);
+    memory dst({dims, dt::f32, tag::ab}, eng);
+
+    const memory::dim nelems = dims[0] * dims[1];
+    {
+        auto ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < nelems; ++i)
+            ptr[i] = (i % 2 ? -1.f : 1.f) * std::ldexp(1.f + (i % 4) / 4.f,
+                             static_cast<int>(i % 9) - 4);
+    }
+
+    reorder(src, f8).execute(strm, src, f8);
+    reorder(f8, dst).execute(strm, f8, dst);
+    strm.wait();
+
+    // All the values are exactly representable in both f8 data types.
+    auto src_ptr = map_memory<float>(src);
+    auto dst_ptr = map_memory<float>(dst);
+    for (memory::dim i = 0; i < nelems; ++i)
+        ASSERT_EQ(src_ptr[i], dst_ptr[i]) << "index: " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        TestFloat8, float8_test_t, ::testing::Values(dt::f8_e5m2, dt::f8_e4m3));
+
+class float8_values_test_t : public float8_test_t {};
+
+TEST_F(float8_values_test_t, TestSpecialValues) {
+    // Largest finite numbers and smallest denormals.
+    const auto e5m2 = to_f32(dt::f8_e5m2, {0x7b, 0x01});
+    ASSERT_EQ(e5m2[0], 57344.f);
+    ASSERT_EQ(e5m2[1], std::ldexp(1.f, -16));
+    const auto e4m3 = to_f32(dt::f8_e4m3, {0x7e, 0x01});
+    ASSERT_EQ(e4m3[0], 448.f);
+    ASSERT_EQ(e4m3[1], std::ldexp(1.f, -9));
+
+    // f8_e5m2 has infinities, f8_e4m3 does not.
+    const auto e5m2_inf = to_f8(dt::f8_e5m2, {1e6f, -INFINITY});
+    ASSERT_EQ(e5m2_inf[0], 0x7c);
+    ASSERT_EQ(e5m2_inf[1], 0xfc);
+    const auto e4m3_nan = to_f32(
+            dt::f8_e4m3, to_f8(dt::f8_e4m3, {1e6f, INFINITY, NAN}));
+    for (float f : e4m3_nan)
+        ASSERT_TRUE(std::isnan(f));
+    ASSERT_TRUE(std::isnan(to_f32(dt::f8_e5m2, to_f8(dt::f8_e5m2, {NAN}))[0]));
+}
+
+TEST_F(float8_values_test_t, TestRoundToNearestEven) {
+    // 1.125 is a tie between 1.0 and 1.25 for f8_e5m2.
+    const auto e5m2 = to_f32(dt::f8_e5m2, to_f8(dt::f8_e5m2, {1.125f, 1.375f}));
+    ASSERT_EQ(e5m2[0], 1.f);
+    ASSERT_EQ(e5m2[1], 1.5f);
+    // 1.0625 is a tie between 1.0 and 1.125 for f8_e4m3. Rounding up the
+    // largest denormal produces the smallest normal number.
+    const auto e4m3 = to_f32(dt::f8_e4m3,
+            to_f8(dt::f8_e4m3, {1.0625f, 1.1875f, std::ldexp(0.99f, -6)}));
+    ASSERT_EQ(e4m3[0], 1.f);
+    ASSERT_EQ(e4m3[1], 1.25f);
+    ASSERT_EQ(e4m3[2], std::ldexp(1.f, -6));
+}
+
+} // namespace dnnl
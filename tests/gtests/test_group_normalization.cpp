@@ -0,0 +1,269 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+static constexpr float epsilon = 1e-5f;
+static constexpr float relu_alpha = 0.25f;
+
+struct gnorm_test_params_t {
+    memory::dims dims;
+    tag data_tag;
+    dt data_dt;
+    memory::dim groups;
+    normalization_flags flags;
+    prop_kind pk;
+    // Appends a ReLU post-op with a negative slope.
+    bool with_relu;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class gnorm_test_t : public ::testing::TestWithParam<gnorm_test_params_t> {
+private:
+    gnorm_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<gnorm_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Group normalization is supported on CPU only.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static void fill(const memory &mem, float shift) {
+        auto ptr = map_memory<float>(mem);
+        const auto nelems = mem.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = static_cast<float>((i * 13) % 23) / 8.f + shift;
+    }
+
+    static void reorder_to(memory src, memory dst) {
+        stream strm(src.get_engine());
+        reorder(src, dst).execute(strm, src, dst);
+        strm.wait();
+    }
+
+    bool has(normalization_flags f) const {
+        return (p.flags & f) != normalization_flags::none;
+    }
+
+    void Test() {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::desc data_md(p.dims, p.data_dt, p.data_tag);
+        memory::desc data_f32_md(p.dims, dt::f32, p.data_tag);
+        memory::desc stat_md({p.dims[0], p.groups}, dt::f32, tag::ab);
+        memory::desc ss_md({p.dims[1]}, dt::f32, tag::a);
+
+        primitive_attr attr;
+        if (p.with_relu) {
+            post_ops ops;
+            ops.append_eltwise(algorithm::eltwise_relu, relu_alpha, 0.f);
+            attr.set_post_ops(ops);
+        }
+
+        group_normalization_forward::primitive_desc pd;
+        try {
+            pd = group_normalization_forward::primitive_desc(eng, p.pk,
+                    data_md, data_md, p.groups, epsilon, p.flags, attr);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented && p.data_dt != dt::f32)
+                GTEST_SKIP() << "The data type is not supported.";
+            throw;
+        }
+        ASSERT_EQ(pd.src_desc(), data_md);
+        ASSERT_EQ(pd.dst_desc(), data_md);
+        ASSERT_EQ(pd.get_groups(), p.groups);
+        ASSERT_EQ(pd.get_epsilon(), epsilon);
+        ASSERT_EQ(pd.get_flags(), p.flags);
+
+        const bool global_stats = has(normalization_flags::use_global_stats);
+        const bool save_stats
+                = !global_stats && p.pk == prop_kind::forward_training;
+        if (global_stats || save_stats) {
+            ASSERT_EQ(pd.mean_desc(), stat_md);
+            ASSERT_EQ(pd.variance_desc(), stat_md);
+        } else {
+            ASSERT_EQ(pd.mean_desc(), memory::desc());
+        }
+
+        memory src(data_md, eng), dst(data_md, eng);
+        memory src_f32(data_f32_md, eng), dst_f32(data_f32_md, eng);
+        memory scale(ss_md, eng), shift(ss_md, eng);
+        memory mean(stat_md, eng), variance(stat_md, eng);
+        // A large shift checks the precision of the variance computation and
+        // of the normalization itself.
+        fill(src_f32, 100.f);
+        // The reference uses the values rounded to the data type.
+        reorder_to(src_f32, src);
+        reorder_to(src, src_f32);
+        fill(scale, 0.5f);
+        fill(shift, -1.f);
+        if (global_stats) {
+            fill(mean, 100.f);
+            fill(variance, 0.1f);
+        }
+
+        std::unordered_map<int, memory> args {
+                {DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+        if (has(normalization_flags::use_scale))
+            args.insert({DNNL_ARG_SCALE, scale});
+        if (has(normalization_flags::use_shift))
+            args.insert({DNNL_ARG_SHIFT, shift});
+        if (global_stats || save_stats) {
+            args.insert({DNNL_ARG_MEAN, mean});
+            args.insert({DNNL_ARG_VARIANCE, variance});
+        }
+        group_normalization_forward(pd).execute(strm, args);
+        strm.wait();
+        reorder_to(dst, dst_f32);
+
+        check(src_f32, scale, shift, mean, variance, dst_f32, global_stats,
+                save_stats);
+    }
+
+    void check(const memory &src, const memory &scale, const memory &shift,
+            const memory &mean, const memory &variance, const memory &dst,
+            bool global_stats, bool save_stats) const {
+        const memory::dim N = p.dims[0], C = p.dims[1];
+        memory::dim SP = 1;
+        for (size_t i = 2; i < p.dims.size(); i++)
+            SP *= p.dims[i];
+        const memory::dim Cg = C / p.groups;
+        const bool is_nspc = is_nspc_layout();
+        // The statistics are always computed in f32, the destination is
+        // rounded to the data type.
+        const double dst_eps = p.data_dt == dt::bf16 ? 1e-2
+                : p.data_dt == dt::f16                ? 2e-3
+                                                      : 1e-4;
+
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        auto sc_ptr = map_memory<float>(scale);
+        auto sh_ptr = map_memory<float>(shift);
+        auto mean_ptr = map_memory<float>(mean);
+        auto var_ptr = map_memory<float>(variance);
+
+        auto off = [&](memory::dim n, memory::dim c, memory::dim sp) {
+            return is_nspc ? (n * SP + sp) * C + c : (n * C + c) * SP + sp;
+        };
+
+        for_(memory::dim n = 0; n < N; n++)
+        for (memory::dim g = 0; g < p.groups; g++) {
+            double m = 0, v = 0;
+            if (global_stats) {
+                m = mean_ptr[n * p.groups + g];
+                v = var_ptr[n * p.groups + g];
+            } else {
+                for_(memory::dim c = g * Cg; c < (g + 1) * Cg; c++)
+                for (memory::dim sp = 0; sp < SP; sp++)
+                    m += src_ptr[off(n, c, sp)];
+                m /= Cg * SP;
+                for_(memory::dim c = g * Cg; c < (g + 1) * Cg; c++)
+                for (memory::dim sp = 0; sp < SP; sp++) {
+                    const double d = src_ptr[off(n, c, sp)] - m;
+                    v += d * d;
+                }
+                v /= Cg * SP;
+            }
+            if (save_stats) {
+                ASSERT_NEAR(m, mean_ptr[n * p.groups + g], 1e-4 * (1 + m));
+                ASSERT_NEAR(v, var_ptr[n * p.groups + g], 1e-4 * (1 + v));
+            }
+
+            for_(memory::dim c = g * Cg; c < (g + 1) * Cg; c++)
+            for (memory::dim sp = 0; sp < SP; sp++) {
+                double ref = (src_ptr[off(n, c, sp)] - m)
+                        / std::sqrt(v + epsilon);
+                if (has(normalization_flags::use_scale)) ref *= sc_ptr[c];
+                if (has(normalization_flags::use_shift)) ref += sh_ptr[c];
+                if (p.with_relu && ref < 0) ref *= relu_alpha;
+                const float got = dst_ptr[off(n, c, sp)];
+                ASSERT_NEAR(ref, got, dst_eps * (1 + std::fabs(ref)))
+                        << "n: " << n << ", c: " << c << ", sp: " << sp;
+            }
+        }
+    }
+
+    bool is_nspc_layout() const {
+        return p.dims.size() > 2
+                && (p.data_tag == tag::nwc || p.data_tag == tag::nhwc
+                        || p.data_tag == tag::ndhwc);
+    }
+};
+
+TEST_P(gnorm_test_t, TestsGnorm) {}
+
+static const auto training = prop_kind::forward_training;
+static const auto inference = prop_kind::forward_inference;
+static const auto no_flags = normalization_flags::none;
+static const auto scale_shift
+        = normalization_flags::use_scale | normalization_flags::use_shift;
+static const auto global_stats = normalization_flags::use_global_stats
+        | normalization_flags::use_scale;
+
+INSTANTIATE_TEST_SUITE_P(TestGnorm, gnorm_test_t,
+        ::testing::Values(
+                gnorm_test_params_t {{2, 32, 7, 9}, tag::nchw, dt::f32, 8,
+                        scale_shift, training, false, false, dnnl_success},
+                gnorm_test_params_t {{2, 32, 7, 9}, tag::nhwc, dt::f32, 8,
+                        scale_shift, training, false, false, dnnl_success},
+                gnorm_test_params_t {{3, 48, 17}, tag::ncw, dt::f32, 3,
+                        no_flags, inference, true, false, dnnl_success},
+                gnorm_test_params_t {{3, 40, 17}, tag::nwc, dt::f32, 5,
+                        scale_shift, inference, true, false, dnnl_success},
+                gnorm_test_params_t {{1, 6, 3, 4, 5}, tag::ncdhw, dt::f32, 2,
+                        global_stats, inference, false, false, dnnl_success},
+                gnorm_test_params_t {{2, 12, 2, 3, 5}, tag::ndhwc, dt::f32, 12,
+                        scale_shift, training, true, false, dnnl_success},
+                gnorm_test_params_t {{4, 20}, tag::nc, dt::f32, 4, scale_shift,
+                        training, false, false, dnnl_success},
+                gnorm_test_params_t {{2, 32, 7, 9}, tag::nchw, dt::bf16, 8,
+                        scale_shift, training, false, false, dnnl_success},
+                gnorm_test_params_t {{3, 40, 17}, tag::nwc, dt::bf16, 5,
+                        scale_shift, inference, true, false, dnnl_success},
+                gnorm_test_params_t {{2, 32, 7, 9}, tag::nhwc, dt::f16, 8,
+                        scale_shift, training, false, false, dnnl_success},
+                gnorm_test_params_t {{3, 48, 17}, tag::ncw, dt::f16, 3,
+                        no_flags, inference, true, false, dnnl_success}));
+
+INSTANTIATE_TEST_SUITE_P(TestGnormEF, gnorm_test_t,
+        ::testing::Values(
+                // The number of channels is not divisible by groups.
+                gnorm_test_params_t {{2, 10, 4}, tag::ncw, dt::f32, 4, no_flags,
+                        training, false, true, dnnl_invalid_arguments},
+                // Backward propagation is not supported.
+                gnorm_test_params_t {{2, 8, 4}, tag::ncw, dt::f32, 2, no_flags,
+                        prop_kind::backward, false, true,
+                        dnnl_invalid_arguments}));
+
+} // namespace dnnl
@@ -119,6 +119,299 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     }
 }
 
+TEST_F(attr_test_t, TestSharedWeights) {
+    dnnl::primitive_attr attr;
+    ASSERT_FALSE(attr.get_shared_weights());
+    for (bool v : {true, false}) {
+        attr.set_shared_weights(v);
+        ASSERT_EQ(v, attr.get_shared_weights());
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSharedWeightsMatMul) {
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim K = 64, N = 48;
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    dnnl::primitive_attr attr;
+    attr.set_shared_weights(true);
+
+    // Primitives with different sources share the weights, and a new weights
+    // buffer must not pick up the data packed for the previous one.
+    for (int iter = 0; iter < 2; iter++) {
+        auto wei = test::make_memory(wei_md, eng);
+        {
+            auto ptr = map_memory<float>(wei);
+            for (memory::dim i = 0; i < K * N; i++)
+                ptr[i] = static_cast<float>((i + iter) % 5) - 2.f;
+        }
+
+        for (memory::dim M : {3, 16}) {
+            memory::desc src_md(
+                    {M, K}, memory::data_type::f32, memory::format_tag::ab);
+            memory::desc dst_md(
+                    {M, N}, memory::data_type::f32, memory::format_tag::ab);
+            auto pd = matmul::primitive_desc(
+                    eng, src_md, wei_md, dst_md, attr);
+            ASSERT_EQ(pd.weights_desc(), wei_md);
+
+            auto src = test::make_memory(src_md, eng);
+            auto dst = test::make_memory(dst_md, eng);
+            {
+                auto ptr = map_memory<float>(src);
+                for (memory::dim i = 0; i < M * K; i++)
+                    ptr[i] = static_cast<float>(i % 3) - 1.f;
+            }
+
+            matmul p(pd);
+            for (int run = 0; run < 2; run++)
+                p.execute(s,
+                        {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                                {DNNL_ARG_DST, dst}});
+            s.wait();
+
+            auto src_ptr = map_memory<float>(src);
+            auto wei_ptr = map_memory<float>(wei);
+            auto dst_ptr = map_memory<float>(dst);
+            for_(memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += src_ptr[m * K + k] * wei_ptr[k * N + n];
+                ASSERT_EQ(ref, dst_ptr[m * N + n]) << "m: " << m << " n: " << n;
+            }
+        }
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSharedWeightsReusedBuffer) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test wraps a user buffer with a CPU memory object.");
+
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim M = 4, K = 64, N = 48;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    dnnl::primitive_attr attr;
+    attr.set_shared_weights(true);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    SKIP_IF(std::string(pd.impl_info_str()).find("brg") != 0,
+            "Only the brgemm implementation packs shared weights.");
+
+    auto src = test::make_memory(src_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    {
+        auto ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < M * K; i++)
+            ptr[i] = 1.f;
+    }
+
+    std::vector<float> buf(K * N, 1.f);
+    auto run = [&](const matmul &p, const memory &wei, float expected) {
+        p.execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        s.wait();
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_EQ(dst_ptr[i], expected) << "i: " << i;
+    };
+
+    {
+        matmul p(pd);
+        memory wei(wei_md, eng, buf.data());
+        run(p, wei, K * 1.f);
+
+        // Modifying the data behind a memory object that has been used
+        // already is not allowed, here it shows that the packed copy is
+        // reused instead of the user data.
+        std::fill(buf.begin(), buf.end(), 2.f);
+        run(p, wei, K * 1.f);
+    }
+
+    // The primitive above stays in the primitive cache, and a new memory
+    // object over the same buffer must not pick up its packed copy.
+    matmul p(pd);
+    memory wei(wei_md, eng, buf.data());
+    run(p, wei, K * 2.f);
+
+    // Neither does a memory object whose data handle has been changed back
+    // and forth.
+    std::vector<float> other(K * N, 3.f);
+    wei.set_data_handle(other.data());
+    run(p, wei, K * 3.f);
+    std::fill(buf.begin(), buf.end(), 4.f);
+    wei.set_data_handle(buf.data());
+    run(p, wei, K * 4.f);
+}
+
+TEST_F(attr_test_t, TestScheduling) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_scheduling(), dnnl::scheduling::balanced);
+    for (auto mode : {dnnl::scheduling::work_stealing,
+                 dnnl::scheduling::balanced}) {
+        attr.set_scheduling(mode);
+        ASSERT_EQ(mode, attr.get_scheduling());
+    }
+    ASSERT_EQ(dnnl_primitive_attr_set_scheduling(
+                      attr.get(), static_cast<dnnl_scheduling_t>(-1)),
+            dnnl_invalid_arguments);
+}
+
+// The work-stealing scheduling changes only the distribution of the work
+// between the threads, so the results match the balanced ones exactly.
+TEST_F(attr_test_t, TestSchedulingExecution) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Scheduling modes are supported on CPU only.");
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const auto fill = [](const memory &mem, int seed) {
+        auto ptr = map_memory<float>(mem);
+        const size_t n = mem.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < n; ++i)
+            ptr[i] = static_cast<float>((i * 13 + seed) % 17) / 8.f - 1.f;
+    };
+    const auto read = [](const memory &mem) {
+        auto ptr = map_memory<float>(mem);
+        const size_t n = mem.get_desc().get_size() / sizeof(float);
+        return std::vector<float>(ptr, ptr + n);
+    };
+
+    // Runs a matmul and a convolution, the primitives with dedicated
+    // work-stealing loops, and an eltwise which goes through parallel_nd().
+    const auto run = [&](scheduling mode) {
+        primitive_attr attr;
+        attr.set_scheduling(mode);
+        std::vector<float> res;
+
+        const memory::dim M = 96, K = 64, N = 80;
+        memory::desc src_md({M, K}, data_type::f32, tag::ab);
+        memory::desc wei_md({K, N}, data_type::f32, tag::ab);
+        memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+        matmul::primitive_desc mm_pd(eng, src_md, wei_md, dst_md, attr);
+        EXPECT_EQ(mm_pd.get_primitive_attr().get_scheduling(), mode);
+        memory src(src_md, eng), wei(wei_md, eng), dst(dst_md, eng);
+        fill(src, 1);
+        fill(wei, 2);
+        matmul(mm_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+
+        memory::desc c_src_md({2, 32, 14, 14}, data_type::f32, tag::nhwc);
+        memory::desc c_wei_md({64, 32, 3, 3}, data_type::f32, tag::any);
+        memory::desc c_dst_md({2, 64, 14, 14}, data_type::f32, tag::nhwc);
+        convolution_forward::primitive_desc conv_pd(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                c_src_md, c_wei_md, c_dst_md, {1, 1}, {1, 1}, {1, 1}, attr);
+        memory c_src(c_src_md, eng), c_wei(conv_pd.weights_desc(), eng),
+                c_dst(c_dst_md, eng);
+        fill(c_src, 3);
+        fill(c_wei, 4);
+        convolution_forward(conv_pd).execute(strm,
+                {{DNNL_ARG_SRC, c_src}, {DNNL_ARG_WEIGHTS, c_wei},
+                        {DNNL_ARG_DST, c_dst}});
+
+        eltwise_forward::primitive_desc elt_pd(eng,
+                prop_kind::forward_inference, algorithm::eltwise_tanh, dst_md,
+                dst_md, 0.f, 0.f, attr);
+        memory elt_dst(dst_md, eng);
+        eltwise_forward(elt_pd).execute(
+                strm, {{DNNL_ARG_SRC, dst}, {DNNL_ARG_DST, elt_dst}});
+        strm.wait();
+
+        for (const auto &mem : {dst, c_dst, elt_dst}) {
+            const auto v = read(mem);
+            res.insert(res.end(), v.begin(), v.end());
+        }
+        return res;
+    };
+
+    const auto balanced = run(scheduling::balanced);
+    const auto work_stealing = run(scheduling::work_stealing);
+    ASSERT_EQ(balanced.size(), work_stealing.size());
+    for (size_t i = 0; i < balanced.size(); ++i)
+        ASSERT_EQ(balanced[i], work_stealing[i]) << "index: " << i;
+}
+
+TEST_F(attr_test_t, TestSrcDynamicQuantization) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_src_dynamic_quantization(), memory::data_type::undef);
+    for (auto dt : {memory::data_type::s8, memory::data_type::undef}) {
+        attr.set_src_dynamic_quantization(dt);
+        ASSERT_EQ(dt, attr.get_src_dynamic_quantization());
+    }
+    ASSERT_EQ(dnnl_primitive_attr_set_src_dynamic_quantization(
+                      attr.get(), dnnl_u8),
+            dnnl_invalid_arguments);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestSrcDynamicQuantizationMatMul) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Dynamic quantization of the source is supported on CPU only");
+
+    engine eng = get_test_engine();
+    stream s(eng);
+
+    const memory::dim M = 19, K = 80, N = 40;
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::s8, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    dnnl::primitive_attr attr;
+    attr.set_src_dynamic_quantization(memory::data_type::s8);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    ASSERT_EQ(pd.get_primitive_attr().get_src_dynamic_quantization(),
+            memory::data_type::s8);
+
+    // Source scales and zero points are computed by the library.
+    attr.set_scales_mask(DNNL_ARG_SRC, 0);
+    EXPECT_ANY_THROW(
+            matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr));
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    {
+        // The absolute maximum of a row is 127 times a power of two, so the
+        // quantized values and the row scales are exact.
+        auto ptr = map_memory<float>(src);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim k = 0; k < K; k++) {
+            const int v = k == 0 ? 127 : (int)((k * 37 + m * 11) % 255) - 127;
+            ptr[m * K + k] = static_cast<float>(v) / (1 << (m % 3));
+        }
+        // The weights take the full s8 range, so pairs of products overflow
+        // int16.
+        auto wei_ptr = map_memory<int8_t>(wei);
+        for (memory::dim i = 0; i < K * N; i++)
+            wei_ptr[i] = static_cast<int8_t>((i * 29) % 256 - 128);
+    }
+
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto wei_ptr = map_memory<int8_t>(wei);
+    auto dst_ptr = map_memory<float>(dst);
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float ref = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            ref += src_ptr[m * K + k] * wei_ptr[k * N + n];
+        ASSERT_EQ(ref, dst_ptr[m * N + n]) << "m: " << m << " n: " << n;
+    }
+}
+
 TEST_F(attr_test_t, TestZeroPoints) {
     dnnl::primitive_attr attr;
 
@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+#include <omp.h>
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+namespace dnnl {
+
+namespace {
+eltwise_forward::primitive_desc make_relu_pd(const engine &eng, memory::dim n) {
+    auto md = memory::desc(
+            {n, 16, 1, 1}, memory::data_type::f32, memory::format_tag::nchw);
+    return eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f, 0.f);
+}
+} // namespace
+
+TEST(primitive_future_test, TestCreateAndExecute) {
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    auto pd = make_relu_pd(eng, 2);
+    primitive_future future(pd);
+    auto relu = future.get_primitive();
+    ASSERT_TRUE(future.is_ready());
+
+    auto src = test::make_memory(pd.src_desc(), eng);
+    auto dst = test::make_memory(pd.dst_desc(), eng);
+    fill_data(memory::data_type::f32, src, 1.f, 2.f);
+    relu.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+}
+
+TEST(primitive_future_test, TestGetTwice) {
+    engine eng = get_test_engine();
+    primitive_future future(make_relu_pd(eng, 3));
+    future.get_primitive();
+    EXPECT_ANY_THROW(future.get_primitive());
+}
+
+TEST(primitive_future_test, TestConcurrentIdenticalRequests) {
+    engine eng = get_test_engine();
+    auto pd = make_relu_pd(eng, 4);
+
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(capacity);
+#endif
+
+    std::vector<primitive_future> futures;
+    for (int i = 0; i < 8; i++)
+        futures.emplace_back(pd);
+    for (auto &f : futures) {
+        auto p = f.get_primitive();
+        ASSERT_TRUE(bool(p));
+    }
+
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    // All the requests share a single cache entry, and so does the
+    // synchronous creation from the calling thread. The latter also checks
+    // that the background threads create the primitive with the number of
+    // threads of the calling thread, which is a part of the cache key.
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+    auto p = eltwise_forward(pd);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+#endif
+}
+
+#if !defined(DNNL_DISABLE_PRIMITIVE_CACHE) \
+        && (DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+                || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL)
+namespace {
+int get_caller_max_threads() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    return omp_get_max_threads();
+#else
+    int nthr = 0;
+    dnnl_threadpool_interop_get_max_concurrency(&nthr);
+    return nthr;
+#endif
+}
+
+void set_caller_max_threads(int nthr) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr);
+#else
+    dnnl_threadpool_interop_set_max_concurrency(nthr);
+#endif
+}
+} // namespace
+
+TEST(primitive_future_test, TestCallerNumberOfThreads) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The number of threads is propagated for the CPU engine.");
+    engine eng = get_test_engine();
+    auto pd = make_relu_pd(eng, 5);
+
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(capacity);
+
+    // A number of threads different from the default one of the background
+    // threads.
+    const int nthr = get_caller_max_threads();
+    set_caller_max_threads(nthr + 1);
+    primitive_future(pd).get_primitive();
+    auto p = eltwise_forward(pd);
+    set_caller_max_threads(nthr);
+
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+}
+#endif
+
+TEST(primitive_future_test, TestDestroyWithoutGet) {
+    engine eng = get_test_engine();
+    for (memory::dim n = 1; n < 5; n++) {
+        primitive_future future(make_relu_pd(eng, n));
+    }
+}
+
+} // namespace dnnl
@@ -219,4 +219,280 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_pointers, 2));
 }
 
+TEST(iface_sparse_test_t, TestBsrMDCreationAndSize) {
+    const int nnz = 5;
+    const memory::dims dims = {64, 128};
+    const memory::dims block_dims = {4, 1};
+    memory::desc md;
+    ASSERT_NO_THROW(md = memory::desc::bsr(
+                            dims, dt::f32, block_dims, nnz, dt::s32, dt::s32));
+
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_nnz(), nnz);
+    ASSERT_EQ(md.get_num_handles(), 3);
+
+    // Values are stored as dense blocks.
+    ASSERT_EQ(md.get_size(0), nnz * 4 * sizeof(float));
+    ASSERT_EQ(md.get_size(1), nnz * sizeof(int32_t));
+    ASSERT_EQ(md.get_size(2), (64 / 4 + 1) * sizeof(int32_t));
+
+    // Different block dimensions make different descriptors.
+    memory::desc md2 = memory::desc::bsr(
+            dims, dt::f32, {1, 4}, nnz, dt::s32, dt::s32);
+    ASSERT_NE(md, md2);
+
+    // The dimensions must be multiples of the block dimensions.
+    EXPECT_ANY_THROW(memory::desc::bsr(
+            {62, 128}, dt::f32, block_dims, nnz, dt::s32, dt::s32));
+    // There can be no more non-zero blocks than blocks.
+    EXPECT_ANY_THROW(memory::desc::bsr(
+            {4, 4}, dt::f32, {2, 2}, 5, dt::s32, dt::s32));
+}
+
+// The parameters are the data types of the values and the destination, the
+// position of the sparse tensor and whether the dense tensor is created with
+// the `any` format tag.
+class bsr_matmul_test_t
+    : public ::testing::TestWithParam<std::tuple<dt, dt, bool, bool>> {};
+
+TEST_P(bsr_matmul_test_t, TestMatmul) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "BSR matmul is supported on CPU only.");
+
+    const dt values_dt = std::get<0>(GetParam());
+    const dt dst_dt = std::get<1>(GetParam());
+    const bool is_src_sparse = std::get<2>(GetParam());
+    const bool is_dense_any = std::get<3>(GetParam());
+    SKIP_IF(unsupported_data_type(values_dt), "Unsupported data type.");
+    const dt dense_dt = values_dt == dt::u8 ? dt::s8 : values_dt;
+
+    const memory::dim M = 16, K = 24, N = 40;
+    const memory::dim R = 4, C = 2;
+    // The sparse matrix is M x K for the source and K x N for the weights.
+    const memory::dim rows = is_src_sparse ? M : K;
+    const memory::dim cols = is_src_sparse ? K : N;
+
+    // Every row of blocks keeps the blocks with (row + col) % 3 == 0; the
+    // block value is a small integer so all the data types represent it
+    // exactly.
+    std::vector<int32_t> indices, pointers {0};
+    std::vector<float> values_f32;
+    std::vector<float> sparse_dense(rows * cols, 0.f);
+    for (memory::dim rb = 0; rb < rows / R; rb++) {
+        for (memory::dim cb = 0; cb < cols / C; cb++) {
+            if ((rb + cb) % 3 != 0) continue;
+            indices.push_back(static_cast<int32_t>(cb));
+            for_(memory::dim r = 0; r < R; r++)
+            for (memory::dim c = 0; c < C; c++) {
+                const float v = static_cast<float>((rb + r + 2 * c) % 4);
+                values_f32.push_back(v);
+                sparse_dense[(rb * R + r) * cols + cb * C + c] = v;
+            }
+        }
+        pointers.push_back(static_cast<int32_t>(indices.size()));
+    }
+    const memory::dim nnz = static_cast<memory::dim>(indices.size());
+
+    auto sparse_md = memory::desc::bsr(
+            {rows, cols}, values_dt, {R, C}, nnz, dt::s32, dt::s32);
+    memory::desc dense_md(is_src_sparse ? memory::dims {K, N}
+                                        : memory::dims {M, K},
+            dense_dt, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, dst_dt, memory::format_tag::ab);
+    memory::desc dense_any_md(dense_md.get_dims(), dense_dt,
+            is_dense_any ? memory::format_tag::any : memory::format_tag::ab);
+
+    const auto &src_md = is_src_sparse ? sparse_md : dense_any_md;
+    const auto &wei_md = is_src_sparse ? dense_any_md : sparse_md;
+
+    // The sparse memory descriptor shows the encoding and the block sizes
+    // in the verbose output.
+    bool verbose_enabled = true;
+    try {
+        set_verbose(2);
+    } catch (error &) { verbose_enabled = false; }
+    testing::internal::CaptureStdout();
+    matmul::primitive_desc pd;
+    EXPECT_NO_THROW(pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+    const std::string verbose_out = testing::internal::GetCapturedStdout();
+    if (verbose_enabled) set_verbose(0);
+    ASSERT_TRUE(pd);
+    if (verbose_enabled)
+        ASSERT_NE(verbose_out.find(":sparse:bsr4x2:"), std::string::npos)
+                << verbose_out;
+
+    // Values and dense data are converted from f32 with reorders.
+    const auto to_dt = [&](const std::vector<float> &v, dt adt) {
+        memory::desc md({(memory::dim)v.size()}, dt::f32, memory::format_tag::a);
+        memory f32_mem(md, eng, const_cast<float *>(v.data()));
+        memory mem({{(memory::dim)v.size()}, adt, memory::format_tag::a}, eng);
+        stream strm(eng);
+        reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+        strm.wait();
+        return mem;
+    };
+
+    std::vector<float> dense_f32(dense_md.get_size()
+            / memory::data_type_size(dense_dt));
+    for (size_t i = 0; i < dense_f32.size(); i++)
+        dense_f32[i] = static_cast<float>(i % 5) - 2.f;
+
+    memory values_mem = to_dt(values_f32, values_dt);
+    memory dense_tmp = to_dt(dense_f32, dense_dt);
+    memory sparse_mem(sparse_md, eng,
+            {values_mem.get_data_handle(), indices.data(), pointers.data()});
+    memory dense_plain_mem(dense_md, eng, dense_tmp.get_data_handle());
+    memory dense_mem(is_src_sparse ? pd.weights_desc() : pd.src_desc(), eng);
+    reorder(dense_plain_mem, dense_mem)
+            .execute(stream(eng), dense_plain_mem, dense_mem);
+    memory dst_mem(dst_md, eng);
+
+    stream strm(eng);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, is_src_sparse ? sparse_mem : dense_mem},
+                    {DNNL_ARG_WEIGHTS, is_src_sparse ? dense_mem : sparse_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    memory dst_f32({{M, N}, dt::f32, memory::format_tag::ab}, eng);
+    reorder(dst_mem, dst_f32).execute(strm, dst_mem, dst_f32);
+    strm.wait();
+
+    const float *src = is_src_sparse ? sparse_dense.data() : dense_f32.data();
+    const float *wei = is_src_sparse ? dense_f32.data() : sparse_dense.data();
+    auto dst = map_memory<float>(dst_f32);
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float ref = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            ref += src[m * K + k] * wei[k * N + n];
+        // All the values are small integers, so the result is exact.
+        ASSERT_EQ(ref, dst[m * N + n]) << "m: " << m << ", n: " << n;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestBsrMatmul, bsr_matmul_test_t,
+        ::testing::Values(std::make_tuple(dt::f32, dt::f32, true, false),
+                std::make_tuple(dt::f32, dt::f32, false, false),
+                std::make_tuple(dt::f32, dt::f32, true, true),
+                std::make_tuple(dt::bf16, dt::f32, true, false),
+                std::make_tuple(dt::bf16, dt::f32, true, true),
+                std::make_tuple(dt::bf16, dt::bf16, false, false),
+                std::make_tuple(dt::u8, dt::s32, true, false),
+                std::make_tuple(dt::s8, dt::f32, false, false)));
+
+TEST(iface_sparse_test_t, TestGroupedMDCreationAndSize) {
+    const memory::dims dims = {64, 128};
+    const int ngroups = 8;
+    memory::desc md;
+    ASSERT_NO_THROW(
+            md = memory::desc::grouped(dims, dt::f32, ngroups, dt::s32));
+
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::grouped);
+    ASSERT_EQ(md.get_nnz(), 64 * 128);
+    ASSERT_EQ(md.get_num_handles(), 2);
+
+    ASSERT_EQ(md.get_size(0), 64 * 128 * sizeof(float));
+    ASSERT_EQ(md.get_size(1), (ngroups + 1) * sizeof(int32_t));
+
+    // Different numbers of groups make different descriptors.
+    memory::desc md2 = memory::desc::grouped(dims, dt::f32, 4, dt::s32);
+    ASSERT_NE(md, md2);
+
+    EXPECT_ANY_THROW(memory::desc::grouped(dims, dt::f32, 0, dt::s32));
+    EXPECT_ANY_THROW(memory::desc::grouped({64}, dt::f32, ngroups, dt::s32));
+}
+
+class grouped_matmul_test_t
+    : public ::testing::TestWithParam<std::tuple<dt, dt, memory::format_tag>> {
+};
+
+TEST_P(grouped_matmul_test_t, TestMatmul) {
+    engine eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Grouped matmul is supported on CPU only.");
+
+    const dt src_dt = std::get<0>(GetParam());
+    const dt dst_dt = std::get<1>(GetParam());
+    const memory::format_tag wei_tag = std::get<2>(GetParam());
+    SKIP_IF(unsupported_data_type(src_dt), "Unsupported data type.");
+
+    // The groups cover full blocks, M tails and an empty group. The last rows
+    // belong to no group.
+    const std::vector<int32_t> offsets = {0, 3, 3, 43, 60, 61};
+    const memory::dim G = (memory::dim)offsets.size() - 1;
+    const memory::dim M = 64, K = 33, N = 70;
+
+    auto src_md = memory::desc::grouped({M, K}, src_dt, G, dt::s32);
+    memory::desc wei_md({G, K, N}, src_dt, wei_tag);
+    memory::desc dst_md({M, N}, dst_dt, memory::format_tag::ab);
+    matmul::primitive_desc pd;
+    ASSERT_NO_THROW(pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+    // The inputs are small integers so all the data types represent them
+    // and the result exactly.
+    std::vector<float> src_f32(M * K), wei_f32(G * K * N);
+    for (size_t i = 0; i < src_f32.size(); i++)
+        src_f32[i] = static_cast<float>(i % 5) - 2.f;
+    for (size_t i = 0; i < wei_f32.size(); i++)
+        wei_f32[i] = static_cast<float>(i % 3) - 1.f;
+
+    stream strm(eng);
+    memory src_f32_mem({{M * K}, dt::f32, memory::format_tag::a}, eng,
+            src_f32.data());
+    memory src_values({{M * K}, src_dt, memory::format_tag::a}, eng);
+    reorder(src_f32_mem, src_values).execute(strm, src_f32_mem, src_values);
+    memory wei_f32_mem({{G, K, N}, dt::f32, memory::format_tag::abc}, eng,
+            wei_f32.data());
+    memory wei_mem(pd.weights_desc(), eng);
+    reorder(wei_f32_mem, wei_mem).execute(strm, wei_f32_mem, wei_mem);
+    strm.wait();
+
+    memory src_mem(src_md, eng,
+            {src_values.get_data_handle(),
+                    const_cast<int32_t *>(offsets.data())});
+    memory dst_mem(dst_md, eng);
+
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    memory dst_f32({{M, N}, dt::f32, memory::format_tag::ab}, eng);
+    reorder(dst_mem, dst_f32).execute(strm, dst_mem, dst_f32);
+    strm.wait();
+
+    auto dst = map_memory<float>(dst_f32);
+    for (memory::dim g = 0; g < G; g++)
+        for_(memory::dim m = offsets[g]; m < offsets[g + 1]; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src_f32[m * K + k] * wei_f32[(g * K + k) * N + n];
+            ASSERT_EQ(ref, dst[m * N + n])
+                    << "g: " << g << ", m: " << m << ", n: " << n;
+        }
+
+    // Offsets that go beyond the source are rejected at execution time.
+    const std::vector<int32_t> bad_offsets = {0, 3, 3, 43, 60, 65};
+    memory bad_src_mem(src_md, eng,
+            {src_values.get_data_handle(),
+                    const_cast<int32_t *>(bad_offsets.data())});
+    EXPECT_ANY_THROW(matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, bad_src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}}));
+}
+
+INSTANTIATE_TEST_SUITE_P(TestGroupedMatmul, grouped_matmul_test_t,
+        ::testing::Values(
+                std::make_tuple(dt::f32, dt::f32, memory::format_tag::any),
+                std::make_tuple(dt::f32, dt::f32, memory::format_tag::abc),
+                std::make_tuple(dt::bf16, dt::f32, memory::format_tag::any),
+                std::make_tuple(dt::bf16, dt::bf16, memory::format_tag::abc)));
+
 } // namespace dnnl
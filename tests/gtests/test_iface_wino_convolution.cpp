@@ -15,6 +15,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -53,6 +56,10 @@ protected:
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
         input_f32.wino_supported = is_gpu;
         input_f16.wino_supported = is_gpu;
+#endif
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        if (get_test_engine_kind() == engine::kind::cpu)
+            input_f32.wino_supported = mayiuse(cpu_isa::avx512_core);
 #endif
     }
 };
@@ -101,9 +108,7 @@ TEST_F(wino_conv_test_t, TestLargePadding) {
         memory::desc wei_md {{32, 16, 3, 3}, input.wei_dt, tag::any};
         memory::desc dst_md {{1, 32, 9, 9}, input.dat_dt, tag::any};
 
-        bool large_pad_is_supported
-                = (get_test_engine_kind() == engine::kind::gpu);
-        if (input.wino_supported && large_pad_is_supported) {
+        if (input.wino_supported) {
             EXPECT_NO_THROW(convolution_forward::primitive_desc(eng,
                     prop_kind::forward, algorithm::convolution_winograd, src_md,
                     wei_md, dst_md, {1, 1}, {2, 2}, {2, 2}));
@@ -132,4 +137,49 @@ TEST_F(wino_conv_test_t, TestUnsupportedKernel) {
     }
 }
 
+TEST_F(wino_conv_test_t, TestResultsMatchDirect) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                    || !input_f32.wino_supported,
+            "Winograd convolution is not supported.");
+
+    // The channels and the spatial dimensions are not multiples of the
+    // vector length and of the tile sizes.
+    const memory::dim N = 2, IC = 24, OC = 40, H = 13, W = 11;
+    memory::desc src_md {{N, IC, H, W}, data_type::f32, tag::nhwc};
+    memory::desc wei_md {{OC, IC, 3, 3}, data_type::f32, tag::oihw};
+    memory::desc bia_md {{OC}, data_type::f32, tag::x};
+    memory::desc dst_md {{N, OC, H, W}, data_type::f32, tag::nhwc};
+
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+
+    memory src(src_md, eng), wei(wei_md, eng), bia(bia_md, eng);
+    fill_data<float>(src_md.get_size() / sizeof(float), src, 0.f, 1.f);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei, 0.f, 1.f);
+    fill_data<float>(bia_md.get_size() / sizeof(float), bia, 0.f, 1.f);
+
+    stream strm(eng);
+    std::vector<memory> dst;
+    for (auto alg :
+            {algorithm::convolution_winograd, algorithm::convolution_direct}) {
+        auto pd = convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, alg, src_md, wei_md, bia_md,
+                dst_md, {1, 1}, {1, 1}, {1, 1}, attr);
+        dst.emplace_back(dst_md, eng);
+        convolution_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst.back()}});
+    }
+    strm.wait();
+
+    auto wino_ptr = map_memory<float>(dst[0]);
+    auto direct_ptr = map_memory<float>(dst[1]);
+    for (memory::dim i = 0; i < N * OC * H * W; ++i)
+        ASSERT_NEAR(direct_ptr[i], wino_ptr[i],
+                1e-4f * (1.f + std::fabs(direct_ptr[i])))
+                << "index: " << i;
+}
+
 } // namespace dnnl
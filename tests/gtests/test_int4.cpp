@@ -0,0 +1,242 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class int4_test_t : public ::testing::TestWithParam<dt> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "4-bit data types are supported on CPU only.");
+    }
+
+    // Two elements are packed into a byte, the element with the even offset
+    // takes the low half.
+    static void set_nibble(uint8_t *ptr, memory::dim off, uint8_t v) {
+        const int shift = off % 2 ? 4 : 0;
+        uint8_t &byte = ptr[off / 2];
+        byte = static_cast<uint8_t>((byte & ~(0xf << shift)) | (v << shift));
+    }
+
+    static void reorder_to(memory src, memory dst) {
+        stream strm(src.get_engine());
+        reorder(src, dst).execute(strm, src, dst);
+        strm.wait();
+    }
+
+    // Returns the f32 values of the 16 encodings of a 4-bit data type.
+    static std::vector<float> decode_table(dt packed_dt) {
+        engine eng = get_test_engine();
+        memory packed({{16}, packed_dt, tag::a}, eng);
+        memory f32({{16}, dt::f32, tag::a}, eng);
+        {
+            auto ptr = map_memory<uint8_t>(packed);
+            for (uint8_t i = 0; i < 16; ++i)
+                set_nibble(ptr, i, i);
+        }
+        reorder_to(packed, f32);
+        auto ptr = map_memory<float>(f32);
+        return std::vector<float>(ptr, ptr + 16);
+    }
+
+    // Converts f32 values to a 4-bit data type and back.
+    static std::vector<float> round_trip(
+            dt packed_dt, const std::vector<float> &v) {
+        const memory::dims dims {static_cast<memory::dim>(v.size())};
+        engine eng = get_test_engine();
+        memory src({dims, dt::f32, tag::a}, eng);
+        memory packed({dims, packed_dt, tag::a}, eng);
+        memory dst({dims, dt::f32, tag::a}, eng);
+        {
+            auto ptr = map_memory<float>(src);
+            for (size_t i = 0; i < v.size(); ++i)
+                ptr[i] = v[i];
+        }
+        reorder_to(src, packed);
+        reorder_to(packed, dst);
+        auto ptr = map_memory<float>(dst);
+        return std::vector<float>(ptr, ptr + v.size());
+    }
+
+    // Runs a matmul with 4-bit weights, per-group scales along K and a
+    // common zero point, and compares the result with a naive computation.
+    // Does nothing if the configuration is not supported.
+    static void test_matmul(dt packed_dt, dt src_dt, memory::dim M,
+            memory::dim K, memory::dim N, memory::dim G) {
+        engine eng = get_test_engine();
+        stream strm(eng);
+
+        memory::desc src_md({M, K}, src_dt, tag::ab);
+        memory::desc wei_md({K, N}, packed_dt, tag::ab);
+        memory::desc dst_md({M, N}, dt::f32, tag::ab);
+        memory::desc scales_md({K / G, N}, dt::f32, tag::ab);
+        memory::desc zp_md({1}, dt::s32, tag::a);
+
+        primitive_attr attr;
+        attr.set_scales(DNNL_ARG_WEIGHTS, (1 << 0) | (1 << 1), {G, 1});
+        const bool with_zp = packed_dt != dt::nf4;
+        if (with_zp) attr.set_zero_points(DNNL_ARG_WEIGHTS, 0, {});
+
+        matmul::primitive_desc pd;
+        try {
+            pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented) return;
+            throw;
+        }
+
+        memory src_f32({{M, K}, dt::f32, tag::ab}, eng);
+        memory src(src_md, eng), wei(wei_md, eng), dst(dst_md, eng);
+        memory scales(scales_md, eng), zp(zp_md, eng);
+
+        const auto table = decode_table(packed_dt);
+        std::vector<uint8_t> wei_raw(K * N);
+        std::vector<float> scales_ref(K / G * N);
+        const int zp_val = with_zp ? 3 : 0;
+        {
+            // Small integers are exact in bf16.
+            auto ptr = map_memory<float>(src_f32);
+            for (memory::dim i = 0; i < M * K; ++i)
+                ptr[i] = static_cast<float>(i % 7) - 3.f;
+        }
+        reorder_to(src_f32, src);
+        {
+            auto ptr = map_memory<uint8_t>(wei);
+            for (memory::dim i = 0; i < K * N; ++i) {
+                wei_raw[i] = static_cast<uint8_t>((i * 5) % 16);
+                set_nibble(ptr, i, wei_raw[i]);
+            }
+        }
+        {
+            auto ptr = map_memory<float>(scales);
+            for (memory::dim i = 0; i < K / G * N; ++i)
+                ptr[i] = scales_ref[i] = 0.25f * static_cast<float>(1 + i % 5);
+        }
+        {
+            auto ptr = map_memory<int32_t>(zp);
+            ptr[0] = zp_val;
+        }
+
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, scales},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS, zp}});
+        strm.wait();
+
+        // The weights decompressed to bf16 keep 8 bits of mantissa.
+        const float eps = src_dt == dt::bf16 ? 1e-2f : 1e-5f;
+        auto src_ptr = map_memory<float>(src_f32);
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim m = 0; m < M; ++m)
+            for (memory::dim n = 0; n < N; ++n) {
+                float ref = 0.f, ref_abs = 0.f;
+                for (memory::dim k = 0; k < K; ++k) {
+                    const float w = (table[wei_raw[k * N + n]] - zp_val)
+                            * scales_ref[k / G * N + n];
+                    ref += src_ptr[m * K + k] * w;
+                    ref_abs += std::fabs(src_ptr[m * K + k] * w);
+                }
+                ASSERT_NEAR(ref, dst_ptr[m * N + n], eps * (1.f + ref_abs))
+                        << "src: " << (src_dt == dt::bf16 ? "bf16" : "f32")
+                        << ", M: " << M << ", K: " << K << ", N: " << N
+                        << ", m: " << m << ", n: " << n;
+            }
+    }
+};
+
+TEST_P(int4_test_t, TestConversions) {
+    const dt packed_dt = GetParam();
+    const auto table = decode_table(packed_dt);
+    // Every encoding is converted back to itself.
+    ASSERT_EQ(round_trip(packed_dt, table), table);
+
+    switch (packed_dt) {
+        case dt::s4:
+            for (uint8_t i = 0; i < 16; ++i)
+                ASSERT_EQ(table[i], i < 8 ? i : i - 16.f);
+            ASSERT_EQ(round_trip(packed_dt, {-100.f, 100.f}),
+                    std::vector<float>({-8.f, 7.f}));
+            break;
+        case dt::u4:
+            for (uint8_t i = 0; i < 16; ++i)
+                ASSERT_EQ(table[i], i);
+            ASSERT_EQ(round_trip(packed_dt, {-1.f, 2.5f}),
+                    std::vector<float>({0.f, 2.f}));
+            break;
+        default:
+            ASSERT_EQ(table.front(), -1.f);
+            ASSERT_EQ(table.back(), 1.f);
+            ASSERT_EQ(round_trip(packed_dt, {0.01f, -5.f}),
+                    std::vector<float>({0.f, -1.f}));
+            break;
+    }
+}
+
+TEST_P(int4_test_t, TestReorderRoundTrip) {
+    const dt packed_dt = GetParam();
+    const memory::dims dims {3, 7};
+    const memory::dim nelems = dims[0] * dims[1];
+    engine eng = get_test_engine();
+    const auto table = decode_table(packed_dt);
+
+    // The transposed layout places logically distant elements in one byte.
+    for (auto packed_tag : {tag::ab, tag::ba}) {
+        memory src({dims, dt::f32, tag::ab}, eng);
+        memory packed({dims, packed_dt, packed_tag}, eng);
+        memory dst({dims, dt::f32, tag::ab}, eng);
+
+        {
+            auto ptr = map_memory<float>(src);
+            for (memory::dim i = 0; i < nelems; ++i)
+                ptr[i] = table[i % 16];
+        }
+
+        reorder_to(src, packed);
+        reorder_to(packed, dst);
+
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < nelems; ++i)
+            ASSERT_EQ(src_ptr[i], dst_ptr[i]) << "index: " << i;
+    }
+}
+
+TEST_P(int4_test_t, TestMatmulGroupedScales) {
+    const dt packed_dt = GetParam();
+    // Blocked sizes, then N and K tails with a group that is not a multiple
+    // of the kernel blocking.
+    test_matmul(packed_dt, dt::f32, 5, 64, 48, 16);
+    test_matmul(packed_dt, dt::f32, 7, 96, 37, 32);
+    test_matmul(packed_dt, dt::bf16, 5, 64, 48, 16);
+    test_matmul(packed_dt, dt::bf16, 7, 96, 37, 32);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        TestInt4, int4_test_t, ::testing::Values(dt::s4, dt::u4, dt::nf4));
+
+} // namespace dnnl
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+// The brgemm matmul covers runtime M with M tail kernels generated up front.
+// The test limits the ISA to avx512_core to check the non-AMX path on any
+// machine that supports it, so it has to be built as a separate binary.
+class matmul_runtime_m_isa_test_t
+    : public ::testing::TestWithParam<memory::data_type> {
+protected:
+    void SetUp() override {
+        static const bool isa_set
+                = set_max_cpu_isa(cpu_isa::avx512_core) == status::success
+                && get_effective_cpu_isa() == cpu_isa::avx512_core;
+        SKIP_IF(!isa_set, "avx512_core cannot be set as the maximal ISA.");
+    }
+};
+
+TEST_P(matmul_runtime_m_isa_test_t, TestBrgemmRuntimeM) {
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    const dt src_dt = GetParam();
+    const dt wei_dt = src_dt == dt::f32 ? dt::f32 : dt::s8;
+    const memory::dim K = 67, N = 35;
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc src_md({DNNL_RUNTIME_DIM_VAL, K}, src_dt, tag::ab);
+    memory::desc wei_md({K, N}, wei_dt, tag::ab);
+    memory::desc dst_md({DNNL_RUNTIME_DIM_VAL, N}, dt::f32, tag::ab);
+
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md);
+    ASSERT_EQ(std::string(pd.impl_info_str()).find("brg"), 0U)
+            << pd.impl_info_str();
+    matmul prim(pd);
+
+    // Small integers keep the int8 accumulation within the range of the
+    // non-VNNI instructions, so all the results are exact.
+    memory wei({{K, N}, wei_dt, tag::ab}, eng);
+    std::vector<float> wei_f(K * N);
+    {
+        auto mapped = map_memory<uint8_t>(wei);
+        uint8_t *ptr = mapped;
+        for (memory::dim i = 0; i < K * N; ++i) {
+            wei_f[i] = static_cast<float>(i % 5) - 2.f;
+            if (wei_dt == dt::f32)
+                reinterpret_cast<float *>(ptr)[i] = wei_f[i];
+            else
+                reinterpret_cast<int8_t *>(ptr)[i]
+                        = static_cast<int8_t>(wei_f[i]);
+        }
+    }
+
+    // A single primitive serves every M, including the M tails.
+    for (memory::dim M : {1, 13, 64, 65, 200}) {
+        memory src({{M, K}, src_dt, tag::ab}, eng);
+        memory dst({{M, N}, dt::f32, tag::ab}, eng);
+        std::vector<float> src_f(M * K);
+        {
+            auto mapped = map_memory<uint8_t>(src);
+            uint8_t *ptr = mapped;
+            for (memory::dim i = 0; i < M * K; ++i) {
+                src_f[i] = static_cast<float>((i * 7) % 9);
+                if (src_dt == dt::f32)
+                    reinterpret_cast<float *>(ptr)[i] = src_f[i];
+                else
+                    ptr[i] = static_cast<uint8_t>(src_f[i]);
+            }
+        }
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim m = 0; m < M; ++m)
+            for (memory::dim n = 0; n < N; ++n) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; ++k)
+                    ref += src_f[m * K + k] * wei_f[k * N + n];
+                ASSERT_EQ(ref, dst_ptr[m * N + n])
+                        << "M: " << M << ", m: " << m << ", n: " << n;
+            }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestMatmulRuntimeM, matmul_runtime_m_isa_test_t,
+        ::testing::Values(memory::data_type::f32, memory::data_type::u8));
+
+} // namespace dnnl
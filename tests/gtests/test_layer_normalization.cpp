@@ -456,4 +456,61 @@ CPU_INST_TEST_CASE(LnormSimpleBF16F32, EXPAND_DTS(bf16, f32, bf16))
 CPU_INST_TEST_CASE(LnormSimpleF32S8, EXPAND_DTS(f32, s8, undef))
 CPU_INST_TEST_CASE(LnormSimpleBF16U8, EXPAND_DTS(bf16, u8, undef))
 
+TEST(lnorm_rms_test_t, TestRmsNorm) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "RMS normalization is supported on CPU only.");
+
+    const memory::dim N = 6, C = 37;
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    using tag = memory::format_tag;
+    memory::desc data_md({N, C}, memory::data_type::f32, tag::ab);
+    memory::desc stat_md({N}, memory::data_type::f32, tag::a);
+    memory::desc ss_md({C}, memory::data_type::f32, tag::a);
+
+    const auto flags = normalization_flags::rms_norm
+            | normalization_flags::use_scale;
+    layer_normalization_forward::primitive_desc pd(eng,
+            prop_kind::forward_training, data_md, data_md, stat_md, epsilon,
+            flags);
+    // The mean is neither computed nor returned.
+    ASSERT_EQ(pd.mean_desc(), memory::desc());
+    ASSERT_EQ(pd.variance_desc(), stat_md);
+
+    memory src(data_md, eng), dst(data_md, eng), scale(ss_md, eng);
+    memory variance(stat_md, eng);
+    {
+        auto ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < N * C; i++)
+            ptr[i] = static_cast<float>((i * 7) % 11) / 4.f - 0.5f;
+        auto sc_ptr = map_memory<float>(scale);
+        for (memory::dim c = 0; c < C; c++)
+            sc_ptr[c] = 0.5f + static_cast<float>(c % 3);
+    }
+
+    layer_normalization_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}, {DNNL_ARG_SCALE, scale},
+                    {DNNL_ARG_VARIANCE, variance}});
+    strm.wait();
+
+    auto src_ptr = map_memory<float>(src);
+    auto dst_ptr = map_memory<float>(dst);
+    auto sc_ptr = map_memory<float>(scale);
+    auto var_ptr = map_memory<float>(variance);
+    for (memory::dim n = 0; n < N; n++) {
+        float ms = 0.f;
+        for (memory::dim c = 0; c < C; c++)
+            ms += src_ptr[n * C + c] * src_ptr[n * C + c];
+        ms /= C;
+        ASSERT_NEAR(ms, var_ptr[n], 1e-5f * (1.f + ms)) << "n: " << n;
+        for (memory::dim c = 0; c < C; c++) {
+            const float ref
+                    = sc_ptr[c] * src_ptr[n * C + c] / std::sqrt(ms + epsilon);
+            ASSERT_NEAR(ref, dst_ptr[n * C + c], 1e-5f * (1.f + std::fabs(ref)))
+                    << "n: " << n << ", c: " << c;
+        }
+    }
+}
+
 } // namespace dnnl
@@ -668,4 +668,86 @@ INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
                         memory::dims {2, 10, 10, 10}, tag::abcd,
                         memory::data_type::f16, 4)));
 
+class runtime_K_test_t : public ::testing::TestWithParam<memory::format_tag> {
+};
+
+// The weights grow along K in a preallocated buffer, as a cache of values in
+// attention does, and a single primitive with runtime K handles all sizes.
+TEST_P(runtime_K_test_t, TestGrowingK) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Engine does not support the prefix of a buffer as memory.");
+
+    const memory::format_tag wei_tag = GetParam();
+    const memory::dim M = 3, N = 40, K_max = 600;
+    const memory::dims src_strides {K_max, 1};
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    memory::desc src_md({M, DNNL_RUNTIME_DIM_VAL}, memory::data_type::f32,
+            src_strides);
+    memory::desc wei_md(
+            {DNNL_RUNTIME_DIM_VAL, N}, memory::data_type::f32, wei_tag);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+    matmul prim(matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+
+    memory src_buf({{M, K_max}, memory::data_type::f32, src_strides}, eng);
+    memory wei_buf({{K_max, N}, memory::data_type::f32, wei_tag}, eng);
+    memory dst(dst_md, eng);
+
+    auto src_val = [](memory::dim m, memory::dim k) {
+        return static_cast<float>((m * 3 + k) % 5) - 2.f;
+    };
+    auto wei_val = [](memory::dim k, memory::dim n) {
+        return static_cast<float>((k * 7 + n) % 9) - 4.f;
+    };
+    // Offset of an element of the weights, appending a row writes to the
+    // last block of rows only.
+    auto wei_off = [&](memory::dim k, memory::dim n) {
+        if (wei_tag == memory::format_tag::ab) return k * N + n;
+        const memory::dim n_blks = (N + 31) / 32;
+        return (k / 16) * n_blks * 16 * 32 + (n / 32) * 16 * 32
+                + (k % 16) * 32 + n % 32;
+    };
+    {
+        auto ptr = map_memory<float>(src_buf);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim k = 0; k < K_max; k++)
+            ptr[m * K_max + k] = src_val(m, k);
+    }
+
+    memory::dim K_prev = 0;
+    for (memory::dim K : {1, 5, 16, 23, 64, 511, 512, 513, 600}) {
+        {
+            auto ptr = map_memory<float>(wei_buf);
+            for_(memory::dim k = K_prev; k < K; k++)
+            for (memory::dim n = 0; n < N; n++)
+                ptr[wei_off(k, n)] = wei_val(k, n);
+        }
+        K_prev = K;
+
+        memory src({{M, K}, memory::data_type::f32, src_strides}, eng,
+                src_buf.get_data_handle());
+        memory wei({{K, N}, memory::data_type::f32, wei_tag}, eng,
+                wei_buf.get_data_handle());
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src_val(m, k) * wei_val(k, n);
+            ASSERT_EQ(ref, dst_ptr[m * N + n])
+                    << "K: " << K << ", m: " << m << ", n: " << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(RuntimeK, runtime_K_test_t,
+        ::testing::Values(
+                memory::format_tag::ab, memory::format_tag::AB16a32b));
+
 } // namespace dnnl
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <numeric>
+#include <tuple>
 #include <utility>
 #include <type_traits>
 
@@ -839,4 +840,263 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestAUGRUlbr, lbr_augru_forward_test_f32,
                                 fmt::undef},
                         test_rnn_sizes_t {1, 1, 5, 1, 4, 4, 4, 4}}));
 
+// Checks that an RNN with variable sequence lengths produces the same results
+// as running every sequence of the minibatch separately with its own length.
+using var_seq_len_params_t = std::tuple<algorithm, dir, memory::data_type>;
+
+class rnn_var_seq_len_test_t
+    : public ::testing::TestWithParam<var_seq_len_params_t> {
+protected:
+    const memory::dim L = 2, T = 5, MB = 4, C = 8;
+
+    algorithm cell_kind() const { return std::get<0>(GetParam()); }
+    dir direction() const { return std::get<1>(GetParam()); }
+    memory::data_type data_dt() const { return std::get<2>(GetParam()); }
+
+    bool with_c_state() const { return cell_kind() == algorithm::vanilla_lstm; }
+    memory::dim n_dir() const {
+        return impl::utils::one_of(direction(), dir::bidirectional_concat,
+                       dir::bidirectional_sum)
+                ? 2
+                : 1;
+    }
+    memory::dim dlc() const {
+        return direction() == dir::bidirectional_concat ? 2 * C : C;
+    }
+    memory::dim n_gates() const {
+        switch (cell_kind()) {
+            case algorithm::vanilla_lstm: return 4;
+            case algorithm::vanilla_gru:
+            case algorithm::lbr_gru: return 3;
+            default: return 1;
+        }
+    }
+    memory::dim n_bias() const {
+        return n_gates() + (cell_kind() == algorithm::lbr_gru);
+    }
+
+    static void reorder_to(memory src, memory dst) {
+        stream strm(src.get_engine());
+        reorder(src, dst).execute(strm, src, dst);
+        strm.wait();
+    }
+
+    // Creates a memory of the data type `dt` filled with f32 `data`.
+    static memory make_memory(const engine &eng, const memory::dims &dims,
+            fmt tag, memory::data_type dt, const std::vector<float> &data) {
+        memory f32_m({dims, memory::data_type::f32, tag}, eng);
+        {
+            auto ptr = map_memory<float>(f32_m);
+            std::copy(data.begin(), data.end(), &ptr[0]);
+        }
+        if (dt == memory::data_type::f32) return f32_m;
+        memory m({dims, dt, tag}, eng);
+        reorder_to(f32_m, m);
+        return m;
+    }
+
+    static std::vector<float> read_memory(const memory &m) {
+        const auto &md = m.get_desc();
+        memory f32_m(
+                {md.get_dims(), memory::data_type::f32, md.get_strides()},
+                m.get_engine());
+        reorder_to(m, f32_m);
+        const auto nelems = f32_m.get_desc().get_size() / sizeof(float);
+        auto ptr = map_memory<float>(f32_m);
+        return std::vector<float>(&ptr[0], &ptr[0] + nelems);
+    }
+
+    static std::vector<float> fill(size_t n, int seed) {
+        std::vector<float> v(n);
+        for (size_t i = 0; i < n; i++)
+            v[i] = 0.1f * static_cast<float>((i * 7 + seed) % 13) - 0.6f;
+        return v;
+    }
+
+    // Runs the RNN for `t` time steps on `mb` sequences and returns
+    // dst_layer, dst_iter and dst_iter_c (empty without the c state).
+    std::vector<std::vector<float>> run(memory::dim t, memory::dim mb,
+            const std::vector<float> &src_layer,
+            const std::vector<float> &src_iter,
+            const std::vector<float> &src_iter_c,
+            const std::vector<int32_t> *seq_lengths) {
+        using data_type = memory::data_type;
+        const memory::dim D = n_dir(), G = n_gates();
+        const data_type dt = data_dt();
+
+        engine eng = get_test_engine();
+        stream strm(eng);
+
+        auto src_layer_m
+                = make_memory(eng, {t, mb, C}, fmt::tnc, dt, src_layer);
+        auto src_iter_m
+                = make_memory(eng, {L, D, mb, C}, fmt::ldnc, dt, src_iter);
+        auto wei_layer_m = make_memory(eng, {L, D, C, G, C}, fmt::ldigo, dt,
+                fill(L * D * C * G * C, 1));
+        auto wei_iter_m = make_memory(eng, {L, D, C, G, C}, fmt::ldigo, dt,
+                fill(L * D * C * G * C, 2));
+        auto bias_m = make_memory(eng, {L, D, n_bias(), C}, fmt::ldgo,
+                data_type::f32, fill(L * D * n_bias() * C, 3));
+        memory dst_layer_m({{t, mb, dlc()}, dt, fmt::tnc}, eng);
+        memory dst_iter_m({{L, D, mb, C}, dt, fmt::ldnc}, eng);
+        memory src_iter_c_m, dst_iter_c_m;
+        if (with_c_state()) {
+            src_iter_c_m = make_memory(eng, {L, D, mb, C}, fmt::ldnc,
+                    data_type::f32, src_iter_c);
+            dst_iter_c_m = memory(
+                    {{L, D, mb, C}, data_type::f32, fmt::ldnc}, eng);
+        }
+
+        const rnn_flags flags = seq_lengths
+                ? rnn_flags::variable_sequence_length
+                : rnn_flags::undef;
+        const auto prop = prop_kind::forward_inference;
+        const dir d = direction();
+        const auto &sl_md = src_layer_m.get_desc();
+        const auto &si_md = src_iter_m.get_desc();
+        const auto &wl_md = wei_layer_m.get_desc();
+        const auto &wi_md = wei_iter_m.get_desc();
+        const auto &b_md = bias_m.get_desc();
+        const auto &dl_md = dst_layer_m.get_desc();
+        const auto &di_md = dst_iter_m.get_desc();
+
+        primitive prim;
+        memory::desc seq_lengths_md;
+        try {
+            switch (cell_kind()) {
+                case algorithm::vanilla_lstm: {
+                    auto pd = lstm_forward::primitive_desc(eng, prop, d, sl_md,
+                            si_md, src_iter_c_m.get_desc(), wl_md, wi_md,
+                            memory::desc(), memory::desc(), b_md, dl_md,
+                            di_md, dst_iter_c_m.get_desc(), flags);
+                    seq_lengths_md = pd.seq_lengths_desc();
+                    prim = lstm_forward(pd);
+                    break;
+                }
+                case algorithm::vanilla_gru: {
+                    auto pd = gru_forward::primitive_desc(eng, prop, d, sl_md,
+                            si_md, wl_md, wi_md, b_md, dl_md, di_md, flags);
+                    seq_lengths_md = pd.seq_lengths_desc();
+                    prim = gru_forward(pd);
+                    break;
+                }
+                case algorithm::lbr_gru: {
+                    auto pd = lbr_gru_forward::primitive_desc(eng, prop, d,
+                            sl_md, si_md, wl_md, wi_md, b_md, dl_md, di_md,
+                            flags);
+                    seq_lengths_md = pd.seq_lengths_desc();
+                    prim = lbr_gru_forward(pd);
+                    break;
+                }
+                default: {
+                    auto pd = vanilla_rnn_forward::primitive_desc(eng, prop,
+                            algorithm::eltwise_tanh, d, sl_md, si_md, wl_md,
+                            wi_md, b_md, dl_md, di_md, 0.f, flags);
+                    seq_lengths_md = pd.seq_lengths_desc();
+                    prim = vanilla_rnn_forward(pd);
+                    break;
+                }
+            }
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented) return {};
+            throw;
+        }
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC_LAYER, src_layer_m},
+                {DNNL_ARG_SRC_ITER, src_iter_m},
+                {DNNL_ARG_WEIGHTS_LAYER, wei_layer_m},
+                {DNNL_ARG_WEIGHTS_ITER, wei_iter_m}, {DNNL_ARG_BIAS, bias_m},
+                {DNNL_ARG_DST_LAYER, dst_layer_m},
+                {DNNL_ARG_DST_ITER, dst_iter_m}};
+        if (with_c_state()) {
+            args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c_m});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c_m});
+        }
+        if (seq_lengths) {
+            EXPECT_EQ(seq_lengths_md,
+                    memory::desc({mb}, data_type::s32, fmt::a));
+            memory seq_lengths_m(seq_lengths_md, eng);
+            {
+                auto ptr = map_memory<int32_t>(seq_lengths_m);
+                std::copy(seq_lengths->begin(), seq_lengths->end(), &ptr[0]);
+            }
+            args.insert({DNNL_ARG_SEQ_LENGTHS, seq_lengths_m});
+        } else {
+            EXPECT_TRUE(seq_lengths_md.is_zero());
+        }
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        return {read_memory(dst_layer_m), read_memory(dst_iter_m),
+                with_c_state() ? read_memory(dst_iter_c_m)
+                               : std::vector<float>()};
+    }
+};
+
+TEST_P(rnn_var_seq_len_test_t, TestsVarSeqLen) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Variable sequence lengths are supported on CPU only.");
+
+    const memory::dim D = n_dir(), DLC = dlc();
+    const std::vector<int32_t> lengths = {3, 5, 1, 4};
+    // The per-sequence runs may block the computations differently.
+    const float eps
+            = data_dt() == memory::data_type::bf16 ? 2e-2f : 1e-5f;
+
+    const auto src_layer = fill(T * MB * C, 4);
+    const auto src_iter = fill(L * D * MB * C, 5);
+    const auto src_iter_c = fill(L * D * MB * C, 6);
+    const auto res = run(T, MB, src_layer, src_iter, src_iter_c, &lengths);
+    SKIP_IF(res.empty(), "The configuration is not supported.");
+
+    for (memory::dim b = 0; b < MB; b++) {
+        const memory::dim len = lengths[b];
+        std::vector<float> b_src_layer(len * C);
+        std::vector<float> b_src_iter(L * D * C), b_src_iter_c(L * D * C);
+        for (memory::dim t = 0; t < len; t++)
+            for (memory::dim c = 0; c < C; c++)
+                b_src_layer[t * C + c] = src_layer[(t * MB + b) * C + c];
+        for (memory::dim ld = 0; ld < L * D; ld++)
+            for (memory::dim c = 0; c < C; c++) {
+                b_src_iter[ld * C + c] = src_iter[(ld * MB + b) * C + c];
+                b_src_iter_c[ld * C + c] = src_iter_c[(ld * MB + b) * C + c];
+            }
+        const auto ref
+                = run(len, 1, b_src_layer, b_src_iter, b_src_iter_c, nullptr);
+        ASSERT_FALSE(ref.empty());
+
+        for (memory::dim t = 0; t < T; t++)
+            for (memory::dim c = 0; c < DLC; c++) {
+                const float got = res[0][(t * MB + b) * DLC + c];
+                const float exp = t < len ? ref[0][t * DLC + c] : 0.f;
+                ASSERT_NEAR(got, exp, eps)
+                        << "dst_layer, b: " << b << ", t: " << t;
+            }
+        for (memory::dim ld = 0; ld < L * D; ld++)
+            for (memory::dim c = 0; c < C; c++) {
+                ASSERT_NEAR(res[1][(ld * MB + b) * C + c], ref[1][ld * C + c],
+                        eps)
+                        << "dst_iter, b: " << b;
+                if (!with_c_state()) continue;
+                ASSERT_NEAR(res[2][(ld * MB + b) * C + c], ref[2][ld * C + c],
+                        eps)
+                        << "dst_iter_c, b: " << b;
+            }
+    }
+}
+
+// bf16 makes the brgemm-based implementation cover all the cell kinds.
+CPU_INSTANTIATE_TEST_SUITE_P(TestVarSeqLen, rnn_var_seq_len_test_t,
+        ::testing::Combine(
+                ::testing::Values(algorithm::vanilla_rnn,
+                        algorithm::vanilla_lstm, algorithm::vanilla_gru,
+                        algorithm::lbr_gru),
+                ::testing::Values(dir::unidirectional_left2right,
+                        dir::unidirectional_right2left,
+                        dir::bidirectional_concat, dir::bidirectional_sum),
+                ::testing::Values(
+                        memory::data_type::f32, memory::data_type::bf16)));
+
 } // namespace dnnl
@@ -0,0 +1,229 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+// The `per_query` mask is broadcast along the keys.
+enum class sdpa_mask_kind_t { none, full, broadcast, per_query };
+
+struct sdpa_test_params_t {
+    memory::dim MB, H, SQ, SKV;
+    // Head sizes of queries, keys and values.
+    memory::dim D, DK, DV;
+    // The layout of keys: abcd or the transposed abdc.
+    tag k_tag;
+    sdpa_mask_kind_t mask_kind;
+    dt mask_dt;
+    sdpa_flags flags;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class sdpa_test_t : public ::testing::TestWithParam<sdpa_test_params_t> {
+private:
+    sdpa_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<sdpa_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "SDPA is supported on CPU only.");
+        SKIP_IF(p.mask_kind != sdpa_mask_kind_t::none
+                        && unsupported_data_type(p.mask_dt),
+                "Engine does not support this data type.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static void fill(const memory &mem, int seed) {
+        auto ptr = map_memory<float>(mem);
+        const auto nelems = mem.get_desc().get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = static_cast<float>((i * 13 + seed) % 17) / 8.f - 1.f;
+    }
+
+    void Test() {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::desc q_md({p.MB, p.H, p.SQ, p.D}, dt::f32, tag::abcd);
+        memory::desc k_md({p.MB, p.H, p.SKV, p.DK}, dt::f32, p.k_tag);
+        memory::desc v_md({p.MB, p.H, p.SKV, p.DV}, dt::f32, tag::abcd);
+        memory::desc dst_md({p.MB, p.H, p.SQ, p.DV}, dt::f32, tag::abcd);
+        memory::desc mask_md;
+        if (p.mask_kind == sdpa_mask_kind_t::full)
+            mask_md = memory::desc(
+                    {p.MB, 1, p.SQ, p.SKV}, p.mask_dt, tag::abcd);
+        else if (p.mask_kind == sdpa_mask_kind_t::broadcast)
+            mask_md = memory::desc({1, 1, 1, p.SKV}, p.mask_dt, tag::abcd);
+        else if (p.mask_kind == sdpa_mask_kind_t::per_query)
+            mask_md = memory::desc({p.MB, 1, p.SQ, 1}, p.mask_dt, tag::abcd);
+
+        const float scale = 1.f / std::sqrt(static_cast<float>(p.D));
+        const bool with_mask = p.mask_kind != sdpa_mask_kind_t::none;
+
+        auto pd = with_mask ? sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                          mask_md, dst_md, scale, p.flags)
+                            : sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                                    dst_md, scale, p.flags);
+        ASSERT_EQ(pd.query_desc(), q_md);
+        ASSERT_EQ(pd.key_desc(), k_md);
+        ASSERT_EQ(pd.value_desc(), v_md);
+        ASSERT_EQ(pd.dst_desc(), dst_md);
+        ASSERT_EQ(pd.mask_desc(), mask_md);
+        ASSERT_EQ(pd.get_scale(), scale);
+        ASSERT_EQ(pd.get_flags(), p.flags);
+
+        memory q(q_md, eng), k(k_md, eng), v(v_md, eng), dst(dst_md, eng);
+        memory mask(mask_md, eng);
+        // The mask values are exact in all the data types.
+        memory mask_f32(with_mask ? memory::desc(mask_md.get_dims(), dt::f32,
+                                tag::abcd)
+                                  : memory::desc(),
+                eng);
+        fill(q, 1);
+        fill(k, 2);
+        fill(v, 3);
+        if (with_mask) {
+            {
+                auto ptr = map_memory<float>(mask_f32);
+                const auto nelems
+                        = mask_f32.get_desc().get_size() / sizeof(float);
+                // Mask out every fifth key completely.
+                for (size_t i = 0; i < nelems; i++)
+                    ptr[i] = i % 5 == 4 ? -INFINITY
+                                        : static_cast<float>(i % 3);
+            }
+            reorder(mask_f32, mask).execute(strm, mask_f32, mask);
+        }
+
+        std::unordered_map<int, memory> args {{DNNL_ARG_QUERIES, q},
+                {DNNL_ARG_KEYS, k}, {DNNL_ARG_VALUES, v}, {DNNL_ARG_DST, dst}};
+        if (with_mask) args.insert({DNNL_ARG_ATTN_MASK, mask});
+        sdpa(pd).execute(strm, args);
+        strm.wait();
+
+        check(q, k, v, mask_f32, dst, scale);
+    }
+
+    void check(const memory &q, const memory &k, const memory &v,
+            const memory &mask, const memory &dst, float scale) const {
+        auto q_ptr = map_memory<float>(q);
+        auto k_ptr = map_memory<float>(k);
+        auto v_ptr = map_memory<float>(v);
+        auto mask_ptr = map_memory<float>(mask);
+        auto dst_ptr = map_memory<float>(dst);
+
+        const bool k_trans = p.k_tag == tag::abdc;
+        const memory::dim causal_shift = p.SKV - p.SQ;
+        std::vector<float> scores(p.SKV);
+
+        for_(memory::dim mb = 0; mb < p.MB * p.H; mb++)
+        for (memory::dim i = 0; i < p.SQ; i++) {
+            float max_score = -INFINITY;
+            for (memory::dim j = 0; j < p.SKV; j++) {
+                float s = 0.f;
+                for (memory::dim d = 0; d < p.D; d++) {
+                    const auto k_off = k_trans ? (mb * p.D + d) * p.SKV + j
+                                               : (mb * p.SKV + j) * p.D + d;
+                    s += q_ptr[(mb * p.SQ + i) * p.D + d] * k_ptr[k_off];
+                }
+                s *= scale;
+                if (p.mask_kind == sdpa_mask_kind_t::full)
+                    s += mask_ptr[((mb / p.H) * p.SQ + i) * p.SKV + j];
+                else if (p.mask_kind == sdpa_mask_kind_t::broadcast)
+                    s += mask_ptr[j];
+                else if (p.mask_kind == sdpa_mask_kind_t::per_query)
+                    s += mask_ptr[(mb / p.H) * p.SQ + i];
+                if (p.flags == sdpa_flags::causal_mask && j > i + causal_shift)
+                    s = -INFINITY;
+                scores[j] = s;
+                max_score = std::max(max_score, s);
+            }
+
+            float sum = 0.f;
+            for (memory::dim j = 0; j < p.SKV; j++) {
+                scores[j] = max_score == -INFINITY
+                        ? 0.f
+                        : std::exp(scores[j] - max_score);
+                sum += scores[j];
+            }
+
+            for (memory::dim dv = 0; dv < p.DV; dv++) {
+                float ref = 0.f;
+                for (memory::dim j = 0; j < p.SKV; j++)
+                    ref += scores[j] * v_ptr[(mb * p.SKV + j) * p.DV + dv];
+                ref = sum > 0.f ? ref / sum : 0.f;
+                const float got = dst_ptr[(mb * p.SQ + i) * p.DV + dv];
+                ASSERT_NEAR(ref, got, 1e-4f * (1.f + std::fabs(ref)))
+                        << "mb: " << mb << ", i: " << i << ", dv: " << dv;
+            }
+        }
+    }
+};
+
+TEST_P(sdpa_test_t, TestsSdpa) {}
+
+using mask = sdpa_mask_kind_t;
+static const auto none = sdpa_flags::none;
+static const auto causal = sdpa_flags::causal_mask;
+
+INSTANTIATE_TEST_SUITE_P(TestSdpa, sdpa_test_t,
+        ::testing::Values(
+                sdpa_test_params_t {2, 2, 7, 7, 16, 16, 16, tag::abcd,
+                        mask::none, dt::f32, none, false, dnnl_success},
+                sdpa_test_params_t {1, 3, 64, 64, 32, 32, 32, tag::abcd,
+                        mask::none, dt::f32, causal, false, dnnl_success},
+                sdpa_test_params_t {2, 2, 19, 300, 24, 24, 40, tag::abcd,
+                        mask::full, dt::f32, none, false, dnnl_success},
+                sdpa_test_params_t {1, 2, 5, 33, 8, 8, 8, tag::abdc,
+                        mask::broadcast, dt::f32, causal, false, dnnl_success},
+                sdpa_test_params_t {1, 1, 70, 260, 64, 64, 64, tag::abdc,
+                        mask::none, dt::f32, none, false, dnnl_success},
+                sdpa_test_params_t {2, 2, 19, 300, 24, 24, 40, tag::abcd,
+                        mask::full, dt::bf16, causal, false, dnnl_success},
+                sdpa_test_params_t {1, 2, 23, 45, 16, 16, 16, tag::abdc,
+                        mask::full, dt::f16, none, false, dnnl_success},
+                sdpa_test_params_t {2, 1, 17, 29, 8, 8, 8, tag::abcd,
+                        mask::per_query, dt::f32, none, false, dnnl_success},
+                sdpa_test_params_t {1, 2, 9, 40, 8, 8, 8, tag::abcd,
+                        mask::per_query, dt::bf16, causal, false,
+                        dnnl_success},
+                // More queries than keys: the first queries see no keys.
+                sdpa_test_params_t {1, 1, 9, 4, 8, 8, 8, tag::abcd,
+                        mask::none, dt::f32, causal, false, dnnl_success}));
+
+INSTANTIATE_TEST_SUITE_P(TestSdpaEF, sdpa_test_t,
+        ::testing::Values(
+                // Head sizes of queries and keys do not match.
+                sdpa_test_params_t {1, 1, 4, 4, 8, 16, 8, tag::abcd,
+                        mask::none, dt::f32, none, true,
+                        dnnl_invalid_arguments}));
+
+} // namespace dnnl
@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl_ukernel.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using namespace ukernel;
+
+namespace {
+// The values used by the tests are small integers, so truncation is exact.
+uint16_t f32_to_bf16(float f) {
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return static_cast<uint16_t>(bits >> 16);
+}
+} // namespace
+
+// The batch size and K. A single batch element and K tails smaller than the
+// packing factor of B take separate paths in the kernels.
+struct ukernel_params_t {
+    memory::dim BS, K;
+};
+
+class ukernel_test_t : public ::testing::TestWithParam<ukernel_params_t> {
+protected:
+    static constexpr memory::dim M = 5, N = 24;
+    memory::dim BS = 0, K = 0;
+
+    void SetUp() override {
+        BS = GetParam().BS;
+        K = GetParam().K;
+        A_.resize(BS * M * K);
+        B_.resize(BS * K * N);
+        for (size_t i = 0; i < A_.size(); i++)
+            A_[i] = static_cast<float>(i % 7) - 3.f;
+        for (size_t i = 0; i < B_.size(); i++)
+            B_[i] = static_cast<float>(i % 5) - 2.f;
+    }
+
+    float ref(memory::dim m, memory::dim n) const {
+        float acc = 0.f;
+        for_(memory::dim b = 0; b < BS; b++)
+        for (memory::dim k = 0; k < K; k++)
+            acc += A_[(b * M + m) * K + k] * B_[(b * K + k) * N + n];
+        return acc;
+    }
+
+    std::vector<float> A_, B_;
+};
+
+TEST_P(ukernel_test_t, TestF32) {
+    ASSERT_EQ(brgemm::get_B_pack_type(dt::f32, dt::f32), pack_type::no_trans);
+
+    brgemm brg(M, N, K, BS, K, N, N, dt::f32, dt::f32, dt::f32, true);
+    if (!brg) GTEST_SKIP() << "f32 brgemm ukernel is not supported.";
+    brg.set_add_C(true);
+    brg.finalize();
+    brg.generate();
+
+    std::vector<std::pair<memory::dim, memory::dim>> offsets;
+    for (memory::dim b = 0; b < BS; b++)
+        offsets.emplace_back(b * M * K * sizeof(float),
+                b * K * N * sizeof(float));
+
+    std::vector<char> scratchpad(brg.get_scratchpad_size());
+    std::vector<float> C(M * N, 1.f);
+
+    brg.set_hw_context();
+    brg.execute(A_.data(), B_.data(), offsets, C.data(), scratchpad.data());
+    brgemm::release_hw_context();
+
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++)
+        ASSERT_EQ(C[m * N + n], 1.f + ref(m, n)) << "m: " << m << ", n: " << n;
+}
+
+TEST_P(ukernel_test_t, TestBf16PackedWithPostOps) {
+    const auto B_pack_type = brgemm::get_B_pack_type(dt::bf16, dt::bf16);
+    ASSERT_EQ(B_pack_type, pack_type::pack32);
+
+    constexpr memory::dim ldb = 32, ldd = N + 3;
+    post_ops po;
+    po.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+
+    brgemm brg(M, N, K, BS, K, ldb, N, dt::bf16, dt::bf16, dt::f32, true);
+    if (!brg) GTEST_SKIP() << "bf16 brgemm ukernel is not supported.";
+    brg.set_post_ops(ldd, dt::f32, po);
+    try {
+        brg.finalize();
+        brg.generate();
+    } catch (error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "bf16 brgemm ukernel is not supported.";
+        throw;
+    }
+
+    brgemm_pack_B pack_B(K, N, N, ldb, dt::bf16, dt::bf16, true);
+    if (!pack_B) GTEST_SKIP() << "B matrix packing is not supported.";
+    pack_B.generate();
+
+    std::vector<uint16_t> A(A_.size()), B(B_.size());
+    for (size_t i = 0; i < A.size(); i++)
+        A[i] = f32_to_bf16(A_[i]);
+    for (size_t i = 0; i < B.size(); i++)
+        B[i] = f32_to_bf16(B_[i]);
+
+    // Packed blocks have K rounded up to the packing factor of 2.
+    const memory::dim packed_B_size = (K + K % 2) * ldb;
+    std::vector<uint16_t> packed_B(BS * packed_B_size);
+    std::vector<std::pair<memory::dim, memory::dim>> offsets;
+    for (memory::dim b = 0; b < BS; b++) {
+        pack_B.execute(&B[b * K * N], &packed_B[b * packed_B_size]);
+        offsets.emplace_back(b * M * K * sizeof(uint16_t),
+                b * packed_B_size * sizeof(uint16_t));
+    }
+
+    std::vector<char> scratchpad(brg.get_scratchpad_size());
+    std::vector<float> C(M * N), D(M * ldd, -1.f);
+
+    brg.set_hw_context();
+    brg.execute(A.data(), packed_B.data(), offsets, C.data(), D.data(),
+            scratchpad.data());
+    brgemm::release_hw_context();
+
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        const float r = ref(m, n);
+        ASSERT_EQ(D[m * ldd + n], r > 0.f ? r : 0.f)
+                << "m: " << m << ", n: " << n;
+    }
+    // Padding between the rows of D is not touched.
+    for (memory::dim m = 0; m < M; m++)
+        ASSERT_EQ(D[m * ldd + N], -1.f);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestUkernel, ukernel_test_t,
+        ::testing::Values(ukernel_params_t {3, 20}, ukernel_params_t {1, 20},
+                ukernel_params_t {1, 19}, ukernel_params_t {2, 19}));
+
+TEST(ukernel_iface_test_t, TestInvalidArguments) {
+    EXPECT_EQ(dnnl_brgemm_create(nullptr, 1, 1, 1, 1, 1, 1, 1, dnnl_f32,
+                      dnnl_f32, dnnl_f32),
+            dnnl_invalid_arguments);
+
+    dnnl_brgemm_t brg = nullptr;
+    // Leading dimension of A is less than K.
+    EXPECT_EQ(dnnl_brgemm_create(&brg, 4, 16, 8, 1, 4, 16, 16, dnnl_f32,
+                      dnnl_f32, dnnl_f32),
+            dnnl_invalid_arguments);
+
+    dnnl_brgemm_pack_B_t pack_B = nullptr;
+    // Unsupported output leading dimension.
+    const dnnl_status_t st = dnnl_brgemm_pack_B_create(
+            &pack_B, 8, 16, 16, 17, dnnl_bf16, dnnl_bf16);
+    EXPECT_TRUE(st == dnnl_invalid_arguments || st == dnnl_unimplemented);
+}
+
+} // namespace dnnl